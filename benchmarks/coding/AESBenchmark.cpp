@@ -0,0 +1,111 @@
+#include "coding/crypto/symmetric/aes/AES.h"
+#include "coding/crypto/symmetric/aes/AESCipher.h"
+#include "coding/crypto/symmetric/aes/AESCrypto.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace link16::coding::crypto;
+
+namespace {
+
+// 计时并返回吞吐量(MB/s)
+template <typename Func>
+double measureMegabytesPerSecond(size_t bytesPerCall, int calls, Func&& func) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < calls; ++i) {
+        func();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return bytesPerCall * static_cast<double>(calls) / 1e6 /
+           std::chrono::duration<double>(end - start).count();
+}
+
+// 对比原实现与各内核在一批STDP消息上的吞吐量
+void benchmarkBatch(size_t messageLength, size_t count) {
+    std::mt19937 rng(1);
+    std::vector<uint8_t> key(16);
+    for (auto& b : key) {
+        b = static_cast<uint8_t>(rng());
+    }
+    const std::string keyString(key.begin(), key.end());
+
+    // ECB按分组对齐，CTR/GCM直接使用原始长度
+    const size_t paddedLength = (messageLength + 15) / 16 * 16;
+    std::vector<uint8_t> messages(count * paddedLength);
+    for (auto& b : messages) {
+        b = static_cast<uint8_t>(rng());
+    }
+    std::vector<uint8_t> output(messages.size());
+    const size_t batchBytes = count * messageLength;
+    const int calls = static_cast<int>(std::max<size_t>(1, (64 << 20) / batchBytes));
+
+    std::cout << count << "条" << messageLength << "字节消息" << std::endl;
+    std::cout << std::fixed << std::setprecision(0);
+
+    // 原实现：每条消息复制向量并重新展开轮密钥
+    AES legacy(AESKeyLength::AES_128);
+    volatile uint8_t sink = 0;
+    const double baseline = measureMegabytesPerSecond(batchBytes, std::max(1, calls / 16), [&]() {
+        for (size_t m = 0; m < count; ++m) {
+            std::vector<unsigned char> in(messages.begin() + m * paddedLength,
+                                          messages.begin() + (m + 1) * paddedLength);
+            sink = sink ^ legacy.EncryptECB(in, key)[0];
+        }
+    });
+    std::cout << "  " << std::setw(18) << "legacy ECB" << ": " << std::setw(7) << baseline << " MB/s" << std::endl;
+
+    const AESKernelType original = getAESKernel();
+    for (AESKernelType kernel : {AESKernelType::PORTABLE, AESKernelType::AESNI}) {
+        if (!isAESKernelSupported(kernel)) {
+            continue;
+        }
+        setAESKernel(kernel);
+        AESCipher cipher;
+        cipher.setKey(key.data(), key.size());
+
+        const double ecb = measureMegabytesPerSecond(batchBytes, calls, [&]() {
+            cipher.encryptBlocks(messages.data(), output.data(), messages.size() / 16);
+        });
+        const double ctr = measureMegabytesPerSecond(batchBytes, calls, [&]() {
+            cipher.cryptCTRBatch(1, messages.data(), count, messageLength, output.data());
+        });
+        uint8_t iv[AESCipher::gcm_iv_size] = {0};
+        uint8_t tag[AESCipher::gcm_tag_size];
+        const double gcm = measureMegabytesPerSecond(batchBytes, calls, [&]() {
+            for (size_t m = 0; m < count; ++m) {
+                cipher.encryptGCM(iv, nullptr, 0, messages.data() + m * messageLength,
+                                  output.data() + m * messageLength, messageLength, tag);
+            }
+        });
+
+        std::cout << "  " << std::setw(18) << getAESKernelName(kernel)
+                  << ": ECB " << std::setw(7) << ecb << " MB/s (x" << std::setprecision(1) << ecb / baseline
+                  << std::setprecision(0) << "), CTR批量 " << std::setw(7) << ctr << " MB/s, GCM "
+                  << std::setw(7) << gcm << " MB/s" << std::endl;
+    }
+    setAESKernel(original);
+
+    // AESCrypto字符串接口(ECB + PKCS7 + 十六进制，缓存轮密钥)
+    AESCrypto crypto(128);
+    const std::string message(reinterpret_cast<const char*>(messages.data()), messageLength);
+    const double hex = measureMegabytesPerSecond(messageLength, calls * static_cast<int>(count) / 4, [&]() {
+        sink = sink ^ static_cast<uint8_t>(crypto.encrypt(message, keyString)[0]);
+    });
+    std::cout << "  " << std::setw(18) << "AESCrypto::encrypt" << ": " << std::setw(7) << hex << " MB/s"
+              << std::endl;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "默认内核: " << getAESKernelName(getAESKernel()) << std::endl;
+    benchmarkBatch(33, 256);
+    benchmarkBatch(1024, 64);
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include "coding/error_detection/crc/CRCCalculator.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace link16::coding::error_detection;
+
+namespace {
+
+// 计时并返回吞吐量(MB/s)
+template <typename Func>
+double measureMegabytesPerSecond(size_t bytesPerCall, int calls, Func&& func) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < calls; ++i) {
+        func();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return bytesPerCall * static_cast<double>(calls) / 1e6 /
+           std::chrono::duration<double>(end - start).count();
+}
+
+// 对比各内核在指定块大小下的吞吐量
+void benchmarkSize(const std::vector<uint8_t>& data, size_t length) {
+    const size_t totalBytes = 64 << 20;
+    const int calls = static_cast<int>(totalBytes / length);
+    const CRCKernelType kernels[] = {
+        CRCKernelType::BITWISE, CRCKernelType::SLICING_BY_8, CRCKernelType::PCLMUL
+    };
+
+    std::cout << length << "字节" << std::endl;
+    std::cout << std::fixed << std::setprecision(0);
+
+    volatile uint32_t sink = 0;
+    double baseline = 0;
+    for (CRCKernelType kernel : kernels) {
+        if (!isCRCKernelSupported(kernel)) {
+            continue;
+        }
+        // 逐比特实现较慢，减少调用次数
+        const int n = kernel == CRCKernelType::BITWISE ? std::max(1, calls / 16) : calls;
+        const double crc32 = measureMegabytesPerSecond(length, n, [&]() {
+            sink = sink ^ calculateCRC32(data.data(), length, kernel);
+        });
+        const double crc16 = measureMegabytesPerSecond(length, n, [&]() {
+            sink = sink ^ calculateCRC16(data.data(), length, kernel);
+        });
+        if (kernel == CRCKernelType::BITWISE) {
+            baseline = crc32;
+        }
+        std::cout << "  " << std::setw(12) << getCRCKernelName(kernel)
+                  << ": CRC-32 " << std::setw(6) << crc32 << " MB/s (x" << std::setprecision(1)
+                  << crc32 / baseline << std::setprecision(0) << "), CRC-16 "
+                  << std::setw(6) << crc16 << " MB/s" << std::endl;
+    }
+}
+
+} // namespace
+
+int main() {
+    std::mt19937 rng(1);
+    std::vector<uint8_t> data(1 << 20);
+    for (auto& b : data) {
+        b = static_cast<uint8_t>(rng());
+    }
+
+    std::cout << "默认内核: " << getCRCKernelName(getCRCKernel()) << std::endl;
+    for (size_t length : {64, 1024, 65536, 1 << 20}) {
+        benchmarkSize(data, length);
+    }
+    return 0;
+}
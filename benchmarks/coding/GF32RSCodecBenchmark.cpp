@@ -0,0 +1,90 @@
+#include "coding/error_correction/reed_solomon/GF32RSCodec.h"
+#include "coding/error_correction/reed_solomon/RSCodecCache.h"
+#include "core/utils/logger.h"
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace link16::coding::error_correction;
+
+namespace {
+
+// 计时并返回每秒处理的码字数
+template <typename Func>
+double measureWordsPerSecond(int words, Func&& func) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < words; ++i) {
+        func(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return words / std::chrono::duration<double>(end - start).count();
+}
+
+// 对比GF(2^8)缓存上下文与GF(2^5)原生编解码器
+template <RS_Length CodeLength, RS_Length DataLength>
+void benchmarkShape(int words, int errors) {
+    typedef GF32RSCodec<CodeLength, DataLength> Codec;
+    auto context = RSCodecCache::getInstance().get(CodeLength, DataLength);
+
+    std::mt19937 rng(7);
+    const int count = 256;
+    std::vector<uint8_t> data(count * DataLength);
+    for (auto& s : data) {
+        s = static_cast<uint8_t>(rng() % 32);
+    }
+    std::vector<uint8_t> codewords8(count * CodeLength);
+    std::vector<uint8_t> codewords5(count * CodeLength);
+    std::vector<uint8_t> received(CodeLength);
+
+    const double encode8 = measureWordsPerSecond(words, [&](int i) {
+        const int n = i % count;
+        context->encode(&data[n * DataLength], &codewords8[n * CodeLength]);
+    });
+    const double encode5 = measureWordsPerSecond(words, [&](int i) {
+        const int n = i % count;
+        Codec::encode(&data[n * DataLength], &codewords5[n * CodeLength]);
+    });
+
+    // 每个码字引入errors个错误后解码
+    auto corrupt = [&](const std::vector<uint8_t>& codewords, int i) {
+        const int n = i % count;
+        for (int t = 0; t < static_cast<int>(CodeLength); ++t) {
+            received[t] = codewords[n * CodeLength + t];
+        }
+        for (int e = 0; e < errors; ++e) {
+            received[(n + e * 3) % CodeLength] ^= static_cast<uint8_t>(1 + (n + e) % 31);
+        }
+    };
+    const double decode8 = measureWordsPerSecond(words, [&](int i) {
+        corrupt(codewords8, i);
+        context->decode(received.data());
+    });
+    const double decode5 = measureWordsPerSecond(words, [&](int i) {
+        corrupt(codewords5, i);
+        Codec::decode(received.data());
+    });
+
+    std::cout << "RS(" << CodeLength << "," << DataLength << ") " << errors << "个错误" << std::endl;
+    std::cout << std::fixed << std::setprecision(0);
+    std::cout << "  编码: GF(2^8) " << encode8 << " words/s, GF(2^5) " << encode5
+              << " words/s (x" << std::setprecision(1) << encode5 / encode8 << ")" << std::endl;
+    std::cout << std::setprecision(0);
+    std::cout << "  解码: GF(2^8) " << decode8 << " words/s, GF(2^5) " << decode5
+              << " words/s (x" << std::setprecision(1) << decode5 / decode8 << ")" << std::endl;
+}
+
+} // namespace
+
+int main() {
+    link16::utils::Logger::getInstance().setLogLevel(link16::utils::LogLevel::WARNING);
+    RSCodecCache::getInstance().preload();
+
+    benchmarkShape<code_31_15, data_31_15>(500000, 0);
+    benchmarkShape<code_31_15, data_31_15>(500000, 4);
+    benchmarkShape<code_16_7, data_16_7>(500000, 2);
+
+    return 0;
+}
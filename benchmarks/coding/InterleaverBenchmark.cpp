@@ -0,0 +1,66 @@
+#include "coding/interleaving/matrix/MatrixInterleaver.h"
+#include "core/utils/logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace link16::coding::interleaving;
+
+namespace {
+
+// 计时并返回吞吐量(MB/s)
+template <typename Func>
+double measureMegabytesPerSecond(size_t bytesPerCall, int calls, Func&& func) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < calls; ++i) {
+        func();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return bytesPerCall * static_cast<double>(calls) / 1e6 /
+           std::chrono::duration<double>(end - start).count();
+}
+
+// 对比返回新向量的接口与输出到调用方缓冲区的接口
+void benchmarkShape(int rows, int cols, size_t frameLength, size_t frameCount) {
+    MatrixInterleaver interleaver(rows, cols);
+    const size_t stride = interleaver.calculateInterleavedLength(static_cast<int>(frameLength));
+
+    std::vector<uint8_t> frames(frameLength * frameCount);
+    for (size_t i = 0; i < frames.size(); ++i) {
+        frames[i] = static_cast<uint8_t>(i);
+    }
+    std::vector<uint8_t> output(stride * frameCount);
+    const int calls = static_cast<int>(std::max<size_t>(1, (256u << 20) / frames.size()));
+
+    const double vectorApi = measureMegabytesPerSecond(frames.size(), calls / 8 + 1, [&]() {
+        for (size_t f = 0; f < frameCount; ++f) {
+            std::vector<uint8_t> frame(frames.begin() + f * frameLength,
+                                       frames.begin() + (f + 1) * frameLength);
+            std::vector<uint8_t> result = interleaver.interleave(frame);
+            output[f * stride] = result[0];
+        }
+    });
+    const double batchApi = measureMegabytesPerSecond(frames.size(), calls, [&]() {
+        interleaver.interleaveBatch(frames.data(), frameCount, frameLength, output.data());
+    });
+
+    std::cout << rows << "x" << cols << ", " << frameCount << "帧 x " << frameLength << "字节" << std::endl;
+    std::cout << std::fixed << std::setprecision(0);
+    std::cout << "  vector接口: " << vectorApi << " MB/s, 批量缓冲区接口: " << batchApi
+              << " MB/s (x" << std::setprecision(1) << batchApi / vectorApi << ")" << std::endl;
+}
+
+} // namespace
+
+int main() {
+    // 关闭逐次调用的INFO日志
+    link16::utils::Logger::getInstance().setLogLevel(link16::utils::LogLevel::WARNING);
+
+    benchmarkShape(9, 12, 108, 1024);
+    benchmarkShape(8, 8, 4096, 64);
+    benchmarkShape(512, 512, 512 * 512, 2);
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include "coding/error_correction/reed_solomon/RSCodecCache.h"
+#include "core/utils/logger.h"
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace link16::coding::error_correction;
+
+namespace {
+
+// 计时并返回每秒处理的码字数
+template <typename Func>
+double measureWordsPerSecond(int words, Func&& func) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < words; ++i) {
+        func(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+    return words / seconds;
+}
+
+// 测试一个编码形状
+void benchmarkShape(int codeLength, int dataLength, int uncachedWords, int cachedWords) {
+    std::vector<uint8_t> data(dataLength);
+    for (int i = 0; i < dataLength; ++i) {
+        data[i] = static_cast<uint8_t>(i * 7 + 1);
+    }
+    std::vector<uint8_t> codeword(codeLength);
+    std::vector<uint8_t> received(codeLength);
+
+    // 优化前: 每个码字重新构建Galois域、生成多项式和编解码器
+    double uncachedEncode = measureWordsPerSecond(uncachedWords, [&](int) {
+        auto context = RSCodecContext::create(codeLength, dataLength);
+        context->encode(data.data(), codeword.data());
+    });
+    double uncachedDecode = measureWordsPerSecond(uncachedWords, [&](int i) {
+        auto context = RSCodecContext::create(codeLength, dataLength);
+        std::memcpy(received.data(), codeword.data(), codeLength);
+        received[i % codeLength] ^= 0x11;
+        context->decode(received.data());
+    });
+
+    // 优化后: 使用缓存的只读上下文
+    auto context = RSCodecCache::getInstance().get(codeLength, dataLength);
+    double cachedEncode = measureWordsPerSecond(cachedWords, [&](int) {
+        context->encode(data.data(), codeword.data());
+    });
+    double cachedDecode = measureWordsPerSecond(cachedWords, [&](int i) {
+        std::memcpy(received.data(), codeword.data(), codeLength);
+        received[i % codeLength] ^= 0x11;
+        context->decode(received.data());
+    });
+
+    // 批量接口: 一次调用处理一整批码字
+    const size_t batchSize = 256;
+    std::vector<uint8_t> messages(batchSize * dataLength);
+    for (size_t i = 0; i < messages.size(); ++i) {
+        messages[i] = static_cast<uint8_t>(i);
+    }
+    std::vector<uint8_t> codewords(batchSize * codeLength);
+    std::vector<uint8_t> decoded(batchSize * dataLength);
+    std::vector<int> corrected(batchSize);
+    std::unique_ptr<bool[]> failed(new bool[batchSize]);
+    const int batches = cachedWords / static_cast<int>(batchSize);
+    double batchEncode = measureWordsPerSecond(batches, [&](int) {
+        context->encodeBatch(messages.data(), batchSize, codewords.data());
+    }) * batchSize;
+    for (size_t n = 0; n < batchSize; ++n) {
+        codewords[n * codeLength + n % codeLength] ^= 0x11;
+    }
+    double batchDecode = measureWordsPerSecond(batches, [&](int) {
+        context->decodeBatch(codewords.data(), batchSize, decoded.data(), corrected.data(), failed.get());
+    }) * batchSize;
+
+    std::cout << "RS(" << codeLength << "," << dataLength << ")" << std::endl;
+    std::cout << std::fixed << std::setprecision(0);
+    std::cout << "  编码: 优化前 " << uncachedEncode << " words/s, 优化后 " << cachedEncode
+              << " words/s (x" << std::setprecision(1) << cachedEncode / uncachedEncode << ")" << std::endl;
+    std::cout << std::setprecision(0);
+    std::cout << "  解码: 优化前 " << uncachedDecode << " words/s, 优化后 " << cachedDecode
+              << " words/s (x" << std::setprecision(1) << cachedDecode / uncachedDecode << ")" << std::endl;
+    std::cout << std::setprecision(0);
+    std::cout << "  批量(" << batchSize << "): 编码 " << batchEncode << " words/s, 解码 "
+              << batchDecode << " words/s" << std::endl;
+}
+
+} // namespace
+
+int main() {
+    link16::utils::Logger::getInstance().setLogLevel(link16::utils::LogLevel::WARNING);
+
+    RSCodecCache::getInstance().preload();
+
+    benchmarkShape(31, 15, 200, 200000);
+    benchmarkShape(16, 7, 200, 200000);
+
+    return 0;
+}
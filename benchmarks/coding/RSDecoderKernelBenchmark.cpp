@@ -0,0 +1,82 @@
+#include "coding/error_correction/reed_solomon/RSCodecCache.h"
+#include "core/utils/logger.h"
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace link16::coding::error_correction;
+
+namespace {
+
+// 测试一个编码形状在各解码内核下的吞吐量
+void benchmarkShape(int codeLength, int dataLength, int errors, size_t words) {
+    auto context = RSCodecCache::getInstance().get(codeLength, dataLength);
+    const size_t batchSize = 256;
+    std::mt19937 rng(12345);
+
+    // 预先生成一批带errors个错误的码字
+    std::vector<uint8_t> messages(batchSize * dataLength);
+    for (auto& symbol : messages) {
+        symbol = static_cast<uint8_t>(rng());
+    }
+    std::vector<uint8_t> codewords(batchSize * codeLength);
+    context->encodeBatch(messages.data(), batchSize, codewords.data());
+    for (size_t n = 0; n < batchSize; ++n) {
+        for (int e = 0; e < errors; ++e) {
+            codewords[n * codeLength + (e * 5 + n) % codeLength] ^= static_cast<uint8_t>(1 + rng() % 255);
+        }
+    }
+
+    std::vector<uint8_t> decoded(batchSize * dataLength);
+    const size_t batches = words / batchSize;
+
+    std::cout << "RS(" << codeLength << "," << dataLength << ") " << errors << "个错误" << std::endl;
+
+    double referenceRate = 0.0;
+    const GFKernelType kernels[] = {GFKernelType::REFERENCE, GFKernelType::SCALAR,
+                                    GFKernelType::SSE41, GFKernelType::AVX2};
+    for (GFKernelType kernel : kernels) {
+        if (!isGFKernelSupported(kernel)) {
+            continue;
+        }
+        RSCodecContext::setDecoderKernel(kernel);
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t b = 0; b < batches; ++b) {
+            context->decodeBatch(codewords.data(), batchSize, decoded.data());
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        const double seconds = std::chrono::duration<double>(end - start).count();
+        const double rate = batches * batchSize / seconds;
+        if (kernel == GFKernelType::REFERENCE) {
+            referenceRate = rate;
+        }
+
+        std::cout << "  " << std::left << std::setw(10) << getGFKernelName(kernel) << std::right
+                  << std::fixed << std::setprecision(0) << std::setw(10) << rate << " words/s  "
+                  << std::setprecision(1) << std::setw(7) << rate * codeLength / 1e6 << " MB/s  x"
+                  << rate / referenceRate << std::endl;
+    }
+}
+
+} // namespace
+
+int main() {
+    link16::utils::Logger::getInstance().setLogLevel(link16::utils::LogLevel::WARNING);
+
+    RSCodecCache::getInstance().preload();
+    const GFKernelType defaultKernel = RSCodecContext::getDecoderKernel();
+
+    benchmarkShape(31, 15, 0, 200000);
+    benchmarkShape(31, 15, 4, 200000);
+    benchmarkShape(31, 15, 8, 200000);
+    benchmarkShape(16, 7, 4, 200000);
+
+    RSCodecContext::setDecoderKernel(defaultKernel);
+    return 0;
+}
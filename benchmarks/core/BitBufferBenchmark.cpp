@@ -0,0 +1,87 @@
+#include "core/types/BitBuffer.h"
+#include "core/utils/logger.h"
+#include "simulation/metrics/BER.h"
+#include <bitset>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace link16;
+
+namespace {
+
+// 计时并返回每次调用的平均微秒数
+template <typename Func>
+double measureMicroseconds(int iterations, Func&& func) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        func();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+}
+
+// 优化前的字符展开方式
+std::string expandToCharacters(const std::string& str) {
+    std::string result;
+    for (char c : str) {
+        result += std::bitset<8>(c).to_string();
+    }
+    return result;
+}
+
+} // namespace
+
+int main() {
+    utils::Logger::getInstance().setLogLevel(utils::LogLevel::ERROR);
+
+    // 约一帧STDP消息量级的数据
+    std::mt19937 rng(3);
+    std::string message(4096, '\0');
+    for (auto& c : message) {
+        c = static_cast<char>(rng());
+    }
+    std::string received = message;
+    for (size_t i = 0; i < received.size(); i += 97) {
+        received[i] ^= 0x10;
+    }
+
+    const int iterations = 2000;
+    volatile size_t sink = 0;
+
+    const double expandChars = measureMicroseconds(iterations, [&]() {
+        sink = sink + expandToCharacters(message).size();
+    });
+    const double expandPacked = measureMicroseconds(iterations, [&]() {
+        sink = sink + BitBuffer::fromBytes(reinterpret_cast<const uint8_t*>(message.data()), message.size()).size();
+    });
+
+    simulation::metrics::BER ber;
+    const std::vector<bool> originalBits = ber.stringToBits(message);
+    const std::vector<bool> receivedBits = ber.stringToBits(received);
+    const BitBuffer originalPacked = BitBuffer::fromBytes(reinterpret_cast<const uint8_t*>(message.data()), message.size());
+    const BitBuffer receivedPacked = BitBuffer::fromBytes(reinterpret_cast<const uint8_t*>(received.data()), received.size());
+
+    const double berVector = measureMicroseconds(iterations, [&]() {
+        sink = sink + static_cast<size_t>(ber.calculate(originalBits, receivedBits) * 1e9);
+    });
+    const double berPacked = measureMicroseconds(iterations, [&]() {
+        sink = sink + static_cast<size_t>(ber.calculate(originalPacked.span(), receivedPacked.span()) * 1e9);
+    });
+
+    std::cout << message.size() * 8 << " 比特" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  展开: 字符串 " << expandChars << " us, BitBuffer " << expandPacked
+              << " us (x" << std::setprecision(1) << expandChars / expandPacked << ")" << std::endl;
+    std::cout << std::setprecision(2);
+    std::cout << "  BER:  vector<bool> " << berVector << " us, BitSpan " << berPacked
+              << " us (x" << std::setprecision(1) << berVector / berPacked << ")" << std::endl;
+    std::cout << "  内存: 字符串 " << message.size() * 8 << " 字节, BitBuffer "
+              << originalPacked.wordCount() * sizeof(uint64_t) << " 字节" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,124 @@
+#include "core/utils/logger.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace link16;
+
+namespace {
+
+// 计时并返回每次调用的平均纳秒数
+template <typename Func>
+double measureNanoseconds(int iterations, Func&& func) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        func(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+// 优化前的同步写法：加锁、stringstream格式化时间、每行flush
+class LegacyLogger {
+public:
+    explicit LegacyLogger(const std::string& path) : file(path, std::ios::out | std::ios::app) {}
+
+    void info(const std::string& message) {
+        std::lock_guard<std::mutex> lock(mutex);
+        file << timeString() << " [INFO] " << message << std::endl;
+        file.flush();
+    }
+
+private:
+    static std::string timeString() {
+        auto now = std::chrono::system_clock::now();
+        auto time = std::chrono::system_clock::to_time_t(now);
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
+        std::stringstream ss;
+        ss << std::put_time(std::localtime(&time), "%Y-%m-%d %H:%M:%S");
+        ss << '.' << std::setfill('0') << std::setw(3) << ms.count();
+        return ss.str();
+    }
+
+    std::ofstream file;
+    std::mutex mutex;
+};
+
+// 多个线程同时记录日志，返回每条的平均纳秒数
+template <typename Func>
+double measureThreads(int threadCount, int perThread, Func&& func) {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < perThread; ++i) {
+                func(i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (threadCount * perThread);
+}
+
+} // namespace
+
+int main() {
+    const std::string legacyPath = "logger_benchmark_legacy.log";
+    const std::string asyncPath = "logger_benchmark_async.log";
+    std::remove(legacyPath.c_str());
+    std::remove(asyncPath.c_str());
+
+    const int iterations = 200000;
+    auto& logger = utils::Logger::getInstance();
+
+    std::cout << std::fixed << std::setprecision(0);
+
+    {
+        LegacyLogger legacy(legacyPath);
+        const double single = measureNanoseconds(iterations, [&](int i) {
+            legacy.info("RS编码完成，码字长度: " + std::to_string(i));
+        });
+        const double multi = measureThreads(4, iterations / 4, [&](int i) {
+            legacy.info("RS编码完成，码字长度: " + std::to_string(i));
+        });
+        std::cout << std::setw(22) << "同步写(优化前)" << ": 单线程 " << std::setw(6) << single
+                  << " ns/条, 4线程 " << std::setw(6) << multi << " ns/条" << std::endl;
+    }
+
+    logger.initialize(asyncPath, utils::LogLevel::INFO);
+    const double single = measureNanoseconds(iterations, [&](int i) {
+        LOG_INFO("RS编码完成，码字长度: " + std::to_string(i));
+    });
+    const double multi = measureThreads(4, iterations / 4, [&](int i) {
+        LOG_INFO("RS编码完成，码字长度: " + std::to_string(i));
+    });
+    auto flushStart = std::chrono::steady_clock::now();
+    logger.flush();
+    const double flushMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - flushStart).count();
+    std::cout << std::setw(22) << "异步写" << ": 单线程 " << std::setw(6) << single
+              << " ns/条, 4线程 " << std::setw(6) << multi << " ns/条 (最终flush " << flushMs << " ms)"
+              << std::endl;
+
+    // 级别被过滤时不构造消息
+    logger.setLogLevel(utils::LogLevel::WARNING);
+    std::cout << std::setprecision(1);
+    const double filtered = measureNanoseconds(iterations * 10, [&](int i) {
+        LOG_INFO("RS编码完成，码字长度: " + std::to_string(i));
+    });
+    std::cout << std::setw(22) << "级别过滤" << ": " << filtered << " ns/条" << std::endl;
+
+    logger.shutdown();
+    std::remove(legacyPath.c_str());
+    std::remove(asyncPath.c_str());
+    return 0;
+}
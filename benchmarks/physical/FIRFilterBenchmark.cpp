@@ -0,0 +1,116 @@
+#include "physical/signal_processing/filter/FIRFilter.h"
+#include "core/utils/logger.h"
+#include <chrono>
+#include <complex>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace link16;
+using namespace link16::physical::signal_processing;
+
+namespace {
+
+// 计时并返回吞吐量(百万样本/秒)
+template <typename Func>
+double measureMegasamples(size_t samplesPerCall, int calls, Func&& func) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < calls; ++i) {
+        func();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return samplesPerCall * static_cast<double>(calls) / 1e6 / std::chrono::duration<double>(end - start).count();
+}
+
+// 优化前的实现：每个样本整体移动延迟线
+std::vector<std::complex<double>> legacyFilter(const std::vector<double>& coefficients,
+                                               std::vector<std::complex<double>>& state,
+                                               const std::vector<std::complex<double>>& input) {
+    const int numTaps = static_cast<int>(coefficients.size());
+    std::vector<std::complex<double>> output(input.size());
+    for (size_t i = 0; i < input.size(); ++i) {
+        for (int j = numTaps - 2; j > 0; --j) {
+            state[j] = state[j - 1];
+        }
+        state[0] = input[i];
+        std::complex<double> sum(0.0, 0.0);
+        for (int j = 0; j < numTaps - 1; ++j) {
+            sum += coefficients[j] * state[j];
+        }
+        sum += coefficients[numTaps - 1] * input[i];
+        output[i] = sum;
+    }
+    return output;
+}
+
+} // namespace
+
+int main() {
+    utils::Logger::getInstance().setLogLevel(utils::LogLevel::WARNING);
+
+    std::mt19937 rng(1);
+    std::normal_distribution<double> gauss;
+    const size_t length = 1 << 16;
+    std::vector<double> real(length);
+    std::vector<std::complex<double>> complexInput(length);
+    for (size_t i = 0; i < length; ++i) {
+        real[i] = gauss(rng);
+        complexInput[i] = std::complex<double>(gauss(rng), gauss(rng));
+    }
+    std::vector<double> realOutput(length);
+    std::vector<std::complex<double>> complexOutput(length);
+
+    std::cout << "默认内核: " << getFIRKernelName(getFIRKernel()) << "，每次" << length << "个样本，单位Msamples/s"
+              << std::endl;
+    std::cout << std::setw(6) << "阶数" << std::setw(10) << "原实现" << std::setw(10) << "标量"
+              << std::setw(10) << "AVX2" << std::setw(10) << "FFT" << std::setw(10) << "AUTO"
+              << std::setw(12) << "复数AUTO" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+
+    for (int numTaps : {8, 16, 32, 64, 128, 256, 512, 1024}) {
+        std::vector<double> taps(numTaps);
+        for (auto& t : taps) {
+            t = gauss(rng);
+        }
+        // 计算量与阶数成正比，按阶数调整调用次数
+        const int calls = std::max(2, 4096 / numTaps);
+
+        std::vector<std::complex<double>> state(numTaps, std::complex<double>(0.0, 0.0));
+        const double legacy = measureMegasamples(length, std::max(1, calls / 8), [&]() {
+            legacyFilter(taps, state, complexInput);
+        });
+
+        auto measureReal = [&](FIRFilter::FilterMode mode, FIRKernelType kernel) {
+            if (!isFIRKernelSupported(kernel)) {
+                return 0.0;
+            }
+            const FIRKernelType original = getFIRKernel();
+            setFIRKernel(kernel);
+            FIRFilter filter;
+            filter.setFilterMode(mode);
+            filter.setCoefficients(taps);
+            const double rate = measureMegasamples(length, calls, [&]() {
+                filter.filter(real.data(), realOutput.data(), length);
+            });
+            setFIRKernel(original);
+            return rate;
+        };
+
+        const double scalar = measureReal(FIRFilter::FilterMode::DIRECT, FIRKernelType::SCALAR);
+        const double avx2 = measureReal(FIRFilter::FilterMode::DIRECT, FIRKernelType::AVX2);
+        const double fft = measureReal(FIRFilter::FilterMode::FFT, getFIRKernel());
+        const double automatic = measureReal(FIRFilter::FilterMode::AUTO, getFIRKernel());
+
+        FIRFilter complexFilter;
+        complexFilter.setCoefficients(taps);
+        const double complexAuto = measureMegasamples(length, calls, [&]() {
+            complexFilter.filter(complexInput.data(), complexOutput.data(), length);
+        });
+
+        std::cout << std::setw(6) << numTaps << std::setw(10) << legacy << std::setw(10) << scalar
+                  << std::setw(10) << avx2 << std::setw(10) << fft << std::setw(10) << automatic
+                  << std::setw(12) << complexAuto << std::endl;
+    }
+    return 0;
+}
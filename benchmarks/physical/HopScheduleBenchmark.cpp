@@ -0,0 +1,101 @@
+#include "physical/frequency/hopping/HopSchedule.h"
+#include "physical/frequency/hopping/FrequencyHopping.h"
+#include "core/utils/logger.h"
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace link16;
+using namespace link16::physical::frequency;
+
+namespace {
+
+// 运行直到累计超过0.2秒，返回每秒生成的跳频数
+template <typename Function>
+double measure(size_t hops, Function function) {
+    size_t iterations = 0;
+    auto start = std::chrono::steady_clock::now();
+    double seconds = 0.0;
+    do {
+        function();
+        ++iterations;
+        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (seconds < 0.2);
+    return hops * iterations / seconds;
+}
+
+void report(const char* name, double hopsPerSecond) {
+    std::cout << std::setw(28) << std::left << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << hopsPerSecond / 1e6 << std::endl;
+}
+
+} // namespace
+
+int main() {
+    utils::Logger::getInstance().setLogLevel(utils::LogLevel::WARNING);
+
+    const uint32_t slots = 4096;
+    const size_t slotHops = static_cast<size_t>(slots) * HopSchedule::pulses_per_slot;
+    std::vector<uint8_t> channels(HopSchedule::pulses_per_slot);
+    volatile uint32_t sink = 0;
+
+    std::cout << "跳频图样生成，单位: 百万跳/秒" << std::endl;
+
+    // 原实现: 换种子时用mt19937重新生成51个频点
+    FrequencyHopping legacy;
+    legacy.initialize(1, 0);
+    uint32_t seed = 0;
+    report("mt19937重新生成序列", measure(51 * 1000, [&]() {
+               for (int i = 0; i < 1000; ++i) {
+                   legacy.setSeed(++seed);
+               }
+           }));
+
+    HopSchedule schedule(12345, 1);
+    report("整时隙直接生成", measure(slotHops, [&]() {
+               for (uint32_t slot = 0; slot < slots; ++slot) {
+                   schedule.generateSlot(slot, channels.data());
+                   sink = sink + channels[0];
+               }
+           }));
+
+    std::mt19937 rng(1);
+    std::vector<uint32_t> randomSlots(1 << 16);
+    std::vector<uint32_t> randomPulses(randomSlots.size());
+    for (size_t i = 0; i < randomSlots.size(); ++i) {
+        randomSlots[i] = rng() % HopSchedule::slots_per_epoch;
+        randomPulses[i] = rng() % HopSchedule::pulses_per_slot;
+    }
+    report("随机访问单个脉冲", measure(randomSlots.size(), [&]() {
+               for (size_t i = 0; i < randomSlots.size(); ++i) {
+                   sink = sink + schedule.getChannel(randomSlots[i], randomPulses[i]);
+               }
+           }));
+
+    auto start = std::chrono::steady_clock::now();
+    HopSchedule precomputed(12345, 1);
+    precomputed.precompute();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    report("预计算整个时元",
+           static_cast<double>(HopSchedule::slots_per_epoch) * HopSchedule::pulses_per_slot / seconds);
+
+    report("整时隙查表", measure(slotHops, [&]() {
+               for (uint32_t slot = 0; slot < slots; ++slot) {
+                   precomputed.generateSlot(slot, channels.data());
+                   sink = sink + channels[0];
+               }
+           }));
+    report("随机访问查表", measure(randomSlots.size(), [&]() {
+               for (size_t i = 0; i < randomSlots.size(); ++i) {
+                   sink = sink + precomputed.getChannel(randomSlots[i], randomPulses[i]);
+               }
+           }));
+
+    std::cout << "整个时元" << HopSchedule::slots_per_epoch << "个时隙，频道表"
+              << static_cast<size_t>(HopSchedule::slots_per_epoch) * HopSchedule::pulses_per_slot / (1 << 20)
+              << "MB，预计算耗时" << std::setprecision(3) << seconds << "秒" << std::endl;
+    return 0;
+}
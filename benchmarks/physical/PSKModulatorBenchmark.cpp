@@ -0,0 +1,143 @@
+#include "physical/modulation/digital/PSK/BPSKModulator.h"
+#include "physical/modulation/digital/PSK/QPSKModulator.h"
+#include "core/utils/logger.h"
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace link16;
+using namespace link16::physical::modulation;
+
+namespace {
+
+// 计时并返回吞吐量(百万样本/秒)
+template <typename Func>
+double measureMegasamples(size_t samplesPerCall, int calls, Func&& func) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < calls; ++i) {
+        func();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return samplesPerCall * static_cast<double>(calls) / 1e6 / std::chrono::duration<double>(end - start).count();
+}
+
+// 优化前的升余弦滤波器，每次调制重新生成
+std::vector<double> legacyFilter(int filterLength, int samplesPerSymbol) {
+    std::vector<double> filter(filterLength);
+    const double beta = 0.35;
+    for (int i = 0; i < filterLength; ++i) {
+        double t = i - filterLength / 2;
+        if (t == 0) {
+            filter[i] = 1.0;
+        } else if (std::abs(t) == samplesPerSymbol / (2.0 * beta)) {
+            filter[i] = (M_PI / 4.0) * std::sin(M_PI / (2.0 * beta));
+        } else {
+            double numerator = std::sin(M_PI * t / samplesPerSymbol);
+            double denominator = M_PI * t / samplesPerSymbol;
+            double cosTerm = std::cos(M_PI * beta * t / samplesPerSymbol);
+            double denomTerm = 1.0 - std::pow(2.0 * beta * t / samplesPerSymbol, 2.0);
+            filter[i] = (numerator / denominator) * (cosTerm / denomTerm);
+        }
+    }
+    double sum = 0.0;
+    for (double coeff : filter) {
+        sum += coeff;
+    }
+    for (double& coeff : filter) {
+        coeff /= sum;
+    }
+    return filter;
+}
+
+// 优化前的实现：逐样本展开符号后做完整卷积
+std::vector<std::complex<double>> legacyModulate(const std::vector<std::complex<double>>& symbols,
+                                                 int samplesPerSymbol, int filterLength) {
+    std::vector<std::complex<double>> baseband;
+    baseband.reserve(symbols.size() * samplesPerSymbol);
+    for (const auto& symbol : symbols) {
+        for (int i = 0; i < samplesPerSymbol; ++i) {
+            baseband.push_back(symbol);
+        }
+    }
+    std::vector<double> filter = legacyFilter(filterLength, samplesPerSymbol);
+    std::vector<std::complex<double>> output(baseband.size() + filter.size() - 1);
+    for (size_t i = 0; i < output.size(); ++i) {
+        std::complex<double> sum(0.0, 0.0);
+        for (size_t j = 0; j < filter.size(); ++j) {
+            if (i >= j && i - j < baseband.size()) {
+                sum += baseband[i - j] * filter[j];
+            }
+        }
+        output[i] = sum;
+    }
+    return output;
+}
+
+} // namespace
+
+int main() {
+    utils::Logger::getInstance().setLogLevel(utils::LogLevel::WARNING);
+
+    std::mt19937 rng(1);
+    const size_t numBits = 1 << 14;
+    BitBuffer bits(numBits);
+    for (size_t i = 0; i < numBits; ++i) {
+        bits.set(i, rng() & 1);
+    }
+
+    std::cout << "每次" << numBits << "比特，单位Msamples/s" << std::endl;
+    std::cout << std::setw(8) << "调制" << std::setw(8) << "sps" << std::setw(8) << "阶数" << std::setw(10)
+              << "原实现" << std::setw(10) << "vector" << std::setw(10) << "缓冲区" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+
+    const int configurations[][2] = {{4, 32}, {10, 32}, {20, 32}, {10, 64}, {4, 128}};
+    for (const auto& config : configurations) {
+        const int sps = config[0];
+        const int taps = config[1];
+
+        for (int bitsPerSymbol : {1, 2}) {
+            std::vector<std::complex<double>> symbols;
+            for (size_t i = 0; i < numBits; i += bitsPerSymbol) {
+                const double q = bitsPerSymbol == 2 ? (bits[i + 1] ? 1.0 : -1.0) : 0.0;
+                symbols.emplace_back(bits[i] ? 1.0 : -1.0, q);
+            }
+            const size_t samples = (symbols.size() - 1) * sps + sps + taps - 1;
+
+            BPSKModulator bpsk;
+            QPSKModulator qpsk;
+            bpsk.setSamplesPerSymbol(sps);
+            bpsk.setFilterLength(taps);
+            qpsk.setSamplesPerSymbol(sps);
+            qpsk.setFilterLength(taps);
+            std::vector<std::complex<double>> output(samples);
+
+            const int legacyCalls = std::max(1, 64 / sps * 32 / taps);
+            const double legacy = measureMegasamples(samples, legacyCalls, [&]() {
+                legacyModulate(symbols, sps, taps);
+            });
+            double vectorRate;
+            double bufferRate;
+            if (bitsPerSymbol == 1) {
+                vectorRate = measureMegasamples(samples, 50, [&]() { bpsk.modulate(bits.span()); });
+                bufferRate = measureMegasamples(samples, 50, [&]() {
+                    bpsk.modulate(bits.span(), output.data(), output.size());
+                });
+            } else {
+                vectorRate = measureMegasamples(samples, 50, [&]() { qpsk.modulate(bits.span()); });
+                bufferRate = measureMegasamples(samples, 50, [&]() {
+                    qpsk.modulate(bits.span(), output.data(), output.size());
+                });
+            }
+
+            std::cout << std::setw(8) << (bitsPerSymbol == 1 ? "BPSK" : "QPSK") << std::setw(8) << sps
+                      << std::setw(8) << taps << std::setw(10) << legacy << std::setw(10) << vectorRate
+                      << std::setw(10) << bufferRate << std::endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,133 @@
+#include "physical/hardware/usrp/SampleRing.h"
+#include "core/utils/logger.h"
+#include <chrono>
+#include <complex>
+#include <condition_variable>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+using namespace link16;
+using namespace link16::physical::hardware;
+
+namespace {
+
+const size_t block_size = 1024;
+const size_t block_total = 200000;
+
+// 模拟DSP处理: 对块内样本求和
+float process(const std::complex<float>* samples, size_t length) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < length; ++i) {
+        sum += samples[i].real();
+    }
+    return sum;
+}
+
+void fill(std::complex<float>* samples, size_t length, uint64_t index) {
+    for (size_t i = 0; i < length; ++i) {
+        samples[i] = std::complex<float>(static_cast<float>(index & 0xff), 0.0f);
+    }
+}
+
+void report(const char* name, double seconds) {
+    std::cout << std::setw(26) << std::left << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << block_total * block_size / seconds / 1e6 << std::setw(12)
+              << seconds * 1e9 / block_total << std::endl;
+    std::cout << std::defaultfloat;
+}
+
+// 原实现: 每块新建vector，经互斥锁保护的队列交给DSP线程
+void measureLockedQueue() {
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::queue<std::vector<std::complex<float>>> queue;
+    bool done = false;
+    volatile float sink = 0.0f;
+
+    const auto start = std::chrono::steady_clock::now();
+    std::thread consumer([&]() {
+        while (true) {
+            std::vector<std::complex<float>> block;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [&]() { return done || !queue.empty(); });
+                if (queue.empty()) {
+                    return;
+                }
+                block = std::move(queue.front());
+                queue.pop();
+            }
+            sink = sink + process(block.data(), block.size());
+        }
+    });
+
+    for (uint64_t i = 0; i < block_total; ++i) {
+        std::vector<std::complex<float>> block(block_size);
+        fill(block.data(), block.size(), i);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            queue.push(std::move(block));
+        }
+        condition.notify_one();
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        done = true;
+    }
+    condition.notify_one();
+    consumer.join();
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    report("加锁队列+vector(原实现)", seconds);
+}
+
+// SampleRing: 直接写入空闲块；这里满时让出CPU等待，只比较传递开销
+void measureRing(size_t blockCount) {
+    SampleRing ring(block_size, blockCount);
+    volatile float sink = 0.0f;
+
+    const auto start = std::chrono::steady_clock::now();
+    std::thread consumer([&]() {
+        SampleBlock block;
+        while (ring.waitRead(block, std::chrono::seconds(1))) {
+            sink = sink + process(block.data, block.length);
+            ring.releaseRead();
+        }
+    });
+
+    for (uint64_t i = 0; i < block_total; ++i) {
+        std::complex<float>* block = nullptr;
+        while ((block = ring.tryAcquireWrite()) == nullptr) {
+            std::this_thread::yield();
+        }
+        fill(block, block_size, i);
+        ring.commitWrite(block_size, i * block_size);
+    }
+    ring.close();
+    consumer.join();
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const std::string name = "SampleRing " + std::to_string(ring.getBlockCount()) + "块";
+    report(name.c_str(), seconds);
+}
+
+} // namespace
+
+int main() {
+    utils::Logger::getInstance().setLogLevel(utils::LogLevel::WARNING);
+
+    std::cout << "接收线程到DSP线程的样本传递，每块" << block_size << "个样本，共" << block_total << "块"
+              << std::endl;
+    std::cout << std::setw(26) << std::left << "方式" << std::right << std::setw(12) << "Msps" << std::setw(12)
+              << "ns/块" << std::endl;
+
+    measureLockedQueue();
+    measureRing(16);
+    measureRing(64);
+    measureRing(256);
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include "physical/modulation/digital/PSK/BPSKModulator.h"
+#include "coding/error_correction/reed_solomon/GF32RSCodec.h"
+#include "core/utils/logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace link16;
+using namespace link16::physical::modulation;
+using namespace link16::coding::error_correction;
+
+namespace {
+
+typedef GF32RSCodec<code_31_15, data_31_15> Codec;
+
+const int bits_per_word = Codec::code_length * SymbolReliabilityMapper::bits_per_symbol;
+
+} // namespace
+
+int main() {
+    utils::Logger::getInstance().setLogLevel(utils::LogLevel::WARNING);
+
+    BPSKModulator modulator;
+    std::mt19937 rng(1);
+
+    // 单个比特的波形能量，用于由Eb/N0换算噪声方差
+    BitBuffer one(1, true);
+    double bitEnergy = 0.0;
+    for (const auto& sample : modulator.modulate(one.span())) {
+        bitEnergy += std::norm(sample);
+    }
+
+    const int words = 4000;
+    std::cout << "BPSK + RS(31,15)，每个信噪比" << words << "个码字" << std::endl;
+    std::cout << std::setw(10) << "Eb/N0(dB)" << std::setw(12) << "信道误比特" << std::setw(12) << "硬判决WER"
+              << std::setw(12) << "软判决WER" << std::setw(14) << "平均删除数" << std::setw(16) << "软解码(万字/s)"
+              << std::endl;
+
+    BitBuffer bits(bits_per_word);
+    std::vector<std::complex<double>> signal(modulator.getModulatedLength(bits_per_word));
+    std::vector<double> llr(bits_per_word);
+
+    for (double ebn0 = 2.0; ebn0 <= 7.01; ebn0 += 1.0) {
+        const double noiseVariance = bitEnergy / std::pow(10.0, ebn0 / 10.0);
+        modulator.setNoiseVariance(noiseVariance);
+        std::normal_distribution<double> gauss(0.0, std::sqrt(noiseVariance / 2.0));
+
+        size_t bitErrors = 0;
+        int hardFailures = 0;
+        int softFailures = 0;
+        long erasures = 0;
+        double softSeconds = 0.0;
+
+        for (int w = 0; w < words; ++w) {
+            uint8_t data[Codec::data_length];
+            uint8_t codeword[Codec::code_length];
+            for (auto& s : data) {
+                s = static_cast<uint8_t>(rng() % 32);
+            }
+            Codec::encode(data, codeword);
+            for (int t = 0; t < Codec::code_length; ++t) {
+                bits.setBits(t * 5, 5, codeword[t]);
+            }
+
+            modulator.modulate(bits.span(), signal.data(), signal.size());
+            for (auto& sample : signal) {
+                sample += std::complex<double>(gauss(rng), gauss(rng));
+            }
+            modulator.demodulateSoft(signal.data(), signal.size(), llr.data(), llr.size());
+
+            // 硬判决: 只用LLR的符号
+            uint8_t hard[Codec::code_length];
+            SymbolReliabilityMapper::mapSymbols(llr.data(), Codec::code_length, hard, nullptr);
+            for (int t = 0; t < Codec::code_length; ++t) {
+                bitErrors += __builtin_popcount(hard[t] ^ codeword[t]);
+            }
+            if (!Codec::decode(hard) || !std::equal(hard, hard + Codec::code_length, codeword)) {
+                ++hardFailures;
+            }
+
+            uint8_t soft[Codec::code_length];
+            int erased = 0;
+            auto start = std::chrono::steady_clock::now();
+            const bool ok = Codec::decodeSoft(llr.data(), soft, nullptr, &erased);
+            softSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (!ok || !std::equal(soft, soft + Codec::code_length, codeword)) {
+                ++softFailures;
+            }
+            erasures += erased;
+        }
+
+        std::cout << std::fixed << std::setprecision(1) << std::setw(10) << ebn0 << std::scientific
+                  << std::setprecision(2) << std::setw(12) << bitErrors / double(words * bits_per_word)
+                  << std::setw(12) << hardFailures / double(words) << std::setw(12) << softFailures / double(words)
+                  << std::fixed << std::setprecision(2) << std::setw(14) << erasures / double(words)
+                  << std::setprecision(1) << std::setw(16) << words / softSeconds / 1e4 << std::endl;
+    }
+    return 0;
+}
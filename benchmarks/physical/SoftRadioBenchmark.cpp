@@ -0,0 +1,161 @@
+#include "physical/hardware/softradio/SoftRadioFile.h"
+#include "physical/hardware/softradio/SoftRadioLoopback.h"
+#include "core/utils/logger.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <complex>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace link16;
+using namespace link16::physical::hardware;
+
+namespace {
+
+const size_t file_samples = 1 << 23;
+const size_t loopback_samples = 1 << 22;
+const int latency_bursts = 50;
+
+// 等待条件成立，最多30秒
+template <typename Predicate>
+void waitFor(Predicate predicate) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (!predicate() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+}
+
+void reportThroughput(const char* name, size_t samples, double seconds) {
+    std::cout << std::setw(28) << std::left << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << samples / seconds / 1e6 << " Msps" << std::endl;
+    std::cout << std::defaultfloat;
+}
+
+// 非实时回放SigMF文件，接收器经环形缓冲区交给DSP线程
+void measureFileReplay() {
+    const std::string path = "softradio_benchmark";
+    {
+        SoftRadioFile writer;
+        writer.initialize("tx=" + path + ",tx_capacity=" + std::to_string(file_samples));
+        std::vector<std::complex<float>> block(65536, std::complex<float>(1.0f, -1.0f));
+        for (size_t offset = 0; offset < file_samples; offset += block.size()) {
+            writer.write(block.data(), block.size(), offset);
+        }
+        writer.close();
+    }
+
+    SoftRadioFile file;
+    file.initialize("rx=" + path + ",realtime=0");
+    USRPReceiver receiver;
+    receiver.initialize();
+    file.attach(receiver);
+
+    std::atomic<size_t> received(0);
+    volatile float sink = 0.0f;
+    const auto start = std::chrono::steady_clock::now();
+    receiver.startContinuousReceive([&](const SampleBlock& block) {
+        sink = sink + block.data[block.length - 1].real();
+        received.fetch_add(block.length);
+    });
+    waitFor([&]() { return received.load() >= file_samples; });
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    receiver.close();
+    file.close();
+    std::remove((path + SoftRadioFile::data_extension).c_str());
+    std::remove((path + SoftRadioFile::meta_extension).c_str());
+
+    reportThroughput("文件回放(非实时)", received.load(), seconds);
+}
+
+// 非实时回环: 发送队列 -> 回环 -> 接收环形缓冲区 -> DSP线程
+void measureLoopbackThroughput() {
+    SoftRadioLoopback loopback;
+    loopback.setRealTime(false);
+    loopback.initialize();
+
+    std::atomic<size_t> received(0);
+    loopback.getReceiver().startContinuousReceive(
+        [&](const SampleBlock& block) { received.fetch_add(block.length); });
+    USRPTransmitter& transmitter = loopback.getTransmitter();
+    transmitter.startStreaming();
+
+    std::vector<std::complex<float>> samples(loopback_samples, std::complex<float>(0.5f, 0.5f));
+    const auto start = std::chrono::steady_clock::now();
+    transmitter.transmit(samples);
+    waitFor([&]() { return received.load() >= loopback_samples; });
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    loopback.close();
+
+    reportThroughput("回环(非实时)", received.load(), seconds);
+}
+
+// 实时回环时延: 从提交突发到DSP线程看到突发的第一个样本
+void measureLoopbackLatency(double sampleRate, size_t receiveBlock) {
+    SoftRadioLoopback loopback;
+    loopback.initialize();
+    loopback.setSampleRate(sampleRate);
+    USRPReceiver& receiver = loopback.getReceiver();
+    receiver.setStreamBuffer(receiveBlock, 64);
+
+    std::atomic<int64_t> detected(0);
+    receiver.startContinuousReceive([&](const SampleBlock& block) {
+        for (size_t i = 0; i < block.length; ++i) {
+            if (block.data[i].real() > 0.5f) {
+                if (detected.load() == 0) {
+                    detected.store(std::chrono::steady_clock::now().time_since_epoch().count());
+                }
+                break;
+            }
+        }
+    });
+    USRPTransmitter& transmitter = loopback.getTransmitter();
+    transmitter.startStreaming();
+
+    std::vector<double> latencies;
+    const std::vector<std::complex<float>> burst(1000, std::complex<float>(1.0f, 0.0f));
+    for (int i = 0; i < latency_bursts; ++i) {
+        detected.store(0);
+        const auto submitted = std::chrono::steady_clock::now();
+        transmitter.transmit(burst);
+        waitFor([&]() { return detected.load() != 0; });
+        const auto seen = std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(detected.load()));
+        latencies.push_back(std::chrono::duration<double, std::micro>(seen - submitted).count());
+
+        // 等突发完全发出，再留一段空闲
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    loopback.close();
+
+    std::sort(latencies.begin(), latencies.end());
+    double sum = 0.0;
+    for (double latency : latencies) {
+        sum += latency;
+    }
+    std::cout << std::fixed << std::setprecision(1) << std::setw(10) << sampleRate / 1e6 << std::setw(10)
+              << receiveBlock << std::setw(12) << sum / latencies.size() << std::setw(12)
+              << latencies[latencies.size() / 2] << std::setw(12) << latencies[latencies.size() * 99 / 100]
+              << std::endl;
+    std::cout << std::defaultfloat;
+}
+
+} // namespace
+
+int main() {
+    utils::Logger::getInstance().setLogLevel(utils::LogLevel::WARNING);
+
+    std::cout << "软件无线电吞吐量" << std::endl;
+    measureFileReplay();
+    measureLoopbackThroughput();
+
+    std::cout << std::endl << "实时回环端到端时延(微秒)，每种配置" << latency_bursts << "个突发" << std::endl;
+    std::cout << std::setw(10) << "Msps" << std::setw(10) << "接收块" << std::setw(12) << "平均" << std::setw(12)
+              << "P50" << std::setw(12) << "P99" << std::endl;
+    measureLoopbackLatency(1.0e6, 1024);
+    measureLoopbackLatency(1.0e6, 256);
+    measureLoopbackLatency(10.0e6, 1024);
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include "physical/synchronization/frame/FrameSynchronizer.h"
+#include "physical/synchronization/frame/SyncCorrelator.h"
+#include "physical/signal_processing/filter/FIRFilter.h"
+#include "core/utils/logger.h"
+#include <algorithm>
+#include <chrono>
+#include <complex>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace link16;
+using namespace link16::physical::synchronization;
+using namespace link16::physical::signal_processing;
+
+namespace {
+
+// 运行直到累计超过0.2秒，返回每秒处理的样本数
+template <typename Function>
+double measure(size_t samples, Function function) {
+    size_t iterations = 0;
+    auto start = std::chrono::steady_clock::now();
+    double seconds = 0.0;
+    do {
+        function();
+        ++iterations;
+        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (seconds < 0.2);
+    return samples * iterations / seconds;
+}
+
+// 按流式块处理整段信号
+double measureCorrelator(const std::vector<std::complex<double>>& sync,
+                         const std::vector<std::complex<double>>& signal, size_t blockLength) {
+    SyncCorrelator correlator;
+    correlator.setReference(sync);
+    std::vector<SyncPeak> peaks;
+    return measure(signal.size(), [&]() {
+        peaks.clear();
+        for (size_t offset = 0; offset < signal.size(); offset += blockLength) {
+            correlator.process(signal.data() + offset, std::min(blockLength, signal.size() - offset), 0.7, peaks);
+        }
+    });
+}
+
+} // namespace
+
+int main() {
+    utils::Logger::getInstance().setLogLevel(utils::LogLevel::WARNING);
+    std::mt19937 rng(1);
+    std::normal_distribution<double> gauss(0.0, 1.0);
+
+    const size_t signalLength = 1 << 16;
+    const size_t blockLength = 4096;
+    std::vector<std::complex<double>> signal(signalLength);
+    for (auto& sample : signal) {
+        sample = std::complex<double>(gauss(rng), gauss(rng));
+    }
+
+    const FIRKernelType original = getFIRKernel();
+    std::cout << "同步相关，信号" << signalLength << "个样本，流式块长" << blockLength << "，单位: 百万样本/秒"
+              << std::endl;
+    std::cout << std::setw(8) << "序列长度" << std::setw(12) << "逐点计算" << std::setw(12) << "标量" << std::setw(12)
+              << "AVX2" << std::setw(8) << "方式" << std::endl;
+
+    for (size_t length : {16, 32, 48, 64, 128, 256, 512}) {
+        std::string sequence;
+        for (size_t i = 0; i < length; ++i) {
+            sequence += (rng() & 1) ? '1' : '0';
+        }
+        FrameSynchronizer synchronizer;
+        synchronizer.setSyncSequence(sequence);
+        const auto sync = synchronizer.generateSyncSignal();
+
+        // 原实现: 每个位置调用calculateCorrelation
+        const size_t legacyLength = signalLength / 16;
+        const double legacy = measure(legacyLength, [&]() {
+            double best = 0.0;
+            for (size_t p = 0; p + length <= legacyLength; ++p) {
+                best = std::max(best, synchronizer.calculateCorrelation(signal, p));
+            }
+            volatile double sink = best;
+            (void)sink;
+        });
+
+        // SyncCorrelator在两种FIR内核下的吞吐，FFT方式与内核无关
+        setFIRKernel(FIRKernelType::SCALAR);
+        const double scalar = measureCorrelator(sync, signal, blockLength);
+        double avx2 = 0.0;
+        if (isFIRKernelSupported(FIRKernelType::AVX2)) {
+            setFIRKernel(FIRKernelType::AVX2);
+            avx2 = measureCorrelator(sync, signal, blockLength);
+        }
+        setFIRKernel(original);
+
+        SyncCorrelator probe;
+        probe.setReference(sync);
+        std::cout << std::setw(8) << length << std::fixed << std::setprecision(2) << std::setw(12) << legacy / 1e6
+                  << std::setw(12) << scalar / 1e6 << std::setw(12) << avx2 / 1e6 << std::setw(8)
+                  << (probe.isUsingFFT() ? "FFT" : "直接") << std::endl;
+    }
+    return 0;
+}
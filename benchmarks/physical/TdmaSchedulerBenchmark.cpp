@@ -0,0 +1,100 @@
+#include "physical/synchronization/time/TdmaScheduler.h"
+#include "core/utils/logger.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace link16;
+using namespace link16::physical::synchronization;
+
+namespace {
+
+const uint64_t slot_length_ns = TdmaScheduler::default_slot_length_ns;
+const uint64_t slot_count = 256;
+
+void report(const char* name, const SlotJitterHistogram& histogram) {
+    std::cout << std::setw(22) << std::left << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << histogram.mean / 1e3 << std::setw(10) << histogram.percentile(0.5) / 1e3
+              << std::setw(10) << histogram.percentile(0.99) / 1e3 << std::setw(10) << histogram.max / 1e3
+              << std::setw(8) << histogram.missedSlots << std::endl;
+}
+
+// 原实现: 每个时隙计算剩余时间后sleep_for，唤醒延迟会累积
+SlotJitterHistogram measureRelativeSleep() {
+    SlotJitterHistogram histogram;
+    histogram.binWidth = 1000;
+    histogram.bins.assign(10000, 0);
+    histogram.overflow = 0;
+    histogram.count = 0;
+    histogram.mean = 0.0;
+    histogram.max = 0;
+    histogram.missedSlots = 0;
+    histogram.latePreparations = 0;
+
+    const auto epoch = std::chrono::steady_clock::now();
+    double sum = 0.0;
+    for (uint64_t i = 0; i < slot_count; ++i) {
+        const auto now = std::chrono::steady_clock::now();
+        const uint64_t elapsed = std::chrono::duration_cast<std::chrono::microseconds>(now - epoch).count();
+        const uint64_t slotUs = slot_length_ns / 1000;
+        const uint64_t next = (elapsed / slotUs + 1) * slotUs;
+        std::this_thread::sleep_for(std::chrono::microseconds(next - elapsed));
+
+        // 相对真实时隙边界(7.8125ms)的偏差
+        const uint64_t woke = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                  std::chrono::steady_clock::now() - epoch).count();
+        const uint64_t boundary = (woke / slot_length_ns) * slot_length_ns;
+        const uint64_t lateness = woke - boundary;
+        const uint64_t bin = lateness / histogram.binWidth;
+        if (bin < histogram.bins.size()) {
+            ++histogram.bins[bin];
+        } else {
+            ++histogram.overflow;
+        }
+        ++histogram.count;
+        sum += lateness;
+        histogram.max = std::max(histogram.max, lateness);
+    }
+    histogram.mean = sum / histogram.count;
+    return histogram;
+}
+
+SlotJitterHistogram measureScheduler(uint64_t spinTime) {
+    TdmaScheduler scheduler;
+    scheduler.setSpinTime(spinTime);
+    scheduler.setHistogram(1000, 10000);
+    scheduler.setPrepareCallback([](uint64_t slot, TdmaScheduler::SampleBuffer& buffer) {
+        buffer.assign(4096, std::complex<float>(static_cast<float>(slot), 0.0f));
+        return true;
+    });
+    volatile float sink = 0.0f;
+    scheduler.setDispatchCallback([&](uint64_t, const TdmaScheduler::SampleBuffer& buffer) {
+        sink = sink + buffer[0].real();
+    });
+
+    scheduler.start();
+    std::this_thread::sleep_for(std::chrono::nanoseconds(slot_length_ns * (slot_count + 1)));
+    scheduler.stop();
+    return scheduler.getJitterHistogram();
+}
+
+} // namespace
+
+int main() {
+    utils::Logger::getInstance().setLogLevel(utils::LogLevel::WARNING);
+
+    std::cout << "时隙边界抖动，时隙长度" << slot_length_ns / 1e6 << "ms，每种方式" << slot_count
+              << "个时隙，单位: 微秒" << std::endl;
+    std::cout << std::setw(22) << std::left << "方式" << std::right << std::setw(10) << "平均" << std::setw(10)
+              << "P50" << std::setw(10) << "P99" << std::setw(10) << "最大" << std::setw(8) << "错过" << std::endl;
+
+    report("sleep_for(原实现)", measureRelativeSleep());
+    report("绝对时刻睡眠", measureScheduler(0));
+    report("睡眠+忙等20us", measureScheduler(20000));
+    report("睡眠+忙等100us", measureScheduler(100000));
+    report("睡眠+忙等200us", measureScheduler(200000));
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include "physical/hardware/usrp/USRPTransmitter.h"
+#include "core/utils/logger.h"
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace link16;
+using namespace link16::physical::hardware;
+
+namespace {
+
+const double sample_rate = 1.0e6;
+const size_t burst_samples = 8192;
+const int burst_total = 40;
+
+// 模拟编码和调制: 生成一个突发的样本，耗时约为空中时间的三分之一
+void encode(std::complex<float>* samples, size_t length, int burst) {
+    for (size_t i = 0; i < length; ++i) {
+        float phase = static_cast<float>(burst) + static_cast<float>(i) * 0.01f;
+        for (int k = 0; k < 24; ++k) {
+            phase = std::sin(phase) + 0.5f;
+        }
+        samples[i] = std::complex<float>(std::cos(phase), std::sin(phase));
+    }
+}
+
+void report(const char* name, double seconds, uint64_t underruns) {
+    const double airTime = burst_total * burst_samples / sample_rate;
+    std::cout << std::setw(26) << std::left << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << seconds * 1e3 << std::setw(10) << airTime * 1e3 << std::setw(10)
+              << airTime / seconds * 100.0 << std::setw(8) << underruns << std::endl;
+    std::cout << std::defaultfloat;
+}
+
+// 原实现: 编码后调用transmit()，阻塞到空中时间结束再编码下一个
+void measureBlocking() {
+    USRPTransmitter transmitter;
+    transmitter.initialize();
+    transmitter.setSampleRate(sample_rate);
+
+    std::vector<std::complex<float>> samples(burst_samples);
+    const auto start = std::chrono::steady_clock::now();
+    for (int burst = 0; burst < burst_total; ++burst) {
+        encode(samples.data(), samples.size(), burst);
+        transmitter.transmit(samples);
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    report("阻塞transmit(原实现)", seconds, 0);
+}
+
+// 发送队列: 直接编码到缓冲池中的缓冲区，发送线程首尾相接发送
+void measureQueue(size_t bufferCount) {
+    USRPTransmitter transmitter;
+    transmitter.initialize();
+    transmitter.setSampleRate(sample_rate);
+    transmitter.setTransmitQueue(burst_samples, bufferCount);
+    transmitter.startStreaming();
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int burst = 0; burst < burst_total; ++burst) {
+        TxBuffer* buffer = transmitter.acquireBuffer();
+        encode(buffer->data, burst_samples, burst);
+        transmitter.submit(buffer, burst_samples, TransmitQueue::asap, burst == burst_total - 1);
+    }
+    transmitter.flush(std::chrono::seconds(60));
+
+    // 等最后一个缓冲区的空中时间结束
+    const uint64_t end = transmitter.getSentSamples();
+    while (transmitter.getDeviceTime() < end) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    transmitter.stopStreaming();
+
+    const std::string name = "发送队列 " + std::to_string(bufferCount) + "个缓冲区";
+    report(name.c_str(), seconds, transmitter.getUnderrunCount());
+}
+
+} // namespace
+
+int main() {
+    utils::Logger::getInstance().setLogLevel(utils::LogLevel::WARNING);
+
+    std::cout << "连续发送" << burst_total << "个突发，每个" << burst_samples << "个样本，采样率"
+              << sample_rate / 1e6 << "Msps" << std::endl;
+    std::cout << std::setw(26) << std::left << "方式" << std::right << std::setw(10) << "耗时ms" << std::setw(10)
+              << "空中ms" << std::setw(10) << "占空比%" << std::setw(8) << "欠载" << std::endl;
+
+    measureBlocking();
+    measureQueue(2);
+    measureQueue(4);
+    return 0;
+}
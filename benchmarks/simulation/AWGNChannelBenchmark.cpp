@@ -0,0 +1,100 @@
+#include "simulation/channel/awgn/AWGNChannel.h"
+#include "simulation/channel/base/GaussianNoise.h"
+#include <chrono>
+#include <complex>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace link16::simulation::channel;
+
+namespace {
+
+const size_t frame_samples = 4096;
+const int repetitions = 500;
+
+// 重复执行，返回每秒处理的百万复数样本数
+double measure(const std::function<void()>& body) {
+    body();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repetitions; ++i) {
+        body();
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return frame_samples * static_cast<double>(repetitions) / seconds / 1.0e6;
+}
+
+void report(const std::string& name, double rate, double baseline) {
+    std::cout << std::setw(10) << std::fixed << std::setprecision(1) << rate << std::setw(9) << std::setprecision(2)
+              << rate / baseline << "x  " << name << std::endl;
+}
+
+} // namespace
+
+int main() {
+    std::vector<std::complex<double>> signal(frame_samples);
+    for (size_t i = 0; i < signal.size(); ++i) {
+        signal[i] = std::polar(1.0, 0.3 * i);
+    }
+    std::vector<std::complex<double>> buffer = signal;
+    volatile double sink = 0.0;
+
+    std::cout << "AWGN信道，每帧" << frame_samples << "个复数样本" << std::endl;
+    std::cout << "  M样本/秒     加速比  实现" << std::endl;
+
+    // 原实现: 测量功率，复制信号，std::normal_distribution逐个生成
+    std::mt19937_64 generator(1);
+    const double baseline = measure([&]() {
+        double power = 0.0;
+        for (const auto& sample : signal) {
+            power += std::norm(sample);
+        }
+        std::normal_distribution<double> dist(0.0, std::sqrt(power / signal.size() / 2.0 / 10.0));
+        std::vector<std::complex<double>> result = signal;
+        for (auto& sample : result) {
+            const double real = dist(generator);
+            const double imag = dist(generator);
+            sample += std::complex<double>(real, imag);
+        }
+        sink = sink + result[0].real();
+    });
+    report("std::normal_distribution (原实现)", baseline, baseline);
+
+    // 只生成高斯样本
+    std::vector<float> gaussian(2 * frame_samples);
+    const GaussianKernelType original = getGaussianKernel();
+    for (GaussianKernelType kernel : {GaussianKernelType::SCALAR, GaussianKernelType::AVX2}) {
+        if (!isGaussianKernelSupported(kernel)) {
+            continue;
+        }
+        setGaussianKernel(kernel);
+        GaussianNoise noise(1);
+        report(std::string("GaussianNoise::generate ") + getGaussianKernelName(kernel),
+               measure([&]() { noise.generate(gaussian.data(), gaussian.size()); }), baseline);
+    }
+    setGaussianKernel(original);
+
+    AWGNChannel channel(10.0);
+    channel.setSeed(1);
+    report("AWGNChannel::process", measure([&]() { sink = sink + channel.process(signal)[0].real(); }), baseline);
+    report("AWGNChannel::processInPlace", measure([&]() {
+        channel.processInPlace(buffer.data(), buffer.size());
+        sink = sink + buffer[0].real();
+    }), baseline);
+
+    channel.setNoisePower(0.1);
+    report("processInPlace 已知噪声功率", measure([&]() {
+        channel.processInPlace(buffer.data(), buffer.size());
+        sink = sink + buffer[0].real();
+    }), baseline);
+
+    std::vector<std::complex<float>> single(signal.begin(), signal.end());
+    report("processInPlace 单精度", measure([&]() {
+        channel.processInPlace(single.data(), single.size());
+        sink = sink + single[0].real();
+    }), baseline);
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+#include "simulation/channel/fading/JakesFader.h"
+#include "simulation/channel/fading/RayleighChannel.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace link16::simulation::channel;
+
+namespace {
+
+const size_t frame_samples = 8192;
+const int repetitions = 200;
+
+// 重复执行，返回每秒处理的百万样本数
+double measure(const std::function<void()>& body) {
+    body();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repetitions; ++i) {
+        body();
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return frame_samples * static_cast<double>(repetitions) / seconds / 1.0e6;
+}
+
+void report(const std::string& name, double rate) {
+    std::cout << std::setw(10) << std::fixed << std::setprecision(1) << rate << "  " << name << std::endl;
+}
+
+} // namespace
+
+int main() {
+    const double doppler = 1.0e-3;
+    const size_t oscillators = JakesFader::default_oscillators;
+    std::vector<std::complex<double>> gains(frame_samples);
+    volatile double sink = 0.0;
+
+    std::cout << "瑞利衰落，每帧" << frame_samples << "个样本，归一化多普勒" << doppler << "，每个分量"
+              << oscillators << "个振荡器" << std::endl;
+    std::cout << "  M样本/秒  实现" << std::endl;
+
+    // 逐样本调用cos计算同样的正弦波叠加
+    std::mt19937_64 generator(1);
+    std::uniform_real_distribution<double> angle(-M_PI, M_PI);
+    std::vector<double> inPhaseFreq(oscillators), quadratureFreq(oscillators), phi(oscillators), psi(oscillators);
+    for (size_t n = 0; n < oscillators; ++n) {
+        const double alpha = (2.0 * M_PI * (n + 1) - M_PI + angle(generator)) / (4.0 * oscillators);
+        inPhaseFreq[n] = 2.0 * M_PI * doppler * std::cos(alpha);
+        quadratureFreq[n] = 2.0 * M_PI * doppler * std::sin(alpha);
+        phi[n] = angle(generator);
+        psi[n] = angle(generator);
+    }
+    uint64_t time = 0;
+    report("逐样本cos", measure([&]() {
+        for (size_t k = 0; k < frame_samples; ++k, ++time) {
+            double inPhase = 0.0, quadrature = 0.0;
+            for (size_t n = 0; n < oscillators; ++n) {
+                inPhase += std::cos(inPhaseFreq[n] * time + phi[n]);
+                quadrature += std::cos(quadratureFreq[n] * time + psi[n]);
+            }
+            gains[k] = std::complex<double>(inPhase, quadrature) / std::sqrt(static_cast<double>(oscillators));
+        }
+        sink = sink + gains[0].real();
+    }));
+
+    JakesFader fader;
+    fader.reset(doppler, generator);
+    report("JakesFader::generate 递推旋转", measure([&]() {
+        fader.generate(gains.data(), gains.size());
+        sink = sink + gains[0].real();
+    }));
+
+    // 每次从同一输入开始，避免反复衰落后样本幅度漂移
+    const std::vector<std::complex<double>> input(frame_samples, std::complex<double>(1.0, 0.0));
+    std::vector<std::complex<double>> signal(frame_samples);
+    for (double spread : {0.0, 2.0e-6, 6.0e-6}) {
+        RayleighChannel channel(20.0, doppler * 1.0e6, 1.0e6, spread);
+        channel.setSeed(1);
+        report("RayleighChannel::processInPlace " + std::to_string(channel.getTapCount()) + "抽头(含噪声)",
+               measure([&]() {
+                   std::copy(input.begin(), input.end(), signal.begin());
+                   channel.processInPlace(signal.data(), signal.size());
+                   sink = sink + signal[0].real();
+               }));
+    }
+
+    return 0;
+}
@@ -0,0 +1,113 @@
+#include "simulation/engine/SimulationEngine.h"
+#include "core/utils/logger.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace link16::simulation;
+
+namespace {
+
+// 运行一次仿真，返回耗时(秒)
+double measure(const engine::SimulationConfig& config, size_t threads, double& ber) {
+    engine::SimulationEngine simulation;
+    simulation.initialize(config);
+    simulation.setThreadCount(threads);
+    auto start = std::chrono::steady_clock::now();
+    simulation.run();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    ber = simulation.getBitErrorRate();
+    return seconds;
+}
+
+} // namespace
+
+int main() {
+    link16::utils::Logger::getInstance().setLogLevel(link16::utils::LogLevel::WARNING);
+
+    link16::SimulationParams simParams;
+    simParams.snr = -6.0;
+    simParams.iterations = 400;
+    simParams.numSamples = 1000;
+
+    engine::SimulationConfig config;
+    config.setSimulationParams(simParams);
+    config.setChannelType("AWGN");
+
+    const size_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<size_t> threadCounts = {1};
+    for (size_t threads = 2; threads <= hardwareThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    if (threadCounts.back() != hardwareThreads) {
+        threadCounts.push_back(hardwareThreads);
+    }
+
+    std::cout << "蒙特卡洛BER仿真，BPSK/AWGN，" << simParams.iterations << "次迭代 x " << simParams.numSamples
+              << "比特，硬件线程" << hardwareThreads << std::endl;
+    std::cout << std::setw(8) << "线程数" << std::setw(12) << "耗时(秒)" << std::setw(14) << "百万比特/秒"
+              << std::setw(10) << "加速比" << std::setw(12) << "误码率" << std::endl;
+
+    double baseline = 0.0;
+    for (size_t threads : threadCounts) {
+        double ber = 0.0;
+        const double seconds = measure(config, threads, ber);
+        if (threads == 1) {
+            baseline = seconds;
+        }
+        const double bits = static_cast<double>(simParams.iterations) * simParams.numSamples;
+        std::cout << std::setw(8) << threads << std::fixed << std::setprecision(3) << std::setw(12) << seconds
+                  << std::setw(14) << bits / seconds / 1e6 << std::setw(10) << baseline / seconds
+                  << std::setprecision(6) << std::setw(12) << ber << std::endl;
+    }
+
+    // 误码率曲线: 每个点固定迭代次数 vs 按目标错误数提前停止
+    const double snrStart = -10.0;
+    const double snrStop = 0.0;
+    const double snrStep = 2.0;
+    const int fixedIterations = 400;
+
+    auto start = std::chrono::steady_clock::now();
+    uint64_t fixedBits = 0;
+    for (double snr = snrStart; snr <= snrStop + 1e-9; snr += snrStep) {
+        link16::SimulationParams params = simParams;
+        params.snr = snr;
+        params.iterations = fixedIterations;
+        engine::SimulationConfig pointConfig = config;
+        pointConfig.setSimulationParams(params);
+        engine::SimulationEngine simulation;
+        simulation.initialize(pointConfig);
+        simulation.run();
+        fixedBits += simulation.getTotalBits();
+    }
+    const double fixedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    engine::SweepParams sweep;
+    sweep.snrStart = snrStart;
+    sweep.snrStop = snrStop;
+    sweep.snrStep = snrStep;
+    sweep.targetErrors = 200;
+    sweep.maxBits = static_cast<uint64_t>(fixedIterations) * simParams.numSamples;
+
+    engine::SimulationEngine simulation;
+    simulation.initialize(config);
+    std::vector<engine::SweepPoint> points;
+    start = std::chrono::steady_clock::now();
+    simulation.runSweep(sweep, points);
+    const double sweepSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    uint64_t sweepBits = 0;
+    for (const auto& point : points) {
+        sweepBits += point.totalBits;
+    }
+
+    std::cout << std::defaultfloat << std::endl << "误码率曲线 " << snrStart << " - " << snrStop << " dB，步长" << snrStep << std::endl;
+    std::cout << std::setw(20) << "方式" << std::setw(12) << "耗时(秒)" << std::setw(14) << "仿真比特" << std::endl;
+    std::cout << std::setw(20) << "固定迭代" << std::fixed << std::setprecision(3) << std::setw(12) << fixedSeconds
+              << std::setw(14) << fixedBits << std::endl;
+    std::cout << std::setw(20) << "200个错误即停止" << std::setw(12) << sweepSeconds << std::setw(14) << sweepBits
+              << std::endl;
+    return 0;
+}
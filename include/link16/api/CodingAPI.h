@@ -58,6 +58,35 @@ public:
      */
     bool rsDecode(const std::string& encodedData, std::string& data, int codeLength = 31, int dataLength = 15);
     
+    /**
+     * @brief Reed-Solomon批量编码
+     * 
+     * 一次调用编码一整批STDP字，分摊编解码上下文查找和调用开销。
+     * @param messages 连续存放的count条消息，每条dataLength字节
+     * @param count 消息数量
+     * @param codewords 调用方提供的输出缓冲区，大小至少为count * codeLength
+     * @param codeLength RS码字长度
+     * @param dataLength RS信息字长度
+     * @return size_t 编码成功的码字数量
+     */
+    size_t rsEncodeBatch(const uint8_t* messages, size_t count, uint8_t* codewords,
+                         int codeLength = 31, int dataLength = 15);
+    
+    /**
+     * @brief Reed-Solomon批量解码
+     * @param codewords 连续存放的count个码字，每个codeLength字节
+     * @param count 码字数量
+     * @param messages 调用方提供的输出缓冲区，大小至少为count * dataLength
+     * @param correctedSymbols 输出每个码字纠正的符号数量(count个元素)，可为空
+     * @param failed 输出每个码字是否解码失败(count个元素)，可为空
+     * @param codeLength RS码字长度
+     * @param dataLength RS信息字长度
+     * @return size_t 解码成功的码字数量
+     */
+    size_t rsDecodeBatch(const uint8_t* codewords, size_t count, uint8_t* messages,
+                         int* correctedSymbols = nullptr, bool* failed = nullptr,
+                         int codeLength = 31, int dataLength = 15);
+    
     /**
      * @brief 计算CRC32校验码
      * @param data 需要计算校验码的数据
@@ -65,6 +94,31 @@ public:
      */
     uint32_t calculateCRC32(const std::string& data);
     
+    /**
+     * @brief 计算CRC32校验码(原始缓冲区)
+     * @param data 数据
+     * @param length 字节数
+     * @return uint32_t CRC32校验码
+     */
+    uint32_t calculateCRC32(const uint8_t* data, size_t length);
+    
+    /**
+     * @brief 在已有CRC32上追加数据，用于分块到达的数据
+     * @param crc 之前数据的CRC32，首次传入0
+     * @param data 追加的数据
+     * @param length 字节数
+     * @return uint32_t 拼接后数据的CRC32
+     */
+    uint32_t updateCRC32(uint32_t crc, const uint8_t* data, size_t length);
+    
+    /**
+     * @brief 分块读取文件计算CRC32，适用于大的录制文件
+     * @param path 文件路径
+     * @param crc 输出CRC32校验码
+     * @return bool 是否成功
+     */
+    bool calculateFileCRC32(const std::string& path, uint32_t& crc);
+    
     /**
      * @brief 验证CRC32校验码
      * @param data 原始数据
@@ -193,6 +247,33 @@ bool rsEncode(const std::string& data, std::string& encodedData, int codeLength
  */
 bool rsDecode(const std::string& encodedData, std::string& data, int codeLength = 31, int dataLength = 15);
 
+/**
+ * @brief Reed-Solomon批量编码全局函数
+ * @param messages 连续存放的count条消息，每条dataLength字节
+ * @param count 消息数量
+ * @param codewords 调用方提供的输出缓冲区，大小至少为count * codeLength
+ * @param codeLength RS码字长度
+ * @param dataLength RS信息字长度
+ * @return size_t 编码成功的码字数量
+ */
+size_t rsEncodeBatch(const uint8_t* messages, size_t count, uint8_t* codewords,
+                     int codeLength = 31, int dataLength = 15);
+
+/**
+ * @brief Reed-Solomon批量解码全局函数
+ * @param codewords 连续存放的count个码字，每个codeLength字节
+ * @param count 码字数量
+ * @param messages 调用方提供的输出缓冲区，大小至少为count * dataLength
+ * @param correctedSymbols 输出每个码字纠正的符号数量，可为空
+ * @param failed 输出每个码字是否解码失败，可为空
+ * @param codeLength RS码字长度
+ * @param dataLength RS信息字长度
+ * @return size_t 解码成功的码字数量
+ */
+size_t rsDecodeBatch(const uint8_t* codewords, size_t count, uint8_t* messages,
+                     int* correctedSymbols = nullptr, bool* failed = nullptr,
+                     int codeLength = 31, int dataLength = 15);
+
 /**
  * @brief 计算CRC32校验码全局函数
  * @param data 需要计算校验码的数据
@@ -200,6 +281,31 @@ bool rsDecode(const std::string& encodedData, std::string& data, int codeLength
  */
 uint32_t calculateCRC32(const std::string& data);
 
+/**
+ * @brief 计算CRC32校验码全局函数(原始缓冲区)
+ * @param data 数据
+ * @param length 字节数
+ * @return uint32_t CRC32校验码
+ */
+uint32_t calculateCRC32(const uint8_t* data, size_t length);
+
+/**
+ * @brief 追加计算CRC32全局函数
+ * @param crc 之前数据的CRC32，首次传入0
+ * @param data 追加的数据
+ * @param length 字节数
+ * @return uint32_t 拼接后数据的CRC32
+ */
+uint32_t updateCRC32(uint32_t crc, const uint8_t* data, size_t length);
+
+/**
+ * @brief 计算文件CRC32全局函数
+ * @param path 文件路径
+ * @param crc 输出CRC32校验码
+ * @return bool 是否成功
+ */
+bool calculateFileCRC32(const std::string& path, uint32_t& crc);
+
 /**
  * @brief 验证CRC32校验码全局函数
  * @param data 原始数据
@@ -3,6 +3,7 @@
 #include <vector>
 #include <cstdint>
 #include "core/types/Link16Types.h"
+#include "simulation/engine/SimulationEngine.h"
 
 namespace link16 {
 namespace api {
@@ -46,6 +47,17 @@ public:
     // 运行仿真
     bool runSimulation();
     
+    /**
+     * @brief 扫描误码率-信噪比曲线，每个点仿真到错误数或置信区间满足要求为止
+     * @param params 扫描参数
+     * @param csvFile 每个点完成时追加一行的CSV文件，为空时不写文件
+     * @return 是否成功
+     */
+    bool runSweep(const simulation::engine::SweepParams& params, const std::string& csvFile = "");
+    
+    // 获取扫描结果，按信噪比从小到大排列
+    std::vector<simulation::engine::SweepPoint> getSweepResults() const;
+    
     // 停止仿真
     void stopSimulation();
     
@@ -84,6 +96,9 @@ private:
     // 仿真结果
     std::vector<double> results;
     
+    // 扫描结果
+    std::vector<simulation::engine::SweepPoint> sweepResults;
+    
     // 仿真状态
     bool running;
     
@@ -101,6 +116,7 @@ PhysicalParams getPhysicalParams();
 void setChannelType(const std::string& type);
 std::string getChannelType();
 bool runSimulation();
+bool runSimulationSweep(const simulation::engine::SweepParams& params, const std::string& csvFile = "");
 void stopSimulation();
 std::vector<double> getSimulationResults();
 bool saveSimulationResults(const std::string& resultFile);
@@ -98,6 +98,38 @@ bool CodingAPI::rsDecode(const std::string& encodedData, std::string& data, int
     return result;
 }
 
+// Reed-Solomon批量编码
+size_t CodingAPI::rsEncodeBatch(const uint8_t* messages, size_t count, uint8_t* codewords,
+                                int codeLength, int dataLength) {
+    if (!initialized) {
+        LOG_ERROR("编码API未初始化");
+        return 0;
+    }
+    
+    // 调用CodingProcessor
+    size_t encoded = s_processor->rsEncodeBatch(messages, count, codewords, codeLength, dataLength);
+    
+    if (encoded != count) {
+        LOG_ERROR("RS批量编码失败: " + std::to_string(count - encoded) + "/" + std::to_string(count));
+    }
+    
+    return encoded;
+}
+
+// Reed-Solomon批量解码
+size_t CodingAPI::rsDecodeBatch(const uint8_t* codewords, size_t count, uint8_t* messages,
+                                int* correctedSymbols, bool* failed,
+                                int codeLength, int dataLength) {
+    if (!initialized) {
+        LOG_ERROR("编码API未初始化");
+        return 0;
+    }
+    
+    // 调用CodingProcessor，失败的码字通过failed标志返回给调用方
+    return s_processor->rsDecodeBatch(codewords, count, messages, correctedSymbols, failed,
+                                      codeLength, dataLength);
+}
+
 // CRC校验
 uint32_t CodingAPI::calculateCRC32(const std::string& data) {
     if (!initialized) {
@@ -107,12 +139,40 @@ uint32_t CodingAPI::calculateCRC32(const std::string& data) {
     
     LOG_INFO("计算CRC32");
     
-    // CRC功能在CodingProcessor中不存在，需要直接调用底层
-    // 这里可以考虑将CRC功能也添加到CodingProcessor中
-    return coding::error_detection::calculateCRC32(
-        reinterpret_cast<const uint8_t*>(data.data()), 
-        data.length()
-    );
+    // 调用CodingProcessor
+    return s_processor->calculateCRC32(data);
+}
+
+// CRC校验(原始缓冲区)
+uint32_t CodingAPI::calculateCRC32(const uint8_t* data, size_t length) {
+    if (!initialized) {
+        LOG_ERROR("编码API未初始化");
+        return 0;
+    }
+    
+    return s_processor->calculateCRC32(data, length);
+}
+
+// CRC追加计算
+uint32_t CodingAPI::updateCRC32(uint32_t crc, const uint8_t* data, size_t length) {
+    if (!initialized) {
+        LOG_ERROR("编码API未初始化");
+        return crc;
+    }
+    
+    return s_processor->updateCRC32(crc, data, length);
+}
+
+// 文件CRC校验
+bool CodingAPI::calculateFileCRC32(const std::string& path, uint32_t& crc) {
+    if (!initialized) {
+        LOG_ERROR("编码API未初始化");
+        return false;
+    }
+    
+    LOG_INFO("计算文件CRC32: " + path);
+    
+    return s_processor->calculateFileCRC32(path, crc);
 }
 
 // 验证CRC
@@ -347,10 +407,33 @@ bool rsDecode(const std::string& encodedData, std::string& data, int codeLength,
     return CodingAPI::getInstance().rsDecode(encodedData, data, codeLength, dataLength);
 }
 
+size_t rsEncodeBatch(const uint8_t* messages, size_t count, uint8_t* codewords,
+                     int codeLength, int dataLength) {
+    return CodingAPI::getInstance().rsEncodeBatch(messages, count, codewords, codeLength, dataLength);
+}
+
+size_t rsDecodeBatch(const uint8_t* codewords, size_t count, uint8_t* messages,
+                     int* correctedSymbols, bool* failed, int codeLength, int dataLength) {
+    return CodingAPI::getInstance().rsDecodeBatch(codewords, count, messages, correctedSymbols, failed,
+                                                  codeLength, dataLength);
+}
+
 uint32_t calculateCRC32(const std::string& data) {
     return CodingAPI::getInstance().calculateCRC32(data);
 }
 
+uint32_t calculateCRC32(const uint8_t* data, size_t length) {
+    return CodingAPI::getInstance().calculateCRC32(data, length);
+}
+
+uint32_t updateCRC32(uint32_t crc, const uint8_t* data, size_t length) {
+    return CodingAPI::getInstance().updateCRC32(crc, data, length);
+}
+
+bool calculateFileCRC32(const std::string& path, uint32_t& crc) {
+    return CodingAPI::getInstance().calculateFileCRC32(path, crc);
+}
+
 bool verifyCRC32(const std::string& data, uint32_t crc) {
     return CodingAPI::getInstance().verifyCRC32(data, crc);
 }
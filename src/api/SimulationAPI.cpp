@@ -206,6 +206,59 @@ bool SimulationAPI::runSimulation() {
     return result;
 }
 
+// 扫描误码率-信噪比曲线
+bool SimulationAPI::runSweep(const simulation::engine::SweepParams& params, const std::string& csvFile) {
+    if (!initialized) {
+        LOG_ERROR("仿真API未初始化");
+        return false;
+    }
+    
+    if (running) {
+        LOG_WARNING("仿真已经在运行");
+        return false;
+    }
+    
+    LOG_INFO("扫描误码率曲线: 信道类型=" + channelType + ", SNR " + std::to_string(params.snrStart) + " - " +
+             std::to_string(params.snrStop) + " dB");
+    
+    // 创建仿真引擎
+    simulation::engine::SimulationConfig config;
+    config.setSimulationParams(simParams);
+    config.setPhysicalParams(physParams);
+    config.setChannelType(channelType);
+    
+    simulation::engine::SimulationEngine engine;
+    if (!engine.initialize(config)) {
+        LOG_ERROR("初始化仿真引擎失败");
+        return false;
+    }
+    
+    running = true;
+    progress = 0.0;
+    sweepResults.clear();
+    
+    bool result = false;
+    if (csvFile.empty()) {
+        result = engine.runSweep(params, sweepResults);
+    } else {
+        result = engine.runSweep(params, csvFile, &sweepResults);
+    }
+    
+    if (result) {
+        progress = 1.0;
+    } else {
+        LOG_ERROR("扫描误码率曲线失败");
+    }
+    
+    running = false;
+    return result;
+}
+
+// 获取扫描结果
+std::vector<simulation::engine::SweepPoint> SimulationAPI::getSweepResults() const {
+    return sweepResults;
+}
+
 // 停止仿真
 void SimulationAPI::stopSimulation() {
     if (!initialized || !running) {
@@ -306,6 +359,10 @@ bool runSimulation() {
     return SimulationAPI::getInstance().runSimulation();
 }
 
+bool runSimulationSweep(const simulation::engine::SweepParams& params, const std::string& csvFile) {
+    return SimulationAPI::getInstance().runSweep(params, csvFile);
+}
+
 void stopSimulation() {
     SimulationAPI::getInstance().stopSimulation();
 }
@@ -1,13 +1,56 @@
 #include "CodingProcessor.h"
 #include "error_correction/reed_solomon/RSCoder.h"
+#include "error_correction/reed_solomon/RSCodecCache.h"
 #include "crypto/symmetric/aes/AESCrypto.h"
 #include "interleaving/matrix/MatrixInterleaver.h"
 #include "error_detection/parity/BIPCoder.h"
+#include "error_detection/crc/CRCCalculator.h"
 #include "core/utils/logger.h"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
 
 namespace link16 {
 namespace coding {
 
+namespace {
+
+// 编解码流水线参数
+const int pipeline_code_length = 31;
+const int pipeline_data_length = 15;
+const int pipeline_rows = 8;
+const int pipeline_cols = 8;
+
+// 每线程复用的流水线暂存区，只增不减，稳态下不再分配
+struct PipelineScratch {
+    std::vector<uint8_t> codewords;
+    std::vector<uint8_t> ciphertext;
+    std::vector<uint8_t> deinterleaved;
+};
+
+PipelineScratch& getPipelineScratch() {
+    thread_local PipelineScratch scratch;
+    return scratch;
+}
+
+uint8_t* reserveScratch(std::vector<uint8_t>& buffer, size_t size) {
+    if (buffer.size() < size) {
+        buffer.resize(size);
+    }
+    return buffer.data();
+}
+
+// 帧头: 一个不加密的RS码字，数据符号前4字节为原始数据长度(大端)，其余为0
+const size_t frame_header_length = pipeline_code_length;
+const size_t frame_length_bytes = 4;
+
+// 原始数据RS编码后的字节数
+size_t codewordBytes(size_t rawLength) {
+    return (rawLength + pipeline_data_length - 1) / pipeline_data_length * pipeline_code_length;
+}
+
+} // namespace
+
 // 构造函数
 CodingProcessor::CodingProcessor() : initialized(false) {
 }
@@ -24,6 +67,12 @@ bool CodingProcessor::initialize() {
     }
     
     try {
+        // 预先构建Reed-Solomon编解码上下文，之后各线程只读共享
+        if (!error_correction::RSCodecCache::getInstance().preload()) {
+            LOG_ERROR("RS编解码上下文构建失败");
+            return false;
+        }
+        
         // 创建Reed-Solomon编码器
         rsEncoder = std::make_unique<error_correction::RSCoder>();
         
@@ -66,41 +115,16 @@ bool CodingProcessor::encodeData(const std::string& rawData, std::string& encode
         return false;
     }
     
-    try {
-        std::string processedData = rawData;
-        std::string tempData;
-        
-        // 1. 计算BIP校验
-        std::vector<bool> bip;
-        if (!calculateBIP(processedData, bip)) {
-            return false;
-        }
-        
-        // 2. Reed-Solomon编码
-        if (!rsEncode(processedData, tempData)) {
-            return false;
-        }
-        processedData = tempData;
-        
-        // 3. 加密（如果有密钥）
-        if (!encryptionKey.empty()) {
-            if (!aesEncrypt(processedData, encryptionKey, tempData)) {
-                return false;
-            }
-            processedData = tempData;
-        }
-        
-        // 4. 交织
-        if (!interleave(processedData, encodedData)) {
-            return false;
-        }
-        
-        return true;
-    } catch (const std::exception& e) {
-        // 记录错误
-        // Logger::error("数据编码失败: " + std::string(e.what()));
+    // encodedData容量足够时resize不会重新分配
+    size_t encodedLength = 0;
+    encodedData.resize(getEncodedLength(rawData.length()));
+    if (!encodeData(reinterpret_cast<const uint8_t*>(rawData.data()), rawData.length(),
+                    reinterpret_cast<uint8_t*>(&encodedData[0]), encodedData.length(), encodedLength)) {
         return false;
     }
+    
+    encodedData.resize(encodedLength);
+    return true;
 }
 
 // 解码数据
@@ -109,43 +133,229 @@ bool CodingProcessor::decodeData(const std::string& encodedData, std::string& ra
         return false;
     }
     
-    try {
-        std::string processedData = encodedData;
-        std::string tempData;
-        
-        // 1. 解交织
-        if (!deinterleave(processedData, tempData)) {
+    size_t rawLength = 0;
+    rawData.resize(getDecodedCapacity(encodedData.length()));
+    if (!decodeData(reinterpret_cast<const uint8_t*>(encodedData.data()), encodedData.length(),
+                    reinterpret_cast<uint8_t*>(&rawData[0]), rawData.length(), rawLength)) {
+        return false;
+    }
+    
+    rawData.resize(rawLength);
+    return true;
+}
+
+// 计算编码后的字节数
+size_t CodingProcessor::getEncodedLength(size_t rawLength) const {
+    if (rawLength == 0) {
+        return 0;
+    }
+    
+    size_t length = codewordBytes(rawLength);
+    if (!encryptionKey.empty()) {
+        length = crypto::AESCrypto::getEncryptedLength(length);
+    }
+    length += frame_header_length;
+    
+    const size_t matrixSize = static_cast<size_t>(pipeline_rows) * pipeline_cols;
+    return (length + matrixSize - 1) / matrixSize * matrixSize;
+}
+
+// 计算解码输出缓冲区所需的字节数
+size_t CodingProcessor::getDecodedCapacity(size_t encodedLength) const {
+    // 只解交织完整的矩阵；加密时明文只有密文的一半，该上界同样足够
+    const size_t matrixSize = static_cast<size_t>(pipeline_rows) * pipeline_cols;
+    const size_t payloadLength = encodedLength / matrixSize * matrixSize;
+    if (payloadLength < frame_header_length) {
+        return 0;
+    }
+    return (payloadLength - frame_header_length) / pipeline_code_length * pipeline_data_length;
+}
+
+// 编码数据到调用方缓冲区
+bool CodingProcessor::encodeData(const uint8_t* rawData, size_t length,
+                                 uint8_t* encodedData, size_t capacity, size_t& encodedLength) {
+    encodedLength = 0;
+    if (!initialized) {
+        return false;
+    }
+    
+    if (length == 0) {
+        return true;
+    }
+    
+    if (!rawData || !encodedData) {
+        LOG_ERROR("编码数据缓冲区为空");
+        return false;
+    }
+    
+    const size_t requiredLength = getEncodedLength(length);
+    if (capacity < requiredLength) {
+        LOG_ERROR("编码输出缓冲区不足: 需要" + std::to_string(requiredLength) +
+                  "字节, 实际" + std::to_string(capacity) + "字节");
+        return false;
+    }
+    
+    auto context = error_correction::RSCodecCache::getInstance().get(pipeline_code_length,
+                                                                     pipeline_data_length);
+    if (!context) {
+        return false;
+    }
+    
+    if (length > UINT32_MAX) {
+        LOG_ERROR("编码数据过长: " + std::to_string(length) + "字节");
+        return false;
+    }
+    
+    PipelineScratch& scratch = getPipelineScratch();
+    
+    // 1. Reed-Solomon编码：帧头在最前面，完整的块直接从输入批量编码，最后一块补0后原地编码
+    const size_t blockCount = (length + pipeline_data_length - 1) / pipeline_data_length;
+    const size_t fullBlocks = length / pipeline_data_length;
+    uint8_t* header = reserveScratch(scratch.codewords, frame_header_length + blockCount * pipeline_code_length);
+    uint8_t* codewords = header + frame_header_length;
+    
+    std::memset(header, 0, pipeline_data_length);
+    for (size_t i = 0; i < frame_length_bytes; ++i) {
+        header[i] = static_cast<uint8_t>(length >> (8 * (frame_length_bytes - 1 - i)));
+    }
+    if (!context->encode(header, header) ||
+        context->encodeBatch(rawData, fullBlocks, codewords) != fullBlocks) {
+        LOG_ERROR("RS编码失败");
+        return false;
+    }
+    
+    if (fullBlocks < blockCount) {
+        uint8_t* lastBlock = codewords + fullBlocks * pipeline_code_length;
+        const size_t remaining = length - fullBlocks * pipeline_data_length;
+        std::memcpy(lastBlock, rawData + fullBlocks * pipeline_data_length, remaining);
+        std::memset(lastBlock + remaining, 0, pipeline_data_length - remaining);
+        if (!context->encode(lastBlock, lastBlock)) {
+            LOG_ERROR("RS编码失败");
             return false;
         }
-        processedData = tempData;
-        
-        // 2. 解密（如果有密钥）
-        if (!encryptionKey.empty()) {
-            if (!aesDecrypt(processedData, encryptionKey, tempData)) {
-                return false;
-            }
-            processedData = tempData;
-        }
-        
-        // 3. Reed-Solomon解码
-        if (!rsDecode(processedData, tempData)) {
+    }
+    
+    const uint8_t* frame = header;
+    size_t frameLength = frame_header_length + blockCount * pipeline_code_length;
+    
+    // 2. 加密（如果有密钥），帧头不加密，十六进制密文写在暂存区中帧头之后
+    if (!encryptionKey.empty()) {
+        const size_t codewordLength = blockCount * pipeline_code_length;
+        uint8_t* encrypted = reserveScratch(scratch.ciphertext, frame_header_length +
+                                            crypto::AESCrypto::getEncryptedLength(codewordLength));
+        std::memcpy(encrypted, header, frame_header_length);
+        frameLength = frame_header_length + aesEncoder->encrypt(codewords, codewordLength, encryptionKey,
+                                                                encrypted + frame_header_length);
+        frame = encrypted;
+    }
+    
+    // 3. 交织，最后一个矩阵用'0'填充
+    encodedLength = interleaving::interleave(frame, frameLength, encodedData,
+                                             pipeline_rows, pipeline_cols, '0');
+    return encodedLength == requiredLength;
+}
+
+// 解码调用方缓冲区中的数据
+bool CodingProcessor::decodeData(const uint8_t* encodedData, size_t length,
+                                 uint8_t* rawData, size_t capacity, size_t& rawLength) {
+    rawLength = 0;
+    if (!initialized) {
+        return false;
+    }
+    
+    if (length == 0) {
+        return true;
+    }
+    
+    if (!encodedData || !rawData) {
+        LOG_ERROR("解码数据缓冲区为空");
+        return false;
+    }
+    
+    auto context = error_correction::RSCodecCache::getInstance().get(pipeline_code_length,
+                                                                     pipeline_data_length);
+    if (!context) {
+        return false;
+    }
+    
+    PipelineScratch& scratch = getPipelineScratch();
+    
+    // 1. 解交织，只处理完整的矩阵
+    uint8_t* deinterleaved = reserveScratch(scratch.deinterleaved, length);
+    const size_t frameLength = interleaving::deinterleave(encodedData, length, deinterleaved,
+                                                          pipeline_rows, pipeline_cols);
+    
+    // 2. 解码帧头得到原始数据长度，由此确定码字(或密文)的确切长度，其后的交织填充不参与后续处理
+    uint8_t header[frame_header_length];
+    if (frameLength < frame_header_length) {
+        LOG_ERROR("编码数据不足一个帧头: " + std::to_string(frameLength));
+        return false;
+    }
+    std::memcpy(header, deinterleaved, frame_header_length);
+    if (!context->decode(header)) {
+        LOG_ERROR("帧头RS解码失败");
+        return false;
+    }
+    
+    size_t messageLength = 0;
+    for (size_t i = 0; i < frame_length_bytes; ++i) {
+        messageLength = (messageLength << 8) | header[i];
+    }
+    for (size_t i = frame_length_bytes; i < static_cast<size_t>(pipeline_data_length); ++i) {
+        if (header[i] != 0) {
+            LOG_ERROR("帧头格式无效");
             return false;
         }
-        processedData = tempData;
-        
-        // 4. 验证BIP校验
-        std::vector<bool> bip;
-        if (!calculateBIP(processedData, bip)) {
+    }
+    
+    const size_t blockCount = (messageLength + pipeline_data_length - 1) / pipeline_data_length;
+    const size_t codewordLength = blockCount * pipeline_code_length;
+    const size_t payloadLength = encryptionKey.empty() ? codewordLength :
+                                 crypto::AESCrypto::getEncryptedLength(codewordLength);
+    if (frameLength - frame_header_length < payloadLength) {
+        LOG_ERROR("编码数据长度与帧头不符: 需要" + std::to_string(payloadLength) +
+                  "字节, 实际" + std::to_string(frameLength - frame_header_length) + "字节");
+        return false;
+    }
+    
+    if (capacity < messageLength) {
+        LOG_ERROR("解码输出缓冲区不足: 需要" + std::to_string(messageLength) +
+                  "字节, 实际" + std::to_string(capacity) + "字节");
+        return false;
+    }
+    
+    uint8_t* codewords = deinterleaved + frame_header_length;
+    
+    // 3. 解密（如果有密钥），只解密帧头指明长度的密文，在暂存区原地解密
+    if (!encryptionKey.empty()) {
+        size_t decryptedLength = 0;
+        if (!aesEncoder->decrypt(codewords, payloadLength, encryptionKey, codewords, decryptedLength) ||
+            decryptedLength != codewordLength) {
+            LOG_ERROR("AES解密失败: 密文格式无效");
             return false;
         }
-        
-        rawData = processedData;
-        return true;
-    } catch (const std::exception& e) {
-        // 记录错误
-        // Logger::error("数据解码失败: " + std::string(e.what()));
+    }
+    
+    // 4. Reed-Solomon解码：完整的块直接写入调用方缓冲区，最后一块在栈上解码后只复制有效部分
+    const size_t fullBlocks = messageLength / pipeline_data_length;
+    if (context->decodeBatch(codewords, fullBlocks, rawData, nullptr, nullptr) != fullBlocks) {
+        LOG_ERROR("RS解码失败");
         return false;
     }
+    
+    if (fullBlocks < blockCount) {
+        uint8_t lastBlock[pipeline_code_length];
+        std::memcpy(lastBlock, codewords + fullBlocks * pipeline_code_length, pipeline_code_length);
+        if (!context->decode(lastBlock)) {
+            LOG_ERROR("RS解码失败");
+            return false;
+        }
+        std::memcpy(rawData + fullBlocks * pipeline_data_length, lastBlock,
+                    messageLength - fullBlocks * pipeline_data_length);
+    }
+    
+    rawLength = messageLength;
+    return true;
 }
 
 // Reed-Solomon编码
@@ -190,6 +400,38 @@ bool CodingProcessor::rsDecode(const std::string& encodedData, std::string& data
     }
 }
 
+// Reed-Solomon批量编码
+size_t CodingProcessor::rsEncodeBatch(const uint8_t* messages, size_t count, uint8_t* codewords,
+                                      int codeLength, int dataLength) {
+    if (!initialized || !messages || !codewords) {
+        return 0;
+    }
+    
+    // 直接使用缓存的只读上下文，不修改rsEncoder的参数，可多线程调用
+    auto context = error_correction::RSCodecCache::getInstance().get(codeLength, dataLength);
+    if (!context) {
+        return 0;
+    }
+    
+    return context->encodeBatch(messages, count, codewords);
+}
+
+// Reed-Solomon批量解码
+size_t CodingProcessor::rsDecodeBatch(const uint8_t* codewords, size_t count, uint8_t* messages,
+                                      int* correctedSymbols, bool* failed,
+                                      int codeLength, int dataLength) {
+    if (!initialized || !codewords || !messages) {
+        return 0;
+    }
+    
+    auto context = error_correction::RSCodecCache::getInstance().get(codeLength, dataLength);
+    if (!context) {
+        return 0;
+    }
+    
+    return context->decodeBatch(codewords, count, messages, correctedSymbols, failed);
+}
+
 // AES加密
 bool CodingProcessor::aesEncrypt(const std::string& plaintext, const std::string& key, std::string& ciphertext) {
     if (!initialized) {
@@ -226,6 +468,26 @@ bool CodingProcessor::aesDecrypt(const std::string& ciphertext, const std::strin
     }
 }
 
+// AES-CTR批量加密
+size_t CodingProcessor::aesEncryptBatch(const uint8_t* messages, size_t count, size_t messageLength,
+                                        uint8_t* ciphertexts, const std::string& key, uint64_t nonce) {
+    if (!initialized || !messages || !ciphertexts) {
+        return 0;
+    }
+    
+    return aesEncoder->encryptBatchCTR(messages, count, messageLength, ciphertexts, key, nonce);
+}
+
+// AES-CTR批量解密
+size_t CodingProcessor::aesDecryptBatch(const uint8_t* ciphertexts, size_t count, size_t messageLength,
+                                        uint8_t* messages, const std::string& key, uint64_t nonce) {
+    if (!initialized || !ciphertexts || !messages) {
+        return 0;
+    }
+    
+    return aesEncoder->decryptBatchCTR(ciphertexts, count, messageLength, messages, key, nonce);
+}
+
 // 交织
 bool CodingProcessor::interleave(const std::string& data, std::string& interleavedData, int rows, int cols) {
     if (!initialized) {
@@ -234,7 +496,7 @@ bool CodingProcessor::interleave(const std::string& data, std::string& interleav
     
     try {
         // 设置交织参数
-        dynamic_cast<interleaving::MatrixInterleaver*>(interleaver.get())->setDimensions(rows, cols);
+        interleaver->setParameters(rows, cols);
         
         // 执行交织
         interleavedData = interleaver->interleave(data);
@@ -255,7 +517,7 @@ bool CodingProcessor::deinterleave(const std::string& interleavedData, std::stri
     
     try {
         // 设置交织参数
-        dynamic_cast<interleaving::MatrixInterleaver*>(interleaver.get())->setDimensions(rows, cols);
+        interleaver->setParameters(rows, cols);
         
         // 执行解交织
         data = interleaver->deinterleave(interleavedData);
@@ -397,5 +659,63 @@ uint32_t CodingProcessor::calculateCRC32(const std::string& data) {
     }
 }
 
+// CRC校验计算(原始缓冲区)
+uint32_t CodingProcessor::calculateCRC32(const uint8_t* data, size_t length) {
+    if (!initialized || (!data && length > 0)) {
+        return 0;
+    }
+    
+    return error_detection::calculateCRC32(data, length);
+}
+
+// CRC校验追加计算
+uint32_t CodingProcessor::updateCRC32(uint32_t crc, const uint8_t* data, size_t length) {
+    if (!initialized || (!data && length > 0)) {
+        return crc;
+    }
+    
+    return error_detection::updateCRC32(crc, data, length);
+}
+
+// 分块读取文件计算CRC32
+bool CodingProcessor::calculateFileCRC32(const std::string& path, uint32_t& crc) {
+    if (!initialized) {
+        return false;
+    }
+    
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        LOG_ERROR("无法打开文件: " + path);
+        return false;
+    }
+    
+    // 固定大小的块缓冲区，与文件大小无关
+    const size_t chunk_size = 1 << 20;
+    std::vector<uint8_t> chunk(chunk_size);
+    error_detection::CRC32Stream stream;
+    
+    while (file) {
+        file.read(reinterpret_cast<char*>(chunk.data()), chunk_size);
+        stream.update(chunk.data(), static_cast<size_t>(file.gcount()));
+    }
+    
+    if (file.bad()) {
+        LOG_ERROR("读取文件失败: " + path);
+        return false;
+    }
+    
+    crc = stream.finalize();
+    return true;
+}
+
+// CRC校验验证
+bool CodingProcessor::verifyCRC32(const std::string& data, uint32_t crc) {
+    if (!initialized) {
+        return false;
+    }
+    
+    return calculateCRC32(data) == crc;
+}
+
 } // namespace coding
 } // namespace link16
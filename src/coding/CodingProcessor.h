@@ -3,15 +3,24 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <cstdint>
 
 namespace link16 {
 namespace coding {
 
 // 前向声明
-class ReedSolomon;
+namespace error_correction {
+class RSCoder;
+}
+namespace crypto {
 class AESCrypto;
-class Interleaver;
+}
+namespace interleaving {
+class MatrixInterleaver;
+}
+namespace error_detection {
 class BIPCoder;
+}
 
 /**
  * @brief 编码层处理器接口
@@ -24,7 +33,7 @@ public:
     // 析构函数
     virtual ~CodingProcessor();
     
-    // 初始化
+    // 初始化，同时预先构建RS(31,15)和RS(16,7)编解码上下文
     bool initialize();
     
     // 关闭
@@ -36,18 +45,50 @@ public:
     // 解码数据
     bool decodeData(const std::string& encodedData, std::string& rawData);
     
+    // 计算编码后的字节数(长度帧头 + RS(31,15) -> 可选AES -> 8x8交织)
+    size_t getEncodedLength(size_t rawLength) const;
+    
+    // 计算解码输出缓冲区所需的字节数
+    size_t getDecodedCapacity(size_t encodedLength) const;
+    
+    // 编码数据到调用方缓冲区，中间结果使用每线程复用的暂存区，稳态下不分配堆内存，
+    // 输出与字符串版本逐字节相同。帧以一个不加密的RS码字开头，记录原始数据长度
+    bool encodeData(const uint8_t* rawData, size_t length,
+                    uint8_t* encodedData, size_t capacity, size_t& encodedLength);
+    
+    // 解码数据到调用方缓冲区，按帧头记录的长度去掉交织填充和RS填充，稳态下不分配堆内存
+    bool decodeData(const uint8_t* encodedData, size_t length,
+                    uint8_t* rawData, size_t capacity, size_t& rawLength);
+    
     // Reed-Solomon编码
     bool rsEncode(const std::string& data, std::string& encodedData, int codeLength = 31, int dataLength = 15);
     
     // Reed-Solomon解码
     bool rsDecode(const std::string& encodedData, std::string& data, int codeLength = 31, int dataLength = 15);
     
+    // Reed-Solomon批量编码，count条消息连续存放，码字写入调用方提供的缓冲区，返回成功数量
+    size_t rsEncodeBatch(const uint8_t* messages, size_t count, uint8_t* codewords,
+                         int codeLength = 31, int dataLength = 15);
+    
+    // Reed-Solomon批量解码，输出每个码字的纠正符号数和失败标志，返回成功数量
+    size_t rsDecodeBatch(const uint8_t* codewords, size_t count, uint8_t* messages,
+                         int* correctedSymbols = nullptr, bool* failed = nullptr,
+                         int codeLength = 31, int dataLength = 15);
+    
     // AES加密
     bool aesEncrypt(const std::string& plaintext, const std::string& key, std::string& ciphertext);
     
     // AES解密
     bool aesDecrypt(const std::string& ciphertext, const std::string& key, std::string& plaintext);
     
+    // AES-CTR批量加密，count条等长消息连续存放，消息i的计数器由nonce和序号i构成，返回成功数量
+    size_t aesEncryptBatch(const uint8_t* messages, size_t count, size_t messageLength,
+                           uint8_t* ciphertexts, const std::string& key, uint64_t nonce);
+    
+    // AES-CTR批量解密，参数与aesEncryptBatch相同
+    size_t aesDecryptBatch(const uint8_t* ciphertexts, size_t count, size_t messageLength,
+                           uint8_t* messages, const std::string& key, uint64_t nonce);
+    
     // 交织
     bool interleave(const std::string& data, std::string& interleavedData, int rows = 8, int cols = 8);
     
@@ -80,6 +121,15 @@ public:
     // CRC校验计算
     uint32_t calculateCRC32(const std::string& data);
     
+    // CRC校验计算(原始缓冲区)
+    uint32_t calculateCRC32(const uint8_t* data, size_t length);
+    
+    // CRC校验追加计算，crc为之前数据的CRC32，首次传入0
+    uint32_t updateCRC32(uint32_t crc, const uint8_t* data, size_t length);
+    
+    // 分块读取文件计算CRC32，不将整个文件读入内存
+    bool calculateFileCRC32(const std::string& path, uint32_t& crc);
+    
     // CRC校验验证
     bool verifyCRC32(const std::string& data, uint32_t crc);
 
@@ -93,7 +143,7 @@ private:
     // 组件实例
     std::unique_ptr<error_correction::RSCoder> rsEncoder;
     std::unique_ptr<crypto::AESCrypto> aesEncoder;
-    std::unique_ptr<interleaving::Interleaver> interleaver;
+    std::unique_ptr<interleaving::MatrixInterleaver> interleaver;
     std::unique_ptr<error_detection::BIPCoder> bipCoder;
 };
 
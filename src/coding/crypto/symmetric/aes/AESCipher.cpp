@@ -0,0 +1,841 @@
+#include "AESCipher.h"
+#include "core/utils/cpuFeatures.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#if defined(LINK16_ARCH_X86)
+    #include <immintrin.h>
+#endif
+
+namespace link16 {
+namespace coding {
+namespace crypto {
+
+namespace {
+
+// CTR模式每次生成的密钥流分组数
+const size_t ctr_chunk_blocks = 32;
+
+inline uint32_t loadBigEndian32(const uint8_t* bytes) {
+    return (static_cast<uint32_t>(bytes[0]) << 24) |
+           (static_cast<uint32_t>(bytes[1]) << 16) |
+           (static_cast<uint32_t>(bytes[2]) << 8) |
+           static_cast<uint32_t>(bytes[3]);
+}
+
+inline void storeBigEndian32(uint8_t* bytes, uint32_t value) {
+    bytes[0] = static_cast<uint8_t>(value >> 24);
+    bytes[1] = static_cast<uint8_t>(value >> 16);
+    bytes[2] = static_cast<uint8_t>(value >> 8);
+    bytes[3] = static_cast<uint8_t>(value);
+}
+
+inline uint64_t loadBigEndian64(const uint8_t* bytes) {
+    return (static_cast<uint64_t>(loadBigEndian32(bytes)) << 32) | loadBigEndian32(bytes + 4);
+}
+
+inline void storeBigEndian64(uint8_t* bytes, uint64_t value) {
+    storeBigEndian32(bytes, static_cast<uint32_t>(value >> 32));
+    storeBigEndian32(bytes + 4, static_cast<uint32_t>(value));
+}
+
+inline uint32_t rotateRight(uint32_t value, int bits) {
+    return (value >> bits) | (value << (32 - bits));
+}
+
+// GF(2^8)乘以x
+inline uint8_t xtime(uint8_t b) {
+    return static_cast<uint8_t>((b << 1) ^ ((b & 0x80) ? 0x1B : 0x00));
+}
+
+// GF(2^8)乘法
+uint8_t multiply(uint8_t a, uint8_t b) {
+    uint8_t result = 0;
+    while (b) {
+        if (b & 1) {
+            result ^= a;
+        }
+        a = xtime(a);
+        b >>= 1;
+    }
+    return result;
+}
+
+/**
+ * AES查找表
+ * te[k][x]为S盒输出经MixColumns后对第k行的贡献，td为解密方向的对应表，
+ * 每轮只需16次查表和异或。
+ */
+struct AESTables {
+    uint8_t sbox[256];
+    uint8_t invSbox[256];
+    uint32_t te[4][256];
+    uint32_t td[4][256];
+
+    AESTables() {
+        // 以3为生成元构造GF(2^8)的指数表，求逆元后做仿射变换
+        uint8_t exp[256];
+        uint8_t log[256] = {0};
+        uint8_t value = 1;
+        for (int i = 0; i < 255; ++i) {
+            exp[i] = value;
+            log[value] = static_cast<uint8_t>(i);
+            value = static_cast<uint8_t>(value ^ xtime(value));
+        }
+
+        for (int x = 0; x < 256; ++x) {
+            const uint8_t inverse = x == 0 ? 0 : exp[(255 - log[x]) % 255];
+            uint8_t s = inverse;
+            for (int shift = 1; shift <= 4; ++shift) {
+                s ^= static_cast<uint8_t>((inverse << shift) | (inverse >> (8 - shift)));
+            }
+            s ^= 0x63;
+            sbox[x] = s;
+            invSbox[s] = static_cast<uint8_t>(x);
+        }
+
+        for (int x = 0; x < 256; ++x) {
+            const uint8_t s = sbox[x];
+            const uint8_t i = invSbox[x];
+            te[0][x] = (static_cast<uint32_t>(multiply(s, 2)) << 24) | (static_cast<uint32_t>(s) << 16) |
+                       (static_cast<uint32_t>(s) << 8) | multiply(s, 3);
+            td[0][x] = (static_cast<uint32_t>(multiply(i, 14)) << 24) |
+                       (static_cast<uint32_t>(multiply(i, 9)) << 16) |
+                       (static_cast<uint32_t>(multiply(i, 13)) << 8) | multiply(i, 11);
+            for (int k = 1; k < 4; ++k) {
+                te[k][x] = rotateRight(te[0][x], 8 * k);
+                td[k][x] = rotateRight(td[0][x], 8 * k);
+            }
+        }
+    }
+};
+
+const AESTables& aesTables() {
+    static const AESTables tables;
+    return tables;
+}
+
+inline uint32_t subWord(const AESTables& t, uint32_t word) {
+    return (static_cast<uint32_t>(t.sbox[word >> 24]) << 24) |
+           (static_cast<uint32_t>(t.sbox[(word >> 16) & 0xFF]) << 16) |
+           (static_cast<uint32_t>(t.sbox[(word >> 8) & 0xFF]) << 8) |
+           t.sbox[word & 0xFF];
+}
+
+// 对轮密钥字做InvMixColumns：td[k][sbox[b]]恰好是InvMixColumns对字节b的贡献
+inline uint32_t invMixColumn(const AESTables& t, uint32_t word) {
+    return t.td[0][t.sbox[word >> 24]] ^ t.td[1][t.sbox[(word >> 16) & 0xFF]] ^
+           t.td[2][t.sbox[(word >> 8) & 0xFF]] ^ t.td[3][t.sbox[word & 0xFF]];
+}
+
+// 查表加密一个分组
+void encryptBlockPortable(const uint8_t* roundKeys, int rounds, const uint8_t* input, uint8_t* output) {
+    const AESTables& t = aesTables();
+    const uint8_t* rk = roundKeys;
+
+    uint32_t s0 = loadBigEndian32(input) ^ loadBigEndian32(rk);
+    uint32_t s1 = loadBigEndian32(input + 4) ^ loadBigEndian32(rk + 4);
+    uint32_t s2 = loadBigEndian32(input + 8) ^ loadBigEndian32(rk + 8);
+    uint32_t s3 = loadBigEndian32(input + 12) ^ loadBigEndian32(rk + 12);
+
+    for (int r = 1; r < rounds; ++r) {
+        rk += 16;
+        const uint32_t t0 = t.te[0][s0 >> 24] ^ t.te[1][(s1 >> 16) & 0xFF] ^
+                            t.te[2][(s2 >> 8) & 0xFF] ^ t.te[3][s3 & 0xFF] ^ loadBigEndian32(rk);
+        const uint32_t t1 = t.te[0][s1 >> 24] ^ t.te[1][(s2 >> 16) & 0xFF] ^
+                            t.te[2][(s3 >> 8) & 0xFF] ^ t.te[3][s0 & 0xFF] ^ loadBigEndian32(rk + 4);
+        const uint32_t t2 = t.te[0][s2 >> 24] ^ t.te[1][(s3 >> 16) & 0xFF] ^
+                            t.te[2][(s0 >> 8) & 0xFF] ^ t.te[3][s1 & 0xFF] ^ loadBigEndian32(rk + 8);
+        const uint32_t t3 = t.te[0][s3 >> 24] ^ t.te[1][(s0 >> 16) & 0xFF] ^
+                            t.te[2][(s1 >> 8) & 0xFF] ^ t.te[3][s2 & 0xFF] ^ loadBigEndian32(rk + 12);
+        s0 = t0;
+        s1 = t1;
+        s2 = t2;
+        s3 = t3;
+    }
+
+    // 最后一轮没有MixColumns
+    rk += 16;
+    const uint32_t state[4] = {s0, s1, s2, s3};
+    for (int c = 0; c < 4; ++c) {
+        const uint32_t word = (static_cast<uint32_t>(t.sbox[state[c] >> 24]) << 24) |
+                              (static_cast<uint32_t>(t.sbox[(state[(c + 1) & 3] >> 16) & 0xFF]) << 16) |
+                              (static_cast<uint32_t>(t.sbox[(state[(c + 2) & 3] >> 8) & 0xFF]) << 8) |
+                              t.sbox[state[(c + 3) & 3] & 0xFF];
+        storeBigEndian32(output + 4 * c, word ^ loadBigEndian32(rk + 4 * c));
+    }
+}
+
+// 查表解密一个分组(等价逆密码)
+void decryptBlockPortable(const uint8_t* roundKeys, int rounds, const uint8_t* input, uint8_t* output) {
+    const AESTables& t = aesTables();
+    const uint8_t* rk = roundKeys;
+
+    uint32_t s0 = loadBigEndian32(input) ^ loadBigEndian32(rk);
+    uint32_t s1 = loadBigEndian32(input + 4) ^ loadBigEndian32(rk + 4);
+    uint32_t s2 = loadBigEndian32(input + 8) ^ loadBigEndian32(rk + 8);
+    uint32_t s3 = loadBigEndian32(input + 12) ^ loadBigEndian32(rk + 12);
+
+    for (int r = 1; r < rounds; ++r) {
+        rk += 16;
+        const uint32_t t0 = t.td[0][s0 >> 24] ^ t.td[1][(s3 >> 16) & 0xFF] ^
+                            t.td[2][(s2 >> 8) & 0xFF] ^ t.td[3][s1 & 0xFF] ^ loadBigEndian32(rk);
+        const uint32_t t1 = t.td[0][s1 >> 24] ^ t.td[1][(s0 >> 16) & 0xFF] ^
+                            t.td[2][(s3 >> 8) & 0xFF] ^ t.td[3][s2 & 0xFF] ^ loadBigEndian32(rk + 4);
+        const uint32_t t2 = t.td[0][s2 >> 24] ^ t.td[1][(s1 >> 16) & 0xFF] ^
+                            t.td[2][(s0 >> 8) & 0xFF] ^ t.td[3][s3 & 0xFF] ^ loadBigEndian32(rk + 8);
+        const uint32_t t3 = t.td[0][s3 >> 24] ^ t.td[1][(s2 >> 16) & 0xFF] ^
+                            t.td[2][(s1 >> 8) & 0xFF] ^ t.td[3][s0 & 0xFF] ^ loadBigEndian32(rk + 12);
+        s0 = t0;
+        s1 = t1;
+        s2 = t2;
+        s3 = t3;
+    }
+
+    rk += 16;
+    const uint32_t state[4] = {s0, s1, s2, s3};
+    for (int c = 0; c < 4; ++c) {
+        const uint32_t word = (static_cast<uint32_t>(t.invSbox[state[c] >> 24]) << 24) |
+                              (static_cast<uint32_t>(t.invSbox[(state[(c + 3) & 3] >> 16) & 0xFF]) << 16) |
+                              (static_cast<uint32_t>(t.invSbox[(state[(c + 2) & 3] >> 8) & 0xFF]) << 8) |
+                              t.invSbox[state[(c + 1) & 3] & 0xFF];
+        storeBigEndian32(output + 4 * c, word ^ loadBigEndian32(rk + 4 * c));
+    }
+}
+
+// 128位大端计数器加1
+inline void incrementCounter(uint64_t& hi, uint64_t& lo) {
+    if (++lo == 0) {
+        ++hi;
+    }
+}
+
+// 128位分组，hi为前8字节(大端)
+struct Block128 {
+    uint64_t hi;
+    uint64_t lo;
+};
+
+// GF(2^128)乘法(NIST SP 800-38D算法1，按位处理)
+void gfMultiply(Block128& x, const Block128& h) {
+    Block128 z = {0, 0};
+    Block128 v = h;
+    for (int i = 0; i < 128; ++i) {
+        const uint64_t bit = i < 64 ? (x.hi >> (63 - i)) & 1 : (x.lo >> (127 - i)) & 1;
+        if (bit) {
+            z.hi ^= v.hi;
+            z.lo ^= v.lo;
+        }
+        const bool carry = v.lo & 1;
+        v.lo = (v.lo >> 1) | (v.hi << 63);
+        v.hi >>= 1;
+        if (carry) {
+            v.hi ^= 0xE100000000000000ULL;
+        }
+    }
+    x = z;
+}
+
+void ghashUpdatePortable(Block128& x, const Block128& h, const uint8_t* data, size_t length) {
+    while (length >= 16) {
+        x.hi ^= loadBigEndian64(data);
+        x.lo ^= loadBigEndian64(data + 8);
+        gfMultiply(x, h);
+        data += 16;
+        length -= 16;
+    }
+    if (length > 0) {
+        uint8_t block[16] = {0};
+        std::memcpy(block, data, length);
+        x.hi ^= loadBigEndian64(block);
+        x.lo ^= loadBigEndian64(block + 8);
+        gfMultiply(x, h);
+    }
+}
+
+void ghashPortable(const uint8_t* hashKey, const uint8_t* aad, size_t aadLength,
+                   const uint8_t* ciphertext, size_t length, uint8_t* result) {
+    const Block128 h = {loadBigEndian64(hashKey), loadBigEndian64(hashKey + 8)};
+    Block128 x = {0, 0};
+    ghashUpdatePortable(x, h, aad, aadLength);
+    ghashUpdatePortable(x, h, ciphertext, length);
+    x.hi ^= static_cast<uint64_t>(aadLength) * 8;
+    x.lo ^= static_cast<uint64_t>(length) * 8;
+    gfMultiply(x, h);
+    storeBigEndian64(result, x.hi);
+    storeBigEndian64(result + 8, x.lo);
+}
+
+#if defined(LINK16_ARCH_X86)
+
+// 加载轮密钥
+LINK16_TARGET("aes,ssse3")
+inline void loadRoundKeys(const uint8_t* roundKeys, int rounds, __m128i* k) {
+    for (int r = 0; r <= rounds; ++r) {
+        k[r] = _mm_load_si128(reinterpret_cast<const __m128i*>(roundKeys + 16 * r));
+    }
+}
+
+// 8个分组交错执行各轮以隐藏aesenc的延迟，b[j]输入前已与首轮密钥异或
+LINK16_TARGET("aes,ssse3")
+inline void encryptEight(const __m128i* k, int rounds, __m128i* b) {
+    for (int r = 1; r < rounds; ++r) {
+        const __m128i key = k[r];
+        b[0] = _mm_aesenc_si128(b[0], key);
+        b[1] = _mm_aesenc_si128(b[1], key);
+        b[2] = _mm_aesenc_si128(b[2], key);
+        b[3] = _mm_aesenc_si128(b[3], key);
+        b[4] = _mm_aesenc_si128(b[4], key);
+        b[5] = _mm_aesenc_si128(b[5], key);
+        b[6] = _mm_aesenc_si128(b[6], key);
+        b[7] = _mm_aesenc_si128(b[7], key);
+    }
+    for (int j = 0; j < 8; ++j) {
+        b[j] = _mm_aesenclast_si128(b[j], k[rounds]);
+    }
+}
+
+LINK16_TARGET("aes,ssse3")
+inline void decryptEight(const __m128i* k, int rounds, __m128i* b) {
+    for (int r = 1; r < rounds; ++r) {
+        const __m128i key = k[r];
+        b[0] = _mm_aesdec_si128(b[0], key);
+        b[1] = _mm_aesdec_si128(b[1], key);
+        b[2] = _mm_aesdec_si128(b[2], key);
+        b[3] = _mm_aesdec_si128(b[3], key);
+        b[4] = _mm_aesdec_si128(b[4], key);
+        b[5] = _mm_aesdec_si128(b[5], key);
+        b[6] = _mm_aesdec_si128(b[6], key);
+        b[7] = _mm_aesdec_si128(b[7], key);
+    }
+    for (int j = 0; j < 8; ++j) {
+        b[j] = _mm_aesdeclast_si128(b[j], k[rounds]);
+    }
+}
+
+LINK16_TARGET("aes,ssse3")
+inline __m128i encryptOne(const __m128i* k, int rounds, __m128i b) {
+    b = _mm_xor_si128(b, k[0]);
+    for (int r = 1; r < rounds; ++r) {
+        b = _mm_aesenc_si128(b, k[r]);
+    }
+    return _mm_aesenclast_si128(b, k[rounds]);
+}
+
+LINK16_TARGET("aes,ssse3")
+inline __m128i decryptOne(const __m128i* k, int rounds, __m128i b) {
+    b = _mm_xor_si128(b, k[0]);
+    for (int r = 1; r < rounds; ++r) {
+        b = _mm_aesdec_si128(b, k[r]);
+    }
+    return _mm_aesdeclast_si128(b, k[rounds]);
+}
+
+// 计数器转换为大端分组
+LINK16_TARGET("aes,ssse3")
+inline __m128i counterBlock(uint64_t hi, uint64_t lo, __m128i reverse) {
+    return _mm_shuffle_epi8(_mm_set_epi64x(static_cast<long long>(hi), static_cast<long long>(lo)), reverse);
+}
+
+// AES-NI ECB加密
+LINK16_TARGET("aes,ssse3")
+void encryptBlocksAesni(const uint8_t* roundKeys, int rounds, const uint8_t* input, uint8_t* output,
+                        size_t blockCount) {
+    __m128i k[15];
+    loadRoundKeys(roundKeys, rounds, k);
+
+    size_t i = 0;
+    for (; i + 8 <= blockCount; i += 8) {
+        const __m128i* in = reinterpret_cast<const __m128i*>(input + 16 * i);
+        __m128i* out = reinterpret_cast<__m128i*>(output + 16 * i);
+        __m128i b[8];
+        for (int j = 0; j < 8; ++j) {
+            b[j] = _mm_xor_si128(_mm_loadu_si128(in + j), k[0]);
+        }
+        encryptEight(k, rounds, b);
+        for (int j = 0; j < 8; ++j) {
+            _mm_storeu_si128(out + j, b[j]);
+        }
+    }
+
+    for (; i < blockCount; ++i) {
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 16 * i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 16 * i), encryptOne(k, rounds, b));
+    }
+}
+
+// AES-NI ECB解密，解密轮密钥与查表实现相同(等价逆密码)
+LINK16_TARGET("aes,ssse3")
+void decryptBlocksAesni(const uint8_t* roundKeys, int rounds, const uint8_t* input, uint8_t* output,
+                        size_t blockCount) {
+    __m128i k[15];
+    loadRoundKeys(roundKeys, rounds, k);
+
+    size_t i = 0;
+    for (; i + 8 <= blockCount; i += 8) {
+        const __m128i* in = reinterpret_cast<const __m128i*>(input + 16 * i);
+        __m128i* out = reinterpret_cast<__m128i*>(output + 16 * i);
+        __m128i b[8];
+        for (int j = 0; j < 8; ++j) {
+            b[j] = _mm_xor_si128(_mm_loadu_si128(in + j), k[0]);
+        }
+        decryptEight(k, rounds, b);
+        for (int j = 0; j < 8; ++j) {
+            _mm_storeu_si128(out + j, b[j]);
+        }
+    }
+
+    for (; i < blockCount; ++i) {
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 16 * i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 16 * i), decryptOne(k, rounds, b));
+    }
+}
+
+// 密钥流与输入异或，bytes不足16时逐字节处理
+LINK16_TARGET("aes,ssse3")
+inline void xorKeystream(__m128i keystream, const uint8_t* input, uint8_t* output, size_t bytes) {
+    if (bytes == 16) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output),
+                         _mm_xor_si128(keystream, _mm_loadu_si128(reinterpret_cast<const __m128i*>(input))));
+        return;
+    }
+    uint8_t block[16];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(block), keystream);
+    for (size_t j = 0; j < bytes; ++j) {
+        output[j] = input[j] ^ block[j];
+    }
+}
+
+// AES-NI CTR模式，计数器保存在寄存器中，密钥流直接与输入异或
+LINK16_TARGET("aes,ssse3")
+void cryptCTRAesni(const uint8_t* roundKeys, int rounds, uint64_t hi, uint64_t lo,
+                   const uint8_t* input, uint8_t* output, size_t length) {
+    __m128i k[15];
+    loadRoundKeys(roundKeys, rounds, k);
+    const __m128i reverse = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    for (; length >= 128; length -= 128, input += 128, output += 128) {
+        __m128i b[8];
+        for (int j = 0; j < 8; ++j) {
+            b[j] = _mm_xor_si128(counterBlock(hi, lo, reverse), k[0]);
+            incrementCounter(hi, lo);
+        }
+        encryptEight(k, rounds, b);
+        for (int j = 0; j < 8; ++j) {
+            xorKeystream(b[j], input + 16 * j, output + 16 * j, 16);
+        }
+    }
+
+    for (; length > 0; input += 16, output += 16) {
+        const size_t bytes = std::min<size_t>(length, 16);
+        xorKeystream(encryptOne(k, rounds, counterBlock(hi, lo, reverse)), input, output, bytes);
+        incrementCounter(hi, lo);
+        length -= bytes;
+    }
+}
+
+// AES-NI批量CTR，各消息的分组连续编号后每次8个一起加密
+LINK16_TARGET("aes,ssse3")
+void cryptCTRBatchAesni(const uint8_t* roundKeys, int rounds, uint64_t nonce, const uint8_t* messages,
+                        size_t count, size_t messageLength, uint8_t* output) {
+    __m128i k[15];
+    loadRoundKeys(roundKeys, rounds, k);
+    const __m128i reverse = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const size_t blocksPerMessage = (messageLength + 15) / 16;
+    const size_t totalBlocks = blocksPerMessage * count;
+
+    size_t message = 0;
+    size_t block = 0;
+    for (size_t done = 0; done < totalBlocks;) {
+        const size_t n = std::min<size_t>(8, totalBlocks - done);
+        __m128i b[8];
+        size_t offsets[8];
+        size_t bytes[8];
+        for (size_t j = 0; j < 8; ++j) {
+            b[j] = _mm_xor_si128(counterBlock(nonce, (static_cast<uint64_t>(message) << 32) | block, reverse),
+                                 k[0]);
+            if (j < n) {
+                offsets[j] = message * messageLength + block * 16;
+                bytes[j] = std::min<size_t>(16, messageLength - block * 16);
+                if (++block == blocksPerMessage) {
+                    block = 0;
+                    ++message;
+                }
+            }
+        }
+        encryptEight(k, rounds, b);
+        for (size_t j = 0; j < n; ++j) {
+            xorKeystream(b[j], messages + offsets[j], output + offsets[j], bytes[j]);
+        }
+        done += n;
+    }
+}
+
+/**
+ * GF(2^128)乘法(Intel白皮书《Carry-Less Multiplication and Its Usage for Computing the GCM Mode》算法)
+ * 输入为字节反序后的分组，结果在同一表示下。
+ */
+LINK16_TARGET("pclmul,ssse3")
+inline __m128i gfMultiplyPclmul(__m128i a, __m128i b) {
+    __m128i lo = _mm_clmulepi64_si128(a, b, 0x00);
+    __m128i mid = _mm_xor_si128(_mm_clmulepi64_si128(a, b, 0x10), _mm_clmulepi64_si128(a, b, 0x01));
+    __m128i hi = _mm_clmulepi64_si128(a, b, 0x11);
+    lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+    hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+
+    // 256位乘积整体左移1位(位反射表示)
+    __m128i carryLo = _mm_srli_epi32(lo, 31);
+    __m128i carryHi = _mm_srli_epi32(hi, 31);
+    lo = _mm_slli_epi32(lo, 1);
+    hi = _mm_slli_epi32(hi, 1);
+    const __m128i carryOut = _mm_srli_si128(carryLo, 12);
+    carryHi = _mm_slli_si128(carryHi, 4);
+    carryLo = _mm_slli_si128(carryLo, 4);
+    lo = _mm_or_si128(lo, carryLo);
+    hi = _mm_or_si128(_mm_or_si128(hi, carryHi), carryOut);
+
+    // 模x^128 + x^7 + x^2 + x + 1约简
+    __m128i t = _mm_xor_si128(_mm_xor_si128(_mm_slli_epi32(lo, 31), _mm_slli_epi32(lo, 30)),
+                              _mm_slli_epi32(lo, 25));
+    const __m128i tHigh = _mm_srli_si128(t, 4);
+    t = _mm_slli_si128(t, 12);
+    lo = _mm_xor_si128(lo, t);
+    __m128i u = _mm_xor_si128(_mm_xor_si128(_mm_srli_epi32(lo, 1), _mm_srli_epi32(lo, 2)),
+                              _mm_srli_epi32(lo, 7));
+    u = _mm_xor_si128(u, tHigh);
+    lo = _mm_xor_si128(lo, u);
+    return _mm_xor_si128(hi, lo);
+}
+
+LINK16_TARGET("pclmul,ssse3")
+__m128i ghashUpdatePclmul(__m128i x, __m128i h, const uint8_t* data, size_t length) {
+    const __m128i reverse = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    while (length >= 16) {
+        const __m128i block = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), reverse);
+        x = gfMultiplyPclmul(_mm_xor_si128(x, block), h);
+        data += 16;
+        length -= 16;
+    }
+    if (length > 0) {
+        uint8_t padded[16] = {0};
+        std::memcpy(padded, data, length);
+        const __m128i block = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(padded)), reverse);
+        x = gfMultiplyPclmul(_mm_xor_si128(x, block), h);
+    }
+    return x;
+}
+
+LINK16_TARGET("pclmul,ssse3")
+void ghashPclmul(const uint8_t* hashKey, const uint8_t* aad, size_t aadLength,
+                 const uint8_t* ciphertext, size_t length, uint8_t* result) {
+    const __m128i reverse = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m128i h = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hashKey)), reverse);
+    __m128i x = _mm_setzero_si128();
+    x = ghashUpdatePclmul(x, h, aad, aadLength);
+    x = ghashUpdatePclmul(x, h, ciphertext, length);
+
+    uint8_t lengths[16];
+    storeBigEndian64(lengths, static_cast<uint64_t>(aadLength) * 8);
+    storeBigEndian64(lengths + 8, static_cast<uint64_t>(length) * 8);
+    x = ghashUpdatePclmul(x, h, lengths, 16);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(result), _mm_shuffle_epi8(x, reverse));
+}
+
+#endif
+
+// 不支持的内核退回到查表实现
+AESKernelType resolveKernel(AESKernelType kernel) {
+    return isAESKernelSupported(kernel) ? kernel : AESKernelType::PORTABLE;
+}
+
+std::atomic<AESKernelType>& defaultKernel() {
+    static std::atomic<AESKernelType> kernel(detectAESKernel());
+    return kernel;
+}
+
+inline void xorBytes(const uint8_t* a, const uint8_t* b, uint8_t* output, size_t length) {
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        uint64_t x;
+        uint64_t y;
+        std::memcpy(&x, a + i, 8);
+        std::memcpy(&y, b + i, 8);
+        x ^= y;
+        std::memcpy(output + i, &x, 8);
+    }
+    for (; i < length; ++i) {
+        output[i] = a[i] ^ b[i];
+    }
+}
+
+} // namespace
+
+// 获取内核名称
+const char* getAESKernelName(AESKernelType type) {
+    switch (type) {
+        case AESKernelType::PORTABLE: return "portable";
+        case AESKernelType::AESNI:    return "aes-ni";
+    }
+    return "unknown";
+}
+
+// 检查当前CPU是否支持该内核
+bool isAESKernelSupported(AESKernelType type) {
+    switch (type) {
+        case AESKernelType::PORTABLE:
+            return true;
+        case AESKernelType::AESNI:
+#if defined(LINK16_ARCH_X86)
+            return utils::CpuFeatures::get().aesni;
+#else
+            return false;
+#endif
+    }
+    return false;
+}
+
+// 获取当前CPU支持的最快内核
+AESKernelType detectAESKernel() {
+    if (isAESKernelSupported(AESKernelType::AESNI)) {
+        return AESKernelType::AESNI;
+    }
+    return AESKernelType::PORTABLE;
+}
+
+// 设置默认AES内核
+void setAESKernel(AESKernelType type) {
+    defaultKernel().store(resolveKernel(type), std::memory_order_relaxed);
+}
+
+// 获取默认AES内核
+AESKernelType getAESKernel() {
+    return defaultKernel().load(std::memory_order_relaxed);
+}
+
+const size_t AESCipher::block_size;
+
+// 构造函数
+AESCipher::AESCipher() : rounds(0) {
+    std::memset(encryptKeys, 0, sizeof(encryptKeys));
+    std::memset(decryptKeys, 0, sizeof(decryptKeys));
+    std::memset(hashKey, 0, sizeof(hashKey));
+}
+
+// 设置密钥并展开轮密钥
+bool AESCipher::setKey(const uint8_t* key, size_t keyLength) {
+    if (!key || (keyLength != 16 && keyLength != 24 && keyLength != 32)) {
+        return false;
+    }
+
+    const AESTables& t = aesTables();
+    const int nk = static_cast<int>(keyLength / 4);
+    const int nr = nk + 6;
+    const int totalWords = 4 * (nr + 1);
+
+    // FIPS-197密钥扩展
+    uint32_t w[60];
+    for (int i = 0; i < nk; ++i) {
+        w[i] = loadBigEndian32(key + 4 * i);
+    }
+    uint8_t rcon = 0x01;
+    for (int i = nk; i < totalWords; ++i) {
+        uint32_t temp = w[i - 1];
+        if (i % nk == 0) {
+            temp = subWord(t, (temp << 8) | (temp >> 24)) ^ (static_cast<uint32_t>(rcon) << 24);
+            rcon = xtime(rcon);
+        } else if (nk > 6 && i % nk == 4) {
+            temp = subWord(t, temp);
+        }
+        w[i] = w[i - nk] ^ temp;
+    }
+
+    for (int i = 0; i < totalWords; ++i) {
+        storeBigEndian32(encryptKeys + 4 * i, w[i]);
+    }
+
+    // 解密轮密钥逆序排列，中间各轮做InvMixColumns
+    for (int r = 0; r <= nr; ++r) {
+        const int source = nr - r;
+        for (int c = 0; c < 4; ++c) {
+            uint32_t word = w[4 * source + c];
+            if (r != 0 && r != nr) {
+                word = invMixColumn(t, word);
+            }
+            storeBigEndian32(decryptKeys + 16 * r + 4 * c, word);
+        }
+    }
+
+    rounds = nr;
+
+    // GHASH密钥
+    std::memset(hashKey, 0, sizeof(hashKey));
+    encryptBlocks(hashKey, hashKey, 1);
+    return true;
+}
+
+// ECB模式加密
+void AESCipher::encryptBlocks(const uint8_t* input, uint8_t* output, size_t blockCount) const {
+#if defined(LINK16_ARCH_X86)
+    if (getAESKernel() == AESKernelType::AESNI && utils::CpuFeatures::get().sse41) {
+        encryptBlocksAesni(encryptKeys, rounds, input, output, blockCount);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < blockCount; ++i) {
+        encryptBlockPortable(encryptKeys, rounds, input + 16 * i, output + 16 * i);
+    }
+}
+
+// ECB模式解密
+void AESCipher::decryptBlocks(const uint8_t* input, uint8_t* output, size_t blockCount) const {
+#if defined(LINK16_ARCH_X86)
+    if (getAESKernel() == AESKernelType::AESNI && utils::CpuFeatures::get().sse41) {
+        decryptBlocksAesni(decryptKeys, rounds, input, output, blockCount);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < blockCount; ++i) {
+        decryptBlockPortable(decryptKeys, rounds, input + 16 * i, output + 16 * i);
+    }
+}
+
+// CTR模式加解密
+void AESCipher::cryptCTR(const uint8_t* counter, const uint8_t* input, uint8_t* output, size_t length) const {
+    uint64_t hi = loadBigEndian64(counter);
+    uint64_t lo = loadBigEndian64(counter + 8);
+#if defined(LINK16_ARCH_X86)
+    if (getAESKernel() == AESKernelType::AESNI && utils::CpuFeatures::get().sse41) {
+        cryptCTRAesni(encryptKeys, rounds, hi, lo, input, output, length);
+        return;
+    }
+#endif
+    alignas(16) uint8_t keystream[ctr_chunk_blocks * block_size];
+
+    while (length > 0) {
+        const size_t blocks = std::min(ctr_chunk_blocks, (length + block_size - 1) / block_size);
+        for (size_t j = 0; j < blocks; ++j) {
+            storeBigEndian64(keystream + 16 * j, hi);
+            storeBigEndian64(keystream + 16 * j + 8, lo);
+            incrementCounter(hi, lo);
+        }
+        encryptBlocks(keystream, keystream, blocks);
+
+        const size_t bytes = std::min(length, blocks * block_size);
+        xorBytes(input, keystream, output, bytes);
+        input += bytes;
+        output += bytes;
+        length -= bytes;
+    }
+}
+
+// CTR模式批量加解密等长消息
+void AESCipher::cryptCTRBatch(uint64_t nonce, const uint8_t* messages, size_t count, size_t messageLength,
+                              uint8_t* output) const {
+#if defined(LINK16_ARCH_X86)
+    if (getAESKernel() == AESKernelType::AESNI && utils::CpuFeatures::get().sse41) {
+        cryptCTRBatchAesni(encryptKeys, rounds, nonce, messages, count, messageLength, output);
+        return;
+    }
+#endif
+    const size_t blocksPerMessage = (messageLength + block_size - 1) / block_size;
+    const size_t totalBlocks = blocksPerMessage * count;
+    alignas(16) uint8_t keystream[ctr_chunk_blocks * block_size];
+
+    // 所有消息的分组连续编号，按块生成计数器后一次加密
+    size_t message = 0;
+    size_t block = 0;
+    for (size_t done = 0; done < totalBlocks;) {
+        const size_t blocks = std::min(ctr_chunk_blocks, totalBlocks - done);
+        size_t m = message;
+        size_t b = block;
+        for (size_t j = 0; j < blocks; ++j) {
+            storeBigEndian64(keystream + 16 * j, nonce);
+            storeBigEndian32(keystream + 16 * j + 8, static_cast<uint32_t>(m));
+            storeBigEndian32(keystream + 16 * j + 12, static_cast<uint32_t>(b));
+            if (++b == blocksPerMessage) {
+                b = 0;
+                ++m;
+            }
+        }
+        encryptBlocks(keystream, keystream, blocks);
+
+        for (size_t j = 0; j < blocks; ++j) {
+            const size_t offset = message * messageLength + block * block_size;
+            const size_t bytes = std::min(block_size, messageLength - block * block_size);
+            xorBytes(messages + offset, keystream + 16 * j, output + offset, bytes);
+            if (++block == blocksPerMessage) {
+                block = 0;
+                ++message;
+            }
+        }
+        done += blocks;
+    }
+}
+
+// 计算GHASH
+void AESCipher::ghash(const uint8_t* aad, size_t aadLength, const uint8_t* ciphertext, size_t length,
+                      uint8_t* result) const {
+#if defined(LINK16_ARCH_X86)
+    if (getAESKernel() == AESKernelType::AESNI && utils::CpuFeatures::get().pclmul &&
+        utils::CpuFeatures::get().sse41) {
+        ghashPclmul(hashKey, aad, aadLength, ciphertext, length, result);
+        return;
+    }
+#endif
+    ghashPortable(hashKey, aad, aadLength, ciphertext, length, result);
+}
+
+// GCM模式加密
+void AESCipher::encryptGCM(const uint8_t* iv, const uint8_t* aad, size_t aadLength,
+                           const uint8_t* input, uint8_t* output, size_t length, uint8_t* tag) const {
+    // 96位IV时J0 = IV || 0^31 || 1，数据从inc32(J0)开始加密
+    alignas(16) uint8_t j0[block_size] = {0};
+    std::memcpy(j0, iv, gcm_iv_size);
+    j0[15] = 1;
+
+    uint8_t counter[block_size];
+    std::memcpy(counter, j0, block_size);
+    counter[15] = 2;
+    cryptCTR(counter, input, output, length);
+
+    uint8_t s[block_size];
+    ghash(aad, aadLength, output, length, s);
+    encryptBlocks(j0, j0, 1);
+    xorBytes(s, j0, tag, gcm_tag_size);
+}
+
+// GCM模式解密
+bool AESCipher::decryptGCM(const uint8_t* iv, const uint8_t* aad, size_t aadLength,
+                           const uint8_t* input, uint8_t* output, size_t length, const uint8_t* tag) const {
+    alignas(16) uint8_t j0[block_size] = {0};
+    std::memcpy(j0, iv, gcm_iv_size);
+    j0[15] = 1;
+
+    // 先对密文计算标签，output可以与input相同
+    uint8_t expected[block_size];
+    ghash(aad, aadLength, input, length, expected);
+    encryptBlocks(j0, j0, 1);
+    xorBytes(expected, j0, expected, gcm_tag_size);
+
+    // 常数时间比较，标签不匹配时不输出明文
+    uint8_t diff = 0;
+    for (size_t i = 0; i < gcm_tag_size; ++i) {
+        diff |= expected[i] ^ tag[i];
+    }
+    if (diff != 0) {
+        std::memset(output, 0, length);
+        return false;
+    }
+
+    uint8_t counter[block_size] = {0};
+    std::memcpy(counter, iv, gcm_iv_size);
+    counter[15] = 2;
+    cryptCTR(counter, input, output, length);
+    return true;
+}
+
+} // namespace crypto
+} // namespace coding
+} // namespace link16
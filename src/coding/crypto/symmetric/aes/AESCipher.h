@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace link16 {
+namespace coding {
+namespace crypto {
+
+/**
+ * @brief AES分组加密内核类型
+ */
+enum class AESKernelType {
+    PORTABLE,  // 查表实现(T表)，所有平台可用
+    AESNI      // AES-NI指令，GCM的GHASH同时使用PCLMULQDQ
+};
+
+/**
+ * @brief 获取内核名称
+ * @param type 内核类型
+ * @return 内核名称
+ */
+const char* getAESKernelName(AESKernelType type);
+
+/**
+ * @brief 检查当前CPU是否支持该内核
+ * @param type 内核类型
+ * @return 是否支持
+ */
+bool isAESKernelSupported(AESKernelType type);
+
+/**
+ * @brief 获取当前CPU支持的最快内核
+ * @return 内核类型
+ */
+AESKernelType detectAESKernel();
+
+/**
+ * @brief 设置默认AES内核，不支持的内核退回到PORTABLE
+ * @param type 内核类型
+ */
+void setAESKernel(AESKernelType type);
+
+/**
+ * @brief 获取默认AES内核
+ * @return 内核类型
+ */
+AESKernelType getAESKernel();
+
+/**
+ * @brief 缓存轮密钥的AES分组密码
+ *
+ * setKey时一次性展开加密和解密轮密钥，之后的加解密只读这些轮密钥，
+ * 不分配内存，同一对象可被多个线程同时使用。支持ECB分组、CTR和GCM模式，
+ * CTR和GCM的各分组互不依赖，AES-NI内核每次并行处理8个分组。
+ */
+class AESCipher {
+public:
+    // 分组字节数
+    static const size_t block_size = 16;
+
+    // GCM初始向量字节数(只支持96位IV)
+    static const size_t gcm_iv_size = 12;
+
+    // GCM认证标签字节数
+    static const size_t gcm_tag_size = 16;
+
+    AESCipher();
+
+    /**
+     * @brief 设置密钥并展开轮密钥
+     * @param key 密钥
+     * @param keyLength 密钥字节数，16、24或32
+     * @return 密钥长度是否有效
+     */
+    bool setKey(const uint8_t* key, size_t keyLength);
+
+    // 是否已设置密钥
+    bool hasKey() const { return rounds != 0; }
+
+    // 轮数，10、12或14，未设置密钥时为0
+    int getRounds() const { return rounds; }
+
+    /**
+     * @brief ECB模式加密连续的分组
+     * @param input 输入，blockCount * 16字节
+     * @param output 输出，可以与input相同
+     * @param blockCount 分组数
+     */
+    void encryptBlocks(const uint8_t* input, uint8_t* output, size_t blockCount) const;
+
+    /**
+     * @brief ECB模式解密连续的分组
+     * @param input 输入，blockCount * 16字节
+     * @param output 输出，可以与input相同
+     * @param blockCount 分组数
+     */
+    void decryptBlocks(const uint8_t* input, uint8_t* output, size_t blockCount) const;
+
+    /**
+     * @brief CTR模式加解密(两者为同一操作)
+     *
+     * 计数器块按128位大端整数递增，与NIST SP 800-38A和OpenSSL的aes-ctr一致。
+     * @param counter 初始计数器块，16字节
+     * @param input 输入
+     * @param output 输出，可以与input相同
+     * @param length 字节数，不要求为16的倍数
+     */
+    void cryptCTR(const uint8_t* counter, const uint8_t* input, uint8_t* output, size_t length) const;
+
+    /**
+     * @brief CTR模式批量加解密等长消息
+     *
+     * 消息i的初始计数器块为 nonce(8字节大端) || i(4字节大端) || 0(4字节)，
+     * 各消息的分组合并后按8个一组加密，短消息也能填满AES-NI流水线。
+     * @param nonce 本批消息共用的随机数，同一密钥下不能重复使用
+     * @param messages 输入，count条消息连续存放
+     * @param count 消息数
+     * @param messageLength 每条消息的字节数
+     * @param output 输出，可以与messages相同
+     */
+    void cryptCTRBatch(uint64_t nonce, const uint8_t* messages, size_t count, size_t messageLength,
+                       uint8_t* output) const;
+
+    /**
+     * @brief GCM模式加密
+     * @param iv 初始向量，12字节
+     * @param aad 附加认证数据，可以为空
+     * @param aadLength 附加认证数据字节数
+     * @param input 明文
+     * @param output 密文，可以与input相同
+     * @param length 字节数
+     * @param tag 输出认证标签，16字节
+     */
+    void encryptGCM(const uint8_t* iv, const uint8_t* aad, size_t aadLength,
+                    const uint8_t* input, uint8_t* output, size_t length, uint8_t* tag) const;
+
+    /**
+     * @brief GCM模式解密并验证认证标签
+     * @param iv 初始向量，12字节
+     * @param aad 附加认证数据，可以为空
+     * @param aadLength 附加认证数据字节数
+     * @param input 密文
+     * @param output 明文，可以与input相同；验证失败时清零
+     * @param length 字节数
+     * @param tag 认证标签，16字节
+     * @return 认证标签是否匹配
+     */
+    bool decryptGCM(const uint8_t* iv, const uint8_t* aad, size_t aadLength,
+                    const uint8_t* input, uint8_t* output, size_t length, const uint8_t* tag) const;
+
+private:
+    // 计算GHASH(aad, ciphertext)
+    void ghash(const uint8_t* aad, size_t aadLength, const uint8_t* ciphertext, size_t length,
+               uint8_t* result) const;
+
+    // 最多15轮密钥，每轮16字节
+    alignas(16) uint8_t encryptKeys[15 * block_size];
+
+    // 等价逆密码的解密轮密钥(中间轮已做InvMixColumns，AES-NI与查表实现通用)
+    alignas(16) uint8_t decryptKeys[15 * block_size];
+
+    // GHASH密钥H = E(K, 0)
+    alignas(16) uint8_t hashKey[block_size];
+
+    int rounds;
+};
+
+} // namespace crypto
+} // namespace coding
+} // namespace link16
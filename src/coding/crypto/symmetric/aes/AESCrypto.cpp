@@ -1,61 +1,82 @@
 #include "AESCrypto.h"
-#include "AES.h"
+#include "AESCipher.h"
+#include <algorithm>
+#include <cstring>
 #include <random>
 #include <sstream>
 #include <iomanip>
+#include <stdexcept>
 #include <vector>
 
 namespace link16 {
 namespace coding {
 namespace crypto {
 
+namespace {
+
+// 每次转换为十六进制的分组数
+const size_t hex_chunk_blocks = 32;
+
+const char hex_digits[] = "0123456789abcdef";
+
+// 字节转换为小写十六进制字符，与原先std::hex输出一致
+void bytesToHex(const uint8_t* bytes, size_t length, uint8_t* hex) {
+    for (size_t i = 0; i < length; ++i) {
+        hex[2 * i] = static_cast<uint8_t>(hex_digits[bytes[i] >> 4]);
+        hex[2 * i + 1] = static_cast<uint8_t>(hex_digits[bytes[i] & 0x0F]);
+    }
+}
+
+int hexValue(uint8_t c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// 十六进制字符转换为字节，output可以与hex相同
+bool hexToBytes(const uint8_t* hex, size_t length, uint8_t* output) {
+    for (size_t i = 0; i < length / 2; ++i) {
+        const int high = hexValue(hex[2 * i]);
+        const int low = hexValue(hex[2 * i + 1]);
+        if (high < 0 || low < 0) {
+            return false;
+        }
+        output[i] = static_cast<uint8_t>((high << 4) | low);
+    }
+    return true;
+}
+
+/**
+ * 每线程缓存最近使用的密钥及其轮密钥
+ * 密钥不变时直接复用，不再重新展开；按线程缓存使同一AESCrypto可被多个线程同时使用。
+ */
+const AESCipher& getCachedCipher(const uint8_t* key, size_t keyLength) {
+    struct CipherCache {
+        uint8_t key[32];
+        size_t keyLength;
+        AESCipher cipher;
+    };
+    thread_local CipherCache cache = {{0}, 0, AESCipher()};
+
+    if (cache.keyLength != keyLength || std::memcmp(cache.key, key, keyLength) != 0) {
+        cache.cipher.setKey(key, keyLength);
+        std::memcpy(cache.key, key, keyLength);
+        cache.keyLength = keyLength;
+    }
+    return cache.cipher;
+}
+
+} // namespace
+
 // 私有实现类
 class AESCrypto::Impl {
 public:
     Impl(int keySize) : keySize(keySize) {
-        // 根据密钥大小选择AES密钥长度
-        switch (keySize) {
-            case 128:
-                aesKeyLength = AESKeyLength::AES_128;
-                break;
-            case 192:
-                aesKeyLength = AESKeyLength::AES_192;
-                break;
-            case 256:
-            default:
-                aesKeyLength = AESKeyLength::AES_256;
-                keySize = 256;
-                break;
+        // 不支持的密钥大小按256位处理
+        if (keySize != 128 && keySize != 192 && keySize != 256) {
+            this->keySize = 256;
         }
-        
-        // 创建AES实例
-        aes = new AES(aesKeyLength);
-    }
-    
-    ~Impl() {
-        delete aes;
-    }
-    
-    // 字符串转换为字节向量
-    std::vector<unsigned char> stringToVector(const std::string& str) {
-        std::vector<unsigned char> vec(str.begin(), str.end());
-        return vec;
-    }
-    
-    // 字节向量转换为字符串
-    std::string vectorToString(const std::vector<unsigned char>& vec) {
-        return std::string(vec.begin(), vec.end());
-    }
-    
-    // 十六进制字符串转换为字节向量
-    std::vector<unsigned char> hexToVector(const std::string& hex) {
-        std::vector<unsigned char> bytes;
-        for (size_t i = 0; i < hex.length(); i += 2) {
-            std::string byteString = hex.substr(i, 2);
-            unsigned char byte = (unsigned char)strtol(byteString.c_str(), NULL, 16);
-            bytes.push_back(byte);
-        }
-        return bytes;
     }
     
     // 字节向量转换为十六进制字符串
@@ -68,79 +89,96 @@ public:
         return ss.str();
     }
     
-    // 加密函数
-    std::string encrypt(const std::string& plaintext, const std::string& key) {
-        // 将密钥转换为向量
-        std::vector<unsigned char> keyVec;
-        if (key.length() * 8 >= keySize) {
-            // 如果密钥长度足够，直接使用
-            keyVec = stringToVector(key.substr(0, keySize / 8));
-        } else {
-            // 如果密钥长度不够，填充到所需长度
-            keyVec = stringToVector(key);
-            while (keyVec.size() * 8 < keySize) {
-                keyVec.push_back(0);
-            }
-        }
-        
-        // 将明文转换为向量
-        std::vector<unsigned char> plaintextVec = stringToVector(plaintext);
+    // 获取密钥对应的分组密码，密钥截断或补0到keySize位
+    const AESCipher& cipherFor(const std::string& key) const {
+        uint8_t keyBytes[32] = {0};
+        const size_t keyLength = static_cast<size_t>(keySize / 8);
+        std::memcpy(keyBytes, key.data(), std::min(key.length(), keyLength));
+        return getCachedCipher(keyBytes, keyLength);
+    }
+    
+    // 加密函数(ECB + PKCS7，输出十六进制)
+    size_t encrypt(const uint8_t* plaintext, size_t length, const std::string& key, uint8_t* output) {
+        const AESCipher& cipher = cipherFor(key);
+        alignas(16) uint8_t blocks[hex_chunk_blocks * AESCipher::block_size];
         
-        // 填充明文到16字节的倍数
-        size_t paddingSize = 16 - (plaintextVec.size() % 16);
-        for (size_t i = 0; i < paddingSize; ++i) {
-            plaintextVec.push_back(static_cast<unsigned char>(paddingSize));
+        // 完整分组直接从输入加密
+        const size_t fullBlocks = length / AESCipher::block_size;
+        for (size_t done = 0; done < fullBlocks;) {
+            const size_t n = std::min(hex_chunk_blocks, fullBlocks - done);
+            cipher.encryptBlocks(plaintext + done * AESCipher::block_size, blocks, n);
+            bytesToHex(blocks, n * AESCipher::block_size, output + done * AESCipher::block_size * 2);
+            done += n;
         }
         
-        // 使用AES加密
-        std::vector<unsigned char> ciphertextVec = aes->EncryptECB(plaintextVec, keyVec);
+        // 最后一个分组按PKCS7填充，长度恰好为16的倍数时填充一个完整分组
+        const size_t remaining = length - fullBlocks * AESCipher::block_size;
+        const uint8_t paddingSize = static_cast<uint8_t>(AESCipher::block_size - remaining);
+        std::memcpy(blocks, plaintext + fullBlocks * AESCipher::block_size, remaining);
+        std::memset(blocks + remaining, paddingSize, paddingSize);
+        cipher.encryptBlocks(blocks, blocks, 1);
+        bytesToHex(blocks, AESCipher::block_size, output + fullBlocks * AESCipher::block_size * 2);
         
-        // 将密文转换为十六进制字符串
-        return vectorToHex(ciphertextVec);
+        return getEncryptedLength(length);
     }
     
-    // 解密函数
-    std::string decrypt(const std::string& ciphertext, const std::string& key) {
-        // 将密钥转换为向量
-        std::vector<unsigned char> keyVec;
-        if (key.length() * 8 >= keySize) {
-            // 如果密钥长度足够，直接使用
-            keyVec = stringToVector(key.substr(0, keySize / 8));
-        } else {
-            // 如果密钥长度不够，填充到所需长度
-            keyVec = stringToVector(key);
-            while (keyVec.size() * 8 < keySize) {
-                keyVec.push_back(0);
-            }
+    // 解密函数，output可以与ciphertext相同
+    bool decrypt(const uint8_t* ciphertext, size_t length, const std::string& key,
+                 uint8_t* output, size_t& outputLength) {
+        outputLength = 0;
+        if (length % (AESCipher::block_size * 2) != 0) {
+            return false;
         }
         
-        // 将十六进制密文转换为向量
-        std::vector<unsigned char> ciphertextVec = hexToVector(ciphertext);
+        const size_t byteCount = length / 2;
+        if (!hexToBytes(ciphertext, length, output)) {
+            return false;
+        }
         
-        // 使用AES解密
-        std::vector<unsigned char> plaintextVec = aes->DecryptECB(ciphertextVec, keyVec);
+        const AESCipher& cipher = cipherFor(key);
+        cipher.decryptBlocks(output, output, byteCount / AESCipher::block_size);
         
-        // 移除填充
-        if (!plaintextVec.empty()) {
-            unsigned char paddingSize = plaintextVec.back();
-            if (paddingSize > 0 && paddingSize <= 16) {
-                // 验证填充
+        // 移除填充，填充无效时保留原数据
+        size_t size = byteCount;
+        if (size > 0) {
+            const uint8_t paddingSize = output[size - 1];
+            if (paddingSize > 0 && paddingSize <= AESCipher::block_size) {
                 bool validPadding = true;
-                for (size_t i = 1; i <= paddingSize && i <= plaintextVec.size(); ++i) {
-                    if (plaintextVec[plaintextVec.size() - i] != paddingSize) {
+                for (size_t i = 1; i <= paddingSize && i <= size; ++i) {
+                    if (output[size - i] != paddingSize) {
                         validPadding = false;
                         break;
                     }
                 }
                 
                 if (validPadding) {
-                    plaintextVec.resize(plaintextVec.size() - paddingSize);
+                    size -= paddingSize;
                 }
             }
         }
         
-        // 将明文向量转换为字符串
-        return vectorToString(plaintextVec);
+        outputLength = size;
+        return true;
+    }
+    
+    // 字符串加密
+    std::string encrypt(const std::string& plaintext, const std::string& key) {
+        std::string ciphertext(getEncryptedLength(plaintext.length()), '\0');
+        encrypt(reinterpret_cast<const uint8_t*>(plaintext.data()), plaintext.length(), key,
+                reinterpret_cast<uint8_t*>(&ciphertext[0]));
+        return ciphertext;
+    }
+    
+    // 字符串解密
+    std::string decrypt(const std::string& ciphertext, const std::string& key) {
+        std::string plaintext(ciphertext.length() / 2, '\0');
+        size_t plaintextLength = 0;
+        if (!decrypt(reinterpret_cast<const uint8_t*>(ciphertext.data()), ciphertext.length(), key,
+                     reinterpret_cast<uint8_t*>(&plaintext[0]), plaintextLength)) {
+            throw std::invalid_argument("AES密文格式无效");
+        }
+        plaintext.resize(plaintextLength);
+        return plaintext;
     }
     
     // 生成随机密钥
@@ -177,8 +215,6 @@ public:
     
 private:
     int keySize;
-    AESKeyLength aesKeyLength;
-    AES* aes;
 };
 
 // AESCrypto实现
@@ -224,6 +260,62 @@ bool AESCrypto::isValidKey(const std::string& key) {
     return pImpl->isValidKey(key);
 }
 
+size_t AESCrypto::getEncryptedLength(size_t plaintextLength) {
+    return (plaintextLength / AESCipher::block_size + 1) * AESCipher::block_size * 2;
+}
+
+size_t AESCrypto::encrypt(const uint8_t* plaintext, size_t length, const std::string& key, uint8_t* output) {
+    if ((!plaintext && length > 0) || !output) {
+        return 0;
+    }
+    return pImpl->encrypt(plaintext, length, key, output);
+}
+
+bool AESCrypto::decrypt(const uint8_t* ciphertext, size_t length, const std::string& key,
+                        uint8_t* output, size_t& outputLength) {
+    outputLength = 0;
+    if ((!ciphertext && length > 0) || !output) {
+        return false;
+    }
+    return pImpl->decrypt(ciphertext, length, key, output, outputLength);
+}
+
+size_t AESCrypto::encryptBatchCTR(const uint8_t* messages, size_t count, size_t messageLength,
+                                  uint8_t* output, const std::string& key, uint64_t nonce) {
+    if (!messages || !output) {
+        return 0;
+    }
+    pImpl->cipherFor(key).cryptCTRBatch(nonce, messages, count, messageLength, output);
+    return count;
+}
+
+size_t AESCrypto::decryptBatchCTR(const uint8_t* ciphertexts, size_t count, size_t messageLength,
+                                  uint8_t* output, const std::string& key, uint64_t nonce) {
+    // CTR模式加解密为同一操作
+    return encryptBatchCTR(ciphertexts, count, messageLength, output, key, nonce);
+}
+
+bool AESCrypto::encryptGCM(const uint8_t* plaintext, size_t length, const std::string& key,
+                           const uint8_t* iv, const uint8_t* aad, size_t aadLength,
+                           uint8_t* ciphertext, uint8_t* tag) {
+    if ((!plaintext && length > 0) || (!ciphertext && length > 0) || !iv || !tag ||
+        (!aad && aadLength > 0)) {
+        return false;
+    }
+    pImpl->cipherFor(key).encryptGCM(iv, aad, aadLength, plaintext, ciphertext, length, tag);
+    return true;
+}
+
+bool AESCrypto::decryptGCM(const uint8_t* ciphertext, size_t length, const std::string& key,
+                           const uint8_t* iv, const uint8_t* aad, size_t aadLength,
+                           const uint8_t* tag, uint8_t* plaintext) {
+    if ((!ciphertext && length > 0) || (!plaintext && length > 0) || !iv || !tag ||
+        (!aad && aadLength > 0)) {
+        return false;
+    }
+    return pImpl->cipherFor(key).decryptGCM(iv, aad, aadLength, ciphertext, plaintext, length, tag);
+}
+
 } // namespace crypto
 } // namespace coding
 } // namespace link16
\ No newline at end of file
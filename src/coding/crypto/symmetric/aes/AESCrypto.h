@@ -3,6 +3,8 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <cstdint>
+#include <cstddef>
 
 namespace link16 {
 namespace coding {
@@ -76,6 +78,81 @@ public:
      * @return 密钥是否有效
      */
     bool isValidKey(const std::string& key);
+    
+    /**
+     * @brief 计算encrypt输出的字节数(PKCS7填充后的十六进制密文)
+     * @param plaintextLength 明文字节数
+     * @return 密文字节数
+     */
+    static size_t getEncryptedLength(size_t plaintextLength);
+    
+    /**
+     * @brief 加密到调用方缓冲区，输出与字符串版本相同，不分配内存
+     * @param plaintext 明文
+     * @param length 明文字节数
+     * @param key 密钥
+     * @param output 输出缓冲区，至少getEncryptedLength(length)字节
+     * @return 写入的字节数
+     */
+    size_t encrypt(const uint8_t* plaintext, size_t length, const std::string& key, uint8_t* output);
+    
+    /**
+     * @brief 解密调用方缓冲区中的十六进制密文，不分配内存
+     * @param ciphertext 密文
+     * @param length 密文字节数，须为32的倍数
+     * @param key 密钥
+     * @param output 输出缓冲区，至少length / 2字节，可以与ciphertext相同
+     * @param outputLength 去除填充后的明文字节数
+     * @return 密文格式是否有效
+     */
+    bool decrypt(const uint8_t* ciphertext, size_t length, const std::string& key,
+                 uint8_t* output, size_t& outputLength);
+    
+    /**
+     * @brief CTR模式批量加密等长消息
+     *
+     * 消息i的计数器块为nonce、序号i和块计数拼接而成，各消息独立，
+     * 所有消息的分组合并后并行加密。同一密钥下nonce不能重复使用。
+     * @param messages 明文，count条消息连续存放
+     * @param count 消息数
+     * @param messageLength 每条消息的字节数
+     * @param output 密文，与明文等长，可以与messages相同
+     * @param key 密钥
+     * @param nonce 本批消息的随机数
+     * @return 加密的消息数
+     */
+    size_t encryptBatchCTR(const uint8_t* messages, size_t count, size_t messageLength,
+                           uint8_t* output, const std::string& key, uint64_t nonce);
+    
+    /**
+     * @brief CTR模式批量解密，参数与encryptBatchCTR相同
+     */
+    size_t decryptBatchCTR(const uint8_t* ciphertexts, size_t count, size_t messageLength,
+                           uint8_t* output, const std::string& key, uint64_t nonce);
+    
+    /**
+     * @brief GCM模式加密并生成认证标签
+     * @param plaintext 明文
+     * @param length 字节数
+     * @param key 密钥
+     * @param iv 初始向量，12字节，同一密钥下不能重复使用
+     * @param aad 附加认证数据(如消息头)，可以为空
+     * @param aadLength 附加认证数据字节数
+     * @param ciphertext 密文，与明文等长
+     * @param tag 认证标签，16字节
+     * @return 参数是否有效
+     */
+    bool encryptGCM(const uint8_t* plaintext, size_t length, const std::string& key,
+                    const uint8_t* iv, const uint8_t* aad, size_t aadLength,
+                    uint8_t* ciphertext, uint8_t* tag);
+    
+    /**
+     * @brief GCM模式解密并验证认证标签，验证失败时明文清零
+     * @return 认证是否通过
+     */
+    bool decryptGCM(const uint8_t* ciphertext, size_t length, const std::string& key,
+                    const uint8_t* iv, const uint8_t* aad, size_t aadLength,
+                    const uint8_t* tag, uint8_t* plaintext);
 
 private:
     // 密钥
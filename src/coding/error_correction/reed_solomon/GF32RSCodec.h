@@ -0,0 +1,438 @@
+#pragma once
+
+#include "core/types/dataType.h"
+#include "SymbolReliabilityMapper.h"
+#include <cstdint>
+#include <cstddef>
+
+namespace link16 {
+namespace coding {
+namespace error_correction {
+
+/**
+ * @brief GF(2^5)域运算
+ *
+ * Link16消息字以5bit为一个符号，直接在GF(32)上做RS编解码，
+ * 对数/反对数表在编译期生成，总共不到100字节。
+ */
+namespace gf32 {
+
+// 域参数，本原多项式x^5 + x^2 + 1
+constexpr int field_size = 31;
+constexpr unsigned int primitive_polynomial = 0x25;
+
+// 对数/反对数表，exp表加倍以免去乘法时的取模
+struct Tables {
+    uint8_t exp[2 * field_size];
+    uint8_t log[field_size + 1];
+};
+
+constexpr Tables makeTables() {
+    Tables tables = {};
+    unsigned int value = 1;
+    for (int i = 0; i < field_size; ++i) {
+        tables.exp[i] = static_cast<uint8_t>(value);
+        tables.exp[i + field_size] = static_cast<uint8_t>(value);
+        tables.log[value] = static_cast<uint8_t>(i);
+        value <<= 1;
+        if (value & 0x20) {
+            value ^= primitive_polynomial;
+        }
+    }
+    return tables;
+}
+
+inline constexpr Tables tables = makeTables();
+
+// alpha^e，e >= 0
+constexpr uint8_t alpha(int e) {
+    return tables.exp[e % field_size];
+}
+
+constexpr uint8_t mul(uint8_t a, uint8_t b) {
+    return (a == 0 || b == 0) ? 0 : tables.exp[tables.log[a] + tables.log[b]];
+}
+
+constexpr uint8_t div(uint8_t a, uint8_t b) {
+    return (a == 0 || b == 0) ? 0 : tables.exp[tables.log[a] + field_size - tables.log[b]];
+}
+
+} // namespace gf32
+
+/**
+ * @brief GF(2^5)上的Reed-Solomon编解码器
+ *
+ * 以RS_Length为模板参数，生成多项式、编码反馈表和伴随式表均在编译期计算，
+ * RS(31,15)的全部表约16KB，可常驻L1缓存。
+ * 码字布局与RSCoder一致：前dataLength个为数据符号，后面为校验符号；
+ * 生成多项式的根为alpha^0..alpha^(fecLength-1)。RS(16,7)为RS(31,22)的缩短码。
+ * 符号数组每个字节存放一个符号(低5位)，也可直接传入symbol(std::bitset<5>)数组。
+ * 所有函数均无状态，可被多个线程同时调用。
+ */
+template <RS_Length CodeLength, RS_Length DataLength>
+class GF32RSCodec {
+public:
+    static constexpr int code_length = static_cast<int>(CodeLength);
+    static constexpr int data_length = static_cast<int>(DataLength);
+    static constexpr int fec_length = code_length - data_length;
+    static constexpr int capability = fec_length / 2;
+
+    static_assert(code_length <= gf32::field_size, "GF(32)上的RS码长不能超过31");
+    static_assert(data_length > 0 && fec_length > 0, "RS数据长度无效");
+
+    /**
+     * @brief 编码
+     * @param data 数据符号，长度为dataLength
+     * @param codeword 输出码字，长度为codeLength，可与data指向同一缓冲区
+     */
+    static void encode(const uint8_t* data, uint8_t* codeword) {
+        uint8_t parity[fec_length] = {};
+
+        for (int i = 0; i < data_length; ++i) {
+            const uint8_t feedback = (data[i] & 0x1F) ^ parity[0];
+            const uint8_t* row = feedbackTable.row[feedback];
+            for (int k = 0; k < fec_length - 1; ++k) {
+                parity[k] = parity[k + 1] ^ row[k];
+            }
+            parity[fec_length - 1] = row[fec_length - 1];
+        }
+
+        for (int i = 0; i < data_length; ++i) {
+            codeword[i] = data[i] & 0x1F;
+        }
+        for (int k = 0; k < fec_length; ++k) {
+            codeword[data_length + k] = parity[k];
+        }
+    }
+
+    /**
+     * @brief 编码(symbol数组版本)
+     * @param data 数据符号，长度为dataLength
+     * @param codeword 输出码字，长度为codeLength
+     */
+    static void encode(const symbol* data, symbol* codeword) {
+        uint8_t buffer[code_length];
+        for (int i = 0; i < data_length; ++i) {
+            buffer[i] = static_cast<uint8_t>(data[i].to_ulong());
+        }
+        encode(buffer, buffer);
+        for (int i = 0; i < code_length; ++i) {
+            codeword[i] = symbol(buffer[i]);
+        }
+    }
+
+    /**
+     * @brief 原地解码
+     * @param codeword 码字，长度为codeLength，仅在解码成功时被纠正
+     * @param correctedSymbols 输出纠正的符号数量，可为空
+     * @return 解码是否成功
+     */
+    static bool decode(uint8_t* codeword, int* correctedSymbols = nullptr) {
+        return decode(codeword, nullptr, 0, correctedSymbols);
+    }
+
+    /**
+     * @brief 原地纠错纠删解码
+     *
+     * 已知位置的删除符号只占用一个校验符号，E个错误和S个删除满足2E+S <= fecLength即可纠正。
+     * @param codeword 码字，长度为codeLength，删除位置的值任意，仅在解码成功时被纠正
+     * @param erasures 删除符号的位置(0..codeLength-1，互不相同)，erasureCount为0时可为空
+     * @param erasureCount 删除符号数量，不超过fecLength
+     * @param correctedSymbols 输出值被改变的符号数量(含删除位置)，可为空
+     * @return 解码是否成功
+     */
+    static bool decode(uint8_t* codeword, const int* erasures, int erasureCount, int* correctedSymbols = nullptr) {
+        if (correctedSymbols) {
+            *correctedSymbols = 0;
+        }
+        if (erasureCount < 0 || erasureCount > fec_length) {
+            return false;
+        }
+
+        // 删除位置定位多项式 gamma(x) = prod(1 - X_i * x)，X_i = alpha^(n-1-t)
+        uint8_t gamma[fec_length + 1] = {1};
+        uint32_t erased = 0;
+        for (int e = 0; e < erasureCount; ++e) {
+            const int t = erasures[e];
+            if (t < 0 || t >= code_length || (erased >> t) & 1) {
+                return false;
+            }
+            erased |= uint32_t(1) << t;
+            const uint8_t locator = gf32::alpha(code_length - 1 - t);
+            for (int i = e + 1; i > 0; --i) {
+                gamma[i] ^= gf32::mul(gamma[i - 1], locator);
+            }
+        }
+
+        // 伴随式: 每个码字符号查表得到其对全部S_j的贡献，按64位整块异或
+        uint64_t packed[syndrome_words] = {};
+        for (int t = 0; t < code_length; ++t) {
+            const uint64_t* row = syndromeTable.row[t][codeword[t] & 0x1F];
+            for (int w = 0; w < syndrome_words; ++w) {
+                packed[w] ^= row[w];
+            }
+        }
+
+        uint64_t flag = 0;
+        for (int w = 0; w < syndrome_words; ++w) {
+            flag |= packed[w];
+        }
+        if (flag == 0) {
+            return true;
+        }
+
+        uint8_t syndromes[fec_length];
+        for (int j = 0; j < fec_length; ++j) {
+            syndromes[j] = static_cast<uint8_t>(packed[j / 8] >> (8 * (j % 8)));
+        }
+
+        // Berlekamp-Massey求错误定位多项式，有删除时以gamma为初值，
+        // 从第erasureCount个伴随式开始迭代，得到的lambda同时包含错误和删除位置
+        uint8_t lambda[fec_length + 1];
+        uint8_t previous[fec_length + 1];
+        for (int i = 0; i <= fec_length; ++i) {
+            lambda[i] = gamma[i];
+            previous[i] = gamma[i];
+        }
+        int degree = erasureCount;
+        int shift = 1;
+        uint8_t previousDiscrepancy = 1;
+
+        for (int n = erasureCount; n < fec_length; ++n) {
+            uint8_t discrepancy = syndromes[n];
+            for (int i = 1; i <= degree && i <= n; ++i) {
+                discrepancy ^= gf32::mul(lambda[i], syndromes[n - i]);
+            }
+
+            if (discrepancy == 0) {
+                ++shift;
+                continue;
+            }
+
+            const uint8_t scale = gf32::div(discrepancy, previousDiscrepancy);
+            if (2 * degree <= n + erasureCount) {
+                uint8_t temp[fec_length + 1];
+                for (int i = 0; i <= fec_length; ++i) {
+                    temp[i] = lambda[i];
+                }
+                for (int i = 0; i + shift <= fec_length; ++i) {
+                    lambda[i + shift] ^= gf32::mul(scale, previous[i]);
+                }
+                degree = n + 1 + erasureCount - degree;
+                for (int i = 0; i <= fec_length; ++i) {
+                    previous[i] = temp[i];
+                }
+                previousDiscrepancy = discrepancy;
+                shift = 1;
+            } else {
+                for (int i = 0; i + shift <= fec_length; ++i) {
+                    lambda[i + shift] ^= gf32::mul(scale, previous[i]);
+                }
+                ++shift;
+            }
+        }
+
+        // 2E + S <= fecLength
+        if (2 * degree - erasureCount > fec_length) {
+            return false;
+        }
+
+        // Chien搜索，只检查码字内的位置: X_t = alpha^(n-1-t)，根为X_t^-1。
+        // t每加1，X_t^-1的指数加1，第i项的指数随之加i
+        int registers[fec_length + 1];
+        for (int i = 0; i <= degree; ++i) {
+            registers[i] = (lambda[i] == 0) ? -1
+                : (gf32::tables.log[lambda[i]] + i * (gf32::field_size - (code_length - 1))) % gf32::field_size;
+        }
+
+        int locations[fec_length];
+        int found = 0;
+        for (int t = 0; t < code_length && found < degree; ++t) {
+            uint8_t sum = 0;
+            for (int i = 0; i <= degree; ++i) {
+                if (registers[i] < 0) {
+                    continue;
+                }
+                sum ^= gf32::tables.exp[registers[i]];
+                registers[i] += i;
+                if (registers[i] >= gf32::field_size) {
+                    registers[i] -= gf32::field_size;
+                }
+            }
+            if (sum == 0) {
+                locations[found++] = t;
+            }
+        }
+        if (found != degree) {
+            return false;
+        }
+
+        // Forney: omega = S(x) * lambda(x) mod x^fecLength
+        uint8_t omega[fec_length];
+        for (int k = 0; k < fec_length; ++k) {
+            uint8_t sum = 0;
+            for (int i = 0; i <= k && i <= degree; ++i) {
+                sum ^= gf32::mul(lambda[i], syndromes[k - i]);
+            }
+            omega[k] = sum;
+        }
+
+        uint8_t corrected[code_length];
+        for (int t = 0; t < code_length; ++t) {
+            corrected[t] = codeword[t] & 0x1F;
+        }
+
+        int changed = 0;
+        for (int r = 0; r < found; ++r) {
+            const int t = locations[r];
+            const int exponent = code_length - 1 - t;
+            const int inverse = (gf32::field_size - exponent) % gf32::field_size;
+
+            uint8_t numerator = 0;
+            for (int k = 0; k < fec_length; ++k) {
+                numerator ^= gf32::mul(omega[k], gf32::alpha(inverse * k));
+            }
+            uint8_t denominator = 0;
+            for (int i = 1; i <= degree; i += 2) {
+                denominator ^= gf32::mul(lambda[i], gf32::alpha(inverse * (i - 1)));
+            }
+            if (denominator == 0) {
+                return false;
+            }
+
+            // 第一个根为alpha^0，错误值 = X * omega(X^-1) / lambda'(X^-1)
+            const uint8_t value = gf32::mul(gf32::alpha(exponent), gf32::div(numerator, denominator));
+            corrected[t] ^= value;
+            changed += value != 0;
+        }
+
+        for (int t = 0; t < code_length; ++t) {
+            codeword[t] = corrected[t];
+        }
+        if (correctedSymbols) {
+            *correctedSymbols = changed;
+        }
+        return true;
+    }
+
+    /**
+     * @brief 由比特LLR软判决解码(广义最小距离解码)
+     *
+     * 先对硬判决纠错；失败时把可靠度最低的符号依次多删除2个(fecLength为奇数时从1个开始)重试，
+     * 直到删除fecLength个。删除的符号不再计入错误，同一码字能纠正的错误符号更多。
+     * @param llr 比特LLR(正值为1)，长度为codeLength * 5，每个符号高位在前
+     * @param codeword 输出码字，长度为codeLength；失败时为未纠正的硬判决
+     * @param correctedSymbols 输出值被改变的符号数量，可为空
+     * @param erasedSymbols 输出解码成功时删除的符号数量，可为空
+     * @return 解码是否成功
+     */
+    static bool decodeSoft(const double* llr, uint8_t* codeword, int* correctedSymbols = nullptr,
+                           int* erasedSymbols = nullptr) {
+        if (erasedSymbols) {
+            *erasedSymbols = 0;
+        }
+
+        double reliability[code_length];
+        SymbolReliabilityMapper::mapSymbols(llr, code_length, codeword, reliability);
+        if (decode(codeword, correctedSymbols)) {
+            return true;
+        }
+
+        int order[code_length];
+        SymbolReliabilityMapper::rankSymbols(reliability, code_length, order);
+
+        // 解码只在成功时修改码字，失败后可直接增加删除数重试
+        for (int erasures = (fec_length % 2 == 0) ? 2 : 1; erasures <= fec_length; erasures += 2) {
+            if (decode(codeword, order, erasures, correctedSymbols)) {
+                if (erasedSymbols) {
+                    *erasedSymbols = erasures;
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief 原地解码(symbol数组版本)
+     * @param codeword 码字，长度为codeLength，仅在解码成功时被纠正
+     * @param correctedSymbols 输出纠正的符号数量，可为空
+     * @return 解码是否成功
+     */
+    static bool decode(symbol* codeword, int* correctedSymbols = nullptr) {
+        uint8_t buffer[code_length];
+        for (int i = 0; i < code_length; ++i) {
+            buffer[i] = static_cast<uint8_t>(codeword[i].to_ulong());
+        }
+        if (!decode(buffer, correctedSymbols)) {
+            return false;
+        }
+        for (int i = 0; i < code_length; ++i) {
+            codeword[i] = symbol(buffer[i]);
+        }
+        return true;
+    }
+
+private:
+    // 生成多项式 g(x) = (x - alpha^0)(x - alpha^1)...(x - alpha^(fec-1))，高次在前
+    struct Generator {
+        uint8_t coef[fec_length + 1];
+    };
+
+    static constexpr Generator makeGenerator() {
+        Generator g = {};
+        g.coef[0] = 1;
+        for (int j = 0; j < fec_length; ++j) {
+            const uint8_t root = gf32::alpha(j);
+            for (int i = j + 1; i > 0; --i) {
+                g.coef[i] ^= gf32::mul(g.coef[i - 1], root);
+            }
+        }
+        return g;
+    }
+
+    // 编码反馈表: row[f][k] = f * g[k+1]，编码时每个符号只需查表和异或
+    struct FeedbackTable {
+        uint8_t row[gf32::field_size + 1][fec_length];
+    };
+
+    static constexpr FeedbackTable makeFeedbackTable() {
+        FeedbackTable table = {};
+        const Generator g = makeGenerator();
+        for (int f = 0; f <= gf32::field_size; ++f) {
+            for (int k = 0; k < fec_length; ++k) {
+                table.row[f][k] = gf32::mul(static_cast<uint8_t>(f), g.coef[k + 1]);
+            }
+        }
+        return table;
+    }
+
+    static constexpr FeedbackTable feedbackTable = makeFeedbackTable();
+
+    // 伴随式表: row[t][c]按字节打包c * alpha^(j*(n-1-t))，j = 0..fecLength-1
+    static constexpr int syndrome_words = (fec_length + 7) / 8;
+
+    struct SyndromeTable {
+        uint64_t row[code_length][gf32::field_size + 1][syndrome_words];
+    };
+
+    static constexpr SyndromeTable makeSyndromeTable() {
+        SyndromeTable table = {};
+        for (int t = 0; t < code_length; ++t) {
+            for (int c = 1; c <= gf32::field_size; ++c) {
+                for (int j = 0; j < fec_length; ++j) {
+                    const uint8_t value = gf32::mul(static_cast<uint8_t>(c),
+                                                    gf32::alpha(j * (code_length - 1 - t)));
+                    table.row[t][c][j / 8] |= static_cast<uint64_t>(value) << (8 * (j % 8));
+                }
+            }
+        }
+        return table;
+    }
+
+    static constexpr SyndromeTable syndromeTable = makeSyndromeTable();
+};
+
+} // namespace error_correction
+} // namespace coding
+} // namespace link16
@@ -0,0 +1,408 @@
+#include "RSCodecCache.h"
+#include "RSFastEncoder.h"
+#include "core/types/dataType.h"
+#include "core/utils/logger.h"
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include "schifra/schifra_galois_field.hpp"
+#include "schifra/schifra_galois_field_polynomial.hpp"
+#include "schifra/schifra_sequential_root_generator_polynomial_creator.hpp"
+#include "schifra/schifra_reed_solomon_encoder.hpp"
+#include "schifra/schifra_reed_solomon_decoder.hpp"
+#include "schifra/schifra_reed_solomon_block.hpp"
+
+namespace link16 {
+namespace coding {
+namespace error_correction {
+
+namespace {
+
+// RS编码参数
+const std::size_t field_descriptor           = 8;
+const std::size_t natural_code_length        = 255;
+const std::size_t generator_polynomial_index = 0;
+
+typedef schifra::galois::field field_type;
+typedef schifra::galois::field_polynomial field_polynomial_type;
+
+// 当前解码内核
+std::atomic<GFKernelType>& decoderKernel() {
+    static std::atomic<GFKernelType> kernel(detectGFKernel());
+    return kernel;
+}
+
+// 创建GF(2^8)域
+std::shared_ptr<const field_type> createField() {
+    return std::make_shared<const field_type>(
+        field_descriptor,
+        schifra::galois::primitive_polynomial_size06,
+        schifra::galois::primitive_polynomial06);
+}
+
+/**
+ * @brief 基于schifra缩短码的编解码上下文
+ *
+ * 构造时一次性完成生成多项式和编解码器的构建，encode/decode均为const，
+ * 只使用栈上的临时块，因此可被多个线程同时调用。编码默认走RSFastEncoder，
+ * 解码默认走RSFastDecoder的向量化路径，内核为REFERENCE时使用schifra编解码器。
+ */
+template <std::size_t CodeLength, std::size_t DataLength>
+class SchifraCodecContext : public RSCodecContext {
+public:
+    static const std::size_t FecLength = CodeLength - DataLength;
+
+    typedef schifra::reed_solomon::shortened_encoder<CodeLength, FecLength, DataLength, natural_code_length> encoder_type;
+    typedef schifra::reed_solomon::shortened_decoder<CodeLength, FecLength, DataLength, natural_code_length> decoder_type;
+    typedef schifra::reed_solomon::block<CodeLength, FecLength> block_type;
+
+    explicit SchifraCodecContext(std::shared_ptr<const field_type> field)
+        : field(std::move(field)),
+          generator(createGenerator(*this->field)),
+          encoder(*this->field, generator),
+          decoder(*this->field, generator_polynomial_index),
+          fastEncoder(*this->field, generator, static_cast<int>(CodeLength), static_cast<int>(DataLength)),
+          fastDecoder(*this->field, static_cast<int>(CodeLength), static_cast<int>(DataLength)) {
+    }
+
+    int getCodeLength() const override {
+        return static_cast<int>(CodeLength);
+    }
+
+    int getDataLength() const override {
+        return static_cast<int>(DataLength);
+    }
+
+    bool encode(const uint8_t* data, uint8_t* codeword) const override {
+        if (decoderKernel().load(std::memory_order_relaxed) != GFKernelType::REFERENCE) {
+            fastEncoder.encode(data, codeword);
+            return true;
+        }
+
+        block_type block;
+
+        for (std::size_t i = 0; i < DataLength; ++i) {
+            block.data[i] = data[i];
+        }
+
+        if (!encoder.encode(block)) {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < CodeLength; ++i) {
+            codeword[i] = static_cast<uint8_t>(block[i]);
+        }
+
+        return true;
+    }
+
+    bool decode(uint8_t* codeword, int* correctedSymbols) const override {
+        const GFKernelType kernel = decoderKernel().load(std::memory_order_relaxed);
+        if (kernel != GFKernelType::REFERENCE) {
+            return fastDecoder.decode(codeword, kernel, correctedSymbols);
+        }
+
+        block_type block;
+
+        for (std::size_t i = 0; i < CodeLength; ++i) {
+            block[i] = codeword[i];
+        }
+
+        const bool result = decoder.decode(block);
+
+        if (correctedSymbols) {
+            *correctedSymbols = static_cast<int>(block.errors_corrected);
+        }
+
+        if (!result) {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < CodeLength; ++i) {
+            codeword[i] = static_cast<uint8_t>(block[i]);
+        }
+
+        return true;
+    }
+
+    size_t encodeBatch(const uint8_t* messages, size_t count, uint8_t* codewords) const override {
+        if (decoderKernel().load(std::memory_order_relaxed) != GFKernelType::REFERENCE) {
+            for (size_t n = 0; n < count; ++n) {
+                fastEncoder.encode(messages + n * DataLength, codewords + n * CodeLength);
+            }
+            return count;
+        }
+
+        // 整批复用同一个块，避免逐码字的虚函数调用和块构造
+        block_type block;
+        size_t encoded = 0;
+
+        for (size_t n = 0; n < count; ++n) {
+            const uint8_t* message = messages + n * DataLength;
+            uint8_t* codeword = codewords + n * CodeLength;
+
+            for (std::size_t i = 0; i < DataLength; ++i) {
+                block.data[i] = message[i];
+            }
+
+            if (!encoder.encode(block)) {
+                continue;
+            }
+
+            for (std::size_t i = 0; i < CodeLength; ++i) {
+                codeword[i] = static_cast<uint8_t>(block[i]);
+            }
+            ++encoded;
+        }
+
+        return encoded;
+    }
+
+    size_t decodeBatch(const uint8_t* codewords, size_t count, uint8_t* messages,
+                       int* correctedSymbols, bool* failed) const override {
+        const GFKernelType kernel = decoderKernel().load(std::memory_order_relaxed);
+        if (kernel != GFKernelType::REFERENCE) {
+            return decodeBatchFast(codewords, count, messages, correctedSymbols, failed, kernel);
+        }
+
+        block_type block;
+        size_t decoded = 0;
+
+        for (size_t n = 0; n < count; ++n) {
+            const uint8_t* codeword = codewords + n * CodeLength;
+            uint8_t* message = messages + n * DataLength;
+
+            for (std::size_t i = 0; i < CodeLength; ++i) {
+                block[i] = codeword[i];
+            }
+
+            const bool result = decoder.decode(block);
+
+            // 解码失败时schifra不会回写数据，这里输出未纠正的数据符号
+            for (std::size_t i = 0; i < DataLength; ++i) {
+                message[i] = static_cast<uint8_t>(block[i]);
+            }
+
+            if (correctedSymbols) {
+                correctedSymbols[n] = result ? static_cast<int>(block.errors_corrected) : 0;
+            }
+            if (failed) {
+                failed[n] = !result;
+            }
+            if (result) {
+                ++decoded;
+            }
+        }
+
+        return decoded;
+    }
+
+private:
+    // 使用向量化解码器批量解码
+    size_t decodeBatchFast(const uint8_t* codewords, size_t count, uint8_t* messages,
+                           int* correctedSymbols, bool* failed, GFKernelType kernel) const {
+        uint8_t block[CodeLength];
+        size_t decoded = 0;
+
+        for (size_t n = 0; n < count; ++n) {
+            std::memcpy(block, codewords + n * CodeLength, CodeLength);
+
+            int corrected = 0;
+            const bool result = fastDecoder.decode(block, kernel, &corrected);
+
+            // 解码失败时block保持不变，输出未纠正的数据符号
+            std::memcpy(messages + n * DataLength, block, DataLength);
+
+            if (correctedSymbols) {
+                correctedSymbols[n] = result ? corrected : 0;
+            }
+            if (failed) {
+                failed[n] = !result;
+            }
+            if (result) {
+                ++decoded;
+            }
+        }
+
+        return decoded;
+    }
+
+    // 创建生成多项式
+    static field_polynomial_type createGenerator(const field_type& field) {
+        field_polynomial_type generator_polynomial(field);
+
+        if (!schifra::make_sequential_root_generator_polynomial(
+                field,
+                generator_polynomial_index,
+                FecLength,
+                generator_polynomial)) {
+            throw std::runtime_error("创建生成多项式失败");
+        }
+
+        return generator_polynomial;
+    }
+
+    // 共享的Galois域，必须先于编解码器构造
+    std::shared_ptr<const field_type> field;
+
+    // 生成多项式
+    field_polynomial_type generator;
+
+    // 编码器
+    encoder_type encoder;
+
+    // 解码器
+    decoder_type decoder;
+
+    // 查表编码器
+    RSFastEncoder fastEncoder;
+
+    // 向量化解码器
+    RSFastDecoder fastDecoder;
+};
+
+// 支持的编码形状
+struct CodecShape {
+    int codeLength;
+    int dataLength;
+    std::unique_ptr<RSCodecContext> (*create)(std::shared_ptr<const field_type> field);
+};
+
+template <std::size_t CodeLength, std::size_t DataLength>
+std::unique_ptr<RSCodecContext> createContext(std::shared_ptr<const field_type> field) {
+    return std::make_unique<SchifraCodecContext<CodeLength, DataLength>>(std::move(field));
+}
+
+// schifra的编解码器以码长为模板参数，这里列出所有需要实例化的形状
+const CodecShape supportedShapes[] = {
+    {16, 7,  &createContext<16, 7>},
+    {31, 15, &createContext<31, 15>},
+    {31, 23, &createContext<31, 23>},
+    {31, 27, &createContext<31, 27>},
+    {63, 31, &createContext<63, 31>},
+    {63, 47, &createContext<63, 47>},
+    {63, 55, &createContext<63, 55>},
+};
+
+// 查找编码形状
+const CodecShape* findShape(int codeLength, int dataLength) {
+    for (const auto& shape : supportedShapes) {
+        if (shape.codeLength == codeLength && shape.dataLength == dataLength) {
+            return &shape;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+// 检查是否支持该编码形状
+bool RSCodecContext::isSupported(int codeLength, int dataLength) {
+    return findShape(codeLength, dataLength) != nullptr;
+}
+
+// 创建一个新的编解码上下文
+std::unique_ptr<RSCodecContext> RSCodecContext::create(int codeLength, int dataLength) {
+    const CodecShape* shape = findShape(codeLength, dataLength);
+    if (!shape) {
+        return nullptr;
+    }
+    return shape->create(createField());
+}
+
+// 设置解码内核
+void RSCodecContext::setDecoderKernel(GFKernelType kernel) {
+    if (!isGFKernelSupported(kernel)) {
+        LOG_WARNING(std::string("CPU不支持解码内核") + getGFKernelName(kernel) + "，使用scalar");
+        kernel = GFKernelType::SCALAR;
+    }
+    decoderKernel().store(kernel, std::memory_order_relaxed);
+}
+
+// 获取当前解码内核
+GFKernelType RSCodecContext::getDecoderKernel() {
+    return decoderKernel().load(std::memory_order_relaxed);
+}
+
+// 获取单例实例
+RSCodecCache& RSCodecCache::getInstance() {
+    static RSCodecCache instance;
+    return instance;
+}
+
+// 预先构建Link16使用的编码形状
+bool RSCodecCache::preload() {
+    return preload({{code_31_15, data_31_15}, {code_16_7, data_16_7}});
+}
+
+// 预先构建指定的编码形状
+bool RSCodecCache::preload(const std::vector<std::pair<int, int>>& shapes) {
+    bool result = true;
+    for (const auto& shape : shapes) {
+        if (!get(shape.first, shape.second)) {
+            result = false;
+        }
+    }
+    return result;
+}
+
+// 获取编解码上下文
+std::shared_ptr<const RSCodecContext> RSCodecCache::get(int codeLength, int dataLength) {
+    const auto key = std::make_pair(codeLength, dataLength);
+
+    {
+        std::shared_lock<std::shared_mutex> lock(cacheMutex);
+        auto it = contexts.find(key);
+        if (it != contexts.end()) {
+            return it->second;
+        }
+    }
+
+    const CodecShape* shape = findShape(codeLength, dataLength);
+    if (!shape) {
+        LOG_ERROR("不支持的RS编码形状: codeLength=" + std::to_string(codeLength) +
+                  ", dataLength=" + std::to_string(dataLength));
+        return nullptr;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(cacheMutex);
+
+    // 其他线程可能已经构建完成
+    auto it = contexts.find(key);
+    if (it != contexts.end()) {
+        return it->second;
+    }
+
+    // 所有形状共享同一个GF(2^8)域
+    static const std::shared_ptr<const field_type> sharedField = createField();
+
+    try {
+        std::shared_ptr<const RSCodecContext> context = shape->create(sharedField);
+        contexts.emplace(key, context);
+
+        LOG_INFO("构建RS编解码上下文: codeLength=" + std::to_string(codeLength) +
+                 ", dataLength=" + std::to_string(dataLength));
+        return context;
+    } catch (const std::exception& e) {
+        LOG_ERROR("构建RS编解码上下文失败: " + std::string(e.what()));
+        return nullptr;
+    }
+}
+
+// 获取已缓存的上下文数量
+size_t RSCodecCache::size() const {
+    std::shared_lock<std::shared_mutex> lock(cacheMutex);
+    return contexts.size();
+}
+
+// 清空缓存
+void RSCodecCache::clear() {
+    std::unique_lock<std::shared_mutex> lock(cacheMutex);
+    contexts.clear();
+}
+
+} // namespace error_correction
+} // namespace coding
+} // namespace link16
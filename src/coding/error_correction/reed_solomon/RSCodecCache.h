@@ -0,0 +1,175 @@
+#pragma once
+
+#include "RSFastDecoder.h"
+#include <cstdint>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+namespace link16 {
+namespace coding {
+namespace error_correction {
+
+/**
+ * @brief Reed-Solomon编解码上下文
+ *
+ * 封装某一(codeLength, dataLength)形状下预先构建好的Galois域、生成多项式、
+ * 编码器和解码器。上下文构建完成后只读，可在多个线程间共享。
+ */
+class RSCodecContext {
+public:
+    /**
+     * @brief 析构函数
+     */
+    virtual ~RSCodecContext() = default;
+
+    /**
+     * @brief 获取编码长度
+     * @return 编码长度
+     */
+    virtual int getCodeLength() const = 0;
+
+    /**
+     * @brief 获取数据长度
+     * @return 数据长度
+     */
+    virtual int getDataLength() const = 0;
+
+    /**
+     * @brief 编码一个码字
+     * @param data 数据符号，长度为dataLength
+     * @param codeword 输出码字缓冲区，长度至少为codeLength，可以与data相同(原地编码)
+     * @return 编码是否成功
+     */
+    virtual bool encode(const uint8_t* data, uint8_t* codeword) const = 0;
+
+    /**
+     * @brief 原地解码一个码字
+     * @param codeword 码字缓冲区，长度为codeLength，解码后被纠正
+     * @param correctedSymbols 输出纠正的符号数量，可为空
+     * @return 解码是否成功
+     */
+    virtual bool decode(uint8_t* codeword, int* correctedSymbols = nullptr) const = 0;
+
+    /**
+     * @brief 批量编码
+     * @param messages 连续存放的count条消息，每条dataLength字节
+     * @param count 消息数量
+     * @param codewords 输出缓冲区，连续存放count个码字，每个codeLength字节
+     * @return 编码成功的码字数量
+     */
+    virtual size_t encodeBatch(const uint8_t* messages, size_t count, uint8_t* codewords) const = 0;
+
+    /**
+     * @brief 批量解码
+     * @param codewords 连续存放的count个码字，每个codeLength字节
+     * @param count 码字数量
+     * @param messages 输出缓冲区，连续存放count条消息，每条dataLength字节；
+     *                 解码失败的码字输出未纠正的数据符号
+     * @param correctedSymbols 输出每个码字纠正的符号数量，可为空
+     * @param failed 输出每个码字是否解码失败，可为空
+     * @return 解码成功的码字数量
+     */
+    virtual size_t decodeBatch(const uint8_t* codewords, size_t count, uint8_t* messages,
+                               int* correctedSymbols = nullptr, bool* failed = nullptr) const = 0;
+
+    /**
+     * @brief 检查是否支持该编码形状
+     * @param codeLength 编码长度
+     * @param dataLength 数据长度
+     * @return 是否支持
+     */
+    static bool isSupported(int codeLength, int dataLength);
+
+    /**
+     * @brief 创建一个新的(不经过缓存的)编解码上下文
+     * @param codeLength 编码长度
+     * @param dataLength 数据长度
+     * @return 编解码上下文，不支持的形状返回空指针
+     */
+    static std::unique_ptr<RSCodecContext> create(int codeLength, int dataLength);
+
+    /**
+     * @brief 设置所有上下文解码使用的内核
+     *
+     * 默认使用当前CPU支持的最快内核；REFERENCE使用schifra原始编解码器，
+     * 用于对比验证，其他内核编码使用不分配内存的RSFastEncoder。不支持的内核按SCALAR处理。
+     * @param kernel 内核类型
+     */
+    static void setDecoderKernel(GFKernelType kernel);
+
+    /**
+     * @brief 获取当前解码内核
+     * @return 内核类型
+     */
+    static GFKernelType getDecoderKernel();
+};
+
+/**
+ * @brief Reed-Solomon编解码上下文缓存
+ *
+ * 以(codeLength, dataLength)为键缓存RSCodecContext，所有形状共享同一个GF(2^8)域。
+ * 通常在CodingProcessor::initialize()中调用preload()预先构建Link16常用形状，
+ * 之后的查找只需要读锁。
+ */
+class RSCodecCache {
+public:
+    /**
+     * @brief 获取单例实例
+     * @return 全局唯一的缓存实例
+     */
+    static RSCodecCache& getInstance();
+
+    /**
+     * @brief 预先构建Link16使用的编码形状，即RS(31,15)和RS(16,7)
+     * @return 是否全部构建成功
+     */
+    bool preload();
+
+    /**
+     * @brief 预先构建指定的编码形状
+     * @param shapes (codeLength, dataLength)列表
+     * @return 是否全部构建成功
+     */
+    bool preload(const std::vector<std::pair<int, int>>& shapes);
+
+    /**
+     * @brief 获取编解码上下文，不存在时构建并缓存
+     * @param codeLength 编码长度
+     * @param dataLength 数据长度
+     * @return 只读的编解码上下文，不支持的形状返回空指针
+     */
+    std::shared_ptr<const RSCodecContext> get(int codeLength, int dataLength);
+
+    /**
+     * @brief 获取已缓存的上下文数量
+     * @return 上下文数量
+     */
+    size_t size() const;
+
+    /**
+     * @brief 清空缓存
+     */
+    void clear();
+
+private:
+    // 私有构造函数(单例模式)
+    RSCodecCache() = default;
+
+    // 禁止拷贝和赋值
+    RSCodecCache(const RSCodecCache&) = delete;
+    RSCodecCache& operator=(const RSCodecCache&) = delete;
+
+    // 读写锁，查找只需共享锁
+    mutable std::shared_mutex cacheMutex;
+
+    // 缓存的上下文
+    std::map<std::pair<int, int>, std::shared_ptr<const RSCodecContext>> contexts;
+};
+
+} // namespace error_correction
+} // namespace coding
+} // namespace link16
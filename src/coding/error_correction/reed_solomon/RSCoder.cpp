@@ -1,21 +1,28 @@
 #include "RSCoder.h"
+#include "RSCodecCache.h"
 #include "core/utils/logger.h"
 #include <iostream>
 #include <cstring>
 #include <vector>
 #include <stdexcept>
-#include "lib/schifra/schifra_galois_field.hpp"
-#include "lib/schifra/schifra_galois_field_polynomial.hpp"
-#include "lib/schifra/schifra_sequential_root_generator_polynomial_creator.hpp"
-#include "lib/schifra/schifra_reed_solomon_encoder.hpp"
-#include "lib/schifra/schifra_reed_solomon_decoder.hpp"
-#include "lib/schifra/schifra_reed_solomon_block.hpp"
-#include "lib/schifra/schifra_error_processes.hpp"
+#include <algorithm>
 
 namespace link16 {
 namespace coding {
 namespace error_correction {
 
+// 内部实现
+class RSCoder::Impl {
+public:
+    // 当前参数对应的编解码上下文(来自全局缓存，只读共享)
+    std::shared_ptr<const RSCodecContext> context;
+
+    // 从缓存获取编解码上下文
+    void bind(int codeLength, int dataLength) {
+        context = RSCodecCache::getInstance().get(codeLength, dataLength);
+    }
+};
+
 // 检查参数是否有效
 bool RSCoder::isValidParameters(int codeLength, int dataLength) {
     return (codeLength > 0 && dataLength > 0 && dataLength < codeLength && codeLength < 256);
@@ -23,7 +30,7 @@ bool RSCoder::isValidParameters(int codeLength, int dataLength) {
 
 // 构造函数
 RSCoder::RSCoder(int codeLength, int dataLength)
-    : codeLength(codeLength), dataLength(dataLength) {
+    : codeLength(codeLength), dataLength(dataLength), pImpl(std::make_unique<Impl>()) {
     // 检查参数有效性
     if (!isValidParameters(codeLength, dataLength)) {
         LOG_ERROR("RS编码器参数无效: codeLength=" + std::to_string(codeLength) +
@@ -34,172 +41,146 @@ RSCoder::RSCoder(int codeLength, int dataLength)
     }
 
     errorCorrectionCapability = (this->codeLength - this->dataLength) / 2;
-    LOG_INFO("创建RS编码器: codeLength=" + std::to_string(this->codeLength) +
-             ", dataLength=" + std::to_string(this->dataLength) +
-             ", 纠错能力=" + std::to_string(errorCorrectionCapability));
+    pImpl->bind(this->codeLength, this->dataLength);
+
+    LOG_DEBUG("创建RS编码器: codeLength=" + std::to_string(this->codeLength) +
+              ", dataLength=" + std::to_string(this->dataLength) +
+              ", 纠错能力=" + std::to_string(errorCorrectionCapability));
 }
 
 // 析构函数
 RSCoder::~RSCoder() {
 }
 
-// 编码函数
-bool RSCoder::encode(const std::string& message, uint8_t* encodedData) {
-    if (!encodedData) {
-        LOG_ERROR("编码数据缓冲区为空");
-        return false;
+// 编码函数(分块版本)
+std::string RSCoder::encode(const std::string& message) {
+    if (!pImpl->context) {
+        throw std::runtime_error("RS编解码上下文不可用");
     }
 
     if (message.empty()) {
-        LOG_ERROR("消息为空");
-        return false;
+        return std::string();
     }
 
-    LOG_INFO("RS编码: 消息长度=" + std::to_string(message.length()) +
-             ", codeLength=" + std::to_string(codeLength) +
-             ", dataLength=" + std::to_string(dataLength));
-
-    try {
-        // 定义RS编码参数
-        const std::size_t field_descriptor                = 8;
-        const std::size_t generator_polynomial_index      = 0;
-        const std::size_t generator_polynomial_root_count = codeLength - dataLength;
+    const size_t blockCount = (message.length() + dataLength - 1) / dataLength;
+    std::string encodedData(blockCount * codeLength, '\0');
+    std::vector<uint8_t> block(dataLength);
 
-        // 创建Galois域
-        typedef schifra::galois::field<field_descriptor> field_type;
-        typedef schifra::galois::field_polynomial<field_type> field_polynomial_type;
+    for (size_t b = 0; b < blockCount; ++b) {
+        const size_t offset = b * dataLength;
+        const size_t count = std::min(message.length() - offset, static_cast<size_t>(dataLength));
 
-        // 创建Reed-Solomon编码器和解码器
-        typedef schifra::reed_solomon::encoder<field_type, dataLength, codeLength> encoder_type;
-        typedef schifra::reed_solomon::decoder<field_type, dataLength, codeLength> decoder_type;
+        std::memcpy(block.data(), message.data() + offset, count);
+        std::memset(block.data() + count, 0, dataLength - count);
 
-        // 创建Reed-Solomon块
-        typedef schifra::reed_solomon::block<field_type, dataLength, codeLength> block_type;
-
-        // 创建Galois域
-        const field_type field;
-
-        // 创建生成多项式
-        field_polynomial_type generator_polynomial(field);
-
-        // 创建生成多项式
-        if (!schifra::make_sequential_root_generator_polynomial(
-                field,
-                generator_polynomial_index,
-                generator_polynomial_root_count,
-                generator_polynomial)) {
-            LOG_ERROR("创建生成多项式失败");
-            return false;
+        if (!pImpl->context->encode(block.data(),
+                                    reinterpret_cast<uint8_t*>(&encodedData[b * codeLength]))) {
+            throw std::runtime_error("RS编码失败");
         }
+    }
+
+    return encodedData;
+}
 
-        // 创建编码器
-        const encoder_type encoder(field, generator_polynomial);
+// 解码函数(分块版本)
+std::string RSCoder::decode(const std::string& encodedData) {
+    if (!pImpl->context) {
+        throw std::runtime_error("RS编解码上下文不可用");
+    }
 
-        // 创建编码块
-        block_type block;
+    if (encodedData.length() % codeLength != 0) {
+        throw std::invalid_argument("RS编码数据长度不是码长的整数倍: " +
+                                    std::to_string(encodedData.length()));
+    }
 
-        // 填充数据
-        for (std::size_t i = 0; i < dataLength; ++i) {
-            if (i < message.length()) {
-                block.data[i] = static_cast<uint8_t>(message[i]);
-            } else {
-                block.data[i] = 0; // 填充0
-            }
-        }
+    const size_t blockCount = encodedData.length() / codeLength;
+    std::string message(blockCount * dataLength, '\0');
+    std::vector<uint8_t> block(codeLength);
 
-        // 编码
-        if (!encoder.encode(block)) {
-            LOG_ERROR("RS编码失败");
-            return false;
-        }
+    for (size_t b = 0; b < blockCount; ++b) {
+        std::memcpy(block.data(), encodedData.data() + b * codeLength, codeLength);
 
-        // 复制编码结果
-        for (std::size_t i = 0; i < codeLength; ++i) {
-            encodedData[i] = block[i];
+        if (!pImpl->context->decode(block.data())) {
+            throw std::runtime_error("RS解码失败: 块" + std::to_string(b));
         }
 
-        LOG_INFO("RS编码成功");
-        return true;
-    } catch (const std::exception& e) {
-        LOG_ERROR("RS编码异常: " + std::string(e.what()));
-        return false;
+        std::memcpy(&message[b * dataLength], block.data(), dataLength);
     }
+
+    // 去除末尾填充的0
+    message.erase(message.find_last_not_of('\0') + 1);
+    return message;
 }
 
-// 解码函数
-bool RSCoder::decode(const uint8_t* encodedData, std::string& message) {
+// 编码函数
+bool RSCoder::encode(const std::string& message, uint8_t* encodedData) {
     if (!encodedData) {
         LOG_ERROR("编码数据缓冲区为空");
         return false;
     }
 
-    LOG_INFO("RS解码: codeLength=" + std::to_string(codeLength) +
-             ", dataLength=" + std::to_string(dataLength));
-
-    try {
-        // 定义RS编码参数
-        const std::size_t field_descriptor                = 8;
-        const std::size_t generator_polynomial_index      = 0;
-        const std::size_t generator_polynomial_root_count = codeLength - dataLength;
+    if (message.empty()) {
+        LOG_ERROR("消息为空");
+        return false;
+    }
 
-        // 创建Galois域
-        typedef schifra::galois::field<field_descriptor> field_type;
-        typedef schifra::galois::field_polynomial<field_type> field_polynomial_type;
+    if (!pImpl->context) {
+        LOG_ERROR("RS编解码上下文不可用");
+        return false;
+    }
 
-        // 创建Reed-Solomon编码器和解码器
-        typedef schifra::reed_solomon::decoder<field_type, dataLength, codeLength> decoder_type;
+    LOG_DEBUG("RS编码: 消息长度=" + std::to_string(message.length()) +
+              ", codeLength=" + std::to_string(codeLength) +
+              ", dataLength=" + std::to_string(dataLength));
 
-        // 创建Reed-Solomon块
-        typedef schifra::reed_solomon::block<field_type, dataLength, codeLength> block_type;
+    // 填充数据
+    std::vector<uint8_t> block(dataLength, 0);
+    for (size_t i = 0; i < block.size() && i < message.length(); ++i) {
+        block[i] = static_cast<uint8_t>(message[i]);
+    }
 
-        // 创建Galois域
-        const field_type field;
+    // 编码
+    if (!pImpl->context->encode(block.data(), encodedData)) {
+        LOG_ERROR("RS编码失败");
+        return false;
+    }
 
-        // 创建生成多项式
-        field_polynomial_type generator_polynomial(field);
+    return true;
+}
 
-        // 创建生成多项式
-        if (!schifra::make_sequential_root_generator_polynomial(
-                field,
-                generator_polynomial_index,
-                generator_polynomial_root_count,
-                generator_polynomial)) {
-            LOG_ERROR("创建生成多项式失败");
-            return false;
-        }
+// 解码函数
+bool RSCoder::decode(const uint8_t* encodedData, std::string& message) {
+    if (!encodedData) {
+        LOG_ERROR("编码数据缓冲区为空");
+        return false;
+    }
 
-        // 创建解码器
-        const decoder_type decoder(field, generator_polynomial_index);
+    if (!pImpl->context) {
+        LOG_ERROR("RS编解码上下文不可用");
+        return false;
+    }
 
-        // 创建编码块
-        block_type block;
+    LOG_DEBUG("RS解码: codeLength=" + std::to_string(codeLength) +
+              ", dataLength=" + std::to_string(dataLength));
 
-        // 填充数据
-        for (std::size_t i = 0; i < codeLength; ++i) {
-            block[i] = encodedData[i];
-        }
+    std::vector<uint8_t> block(encodedData, encodedData + codeLength);
 
-        // 解码
-        if (!decoder.decode(block)) {
-            LOG_ERROR("RS解码失败");
-            return false;
-        }
+    // 解码
+    if (!pImpl->context->decode(block.data())) {
+        LOG_ERROR("RS解码失败");
+        return false;
+    }
 
-        // 提取解码结果
-        message.clear();
-        for (std::size_t i = 0; i < dataLength; ++i) {
-            // 跳过填充的0
-            if (block.data[i] != 0) {
-                message.push_back(static_cast<char>(block.data[i]));
-            }
+    // 提取解码结果
+    message.clear();
+    for (int i = 0; i < dataLength; ++i) {
+        // 跳过填充的0
+        if (block[i] != 0) {
+            message.push_back(static_cast<char>(block[i]));
         }
-
-        LOG_INFO("RS解码成功: 解码后消息长度=" + std::to_string(message.length()));
-        return true;
-    } catch (const std::exception& e) {
-        LOG_ERROR("RS解码异常: " + std::string(e.what()));
-        return false;
     }
+
+    return true;
 }
 
 // 编码函数(字节数组版本)
@@ -225,74 +206,26 @@ bool RSCoder::encode(const uint8_t* data, size_t dataSize, uint8_t* encodedData)
         return false;
     }
 
-    LOG_INFO("RS编码(字节数组): 数据大小=" + std::to_string(dataSize) +
-             ", codeLength=" + std::to_string(codeLength) +
-             ", dataLength=" + std::to_string(dataLength));
-
-    try {
-        // 定义RS编码参数
-        const std::size_t field_descriptor                = 8;
-        const std::size_t generator_polynomial_index      = 0;
-        const std::size_t generator_polynomial_root_count = codeLength - dataLength;
-
-        // 创建Galois域
-        typedef schifra::galois::field<field_descriptor> field_type;
-        typedef schifra::galois::field_polynomial<field_type> field_polynomial_type;
-
-        // 创建Reed-Solomon编码器和解码器
-        typedef schifra::reed_solomon::encoder<field_type, dataLength, codeLength> encoder_type;
-
-        // 创建Reed-Solomon块
-        typedef schifra::reed_solomon::block<field_type, dataLength, codeLength> block_type;
-
-        // 创建Galois域
-        const field_type field;
-
-        // 创建生成多项式
-        field_polynomial_type generator_polynomial(field);
-
-        // 创建生成多项式
-        if (!schifra::make_sequential_root_generator_polynomial(
-                field,
-                generator_polynomial_index,
-                generator_polynomial_root_count,
-                generator_polynomial)) {
-            LOG_ERROR("创建生成多项式失败");
-            return false;
-        }
-
-        // 创建编码器
-        const encoder_type encoder(field, generator_polynomial);
-
-        // 创建编码块
-        block_type block;
-
-        // 填充数据
-        for (std::size_t i = 0; i < dataLength; ++i) {
-            if (i < dataSize) {
-                block.data[i] = data[i];
-            } else {
-                block.data[i] = 0; // 填充0
-            }
-        }
+    if (!pImpl->context) {
+        LOG_ERROR("RS编解码上下文不可用");
+        return false;
+    }
 
-        // 编码
-        if (!encoder.encode(block)) {
-            LOG_ERROR("RS编码失败");
-            return false;
-        }
+    LOG_DEBUG("RS编码(字节数组): 数据大小=" + std::to_string(dataSize) +
+              ", codeLength=" + std::to_string(codeLength) +
+              ", dataLength=" + std::to_string(dataLength));
 
-        // 复制编码结果
-        for (std::size_t i = 0; i < codeLength; ++i) {
-            encodedData[i] = block[i];
-        }
+    // 填充数据
+    std::vector<uint8_t> block(dataLength, 0);
+    std::memcpy(block.data(), data, dataSize);
 
-        LOG_INFO("RS编码成功");
-        return true;
-    } catch (const std::exception& e) {
-        LOG_ERROR("RS编码异常: " + std::string(e.what()));
+    // 编码
+    if (!pImpl->context->encode(block.data(), encodedData)) {
+        LOG_ERROR("RS编码失败");
         return false;
     }
+
+    return true;
 }
 
 // 解码函数(字节数组版本)
@@ -307,73 +240,67 @@ bool RSCoder::decode(const uint8_t* encodedData, uint8_t* decodedData, size_t& d
         return false;
     }
 
-    LOG_INFO("RS解码(字节数组): codeLength=" + std::to_string(codeLength) +
-             ", dataLength=" + std::to_string(dataLength));
-
-    try {
-        // 定义RS编码参数
-        const std::size_t field_descriptor                = 8;
-        const std::size_t generator_polynomial_index      = 0;
-        const std::size_t generator_polynomial_root_count = codeLength - dataLength;
-
-        // 创建Galois域
-        typedef schifra::galois::field<field_descriptor> field_type;
-        typedef schifra::galois::field_polynomial<field_type> field_polynomial_type;
-
-        // 创建Reed-Solomon编码器和解码器
-        typedef schifra::reed_solomon::decoder<field_type, dataLength, codeLength> decoder_type;
+    if (!pImpl->context) {
+        LOG_ERROR("RS编解码上下文不可用");
+        return false;
+    }
 
-        // 创建Reed-Solomon块
-        typedef schifra::reed_solomon::block<field_type, dataLength, codeLength> block_type;
+    LOG_DEBUG("RS解码(字节数组): codeLength=" + std::to_string(codeLength) +
+              ", dataLength=" + std::to_string(dataLength));
 
-        // 创建Galois域
-        const field_type field;
+    std::vector<uint8_t> block(encodedData, encodedData + codeLength);
 
-        // 创建生成多项式
-        field_polynomial_type generator_polynomial(field);
+    // 解码
+    if (!pImpl->context->decode(block.data())) {
+        LOG_ERROR("RS解码失败");
+        return false;
+    }
 
-        // 创建生成多项式
-        if (!schifra::make_sequential_root_generator_polynomial(
-                field,
-                generator_polynomial_index,
-                generator_polynomial_root_count,
-                generator_polynomial)) {
-            LOG_ERROR("创建生成多项式失败");
-            return false;
+    // 提取解码结果
+    decodedSize = 0;
+    for (int i = 0; i < dataLength; ++i) {
+        decodedData[i] = block[i];
+        if (block[i] != 0) {
+            decodedSize = i + 1;
         }
+    }
 
-        // 创建解码器
-        const decoder_type decoder(field, generator_polynomial_index);
+    return true;
+}
 
-        // 创建编码块
-        block_type block;
+// 批量编码
+size_t RSCoder::encodeBatch(const uint8_t* messages, size_t count, uint8_t* codewords) {
+    if (!messages || !codewords) {
+        LOG_ERROR("批量编码缓冲区为空");
+        return 0;
+    }
 
-        // 填充数据
-        for (std::size_t i = 0; i < codeLength; ++i) {
-            block[i] = encodedData[i];
-        }
+    if (!pImpl->context) {
+        LOG_ERROR("RS编解码上下文不可用");
+        return 0;
+    }
 
-        // 解码
-        if (!decoder.decode(block)) {
-            LOG_ERROR("RS解码失败");
-            return false;
-        }
+    const size_t encoded = pImpl->context->encodeBatch(messages, count, codewords);
+    if (encoded != count) {
+        LOG_ERROR("RS批量编码失败: " + std::to_string(count - encoded) + "/" + std::to_string(count));
+    }
+    return encoded;
+}
 
-        // 提取解码结果
-        decodedSize = 0;
-        for (std::size_t i = 0; i < dataLength; ++i) {
-            decodedData[i] = block.data[i];
-            if (block.data[i] != 0) {
-                decodedSize = i + 1;
-            }
-        }
+// 批量解码
+size_t RSCoder::decodeBatch(const uint8_t* codewords, size_t count, uint8_t* messages,
+                            int* correctedSymbols, bool* failed) {
+    if (!codewords || !messages) {
+        LOG_ERROR("批量解码缓冲区为空");
+        return 0;
+    }
 
-        LOG_INFO("RS解码成功: 解码后数据大小=" + std::to_string(decodedSize));
-        return true;
-    } catch (const std::exception& e) {
-        LOG_ERROR("RS解码异常: " + std::string(e.what()));
-        return false;
+    if (!pImpl->context) {
+        LOG_ERROR("RS编解码上下文不可用");
+        return 0;
     }
+
+    return pImpl->context->decodeBatch(codewords, count, messages, correctedSymbols, failed);
 }
 
 // 设置编码参数
@@ -385,13 +312,19 @@ void RSCoder::setParameters(int codeLength, int dataLength) {
         return;
     }
 
+    // 参数未变化时无需重新查找上下文
+    if (codeLength == this->codeLength && dataLength == this->dataLength && pImpl->context) {
+        return;
+    }
+
     this->codeLength = codeLength;
     this->dataLength = dataLength;
     this->errorCorrectionCapability = (codeLength - dataLength) / 2;
+    pImpl->bind(codeLength, dataLength);
 
-    LOG_INFO("设置RS编码器参数: codeLength=" + std::to_string(codeLength) +
-             ", dataLength=" + std::to_string(dataLength) +
-             ", 纠错能力=" + std::to_string(errorCorrectionCapability));
+    LOG_DEBUG("设置RS编码器参数: codeLength=" + std::to_string(codeLength) +
+              ", dataLength=" + std::to_string(dataLength) +
+              ", 纠错能力=" + std::to_string(errorCorrectionCapability));
 }
 
 // 获取编码长度
@@ -416,7 +349,7 @@ bool RS(int codeLength, int dataLength, const std::string& message, void* encode
         return false;
     }
 
-    // 创建RS编码器
+    // 创建RS编码器(编解码上下文来自缓存，创建开销很小)
     RSCoder coder(codeLength, dataLength);
 
     // 编码
@@ -435,7 +368,7 @@ bool RS(int codeLength, int dataLength, const uint8_t* data, size_t dataSize, vo
         return false;
     }
 
-    // 创建RS编码器
+    // 创建RS编码器(编解码上下文来自缓存，创建开销很小)
     RSCoder coder(codeLength, dataLength);
 
     // 编码
@@ -28,6 +28,8 @@ public:
     
     /**
      * @brief 编码函数
+     *
+     * 消息按dataLength分块，不足部分补0，每块输出codeLength字节。
      * @param message 要编码的消息
      * @return 编码后的数据
      */
@@ -35,11 +37,66 @@ public:
     
     /**
      * @brief 解码函数
-     * @param encodedData 编码后的数据
-     * @return 解码后的消息
+     * @param encodedData 编码后的数据，长度必须为codeLength的整数倍
+     * @return 解码后的消息(去除末尾的填充0)
      */
     std::string decode(const std::string& encodedData);
     
+    /**
+     * @brief 编码单个码字
+     * @param message 要编码的消息，超出dataLength的部分被忽略
+     * @param encodedData 输出缓冲区，长度至少为codeLength
+     * @return 编码是否成功
+     */
+    bool encode(const std::string& message, uint8_t* encodedData);
+    
+    /**
+     * @brief 解码单个码字
+     * @param encodedData 编码后的数据，长度为codeLength
+     * @param message 解码后的消息
+     * @return 解码是否成功
+     */
+    bool decode(const uint8_t* encodedData, std::string& message);
+    
+    /**
+     * @brief 编码单个码字(字节数组版本)
+     * @param data 输入数据
+     * @param dataSize 输入数据大小，不大于dataLength
+     * @param encodedData 输出缓冲区，长度至少为codeLength
+     * @return 编码是否成功
+     */
+    bool encode(const uint8_t* data, size_t dataSize, uint8_t* encodedData);
+    
+    /**
+     * @brief 解码单个码字(字节数组版本)
+     * @param encodedData 编码后的数据，长度为codeLength
+     * @param decodedData 输出缓冲区，长度至少为dataLength
+     * @param decodedSize 解码后的有效数据大小
+     * @return 解码是否成功
+     */
+    bool decode(const uint8_t* encodedData, uint8_t* decodedData, size_t& decodedSize);
+    
+    /**
+     * @brief 批量编码
+     * @param messages 连续存放的count条消息，每条dataLength字节
+     * @param count 消息数量
+     * @param codewords 调用方提供的输出缓冲区，大小至少为count * codeLength
+     * @return 编码成功的码字数量
+     */
+    size_t encodeBatch(const uint8_t* messages, size_t count, uint8_t* codewords);
+    
+    /**
+     * @brief 批量解码
+     * @param codewords 连续存放的count个码字，每个codeLength字节
+     * @param count 码字数量
+     * @param messages 调用方提供的输出缓冲区，大小至少为count * dataLength
+     * @param correctedSymbols 输出每个码字纠正的符号数量，可为空
+     * @param failed 输出每个码字是否解码失败，可为空
+     * @return 解码成功的码字数量
+     */
+    size_t decodeBatch(const uint8_t* codewords, size_t count, uint8_t* messages,
+                       int* correctedSymbols = nullptr, bool* failed = nullptr);
+    
     /**
      * @brief 设置编码参数
      * @param codeLength 编码长度，必须大于0且小于256
@@ -99,11 +156,32 @@ private:
     // 纠错能力
     int errorCorrectionCapability;
     
-    // 内部实现
+    // 内部实现，持有当前参数对应的缓存编解码上下文
     class Impl;
     std::unique_ptr<Impl> pImpl;
 };
 
+/**
+ * @brief 全局RS编码函数
+ * @param codeLength 编码长度
+ * @param dataLength 数据长度
+ * @param message 要编码的消息
+ * @param encodedData 输出缓冲区，长度至少为codeLength
+ * @return 编码是否成功
+ */
+bool RS(int codeLength, int dataLength, const std::string& message, void* encodedData);
+
+/**
+ * @brief 全局RS编码函数(字节数组版本)
+ * @param codeLength 编码长度
+ * @param dataLength 数据长度
+ * @param data 输入数据
+ * @param dataSize 输入数据大小
+ * @param encodedData 输出缓冲区，长度至少为codeLength
+ * @return 编码是否成功
+ */
+bool RS(int codeLength, int dataLength, const uint8_t* data, size_t dataSize, void* encodedData);
+
 } // namespace error_correction
 } // namespace coding
 } // namespace link16
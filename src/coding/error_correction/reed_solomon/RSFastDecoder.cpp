@@ -0,0 +1,583 @@
+#include "RSFastDecoder.h"
+#include "core/utils/cpuFeatures.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include "schifra/schifra_galois_field.hpp"
+
+#if defined(LINK16_ARCH_X86)
+    #include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+namespace link16 {
+namespace coding {
+namespace error_correction {
+
+namespace {
+
+// GF(2^8)参数
+const int field_size = 255;
+
+// 支持的最大校验长度及多项式缓冲区大小
+const int max_fec_length = 64;
+const int max_poly_size = 2 * max_fec_length + 4;
+
+// 固定容量的多项式(低次在前)
+struct Poly {
+    uint8_t coef[max_poly_size];
+    int size;
+};
+
+// 去除高次的0系数(对应field_polynomial::simplify)
+void trim(Poly& poly) {
+    while (poly.size > 0 && poly.coef[poly.size - 1] == 0) {
+        --poly.size;
+    }
+}
+
+// 标量伴随式: S_j = sum_t c_t * alpha^(j*(n-1-t))
+void syndromesScalar(const uint8_t* codeword, int codeLength, int fecLength,
+                     const uint8_t* powers, const uint8_t* expTable, const int* logTable,
+                     uint8_t* syndromes) {
+    for (int j = 0; j < fecLength; ++j) {
+        const uint8_t* row = powers + (j / 16) * codeLength * 16 + (j % 16);
+        uint8_t sum = 0;
+        for (int t = 0; t < codeLength; ++t) {
+            const uint8_t c = codeword[t];
+            const uint8_t p = row[t * 16];
+            if (c != 0 && p != 0) {
+                sum ^= expTable[logTable[c] + logTable[p]];
+            }
+        }
+        syndromes[j] = sum;
+    }
+}
+
+// 标量Chien搜索
+int chienScalar(const uint8_t* lambda, int size, const uint8_t* powers,
+                const uint8_t* expTable, const int* logTable, int* roots) {
+    const int degree = size - 1;
+    int count = 0;
+    for (int i = 1; i <= field_size; ++i) {
+        uint8_t sum = 0;
+        for (int k = 0; k < size; ++k) {
+            const uint8_t p = powers[k * 256 + i];
+            if (lambda[k] != 0) {
+                sum ^= expTable[logTable[lambda[k]] + logTable[p]];
+            }
+        }
+        if (sum == 0) {
+            roots[count++] = i;
+            if (count == degree) {
+                break;
+            }
+        }
+    }
+    return count;
+}
+
+#if defined(LINK16_ARCH_X86)
+
+// 分半字节乘法: c*x = Tlo[x & 0x0F] ^ Thi[x >> 4]
+LINK16_TARGET("sse4.1")
+inline __m128i mulConst128(__m128i x, __m128i low, __m128i high, __m128i mask) {
+    const __m128i lo = _mm_and_si128(x, mask);
+    const __m128i hi = _mm_and_si128(_mm_srli_epi64(x, 4), mask);
+    return _mm_xor_si128(_mm_shuffle_epi8(low, lo), _mm_shuffle_epi8(high, hi));
+}
+
+LINK16_TARGET("avx2")
+inline __m256i mulConst256(__m256i x, __m256i low, __m256i high, __m256i mask) {
+    const __m256i lo = _mm256_and_si256(x, mask);
+    const __m256i hi = _mm256_and_si256(_mm256_srli_epi64(x, 4), mask);
+    return _mm256_xor_si256(_mm256_shuffle_epi8(low, lo), _mm256_shuffle_epi8(high, hi));
+}
+
+// SSE4.1伴随式: 每次计算16个伴随式，码字符号作为乘法常数
+LINK16_TARGET("sse4.1")
+void syndromesSSE41(const uint8_t* codeword, int codeLength, int groups,
+                    const uint8_t* powers, const uint8_t* nibbleLow, const uint8_t* nibbleHigh,
+                    uint8_t* syndromes) {
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    for (int g = 0; g < groups; ++g) {
+        const uint8_t* rows = powers + g * codeLength * 16;
+        __m128i acc = _mm_setzero_si128();
+        for (int t = 0; t < codeLength; ++t) {
+            const uint8_t c = codeword[t];
+            if (c == 0) {
+                continue;
+            }
+            const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(nibbleLow + c * 16));
+            const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(nibbleHigh + c * 16));
+            const __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows + t * 16));
+            acc = _mm_xor_si128(acc, mulConst128(p, low, high, mask));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(syndromes + g * 16), acc);
+    }
+}
+
+// AVX2伴随式: 高低128位分别处理相邻两个码字符号，最后合并
+LINK16_TARGET("avx2")
+void syndromesAVX2(const uint8_t* codeword, int codeLength, int groups,
+                   const uint8_t* powers, const uint8_t* nibbleLow, const uint8_t* nibbleHigh,
+                   uint8_t* syndromes) {
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    for (int g = 0; g < groups; ++g) {
+        const uint8_t* rows = powers + g * codeLength * 16;
+        __m256i acc = _mm256_setzero_si256();
+        int t = 0;
+        for (; t + 1 < codeLength; t += 2) {
+            const uint8_t c0 = codeword[t];
+            const uint8_t c1 = codeword[t + 1];
+            const __m256i low = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(nibbleLow + c0 * 16))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(nibbleLow + c1 * 16)), 1);
+            const __m256i high = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(nibbleHigh + c0 * 16))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(nibbleHigh + c1 * 16)), 1);
+            const __m256i p = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rows + t * 16));
+            acc = _mm256_xor_si256(acc, mulConst256(p, low, high, mask));
+        }
+        __m128i sum = _mm_xor_si128(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+        if (t < codeLength && codeword[t] != 0) {
+            const uint8_t c = codeword[t];
+            const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(nibbleLow + c * 16));
+            const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(nibbleHigh + c * 16));
+            const __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows + t * 16));
+            sum = _mm_xor_si128(sum, mulConst128(p, low, high, _mm_set1_epi8(0x0F)));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(syndromes + g * 16), sum);
+    }
+}
+
+// 最低置位的位置，value不为0
+inline int countTrailingZeros(unsigned int value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(value);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return static_cast<int>(index);
+#else
+    int count = 0;
+    while ((value & 1u) == 0) {
+        value >>= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+// 从零字节掩码中按升序收集根，返回是否已找到全部根
+inline bool collectRoots(unsigned int zeroMask, int base, int degree, int* roots, int& count) {
+    while (zeroMask != 0) {
+        const int bit = countTrailingZeros(zeroMask);
+        zeroMask &= zeroMask - 1;
+        roots[count++] = base + bit;
+        if (count == degree) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// SSE4.1 Chien搜索: 每次计算16个求值点，多项式系数作为乘法常数
+LINK16_TARGET("sse4.1")
+int chienSSE41(const uint8_t* lambda, int size, const uint8_t* powers,
+               const uint8_t* nibbleLow, const uint8_t* nibbleHigh, int* roots) {
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    const __m128i zero = _mm_setzero_si128();
+    const int degree = size - 1;
+    int count = 0;
+    for (int base = 0; base < 256; base += 16) {
+        __m128i acc = zero;
+        for (int k = 0; k < size; ++k) {
+            const uint8_t c = lambda[k];
+            if (c == 0) {
+                continue;
+            }
+            const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(nibbleLow + c * 16));
+            const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(nibbleHigh + c * 16));
+            const __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(powers + k * 256 + base));
+            acc = _mm_xor_si128(acc, mulConst128(p, low, high, mask));
+        }
+        unsigned int zeroMask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(acc, zero)));
+        if (base == 0) {
+            zeroMask &= ~1u;  // 0不是域中的非零元素
+        }
+        if (collectRoots(zeroMask, base, degree, roots, count)) {
+            break;
+        }
+    }
+    return count;
+}
+
+// AVX2 Chien搜索: 每次计算32个求值点
+LINK16_TARGET("avx2")
+int chienAVX2(const uint8_t* lambda, int size, const uint8_t* powers,
+              const uint8_t* nibbleLow, const uint8_t* nibbleHigh, int* roots) {
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    const __m256i zero = _mm256_setzero_si256();
+    const int degree = size - 1;
+    int count = 0;
+    for (int base = 0; base < 256; base += 32) {
+        __m256i acc = zero;
+        for (int k = 0; k < size; ++k) {
+            const uint8_t c = lambda[k];
+            if (c == 0) {
+                continue;
+            }
+            const __m256i low = _mm256_broadcastsi128_si256(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(nibbleLow + c * 16)));
+            const __m256i high = _mm256_broadcastsi128_si256(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(nibbleHigh + c * 16)));
+            const __m256i p = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(powers + k * 256 + base));
+            acc = _mm256_xor_si256(acc, mulConst256(p, low, high, mask));
+        }
+        unsigned int zeroMask = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(acc, zero)));
+        if (base == 0) {
+            zeroMask &= ~1u;  // 0不是域中的非零元素
+        }
+        if (collectRoots(zeroMask, base, degree, roots, count)) {
+            break;
+        }
+    }
+    return count;
+}
+
+#endif
+
+// 未指定或不支持的内核退回到标量实现
+GFKernelType resolveKernel(GFKernelType kernel) {
+    return isGFKernelSupported(kernel) ? kernel : GFKernelType::SCALAR;
+}
+
+} // namespace
+
+// 获取内核名称
+const char* getGFKernelName(GFKernelType type) {
+    switch (type) {
+        case GFKernelType::REFERENCE: return "reference";
+        case GFKernelType::SCALAR:    return "scalar";
+        case GFKernelType::SSE41:     return "sse4.1";
+        case GFKernelType::AVX2:      return "avx2";
+    }
+    return "unknown";
+}
+
+// 检查当前CPU是否支持该内核
+bool isGFKernelSupported(GFKernelType type) {
+    switch (type) {
+        case GFKernelType::REFERENCE:
+        case GFKernelType::SCALAR:
+            return true;
+#if defined(LINK16_ARCH_X86)
+        case GFKernelType::SSE41:
+            return utils::CpuFeatures::get().sse41;
+        case GFKernelType::AVX2:
+            return utils::CpuFeatures::get().avx2;
+#else
+        case GFKernelType::SSE41:
+        case GFKernelType::AVX2:
+            return false;
+#endif
+    }
+    return false;
+}
+
+// 获取当前CPU支持的最快内核
+GFKernelType detectGFKernel() {
+    if (isGFKernelSupported(GFKernelType::AVX2)) {
+        return GFKernelType::AVX2;
+    }
+    if (isGFKernelSupported(GFKernelType::SSE41)) {
+        return GFKernelType::SSE41;
+    }
+    return GFKernelType::SCALAR;
+}
+
+// 构造函数
+RSFastDecoder::RSFastDecoder(const schifra::galois::field& field, int codeLength, int dataLength)
+    : codeLength(codeLength),
+      dataLength(dataLength),
+      fecLength(codeLength - dataLength),
+      paddingLength(field_size - codeLength),
+      syndromeGroups((codeLength - dataLength + 15) / 16),
+      chienTerms(codeLength - dataLength + 2),
+      expTable(2 * 256, 0),
+      logTable(256, 0) {
+    if (field.size() != static_cast<unsigned int>(field_size)) {
+        throw std::invalid_argument("RSFastDecoder仅支持GF(2^8)");
+    }
+    if (dataLength <= 0 || codeLength <= dataLength || codeLength > field_size ||
+        fecLength > max_fec_length) {
+        throw std::invalid_argument("RSFastDecoder参数无效: codeLength=" + std::to_string(codeLength) +
+                                    ", dataLength=" + std::to_string(dataLength));
+    }
+
+    // 对数/反对数表，expTable加倍以免去乘法时的取模
+    for (int i = 0; i < field_size; ++i) {
+        const uint8_t value = static_cast<uint8_t>(field.alpha(i));
+        expTable[i] = value;
+        expTable[i + field_size] = value;
+        logTable[value] = i;
+    }
+
+    // 伴随式幂次表，按16个伴随式一组、每个码字符号一行存放
+    syndromePowers.assign(static_cast<size_t>(syndromeGroups) * codeLength * 16, 0);
+    for (int g = 0; g < syndromeGroups; ++g) {
+        for (int t = 0; t < codeLength; ++t) {
+            for (int lane = 0; lane < 16; ++lane) {
+                const int j = g * 16 + lane;
+                if (j >= fecLength) {
+                    break;
+                }
+                const int exponent = (j * (codeLength - 1 - t)) % field_size;
+                syndromePowers[(static_cast<size_t>(g) * codeLength + t) * 16 + lane] = expTable[exponent];
+            }
+        }
+    }
+
+    // Chien搜索幂次表，第k行为alpha^(i*k)，i=0的列不使用
+    chienPowers.assign(static_cast<size_t>(chienTerms) * 256, 0);
+    for (int k = 0; k < chienTerms; ++k) {
+        for (int i = 1; i < 256; ++i) {
+            chienPowers[k * 256 + i] = expTable[(i * k) % field_size];
+        }
+    }
+
+    // 分半字节乘法表
+    nibbleLow.assign(256 * 16, 0);
+    nibbleHigh.assign(256 * 16, 0);
+    for (int c = 0; c < 256; ++c) {
+        for (int x = 0; x < 16; ++x) {
+            nibbleLow[c * 16 + x] = mul(static_cast<uint8_t>(c), static_cast<uint8_t>(x));
+            nibbleHigh[c * 16 + x] = mul(static_cast<uint8_t>(c), static_cast<uint8_t>(x << 4));
+        }
+    }
+}
+
+// GF(2^8)乘法
+uint8_t RSFastDecoder::mul(uint8_t a, uint8_t b) const {
+    if (a == 0 || b == 0) {
+        return 0;
+    }
+    return expTable[logTable[a] + logTable[b]];
+}
+
+// GF(2^8)除法
+uint8_t RSFastDecoder::div(uint8_t a, uint8_t b) const {
+    if (a == 0 || b == 0) {
+        return 0;
+    }
+    return expTable[logTable[a] - logTable[b] + field_size];
+}
+
+// 多项式在x=alpha^logX处求值
+uint8_t RSFastDecoder::evaluate(const uint8_t* poly, int size, int logX) const {
+    uint8_t sum = 0;
+    for (int k = 0; k < size; ++k) {
+        if (poly[k] != 0) {
+            sum ^= expTable[(logTable[poly[k]] + logX * k) % field_size];
+        }
+    }
+    return sum;
+}
+
+// 计算伴随式
+bool RSFastDecoder::computeSyndromes(const uint8_t* codeword, GFKernelType kernel, uint8_t* syndromes) const {
+    switch (resolveKernel(kernel)) {
+#if defined(LINK16_ARCH_X86)
+        case GFKernelType::AVX2: {
+            uint8_t buffer[max_fec_length];
+            syndromesAVX2(codeword, codeLength, syndromeGroups, syndromePowers.data(),
+                          nibbleLow.data(), nibbleHigh.data(), buffer);
+            std::memcpy(syndromes, buffer, fecLength);
+            break;
+        }
+        case GFKernelType::SSE41: {
+            uint8_t buffer[max_fec_length];
+            syndromesSSE41(codeword, codeLength, syndromeGroups, syndromePowers.data(),
+                           nibbleLow.data(), nibbleHigh.data(), buffer);
+            std::memcpy(syndromes, buffer, fecLength);
+            break;
+        }
+#endif
+        default:
+            syndromesScalar(codeword, codeLength, fecLength, syndromePowers.data(),
+                            expTable.data(), logTable.data(), syndromes);
+            break;
+    }
+
+    uint8_t flag = 0;
+    for (int j = 0; j < fecLength; ++j) {
+        flag |= syndromes[j];
+    }
+    return flag == 0;
+}
+
+// Chien搜索
+int RSFastDecoder::chienSearch(const uint8_t* lambda, int size, GFKernelType kernel, int* roots) const {
+    if (size > chienTerms) {
+        // 超出幂次表范围(正常解码不会出现)，逐点求值
+        const int degree = size - 1;
+        int count = 0;
+        for (int i = 1; i <= field_size; ++i) {
+            if (evaluate(lambda, size, i) == 0) {
+                roots[count++] = i;
+                if (count == degree) {
+                    break;
+                }
+            }
+        }
+        return count;
+    }
+
+    switch (resolveKernel(kernel)) {
+#if defined(LINK16_ARCH_X86)
+        case GFKernelType::AVX2:
+            return chienAVX2(lambda, size, chienPowers.data(), nibbleLow.data(), nibbleHigh.data(), roots);
+        case GFKernelType::SSE41:
+            return chienSSE41(lambda, size, chienPowers.data(), nibbleLow.data(), nibbleHigh.data(), roots);
+#endif
+        default:
+            return chienScalar(lambda, size, chienPowers.data(), expTable.data(), logTable.data(), roots);
+    }
+}
+
+// 原地解码一个码字
+bool RSFastDecoder::decode(uint8_t* codeword, GFKernelType kernel, int* correctedSymbols) const {
+    if (correctedSymbols) {
+        *correctedSymbols = 0;
+    }
+
+    uint8_t syndromes[max_fec_length];
+    if (computeSyndromes(codeword, kernel, syndromes)) {
+        return true;
+    }
+
+    // Berlekamp-Massey，与schifra的modified_berlekamp_massey_algorithm逐步一致
+    Poly lambda;
+    lambda.coef[0] = 1;
+    lambda.size = 1;
+
+    Poly previous;
+    previous.coef[0] = 0;
+    previous.coef[1] = 1;
+    previous.size = 2;
+
+    int i = -1;
+    int l = 0;
+
+    for (int round = 0; round < fecLength; ++round) {
+        const int upperBound = std::min(l, lambda.size - 1);
+        uint8_t discrepancy = 0;
+        for (int k = 0; k <= upperBound; ++k) {
+            discrepancy ^= mul(lambda.coef[k], syndromes[round - k]);
+        }
+
+        if (discrepancy != 0) {
+            Poly tau;
+            tau.size = std::max(lambda.size, previous.size);
+            for (int k = 0; k < tau.size; ++k) {
+                const uint8_t a = (k < lambda.size) ? lambda.coef[k] : 0;
+                const uint8_t b = (k < previous.size) ? mul(discrepancy, previous.coef[k]) : 0;
+                tau.coef[k] = a ^ b;
+            }
+            trim(tau);
+
+            if (l < round - i) {
+                const int tmp = round - i;
+                i = round - l;
+                l = tmp;
+                previous.size = lambda.size;
+                for (int k = 0; k < lambda.size; ++k) {
+                    previous.coef[k] = div(lambda.coef[k], discrepancy);
+                }
+            }
+
+            lambda = tau;
+        }
+
+        if (previous.size > 0) {
+            if (previous.size >= max_poly_size) {
+                return false;
+            }
+            std::memmove(previous.coef + 1, previous.coef, previous.size);
+            previous.coef[0] = 0;
+            ++previous.size;
+        }
+    }
+
+    // Chien搜索
+    int roots[max_poly_size];
+    const int rootCount = chienSearch(lambda.coef, lambda.size, kernel, roots);
+    if (rootCount == 0 || 2 * rootCount > fecLength) {
+        return false;
+    }
+
+    // Forney: omega = (lambda * S) mod x^fecLength
+    uint8_t omega[max_fec_length];
+    for (int k = 0; k < fecLength; ++k) {
+        uint8_t sum = 0;
+        for (int m = 0; m <= k && m < lambda.size; ++m) {
+            sum ^= mul(lambda.coef[m], syndromes[k - m]);
+        }
+        omega[k] = sum;
+    }
+
+    // 形式导数，只保留奇次项
+    uint8_t derivative[max_poly_size];
+    const int derivativeSize = std::max(lambda.size - 1, 1);
+    derivative[0] = 0;
+    for (int k = 0; k + 1 < lambda.size; ++k) {
+        derivative[k] = (k % 2 == 0) ? lambda.coef[k + 1] : 0;
+    }
+
+    // 在副本上纠错，失败时保持输入不变
+    uint8_t corrected[field_size];
+    std::memcpy(corrected, codeword, codeLength);
+    int correctedCount = 0;
+
+    for (int r = 0; r < rootCount; ++r) {
+        const int location = roots[r];
+        const uint8_t numerator = mul(evaluate(omega, fecLength, location),
+                                      expTable[field_size - location]);
+        const uint8_t denominator = evaluate(derivative, derivativeSize, location);
+
+        if (numerator != 0) {
+            if (denominator == 0) {
+                if (correctedSymbols) {
+                    *correctedSymbols = correctedCount;
+                }
+                return false;
+            }
+            // 位置落在缩短码的填充区时与schifra一样只计数
+            const int index = location - 1 - paddingLength;
+            if (index >= 0) {
+                corrected[index] ^= div(numerator, denominator);
+            }
+            ++correctedCount;
+        }
+    }
+
+    if (correctedSymbols) {
+        *correctedSymbols = correctedCount;
+    }
+
+    if (lambda.size - 1 != rootCount) {
+        return false;
+    }
+
+    std::memcpy(codeword, corrected, codeLength);
+    return true;
+}
+
+} // namespace error_correction
+} // namespace coding
+} // namespace link16
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace schifra {
+namespace galois {
+class field;
+} // namespace galois
+} // namespace schifra
+
+namespace link16 {
+namespace coding {
+namespace error_correction {
+
+/**
+ * @brief GF(2^8)解码内核类型
+ */
+enum class GFKernelType {
+    REFERENCE,  // schifra原始解码器
+    SCALAR,     // 查表标量实现
+    SSE41,      // SSE4.1 PSHUFB分半字节乘法
+    AVX2        // AVX2 PSHUFB分半字节乘法
+};
+
+/**
+ * @brief 获取内核名称
+ * @param type 内核类型
+ * @return 内核名称
+ */
+const char* getGFKernelName(GFKernelType type);
+
+/**
+ * @brief 检查当前CPU是否支持该内核
+ * @param type 内核类型
+ * @return 是否支持
+ */
+bool isGFKernelSupported(GFKernelType type);
+
+/**
+ * @brief 获取当前CPU支持的最快内核
+ * @return 内核类型
+ */
+GFKernelType detectGFKernel();
+
+/**
+ * @brief 向量化的Reed-Solomon解码器
+ *
+ * 伴随式计算和Chien搜索使用PSHUFB分半字节查表乘法(SSE4.1/AVX2)，
+ * Berlekamp-Massey和Forney算法沿用schifra的实现细节，
+ * 因此纠错结果、失败判定和纠正符号数与schifra::reed_solomon::shortened_decoder逐位一致。
+ * 构造完成后只读，可被多个线程同时调用。
+ */
+class RSFastDecoder {
+public:
+    /**
+     * @brief 构造函数
+     * @param field GF(2^8)域，根与生成多项式一致(生成多项式索引为0)
+     * @param codeLength 编码长度(缩短码)
+     * @param dataLength 数据长度
+     */
+    RSFastDecoder(const schifra::galois::field& field, int codeLength, int dataLength);
+
+    /**
+     * @brief 原地解码一个码字
+     * @param codeword 码字缓冲区，长度为codeLength，仅在解码成功时被纠正
+     * @param kernel 伴随式和Chien搜索使用的内核，REFERENCE按SCALAR处理
+     * @param correctedSymbols 输出纠正的符号数量(与schifra的errors_corrected一致)，可为空
+     * @return 解码是否成功
+     */
+    bool decode(uint8_t* codeword, GFKernelType kernel, int* correctedSymbols = nullptr) const;
+
+    /**
+     * @brief 计算伴随式
+     * @param codeword 码字，长度为codeLength
+     * @param kernel 内核类型
+     * @param syndromes 输出伴随式，长度为fecLength
+     * @return 伴随式是否全为0
+     */
+    bool computeSyndromes(const uint8_t* codeword, GFKernelType kernel, uint8_t* syndromes) const;
+
+    /**
+     * @brief Chien搜索，按schifra的顺序在alpha^1..alpha^255中查找错误定位多项式的根
+     * @param lambda 错误定位多项式系数(低次在前)
+     * @param size 系数个数
+     * @param kernel 内核类型
+     * @param roots 输出根的指数，至少可容纳size-1个
+     * @return 找到的根数量
+     */
+    int chienSearch(const uint8_t* lambda, int size, GFKernelType kernel, int* roots) const;
+
+    /**
+     * @brief 获取编码长度
+     * @return 编码长度
+     */
+    int getCodeLength() const { return codeLength; }
+
+    /**
+     * @brief 获取数据长度
+     * @return 数据长度
+     */
+    int getDataLength() const { return dataLength; }
+
+private:
+    // GF(2^8)乘法和除法(查对数表)
+    uint8_t mul(uint8_t a, uint8_t b) const;
+    uint8_t div(uint8_t a, uint8_t b) const;
+
+    // 多项式求值，x^k按schifra的约定计算
+    uint8_t evaluate(const uint8_t* poly, int size, int logX) const;
+
+    int codeLength;
+    int dataLength;
+    int fecLength;
+    int paddingLength;     // 缩短码在自然码长255中的填充长度
+    int syndromeGroups;    // 每组16个伴随式
+    int chienTerms;        // Chien搜索表支持的最大系数个数
+
+    std::vector<uint8_t> expTable;   // 512项，免去取模
+    std::vector<int> logTable;       // 256项
+
+    // syndromePowers[(g * codeLength + t) * 16 + lane] = alpha^((g*16+lane) * (n-1-t))
+    std::vector<uint8_t> syndromePowers;
+
+    // chienPowers[k * 256 + i] = alpha^(i*k)
+    std::vector<uint8_t> chienPowers;
+
+    // 分半字节乘法表: nibbleLow[c*16 + x] = c*x, nibbleHigh[c*16 + x] = c*(x<<4)
+    std::vector<uint8_t> nibbleLow;
+    std::vector<uint8_t> nibbleHigh;
+};
+
+} // namespace error_correction
+} // namespace coding
+} // namespace link16
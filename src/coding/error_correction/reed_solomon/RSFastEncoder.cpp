@@ -0,0 +1,77 @@
+#include "RSFastEncoder.h"
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include "schifra/schifra_galois_field.hpp"
+#include "schifra/schifra_galois_field_polynomial.hpp"
+
+namespace link16 {
+namespace coding {
+namespace error_correction {
+
+namespace {
+
+// GF(2^8)参数
+const int field_size = 255;
+
+// 支持的最大校验长度
+const int max_fec_length = 64;
+
+} // namespace
+
+// 构造函数
+RSFastEncoder::RSFastEncoder(const schifra::galois::field& field,
+                             const schifra::galois::field_polynomial& generator,
+                             int codeLength, int dataLength)
+    : codeLength(codeLength),
+      dataLength(dataLength),
+      fecLength(codeLength - dataLength) {
+    if (field.size() != static_cast<unsigned int>(field_size)) {
+        throw std::invalid_argument("RSFastEncoder仅支持GF(2^8)");
+    }
+    if (dataLength <= 0 || codeLength <= dataLength || codeLength > field_size ||
+        fecLength > max_fec_length || generator.deg() != fecLength) {
+        throw std::invalid_argument("RSFastEncoder参数无效: codeLength=" + std::to_string(codeLength) +
+                                    ", dataLength=" + std::to_string(dataLength));
+    }
+
+    // 生成多项式不要求首一，商的系数为反馈值除以最高次系数
+    const schifra::galois::field_symbol lead = generator[fecLength].poly();
+    feedback.assign(static_cast<size_t>(fecLength) * 256, 0);
+    for (int j = 0; j < fecLength; ++j) {
+        const schifra::galois::field_symbol coefficient = field.div(generator[j].poly(), lead);
+        for (int f = 1; f < 256; ++f) {
+            feedback[j * 256 + f] = static_cast<uint8_t>(field.mul(static_cast<schifra::galois::field_symbol>(f),
+                                                                   coefficient));
+        }
+    }
+}
+
+// 编码一个码字
+void RSFastEncoder::encode(const uint8_t* data, uint8_t* codeword) const {
+    // parity[j]为余式x^j的系数；缩短码前部填充的0不改变寄存器状态
+    uint8_t parity[max_fec_length] = {0};
+    const uint8_t* table = feedback.data();
+    const int top = fecLength - 1;
+
+    for (int i = 0; i < dataLength; ++i) {
+        const uint8_t f = data[i] ^ parity[top];
+        const uint8_t* row = table + f;
+        for (int j = top; j > 0; --j) {
+            parity[j] = parity[j - 1] ^ row[j * 256];
+        }
+        parity[0] = row[0];
+    }
+
+    if (codeword != data) {
+        std::memmove(codeword, data, dataLength);
+    }
+    // 校验符号按从高次到低次排列
+    for (int i = 0; i < fecLength; ++i) {
+        codeword[dataLength + i] = parity[top - i];
+    }
+}
+
+} // namespace error_correction
+} // namespace coding
+} // namespace link16
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace schifra {
+namespace galois {
+class field;
+class field_polynomial;
+} // namespace galois
+} // namespace schifra
+
+namespace link16 {
+namespace coding {
+namespace error_correction {
+
+/**
+ * @brief 查表LFSR实现的Reed-Solomon系统编码器
+ *
+ * 校验符号为信息多项式乘x^fecLength后除以生成多项式的余式，与
+ * schifra::reed_solomon::shortened_encoder逐位一致。每个生成多项式系数预先
+ * 展开为256项乘法表，编码只使用栈上的移位寄存器，不分配堆内存。
+ * 构造完成后只读，可被多个线程同时调用。
+ */
+class RSFastEncoder {
+public:
+    /**
+     * @brief 构造函数
+     * @param field GF(2^8)域
+     * @param generator 生成多项式，次数为codeLength - dataLength
+     * @param codeLength 编码长度(缩短码)
+     * @param dataLength 数据长度
+     */
+    RSFastEncoder(const schifra::galois::field& field, const schifra::galois::field_polynomial& generator,
+                  int codeLength, int dataLength);
+
+    /**
+     * @brief 编码一个码字
+     * @param data 信息符号，长度为dataLength
+     * @param codeword 输出码字，长度为codeLength，信息在前、校验在后；
+     *                 可以与data指向同一缓冲区(原地编码)
+     */
+    void encode(const uint8_t* data, uint8_t* codeword) const;
+
+private:
+    int codeLength;
+    int dataLength;
+    int fecLength;
+
+    // feedback[j * 256 + f] = f * g_j / g_fec
+    std::vector<uint8_t> feedback;
+};
+
+} // namespace error_correction
+} // namespace coding
+} // namespace link16
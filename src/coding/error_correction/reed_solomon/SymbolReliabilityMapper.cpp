@@ -0,0 +1,70 @@
+#include "SymbolReliabilityMapper.h"
+#include <algorithm>
+#include <cmath>
+
+namespace link16 {
+namespace coding {
+namespace error_correction {
+
+// 硬判决并计算每个符号的可靠度
+void SymbolReliabilityMapper::mapSymbols(const double* llr, int symbolCount, uint8_t* symbols,
+                                         double* reliability) {
+    for (int t = 0; t < symbolCount; ++t) {
+        const double* bits = llr + t * bits_per_symbol;
+        uint8_t value = 0;
+        double weakest = std::abs(bits[0]);
+        for (int b = 0; b < bits_per_symbol; ++b) {
+            value = static_cast<uint8_t>((value << 1) | (bits[b] > 0.0 ? 1 : 0));
+            weakest = std::min(weakest, std::abs(bits[b]));
+        }
+        symbols[t] = value;
+        if (reliability) {
+            reliability[t] = weakest;
+        }
+    }
+}
+
+// 按可靠度从低到高排列符号位置
+void SymbolReliabilityMapper::rankSymbols(const double* reliability, int symbolCount, int* order) {
+    for (int t = 0; t < symbolCount; ++t) {
+        order[t] = t;
+    }
+    // 码字只有几十个符号，插入排序即可，可靠度相同时位置小的在前
+    for (int i = 1; i < symbolCount; ++i) {
+        const int current = order[i];
+        int j = i;
+        for (; j > 0 && reliability[order[j - 1]] > reliability[current]; --j) {
+            order[j] = order[j - 1];
+        }
+        order[j] = current;
+    }
+}
+
+// 选出可靠度低于门限的符号作为删除
+int SymbolReliabilityMapper::selectErasures(const double* reliability, int symbolCount, double threshold,
+                                            int maxErasures, int* erasures) {
+    int count = 0;
+    for (int t = 0; t < symbolCount; ++t) {
+        if (!(reliability[t] < threshold)) {
+            continue;
+        }
+        // 按可靠度升序插入，已满时挤出最可靠的一个
+        int j;
+        if (count < maxErasures) {
+            j = count++;
+        } else if (maxErasures > 0 && reliability[t] < reliability[erasures[maxErasures - 1]]) {
+            j = maxErasures - 1;
+        } else {
+            continue;
+        }
+        for (; j > 0 && reliability[erasures[j - 1]] > reliability[t]; --j) {
+            erasures[j] = erasures[j - 1];
+        }
+        erasures[j] = t;
+    }
+    return count;
+}
+
+} // namespace error_correction
+} // namespace coding
+} // namespace link16
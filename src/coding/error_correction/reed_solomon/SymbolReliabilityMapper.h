@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace link16 {
+namespace coding {
+namespace error_correction {
+
+/**
+ * @brief 由比特LLR得到RS符号的硬判决和可靠度
+ *
+ * LLR = log(P(b=1)/P(b=0))，每个5bit符号的比特按高位在前连续存放。
+ * 符号的可靠度取其5个比特|LLR|的最小值：只要有一个比特接近判决门限，整个符号就不可靠。
+ * 可靠度最低的符号作为删除交给纠错纠删解码器，每个删除只占用一个校验符号。
+ */
+class SymbolReliabilityMapper {
+public:
+    // 每个符号的比特数
+    static const int bits_per_symbol = 5;
+
+    /**
+     * @brief 硬判决并计算每个符号的可靠度
+     * @param llr 比特LLR，长度为symbolCount * bits_per_symbol
+     * @param symbolCount 符号数量
+     * @param symbols 输出硬判决符号，每字节一个(低5位)
+     * @param reliability 输出每个符号的可靠度，可为空
+     */
+    static void mapSymbols(const double* llr, int symbolCount, uint8_t* symbols, double* reliability);
+
+    /**
+     * @brief 按可靠度从低到高排列符号位置
+     * @param reliability 每个符号的可靠度
+     * @param symbolCount 符号数量
+     * @param order 输出符号位置，长度为symbolCount，前k个即为最不可靠的k个符号
+     */
+    static void rankSymbols(const double* reliability, int symbolCount, int* order);
+
+    /**
+     * @brief 选出可靠度低于门限的符号作为删除，最多maxErasures个，最不可靠的在前
+     * @param reliability 每个符号的可靠度
+     * @param symbolCount 符号数量
+     * @param threshold 可靠度门限
+     * @param maxErasures 最多删除的符号数
+     * @param erasures 输出删除位置，至少可容纳maxErasures个
+     * @return 删除的符号数
+     */
+    static int selectErasures(const double* reliability, int symbolCount, double threshold, int maxErasures,
+                              int* erasures);
+};
+
+} // namespace error_correction
+} // namespace coding
+} // namespace link16
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+namespace link16 {
+namespace coding {
+namespace error_detection {
+
+/**
+ * @brief CRC计算内核类型
+ */
+enum class CRCKernelType {
+    BITWISE,       // 逐比特移位(参考实现)
+    SLICING_BY_8,  // 8张256项查找表，每次处理8字节
+    PCLMUL         // PCLMULQDQ无进位乘法折叠(仅CRC-32)
+};
+
+/**
+ * @brief 获取内核名称
+ * @param type 内核类型
+ * @return 内核名称
+ */
+const char* getCRCKernelName(CRCKernelType type);
+
+/**
+ * @brief 检查当前CPU是否支持该内核
+ * @param type 内核类型
+ * @return 是否支持
+ */
+bool isCRCKernelSupported(CRCKernelType type);
+
+/**
+ * @brief 获取当前CPU支持的最快内核
+ * @return 内核类型
+ */
+CRCKernelType detectCRCKernel();
+
+/**
+ * @brief 设置默认CRC内核，不支持的内核退回到SLICING_BY_8
+ * @param type 内核类型
+ */
+void setCRCKernel(CRCKernelType type);
+
+/**
+ * @brief 获取默认CRC内核
+ * @return 内核类型
+ */
+CRCKernelType getCRCKernel();
+
+/**
+ * @brief CRC-16/CCITT-FALSE (多项式0x1021，初值0xFFFF，高位在前，无结果异或)
+ * @param data 数据
+ * @param length 字节数
+ * @return CRC值
+ */
+uint16_t calculateCRC16(const uint8_t* data, size_t length);
+
+/**
+ * @brief CRC-32 (IEEE 802.3，反射多项式0xEDB88320，初值和结果异或0xFFFFFFFF)
+ * @param data 数据
+ * @param length 字节数
+ * @return CRC值
+ */
+uint32_t calculateCRC32(const uint8_t* data, size_t length);
+
+/**
+ * @brief 使用指定内核计算CRC-16，PCLMUL按SLICING_BY_8处理
+ */
+uint16_t calculateCRC16(const uint8_t* data, size_t length, CRCKernelType kernel);
+
+/**
+ * @brief 使用指定内核计算CRC-32
+ */
+uint32_t calculateCRC32(const uint8_t* data, size_t length, CRCKernelType kernel);
+
+/**
+ * @brief 在已有CRC-32结果上追加数据
+ *
+ * updateCRC32(updateCRC32(0, a, n), b, m)等于a和b拼接后的calculateCRC32，
+ * 与zlib的crc32()约定相同，首次调用传入0。
+ * @param crc 之前数据的CRC-32
+ * @param data 追加的数据
+ * @param length 字节数
+ * @return 拼接后数据的CRC-32
+ */
+uint32_t updateCRC32(uint32_t crc, const uint8_t* data, size_t length);
+
+/**
+ * @brief 流式CRC-32计算
+ *
+ * 用于分块读取的大文件或录制数据，每次update使用默认内核。
+ */
+class CRC32Stream {
+public:
+    CRC32Stream() : state(0xFFFFFFFF), byteCount(0) {}
+
+    // 追加数据
+    void update(const uint8_t* data, size_t length);
+    void update(const std::string& data) {
+        update(reinterpret_cast<const uint8_t*>(data.data()), data.length());
+    }
+
+    // 获取当前已处理数据的CRC-32，不影响后续update
+    uint32_t finalize() const { return ~state; }
+
+    // 重新开始
+    void reset() {
+        state = 0xFFFFFFFF;
+        byteCount = 0;
+    }
+
+    // 已处理的字节数
+    uint64_t size() const { return byteCount; }
+
+private:
+    uint32_t state;
+    uint64_t byteCount;
+};
+
+/**
+ * @brief 流式CRC-16计算
+ */
+class CRC16Stream {
+public:
+    CRC16Stream() : state(0xFFFF), byteCount(0) {}
+
+    // 追加数据
+    void update(const uint8_t* data, size_t length);
+    void update(const std::string& data) {
+        update(reinterpret_cast<const uint8_t*>(data.data()), data.length());
+    }
+
+    // 获取当前已处理数据的CRC-16，不影响后续update
+    uint16_t finalize() const { return state; }
+
+    // 重新开始
+    void reset() {
+        state = 0xFFFF;
+        byteCount = 0;
+    }
+
+    // 已处理的字节数
+    uint64_t size() const { return byteCount; }
+
+private:
+    uint16_t state;
+    uint64_t byteCount;
+};
+
+} // namespace error_detection
+} // namespace coding
+} // namespace link16
@@ -1,46 +1,362 @@
-#include "CRCCoder.h"
-#include <iostream>
+#include "CRCCalculator.h"
+#include "core/utils/cpuFeatures.h"
+#include <atomic>
+
+#if defined(LINK16_ARCH_X86)
+    #include <immintrin.h>
+#endif
 
 namespace link16 {
 namespace coding {
 namespace error_detection {
 
-// CRC-16计算函数
-uint16_t calculateCRC16(const uint8_t* data, size_t length) {
-    uint16_t crc = 0xFFFF;
-    
+namespace {
+
+// CRC-16/CCITT多项式(高位在前)
+const uint16_t crc16_polynomial = 0x1021;
+
+// CRC-32反射多项式
+const uint32_t crc32_polynomial = 0xEDB88320;
+
+// 按小端读取4字节
+inline uint32_t loadLittleEndian32(const uint8_t* bytes) {
+    return static_cast<uint32_t>(bytes[0]) |
+           (static_cast<uint32_t>(bytes[1]) << 8) |
+           (static_cast<uint32_t>(bytes[2]) << 16) |
+           (static_cast<uint32_t>(bytes[3]) << 24);
+}
+
+/**
+ * slicing-by-8查找表
+ * table[0]为常规单字节表，table[k][b]为字节b之后再跟k个0字节时对CRC的贡献，
+ * 因此8个字节的贡献可以分别查表后异或合并。
+ */
+struct CRCTables {
+    uint32_t crc32[8][256];
+    uint16_t crc16[8][256];
+
+    CRCTables() {
+        for (int b = 0; b < 256; ++b) {
+            uint32_t c32 = static_cast<uint32_t>(b);
+            uint16_t c16 = static_cast<uint16_t>(b << 8);
+            for (int j = 0; j < 8; ++j) {
+                c32 = (c32 & 1) ? (c32 >> 1) ^ crc32_polynomial : c32 >> 1;
+                c16 = (c16 & 0x8000) ? static_cast<uint16_t>((c16 << 1) ^ crc16_polynomial)
+                                     : static_cast<uint16_t>(c16 << 1);
+            }
+            crc32[0][b] = c32;
+            crc16[0][b] = c16;
+        }
+        for (int k = 1; k < 8; ++k) {
+            for (int b = 0; b < 256; ++b) {
+                const uint32_t prev32 = crc32[k - 1][b];
+                crc32[k][b] = (prev32 >> 8) ^ crc32[0][prev32 & 0xFF];
+                const uint16_t prev16 = crc16[k - 1][b];
+                crc16[k][b] = static_cast<uint16_t>((prev16 << 8) ^ crc16[0][prev16 >> 8]);
+            }
+        }
+    }
+};
+
+const CRCTables& crcTables() {
+    static const CRCTables tables;
+    return tables;
+}
+
+// 逐比特CRC-16，state为未做结果处理的寄存器值
+uint16_t crc16Bitwise(uint16_t crc, const uint8_t* data, size_t length) {
     for (size_t i = 0; i < length; ++i) {
         crc ^= (uint16_t)data[i] << 8;
-        
+
         for (int j = 0; j < 8; ++j) {
             if (crc & 0x8000) {
-                crc = (crc << 1) ^ 0x1021;
+                crc = (crc << 1) ^ crc16_polynomial;
             } else {
                 crc <<= 1;
             }
         }
     }
-    
     return crc;
 }
 
-// CRC-32计算函数
-uint32_t calculateCRC32(const uint8_t* data, size_t length) {
-    uint32_t crc = 0xFFFFFFFF;
-    
+// 逐比特CRC-32
+uint32_t crc32Bitwise(uint32_t crc, const uint8_t* data, size_t length) {
     for (size_t i = 0; i < length; ++i) {
         crc ^= data[i];
-        
+
         for (int j = 0; j < 8; ++j) {
             if (crc & 1) {
-                crc = (crc >> 1) ^ 0xEDB88320;
+                crc = (crc >> 1) ^ crc32_polynomial;
             } else {
                 crc >>= 1;
             }
         }
     }
-    
-    return ~crc;
+    return crc;
+}
+
+// slicing-by-8 CRC-16: 寄存器的两个字节并入前两个数据字节
+uint16_t crc16Slice8(uint16_t crc, const uint8_t* data, size_t length) {
+    const CRCTables& t = crcTables();
+    while (length >= 8) {
+        crc = static_cast<uint16_t>(
+            t.crc16[7][data[0] ^ (crc >> 8)] ^ t.crc16[6][data[1] ^ (crc & 0xFF)] ^
+            t.crc16[5][data[2]] ^ t.crc16[4][data[3]] ^
+            t.crc16[3][data[4]] ^ t.crc16[2][data[5]] ^
+            t.crc16[1][data[6]] ^ t.crc16[0][data[7]]);
+        data += 8;
+        length -= 8;
+    }
+    while (length-- > 0) {
+        crc = static_cast<uint16_t>((crc << 8) ^ t.crc16[0][(crc >> 8) ^ *data++]);
+    }
+    return crc;
+}
+
+// slicing-by-8 CRC-32: 寄存器并入前4个数据字节
+uint32_t crc32Slice8(uint32_t crc, const uint8_t* data, size_t length) {
+    const CRCTables& t = crcTables();
+    while (length >= 8) {
+        const uint32_t low = loadLittleEndian32(data) ^ crc;
+        const uint32_t high = loadLittleEndian32(data + 4);
+        crc = t.crc32[7][low & 0xFF] ^ t.crc32[6][(low >> 8) & 0xFF] ^
+              t.crc32[5][(low >> 16) & 0xFF] ^ t.crc32[4][low >> 24] ^
+              t.crc32[3][high & 0xFF] ^ t.crc32[2][(high >> 8) & 0xFF] ^
+              t.crc32[1][(high >> 16) & 0xFF] ^ t.crc32[0][high >> 24];
+        data += 8;
+        length -= 8;
+    }
+    while (length-- > 0) {
+        crc = (crc >> 8) ^ t.crc32[0][(crc ^ *data++) & 0xFF];
+    }
+    return crc;
+}
+
+#if defined(LINK16_ARCH_X86)
+
+/**
+ * PCLMULQDQ折叠CRC-32 (Intel "Fast CRC Computation Using PCLMULQDQ"，反射域常数)
+ * 每次并行折叠4个128位块，最后折叠到128位再用Barrett约简到32位。
+ * length至少64且为16的倍数。
+ */
+LINK16_TARGET("pclmul,sse4.1")
+uint32_t crc32FoldPclmul(uint32_t crc, const uint8_t* data, size_t length) {
+    alignas(16) static const uint64_t k1k2[] = {0x0154442bd4ULL, 0x01c6e41596ULL};
+    alignas(16) static const uint64_t k3k4[] = {0x01751997d0ULL, 0x00ccaa009eULL};
+    alignas(16) static const uint64_t k5k0[] = {0x0163cd6124ULL, 0x0000000000ULL};
+    alignas(16) static const uint64_t poly[] = {0x01db710641ULL, 0x01f7011641ULL};
+
+    __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00));
+    __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10));
+    __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20));
+    __m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+
+    __m128i k = _mm_load_si128(reinterpret_cast<const __m128i*>(k1k2));
+    data += 64;
+    length -= 64;
+
+    // 并行折叠64字节块
+    while (length >= 64) {
+        const __m128i x5 = _mm_clmulepi64_si128(x1, k, 0x00);
+        const __m128i x6 = _mm_clmulepi64_si128(x2, k, 0x00);
+        const __m128i x7 = _mm_clmulepi64_si128(x3, k, 0x00);
+        const __m128i x8 = _mm_clmulepi64_si128(x4, k, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, k, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, k, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, k, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, k, 0x11);
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5),
+                           _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6),
+                           _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7),
+                           _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8),
+                           _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30)));
+
+        data += 64;
+        length -= 64;
+    }
+
+    // 折叠到128位
+    k = _mm_load_si128(reinterpret_cast<const __m128i*>(k3k4));
+    __m128i x5 = _mm_clmulepi64_si128(x1, k, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, k, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, k, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    // 剩余的16字节块
+    while (length >= 16) {
+        x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        x5 = _mm_clmulepi64_si128(x1, k, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+        data += 16;
+        length -= 16;
+    }
+
+    // 128位折叠到64位
+    x2 = _mm_clmulepi64_si128(x1, k, 0x10);
+    const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+    k = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(k5k0));
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask32);
+    x1 = _mm_clmulepi64_si128(x1, k, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett约简到32位
+    k = _mm_load_si128(reinterpret_cast<const __m128i*>(poly));
+    x2 = _mm_and_si128(x1, mask32);
+    x2 = _mm_clmulepi64_si128(x2, k, 0x10);
+    x2 = _mm_and_si128(x2, mask32);
+    x2 = _mm_clmulepi64_si128(x2, k, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+#endif
+
+// 不足64字节时折叠的准备开销大于收益
+const size_t pclmul_minimum_length = 64;
+
+// PCLMUL处理16字节对齐长度的部分，其余部分查表
+uint32_t crc32Pclmul(uint32_t crc, const uint8_t* data, size_t length) {
+#if defined(LINK16_ARCH_X86)
+    if (length >= pclmul_minimum_length) {
+        const size_t chunk = length & ~static_cast<size_t>(15);
+        crc = crc32FoldPclmul(crc, data, chunk);
+        data += chunk;
+        length -= chunk;
+    }
+#endif
+    return crc32Slice8(crc, data, length);
+}
+
+// 未指定或不支持的内核退回到查表实现
+CRCKernelType resolveKernel(CRCKernelType kernel) {
+    return isCRCKernelSupported(kernel) ? kernel : CRCKernelType::SLICING_BY_8;
+}
+
+std::atomic<CRCKernelType>& defaultKernel() {
+    static std::atomic<CRCKernelType> kernel(detectCRCKernel());
+    return kernel;
+}
+
+// 按内核更新CRC-32寄存器
+uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t length, CRCKernelType kernel) {
+    switch (kernel) {
+        case CRCKernelType::BITWISE:
+            return crc32Bitwise(crc, data, length);
+        case CRCKernelType::PCLMUL:
+            return crc32Pclmul(crc, data, length);
+        case CRCKernelType::SLICING_BY_8:
+            break;
+    }
+    return crc32Slice8(crc, data, length);
+}
+
+// 按内核更新CRC-16寄存器
+uint16_t crc16Update(uint16_t crc, const uint8_t* data, size_t length, CRCKernelType kernel) {
+    if (kernel == CRCKernelType::BITWISE) {
+        return crc16Bitwise(crc, data, length);
+    }
+    return crc16Slice8(crc, data, length);
+}
+
+} // namespace
+
+// 获取内核名称
+const char* getCRCKernelName(CRCKernelType type) {
+    switch (type) {
+        case CRCKernelType::BITWISE:      return "bitwise";
+        case CRCKernelType::SLICING_BY_8: return "slicing-by-8";
+        case CRCKernelType::PCLMUL:       return "pclmul";
+    }
+    return "unknown";
+}
+
+// 检查当前CPU是否支持该内核
+bool isCRCKernelSupported(CRCKernelType type) {
+    switch (type) {
+        case CRCKernelType::BITWISE:
+        case CRCKernelType::SLICING_BY_8:
+            return true;
+        case CRCKernelType::PCLMUL:
+#if defined(LINK16_ARCH_X86)
+            return utils::CpuFeatures::get().pclmul && utils::CpuFeatures::get().sse41;
+#else
+            return false;
+#endif
+    }
+    return false;
+}
+
+// 获取当前CPU支持的最快内核
+CRCKernelType detectCRCKernel() {
+    if (isCRCKernelSupported(CRCKernelType::PCLMUL)) {
+        return CRCKernelType::PCLMUL;
+    }
+    return CRCKernelType::SLICING_BY_8;
+}
+
+// 设置默认CRC内核
+void setCRCKernel(CRCKernelType type) {
+    defaultKernel().store(resolveKernel(type), std::memory_order_relaxed);
+}
+
+// 获取默认CRC内核
+CRCKernelType getCRCKernel() {
+    return defaultKernel().load(std::memory_order_relaxed);
+}
+
+// CRC-16计算函数
+uint16_t calculateCRC16(const uint8_t* data, size_t length) {
+    return crc16Update(0xFFFF, data, length, getCRCKernel());
+}
+
+// CRC-32计算函数
+uint32_t calculateCRC32(const uint8_t* data, size_t length) {
+    return ~crc32Update(0xFFFFFFFF, data, length, getCRCKernel());
+}
+
+// 使用指定内核计算CRC-16
+uint16_t calculateCRC16(const uint8_t* data, size_t length, CRCKernelType kernel) {
+    return crc16Update(0xFFFF, data, length, resolveKernel(kernel));
+}
+
+// 使用指定内核计算CRC-32
+uint32_t calculateCRC32(const uint8_t* data, size_t length, CRCKernelType kernel) {
+    return ~crc32Update(0xFFFFFFFF, data, length, resolveKernel(kernel));
+}
+
+// 在已有CRC-32结果上追加数据
+uint32_t updateCRC32(uint32_t crc, const uint8_t* data, size_t length) {
+    return ~crc32Update(~crc, data, length, getCRCKernel());
+}
+
+// 流式CRC-32追加数据
+void CRC32Stream::update(const uint8_t* data, size_t length) {
+    state = crc32Update(state, data, length, getCRCKernel());
+    byteCount += length;
+}
+
+// 流式CRC-16追加数据
+void CRC16Stream::update(const uint8_t* data, size_t length) {
+    state = crc16Update(state, data, length, getCRCKernel());
+    byteCount += length;
 }
 
 } // namespace error_detection
@@ -1,13 +1,93 @@
 #include "BIPCoder.h"
 #include <iostream>
 #include <bitset>
-#include <vector>
 #include <algorithm>
 
 namespace link16 {
 namespace coding {
 namespace error_detection {
 
+namespace {
+
+// BIP校验位数，也是比特分组的周期
+const int bip_length = 5;
+
+// 统计64位字中1的个数
+inline int popcount64(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(value);
+#else
+    return static_cast<int>(std::bitset<64>(value).count());
+#endif
+}
+
+/**
+ * 每组比特在64位字中的掩码
+ * 320比特(5个字)恰好是分组周期的整数倍，因此第k个字(k = 字序号 % 5)的第j个比特
+ * (高位在前)属于第(64k + j) % 5组，与字在数据中的绝对位置无关。
+ */
+struct BIPMasks {
+    uint64_t mask[bip_length][bip_length];  // [字相位][组]
+
+    constexpr BIPMasks() : mask() {
+        for (int k = 0; k < bip_length; ++k) {
+            for (int j = 0; j < 64; ++j) {
+                mask[k][(64 * k + j) % bip_length] |= uint64_t(1) << (63 - j);
+            }
+        }
+    }
+};
+
+constexpr BIPMasks bip_masks;
+
+/**
+ * 伴随式查找表: 伴随式 -> 产生该伴随式的第一个单比特错误位置
+ * 由各比特位置对应的伴随式生成，不能由单比特错误产生的伴随式为-1
+ */
+struct SyndromeTable {
+    int8_t position[1 << bip_length];
+
+    constexpr SyndromeTable() : position() {
+        for (int s = 0; s < (1 << bip_length); ++s) {
+            position[s] = -1;
+        }
+        for (int p = 63; p >= 0; --p) {
+            for (int g = 0; g < bip_length; ++g) {
+                if (bip_masks.mask[0][g] & (uint64_t(1) << (63 - p))) {
+                    position[1 << g] = static_cast<int8_t>(p);
+                }
+            }
+        }
+    }
+};
+
+constexpr SyndromeTable syndrome_table;
+
+// 按大端读取8字节
+inline uint64_t loadBigEndian(const uint8_t* bytes) {
+    uint64_t value = 0;
+    for (int i = 0; i < 8; ++i) {
+        value = (value << 8) | bytes[i];
+    }
+    return value;
+}
+
+// 由5个相位的累加字得到奇校验位
+std::bitset<5> foldParity(const uint64_t* accumulator) {
+    std::bitset<5> bip;
+    for (int g = 0; g < bip_length; ++g) {
+        uint64_t bits = 0;
+        for (int k = 0; k < bip_length; ++k) {
+            bits ^= accumulator[k] & bip_masks.mask[k][g];
+        }
+        // 奇校验: 组内1的个数为偶数时校验位为1
+        bip[g] = (popcount64(bits) & 1) == 0;
+    }
+    return bip;
+}
+
+} // namespace
+
 // 构造函数
 BIPCoder::BIPCoder() {
 }
@@ -21,6 +101,11 @@ std::bitset<5> BIPCoder::calculateBIP(const std::string& data) {
     return BIP(data);
 }
 
+// 计算BIP校验位(打包比特版本)
+std::bitset<5> BIPCoder::calculateBIP(const BitSpan& bits) {
+    return BIP(bits);
+}
+
 // 验证BIP校验位
 bool BIPCoder::verifyBIP(const std::string& data, const std::bitset<5>& bip) {
     std::bitset<5> calculatedBIP = calculateBIP(data);
@@ -45,40 +130,61 @@ std::string BIPCoder::extractData(const std::string& dataWithBIP) {
 
 // 全局BIP计算函数
 std::bitset<5> BIP(const std::string& data) {
+    return BIP(reinterpret_cast<const uint8_t*>(data.data()), data.length());
+}
+
+// 全局BIP计算函数(字节版本)，同相位的字先异或合并，最后按组掩码统计
+std::bitset<5> BIP(const uint8_t* data, size_t length) {
     // 如果数据为空，返回全0
-    if (data.empty()) {
-        return std::bitset<5>("00000");
+    if (length == 0) {
+        return std::bitset<5>();
     }
     
-    // 将字符串转换为位序列
-    std::vector<bool> bits;
-    for (char c : data) {
-        // 对每个字符，提取其二进制表示
-        std::bitset<8> charBits(c);
-        for (int i = 7; i >= 0; --i) {
-            bits.push_back(charBits[i]);
+    uint64_t accumulator[bip_length] = {0, 0, 0, 0, 0};
+    int phase = 0;
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        accumulator[phase] ^= loadBigEndian(data + i);
+        phase = (phase == bip_length - 1) ? 0 : phase + 1;
+    }
+    
+    // 剩余不足8字节，低位补0
+    if (i < length) {
+        uint64_t tail = 0;
+        for (int shift = 56; i < length; ++i, shift -= 8) {
+            tail |= static_cast<uint64_t>(data[i]) << shift;
         }
+        accumulator[phase] ^= tail;
     }
     
-    // 初始化5个校验位
-    std::bitset<5> bip;
+    return foldParity(accumulator);
+}
+
+// 全局BIP计算函数(打包比特版本)
+std::bitset<5> BIP(const BitSpan& bits) {
+    if (bits.empty()) {
+        return std::bitset<5>();
+    }
     
-    // 计算每个校验位
-    // 在Link16中，通常使用奇校验，即每组中1的个数加上校验位应为奇数
-    for (size_t i = 0; i < 5; ++i) {
-        // 计算当前组中1的个数
-        int count = 0;
-        for (size_t j = i; j < bits.size(); j += 5) {
-            if (bits[j]) {
-                count++;
-            }
-        }
-        
-        // 设置校验位，使总数为奇数
-        bip[i] = (count % 2 == 0) ? 1 : 0;
+    uint64_t accumulator[bip_length] = {0, 0, 0, 0, 0};
+    int phase = 0;
+    size_t pos = 0;
+    for (; pos + 64 <= bits.size(); pos += 64) {
+        accumulator[phase] ^= bits.getBits(pos, 64);
+        phase = (phase == bip_length - 1) ? 0 : phase + 1;
     }
     
-    return bip;
+    if (pos < bits.size()) {
+        const int rest = static_cast<int>(bits.size() - pos);
+        accumulator[phase] ^= bits.getBits(pos, rest) << (64 - rest);
+    }
+    
+    return foldParity(accumulator);
+}
+
+// 根据伴随式查找单比特错误的位置
+int locateSingleBitError(const std::bitset<5>& syndrome) {
+    return syndrome_table.position[syndrome.to_ulong()];
 }
 
 // 验证带BIP的数据是否正确
@@ -88,13 +194,12 @@ bool validateBIP(const std::string& dataWithBIP) {
         return false;
     }
     
-    // 提取数据和BIP
-    std::string data = dataWithBIP.substr(0, dataWithBIP.length() - 5);
-    std::string bipStr = dataWithBIP.substr(dataWithBIP.length() - 5);
-    std::bitset<5> receivedBIP(bipStr);
+    // 提取BIP，数据部分直接在原缓冲区上计算
+    const size_t dataLength = dataWithBIP.length() - 5;
+    std::bitset<5> receivedBIP(dataWithBIP, dataLength, 5);
     
     // 计算BIP并验证
-    std::bitset<5> calculatedBIP = BIP(data);
+    std::bitset<5> calculatedBIP = BIP(reinterpret_cast<const uint8_t*>(dataWithBIP.data()), dataLength);
     return calculatedBIP == receivedBIP;
 }
 
@@ -105,63 +210,30 @@ std::string correctSingleBitError(const std::string& dataWithBIP) {
         return dataWithBIP;
     }
     
-    // 提取数据和BIP
-    std::string data = dataWithBIP.substr(0, dataWithBIP.length() - 5);
-    std::string bipStr = dataWithBIP.substr(dataWithBIP.length() - 5);
-    std::bitset<5> receivedBIP(bipStr);
+    // 提取BIP
+    const size_t dataLength = dataWithBIP.length() - 5;
+    std::bitset<5> receivedBIP(dataWithBIP, dataLength, 5);
     
     // 计算BIP
-    std::bitset<5> calculatedBIP = BIP(data);
+    std::bitset<5> calculatedBIP = BIP(reinterpret_cast<const uint8_t*>(dataWithBIP.data()), dataLength);
     
     // 如果BIP匹配，数据无错误
     if (calculatedBIP == receivedBIP) {
         return dataWithBIP;
     }
     
-    // 计算错误位置的校验位模式
-    std::bitset<5> errorPattern = calculatedBIP ^ receivedBIP;
-    
-    // 将数据转换为位序列
-    std::vector<bool> bits;
-    for (char c : data) {
-        std::bitset<8> charBits(c);
-        for (int i = 7; i >= 0; --i) {
-            bits.push_back(charBits[i]);
-        }
-    }
-    
-    // 尝试找到错误位置
-    for (size_t i = 0; i < bits.size(); ++i) {
-        // 计算当前位置对应的校验位模式
-        std::bitset<5> posPattern;
-        for (size_t j = 0; j < 5; ++j) {
-            if ((i % 5) == j) {
-                posPattern[j] = 1;
-            }
-        }
-        
-        // 如果模式匹配，翻转该位
-        if (posPattern == errorPattern) {
-            bits[i] = !bits[i];
-            
-            // 重建修正后的数据
-            std::string correctedData;
-            for (size_t j = 0; j < bits.size(); j += 8) {
-                std::bitset<8> charBits;
-                for (size_t k = 0; k < 8 && (j + k) < bits.size(); ++k) {
-                    charBits[7 - k] = bits[j + k];
-                }
-                correctedData.push_back(static_cast<char>(charBits.to_ulong()));
-            }
-            
-            // 添加原始BIP
-            return correctedData + bipStr;
-        }
+    // 查表得到错误位置
+    const int position = locateSingleBitError(calculatedBIP ^ receivedBIP);
+    if (position < 0 || static_cast<size_t>(position) >= dataLength * 8) {
+        // 如果无法修正，返回原始数据
+        std::cerr << "无法修正错误，可能存在多位错误" << std::endl;
+        return dataWithBIP;
     }
     
-    // 如果无法修正，返回原始数据
-    std::cerr << "无法修正错误，可能存在多位错误" << std::endl;
-    return dataWithBIP;
+    // 翻转该位，保留原始BIP
+    std::string correctedData = dataWithBIP;
+    correctedData[position / 8] = static_cast<char>(correctedData[position / 8] ^ (0x80 >> (position % 8)));
+    return correctedData;
 }
 
 } // namespace error_detection
@@ -2,6 +2,8 @@
 #include <string>
 #include <bitset>
 #include <cstdint>
+#include <cstddef>
+#include "core/types/BitBuffer.h"
 
 namespace link16 {
 namespace coding {
@@ -12,6 +14,7 @@ namespace error_detection {
  * 
  * BIP (Bit Integrity Parity) 是Link16协议中使用的一种校验机制，
  * 通常是5位校验码，用于检测数据传输过程中的错误。
+ * 第i个校验位覆盖位置模5余i的所有比特(按字节高位在前编号)，采用奇校验。
  */
 class BIPCoder {
 public:
@@ -33,6 +36,14 @@ public:
      */
     std::bitset<5> calculateBIP(const std::string& data);
     
+    /**
+     * @brief 计算BIP校验位(打包比特版本)
+     * 
+     * @param bits 输入比特
+     * @return std::bitset<5> 5位BIP校验码
+     */
+    std::bitset<5> calculateBIP(const BitSpan& bits);
+    
     /**
      * @brief 验证BIP校验位
      * 
@@ -68,6 +79,36 @@ public:
  */
 std::bitset<5> BIP(const std::string& data);
 
+/**
+ * @brief 全局BIP计算函数(字节版本)
+ * 
+ * @param data 输入数据
+ * @param length 字节数
+ * @return std::bitset<5> 5位BIP校验码
+ */
+std::bitset<5> BIP(const uint8_t* data, size_t length);
+
+/**
+ * @brief 全局BIP计算函数(打包比特版本)
+ * 
+ * 与字节版本编号一致：第i个比特属于第i%5组，BitBuffer::fromBytes(data)的结果与data相同。
+ * 
+ * @param bits 输入比特
+ * @return std::bitset<5> 5位BIP校验码
+ */
+std::bitset<5> BIP(const BitSpan& bits);
+
+/**
+ * @brief 根据伴随式查找单比特错误的位置
+ * 
+ * 伴随式为计算出的BIP与接收的BIP的异或。5个交织校验位只能确定错误所在的组，
+ * 因此返回该组中的第一个比特位置。
+ * 
+ * @param syndrome 伴随式
+ * @return int 比特位置，伴随式为0或对应多比特错误时返回-1
+ */
+int locateSingleBitError(const std::bitset<5>& syndrome);
+
 /**
  * @brief 验证带BIP的数据是否正确
  * 
@@ -2,6 +2,10 @@
 #include "core/utils/logger.h"
 #include <iostream>
 #include <vector>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
 
@@ -9,14 +13,193 @@ namespace link16 {
 namespace coding {
 namespace interleaving {
 
+namespace {
+
+// 置换表: 交织后矩阵内第k个元素取自输入矩阵内第table[k]个元素
+typedef std::vector<uint32_t> PermutationTable;
+
+// 超过该元素数的矩阵不建表，改用分块转置
+const size_t max_table_size = 1 << 16;
+
+// 分块转置的块大小
+const int transpose_block = 32;
+
+/**
+ * @brief 按(rows, cols)缓存的置换表
+ *
+ * 行写列读的交织等价于rows x cols矩阵转置，解交织使用(cols, rows)的表。
+ * 表构建后只读，可被多个线程共享。
+ */
+std::shared_ptr<const PermutationTable> getPermutationTable(int rows, int cols) {
+    const size_t matrixSize = static_cast<size_t>(rows) * cols;
+    if (rows <= 0 || cols <= 0 || matrixSize > max_table_size) {
+        return nullptr;
+    }
+
+    static std::shared_mutex mutex;
+    static std::map<std::pair<int, int>, std::shared_ptr<const PermutationTable>> tables;
+    const std::pair<int, int> key(rows, cols);
+
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it = tables.find(key);
+        if (it != tables.end()) {
+            return it->second;
+        }
+    }
+
+    auto table = std::make_shared<PermutationTable>(matrixSize);
+    for (int j = 0; j < cols; ++j) {
+        for (int i = 0; i < rows; ++i) {
+            (*table)[static_cast<size_t>(j) * rows + i] = static_cast<uint32_t>(i * cols + j);
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    auto result = tables.emplace(key, std::move(table));
+    return result.first->second;
+}
+
+/**
+ * @brief 交织置换，没有表时按下标计算
+ */
+class Permutation {
+public:
+    Permutation(int rows, int cols)
+        : rows(rows), cols(cols), table(getPermutationTable(rows, cols)) {}
+
+    // 输出位置k对应的输入位置
+    size_t operator[](size_t k) const {
+        return table ? (*table)[k] : (k % rows) * cols + k / rows;
+    }
+
+private:
+    int rows;
+    int cols;
+    std::shared_ptr<const PermutationTable> table;
+};
+
+// 分块转置rows x cols矩阵(行优先)，使输入和输出的访问都局限在小块内
+template <typename T>
+void transposeBlocked(const T* input, T* output, int rows, int cols) {
+    for (int i0 = 0; i0 < rows; i0 += transpose_block) {
+        const int iEnd = std::min(rows, i0 + transpose_block);
+        for (int j0 = 0; j0 < cols; j0 += transpose_block) {
+            const int jEnd = std::min(cols, j0 + transpose_block);
+            for (int j = j0; j < jEnd; ++j) {
+                T* out = output + static_cast<size_t>(j) * rows;
+                for (int i = i0; i < iEnd; ++i) {
+                    out[i] = input[static_cast<size_t>(i) * cols + j];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief 按行写入、按列读出一组矩阵
+ * @param input 输入
+ * @param length 输入长度，最后一个矩阵不足时用padding补齐
+ * @param output 输出，长度为numMatrices * rows * cols
+ * @param numMatrices 矩阵数量
+ * @param table 置换表，为空时使用分块转置
+ */
+template <typename T>
+void permuteMatrices(const T* input, size_t length, T* output, size_t numMatrices,
+                     int rows, int cols, const PermutationTable* table, T padding) {
+    const size_t matrixSize = static_cast<size_t>(rows) * cols;
+    for (size_t m = 0; m < numMatrices; ++m) {
+        const T* in = input + m * matrixSize;
+        T* out = output + m * matrixSize;
+        const size_t available = length - m * matrixSize;
+
+        if (available >= matrixSize) {
+            if (table) {
+                const uint32_t* index = table->data();
+                for (size_t k = 0; k < matrixSize; ++k) {
+                    out[k] = in[index[k]];
+                }
+            } else {
+                transposeBlocked(in, out, rows, cols);
+            }
+        } else {
+            // 最后一个不完整的矩阵，越界位置填充
+            for (int j = 0; j < cols; ++j) {
+                for (int i = 0; i < rows; ++i) {
+                    const size_t index = static_cast<size_t>(i) * cols + j;
+                    out[static_cast<size_t>(j) * rows + i] = index < available ? in[index] : padding;
+                }
+            }
+        }
+    }
+}
+
+// 交织length个元素到output，返回写入的元素数
+template <typename T>
+size_t interleaveInto(const T* data, size_t length, T* output, int rows, int cols,
+                      const PermutationTable* table, T padding) {
+    const size_t matrixSize = static_cast<size_t>(rows) * cols;
+    const size_t numMatrices = (length + matrixSize - 1) / matrixSize;
+    permuteMatrices(data, length, output, numMatrices, rows, cols, table, padding);
+    return numMatrices * matrixSize;
+}
+
+// 解交织完整的矩阵到output，返回写入的元素数
+template <typename T>
+size_t deinterleaveInto(const T* data, size_t length, T* output, int rows, int cols,
+                        const PermutationTable* table) {
+    const size_t matrixSize = static_cast<size_t>(rows) * cols;
+    const size_t numMatrices = length / matrixSize;
+    // 解交织即cols x rows矩阵的交织
+    permuteMatrices(data, numMatrices * matrixSize, output, numMatrices, cols, rows, table, T());
+    return numMatrices * matrixSize;
+}
+
+// 按符号置换完整的矩阵，末尾不足一个矩阵的比特原样保留
+BitBuffer permuteSymbols(const BitSpan& data, int symbolBits, int rows, int cols) {
+    const size_t matrixSize = static_cast<size_t>(rows) * cols;
+    const size_t matrixBits = matrixSize * symbolBits;
+    const size_t numMatrices = data.size() / matrixBits;
+
+    BitBuffer result;
+    result.reserve(data.size());
+
+    const Permutation permutation(rows, cols);
+    for (size_t m = 0; m < numMatrices; ++m) {
+        const size_t base = m * matrixBits;
+        for (size_t k = 0; k < matrixSize; ++k) {
+            result.append(data.getBits(base + permutation[k] * symbolBits, symbolBits), symbolBits);
+        }
+    }
+    result.append(data.subspan(numMatrices * matrixBits, data.size() - numMatrices * matrixBits));
+
+    return result;
+}
+
+} // namespace
+
+// 内部实现
+class MatrixInterleaver::Impl {
+public:
+    // 当前参数的交织表和解交织表
+    std::shared_ptr<const PermutationTable> interleaveTable;
+    std::shared_ptr<const PermutationTable> deinterleaveTable;
+
+    void update(int rows, int cols) {
+        interleaveTable = getPermutationTable(rows, cols);
+        deinterleaveTable = getPermutationTable(cols, rows);
+    }
+};
+
 // 构造函数
 MatrixInterleaver::MatrixInterleaver(int rows, int cols)
-    : rows(rows), cols(cols) {
+    : rows(rows), cols(cols), pImpl(new Impl()) {
     if (rows <= 0 || cols <= 0) {
         LOG_ERROR("矩阵交织器参数无效: rows=" + std::to_string(rows) + ", cols=" + std::to_string(cols));
         this->rows = 8;
         this->cols = 8;
     }
+    pImpl->update(this->rows, this->cols);
 }
 
 // 析构函数
@@ -25,12 +208,12 @@ MatrixInterleaver::~MatrixInterleaver() {
 
 // 交织
 std::string MatrixInterleaver::interleave(const std::string& data) {
-    return interleave(data, rows, cols);
+    return interleaving::interleave(data, rows, cols);
 }
 
 // 解交织
 std::string MatrixInterleaver::deinterleave(const std::string& interleavedData) {
-    return deinterleave(interleavedData, rows, cols);
+    return interleaving::deinterleave(interleavedData, rows, cols);
 }
 
 // 设置交织参数
@@ -42,6 +225,7 @@ void MatrixInterleaver::setParameters(int rows, int cols) {
 
     this->rows = rows;
     this->cols = cols;
+    pImpl->update(rows, cols);
     LOG_INFO("设置矩阵交织器参数: rows=" + std::to_string(rows) + ", cols=" + std::to_string(cols));
 }
 
@@ -55,6 +239,75 @@ int MatrixInterleaver::getCols() const {
     return cols;
 }
 
+// 获取交织大小
+int MatrixInterleaver::getInterleaverSize() const {
+    return rows * cols;
+}
+
+// 检查参数是否有效
+bool MatrixInterleaver::isValidParameters(int rows, int cols) {
+    return rows > 0 && cols > 0;
+}
+
+// 计算交织后的数据长度
+int MatrixInterleaver::calculateInterleavedLength(int dataLength) const {
+    const int matrixSize = rows * cols;
+    return (dataLength + matrixSize - 1) / matrixSize * matrixSize;
+}
+
+// 计算原始数据长度，只有完整的矩阵会被解交织
+int MatrixInterleaver::calculateOriginalLength(int interleavedLength) const {
+    const int matrixSize = rows * cols;
+    return interleavedLength / matrixSize * matrixSize;
+}
+
+// 交织到调用方缓冲区
+size_t MatrixInterleaver::interleave(const uint8_t* data, size_t length, uint8_t* output) {
+    if (!data || !output) {
+        return 0;
+    }
+    return interleaveInto<uint8_t>(data, length, output, rows, cols, pImpl->interleaveTable.get(), 0);
+}
+
+// 解交织到调用方缓冲区
+size_t MatrixInterleaver::deinterleave(const uint8_t* interleavedData, size_t length, uint8_t* output) {
+    if (!interleavedData || !output) {
+        return 0;
+    }
+    return deinterleaveInto<uint8_t>(interleavedData, length, output, rows, cols,
+                                     pImpl->deinterleaveTable.get());
+}
+
+// 批量交织
+size_t MatrixInterleaver::interleaveBatch(const uint8_t* frames, size_t frameCount, size_t frameLength,
+                                          uint8_t* output) {
+    if (!frames || !output) {
+        return 0;
+    }
+    const size_t matrixSize = static_cast<size_t>(rows) * cols;
+    const size_t stride = (frameLength + matrixSize - 1) / matrixSize * matrixSize;
+    for (size_t f = 0; f < frameCount; ++f) {
+        interleaveInto<uint8_t>(frames + f * frameLength, frameLength, output + f * stride,
+                                rows, cols, pImpl->interleaveTable.get(), 0);
+    }
+    return frameCount;
+}
+
+// 批量解交织
+size_t MatrixInterleaver::deinterleaveBatch(const uint8_t* frames, size_t frameCount, size_t frameLength,
+                                            uint8_t* output) {
+    if (!frames || !output) {
+        return 0;
+    }
+    const size_t matrixSize = static_cast<size_t>(rows) * cols;
+    const size_t stride = frameLength / matrixSize * matrixSize;
+    for (size_t f = 0; f < frameCount; ++f) {
+        deinterleaveInto<uint8_t>(frames + f * frameLength, frameLength, output + f * stride,
+                                  rows, cols, pImpl->deinterleaveTable.get());
+    }
+    return frameCount;
+}
+
 // 全局交织函数
 std::string interleave(const std::string& data, int rows, int cols) {
     if (data.empty()) {
@@ -70,41 +323,13 @@ std::string interleave(const std::string& data, int rows, int cols) {
              ", 数据长度=" + std::to_string(data.length()));
 
     // 计算需要的矩阵数量
-    size_t matrixSize = rows * cols;
+    size_t matrixSize = static_cast<size_t>(rows) * cols;
     size_t numMatrices = (data.length() + matrixSize - 1) / matrixSize;
-    size_t totalSize = numMatrices * matrixSize;
-
-    // 创建填充后的数据
-    std::string paddedData = data;
-    if (paddedData.length() < totalSize) {
-        // 使用0填充
-        paddedData.append(totalSize - paddedData.length(), '0');
-    }
-
-    // 创建结果字符串
-    std::string result;
-    result.reserve(totalSize);
-
-    // 对每个矩阵进行交织
-    for (size_t m = 0; m < numMatrices; ++m) {
-        // 创建矩阵
-        std::vector<std::vector<char>> matrix(rows, std::vector<char>(cols));
-
-        // 按行填充矩阵
-        for (int i = 0; i < rows; ++i) {
-            for (int j = 0; j < cols; ++j) {
-                size_t index = m * matrixSize + i * cols + j;
-                matrix[i][j] = paddedData[index];
-            }
-        }
 
-        // 按列读取矩阵
-        for (int j = 0; j < cols; ++j) {
-            for (int i = 0; i < rows; ++i) {
-                result.push_back(matrix[i][j]);
-            }
-        }
-    }
+    // 直接收集到结果中，不足部分使用'0'填充
+    std::string result(numMatrices * matrixSize, '0');
+    auto table = getPermutationTable(rows, cols);
+    interleaveInto<char>(data.data(), data.length(), &result[0], rows, cols, table.get(), '0');
 
     return result;
 }
@@ -124,37 +349,17 @@ std::string deinterleave(const std::string& interleavedData, int rows, int cols)
              ", 数据长度=" + std::to_string(interleavedData.length()));
 
     // 检查数据长度是否是矩阵大小的整数倍
-    size_t matrixSize = rows * cols;
+    size_t matrixSize = static_cast<size_t>(rows) * cols;
     if (interleavedData.length() % matrixSize != 0) {
         LOG_WARNING("交织数据长度不是矩阵大小的整数倍，可能导致解交织错误");
     }
 
-    // 计算矩阵数量
-    size_t numMatrices = interleavedData.length() / matrixSize;
-
-    // 创建结果字符串
-    std::string result;
-    result.reserve(interleavedData.length());
-
-    // 对每个矩阵进行解交织
-    for (size_t m = 0; m < numMatrices; ++m) {
-        // 创建矩阵
-        std::vector<std::vector<char>> matrix(rows, std::vector<char>(cols));
-
-        // 按列填充矩阵
-        for (int j = 0; j < cols; ++j) {
-            for (int i = 0; i < rows; ++i) {
-                size_t index = m * matrixSize + j * rows + i;
-                matrix[i][j] = interleavedData[index];
-            }
-        }
-
-        // 按行读取矩阵
-        for (int i = 0; i < rows; ++i) {
-            for (int j = 0; j < cols; ++j) {
-                result.push_back(matrix[i][j]);
-            }
-        }
+    // 只解交织完整的矩阵
+    std::string result(interleavedData.length() / matrixSize * matrixSize, '\0');
+    if (!result.empty()) {
+        auto table = getPermutationTable(cols, rows);
+        deinterleaveInto<char>(interleavedData.data(), interleavedData.length(), &result[0],
+                               rows, cols, table.get());
     }
 
     return result;
@@ -162,22 +367,22 @@ std::string deinterleave(const std::string& interleavedData, int rows, int cols)
 
 // 交织二进制数据
 std::vector<bool> MatrixInterleaver::interleave(const std::vector<bool>& data) {
-    return interleave(data, rows, cols);
+    return interleaving::interleave(data, rows, cols);
 }
 
 // 解交织二进制数据
 std::vector<bool> MatrixInterleaver::deinterleave(const std::vector<bool>& interleavedData) {
-    return deinterleave(interleavedData, rows, cols);
+    return interleaving::deinterleave(interleavedData, rows, cols);
 }
 
 // 交织字节数据
 std::vector<uint8_t> MatrixInterleaver::interleave(const std::vector<uint8_t>& data) {
-    return interleave(data, rows, cols);
+    return interleaving::interleave(data, rows, cols);
 }
 
 // 解交织字节数据
 std::vector<uint8_t> MatrixInterleaver::deinterleave(const std::vector<uint8_t>& interleavedData) {
-    return deinterleave(interleavedData, rows, cols);
+    return interleaving::deinterleave(interleavedData, rows, cols);
 }
 
 // 全局交织函数(二进制版本)
@@ -195,38 +400,18 @@ std::vector<bool> interleave(const std::vector<bool>& data, int rows, int cols)
              ", 数据长度=" + std::to_string(data.size()));
 
     // 计算需要的矩阵数量
-    size_t matrixSize = rows * cols;
+    size_t matrixSize = static_cast<size_t>(rows) * cols;
     size_t numMatrices = (data.size() + matrixSize - 1) / matrixSize;
-    size_t totalSize = numMatrices * matrixSize;
-
-    // 创建填充后的数据
-    std::vector<bool> paddedData = data;
-    if (paddedData.size() < totalSize) {
-        // 使用false填充
-        paddedData.resize(totalSize, false);
-    }
-
-    // 创建结果向量
-    std::vector<bool> result;
-    result.reserve(totalSize);
 
-    // 对每个矩阵进行交织
+    // 按置换表收集，越界位置为false
+    std::vector<bool> result(numMatrices * matrixSize, false);
+    const Permutation permutation(rows, cols);
     for (size_t m = 0; m < numMatrices; ++m) {
-        // 创建矩阵
-        std::vector<std::vector<bool>> matrix(rows, std::vector<bool>(cols));
-
-        // 按行填充矩阵
-        for (int i = 0; i < rows; ++i) {
-            for (int j = 0; j < cols; ++j) {
-                size_t index = m * matrixSize + i * cols + j;
-                matrix[i][j] = paddedData[index];
-            }
-        }
-
-        // 按列读取矩阵
-        for (int j = 0; j < cols; ++j) {
-            for (int i = 0; i < rows; ++i) {
-                result.push_back(matrix[i][j]);
+        const size_t base = m * matrixSize;
+        for (size_t k = 0; k < matrixSize; ++k) {
+            const size_t index = base + permutation[k];
+            if (index < data.size()) {
+                result[base + k] = data[index];
             }
         }
     }
@@ -249,7 +434,7 @@ std::vector<bool> deinterleave(const std::vector<bool>& interleavedData, int row
              ", 数据长度=" + std::to_string(interleavedData.size()));
 
     // 检查数据长度是否是矩阵大小的整数倍
-    size_t matrixSize = rows * cols;
+    size_t matrixSize = static_cast<size_t>(rows) * cols;
     if (interleavedData.size() % matrixSize != 0) {
         LOG_WARNING("交织数据长度不是矩阵大小的整数倍，可能导致解交织错误");
     }
@@ -257,28 +442,13 @@ std::vector<bool> deinterleave(const std::vector<bool>& interleavedData, int row
     // 计算矩阵数量
     size_t numMatrices = interleavedData.size() / matrixSize;
 
-    // 创建结果向量
-    std::vector<bool> result;
-    result.reserve(interleavedData.size());
-
-    // 对每个矩阵进行解交织
+    // 解交织即cols x rows矩阵的交织
+    std::vector<bool> result(numMatrices * matrixSize);
+    const Permutation permutation(cols, rows);
     for (size_t m = 0; m < numMatrices; ++m) {
-        // 创建矩阵
-        std::vector<std::vector<bool>> matrix(rows, std::vector<bool>(cols));
-
-        // 按列填充矩阵
-        for (int j = 0; j < cols; ++j) {
-            for (int i = 0; i < rows; ++i) {
-                size_t index = m * matrixSize + j * rows + i;
-                matrix[i][j] = interleavedData[index];
-            }
-        }
-
-        // 按行读取矩阵
-        for (int i = 0; i < rows; ++i) {
-            for (int j = 0; j < cols; ++j) {
-                result.push_back(matrix[i][j]);
-            }
+        const size_t base = m * matrixSize;
+        for (size_t k = 0; k < matrixSize; ++k) {
+            result[base + k] = interleavedData[base + permutation[k]];
         }
     }
 
@@ -300,41 +470,12 @@ std::vector<uint8_t> interleave(const std::vector<uint8_t>& data, int rows, int
              ", 数据长度=" + std::to_string(data.size()));
 
     // 计算需要的矩阵数量
-    size_t matrixSize = rows * cols;
+    size_t matrixSize = static_cast<size_t>(rows) * cols;
     size_t numMatrices = (data.size() + matrixSize - 1) / matrixSize;
-    size_t totalSize = numMatrices * matrixSize;
-
-    // 创建填充后的数据
-    std::vector<uint8_t> paddedData = data;
-    if (paddedData.size() < totalSize) {
-        // 使用0填充
-        paddedData.resize(totalSize, 0);
-    }
-
-    // 创建结果向量
-    std::vector<uint8_t> result;
-    result.reserve(totalSize);
 
-    // 对每个矩阵进行交织
-    for (size_t m = 0; m < numMatrices; ++m) {
-        // 创建矩阵
-        std::vector<std::vector<uint8_t>> matrix(rows, std::vector<uint8_t>(cols));
-
-        // 按行填充矩阵
-        for (int i = 0; i < rows; ++i) {
-            for (int j = 0; j < cols; ++j) {
-                size_t index = m * matrixSize + i * cols + j;
-                matrix[i][j] = paddedData[index];
-            }
-        }
-
-        // 按列读取矩阵
-        for (int j = 0; j < cols; ++j) {
-            for (int i = 0; i < rows; ++i) {
-                result.push_back(matrix[i][j]);
-            }
-        }
-    }
+    std::vector<uint8_t> result(numMatrices * matrixSize);
+    auto table = getPermutationTable(rows, cols);
+    interleaveInto<uint8_t>(data.data(), data.size(), result.data(), rows, cols, table.get(), 0);
 
     return result;
 }
@@ -354,42 +495,213 @@ std::vector<uint8_t> deinterleave(const std::vector<uint8_t>& interleavedData, i
              ", 数据长度=" + std::to_string(interleavedData.size()));
 
     // 检查数据长度是否是矩阵大小的整数倍
-    size_t matrixSize = rows * cols;
+    size_t matrixSize = static_cast<size_t>(rows) * cols;
     if (interleavedData.size() % matrixSize != 0) {
         LOG_WARNING("交织数据长度不是矩阵大小的整数倍，可能导致解交织错误");
     }
 
-    // 计算矩阵数量
-    size_t numMatrices = interleavedData.size() / matrixSize;
+    std::vector<uint8_t> result(interleavedData.size() / matrixSize * matrixSize);
+    auto table = getPermutationTable(cols, rows);
+    deinterleaveInto<uint8_t>(interleavedData.data(), interleavedData.size(), result.data(),
+                              rows, cols, table.get());
+
+    return result;
+}
+
+// 全局交织函数(字节版本，输出到调用方缓冲区)
+size_t interleave(const uint8_t* data, size_t length, uint8_t* output, int rows, int cols,
+                  uint8_t padding) {
+    if (!data || !output || length == 0) {
+        return 0;
+    }
+
+    if (rows <= 0 || cols <= 0) {
+        LOG_ERROR("矩阵交织器参数无效: rows=" + std::to_string(rows) + ", cols=" + std::to_string(cols));
+        return 0;
+    }
+
+    auto table = getPermutationTable(rows, cols);
+    return interleaveInto<uint8_t>(data, length, output, rows, cols, table.get(), padding);
+}
+
+// 全局解交织函数(字节版本，输出到调用方缓冲区)
+size_t deinterleave(const uint8_t* interleavedData, size_t length, uint8_t* output, int rows, int cols) {
+    if (!interleavedData || !output || length == 0) {
+        return 0;
+    }
+
+    if (rows <= 0 || cols <= 0) {
+        LOG_ERROR("矩阵解交织器参数无效: rows=" + std::to_string(rows) + ", cols=" + std::to_string(cols));
+        return 0;
+    }
+
+    auto table = getPermutationTable(cols, rows);
+    return deinterleaveInto<uint8_t>(interleavedData, length, output, rows, cols, table.get());
+}
+
+// 全局批量交织函数
+size_t interleaveBatch(const uint8_t* frames, size_t frameCount, size_t frameLength,
+                       uint8_t* output, int rows, int cols) {
+    if (!frames || !output) {
+        return 0;
+    }
+
+    if (rows <= 0 || cols <= 0) {
+        LOG_ERROR("矩阵交织器参数无效: rows=" + std::to_string(rows) + ", cols=" + std::to_string(cols));
+        return 0;
+    }
+
+    // 所有帧共用一次查到的置换表
+    const size_t matrixSize = static_cast<size_t>(rows) * cols;
+    const size_t stride = (frameLength + matrixSize - 1) / matrixSize * matrixSize;
+    auto table = getPermutationTable(rows, cols);
+    for (size_t f = 0; f < frameCount; ++f) {
+        interleaveInto<uint8_t>(frames + f * frameLength, frameLength, output + f * stride,
+                                rows, cols, table.get(), 0);
+    }
+    return frameCount;
+}
+
+// 全局批量解交织函数
+size_t deinterleaveBatch(const uint8_t* frames, size_t frameCount, size_t frameLength,
+                         uint8_t* output, int rows, int cols) {
+    if (!frames || !output) {
+        return 0;
+    }
 
-    // 创建结果向量
-    std::vector<uint8_t> result;
-    result.reserve(interleavedData.size());
+    if (rows <= 0 || cols <= 0) {
+        LOG_ERROR("矩阵解交织器参数无效: rows=" + std::to_string(rows) + ", cols=" + std::to_string(cols));
+        return 0;
+    }
 
-    // 对每个矩阵进行解交织
+    const size_t matrixSize = static_cast<size_t>(rows) * cols;
+    const size_t stride = frameLength / matrixSize * matrixSize;
+    auto table = getPermutationTable(cols, rows);
+    for (size_t f = 0; f < frameCount; ++f) {
+        deinterleaveInto<uint8_t>(frames + f * frameLength, frameLength, output + f * stride,
+                                  rows, cols, table.get());
+    }
+    return frameCount;
+}
+
+// 交织打包比特
+BitBuffer MatrixInterleaver::interleave(const BitSpan& data) {
+    return interleaving::interleave(data, rows, cols);
+}
+
+// 解交织打包比特
+BitBuffer MatrixInterleaver::deinterleave(const BitSpan& interleavedData) {
+    return interleaving::deinterleave(interleavedData, rows, cols);
+}
+
+// 全局交织函数(打包比特版本)
+BitBuffer interleave(const BitSpan& data, int rows, int cols) {
+    if (data.empty()) {
+        return BitBuffer();
+    }
+
+    if (rows <= 0 || cols <= 0) {
+        LOG_ERROR("矩阵交织器参数无效: rows=" + std::to_string(rows) + ", cols=" + std::to_string(cols));
+        BitBuffer result;
+        result.append(data);
+        return result;
+    }
+
+    // 计算需要的矩阵数量，末尾不足的部分按0处理
+    const size_t matrixSize = static_cast<size_t>(rows) * cols;
+    const size_t numMatrices = (data.size() + matrixSize - 1) / matrixSize;
+
+    BitBuffer result;
+    result.reserve(numMatrices * matrixSize);
+
+    const Permutation permutation(rows, cols);
+    uint64_t word = 0;
+    int count = 0;
     for (size_t m = 0; m < numMatrices; ++m) {
-        // 创建矩阵
-        std::vector<std::vector<uint8_t>> matrix(rows, std::vector<uint8_t>(cols));
-
-        // 按列填充矩阵
-        for (int j = 0; j < cols; ++j) {
-            for (int i = 0; i < rows; ++i) {
-                size_t index = m * matrixSize + j * rows + i;
-                matrix[i][j] = interleavedData[index];
+        const size_t base = m * matrixSize;
+        for (size_t k = 0; k < matrixSize; ++k) {
+            const size_t index = base + permutation[k];
+            word = (word << 1) | ((index < data.size() && data[index]) ? 1 : 0);
+            if (++count == 64) {
+                result.append(word, 64);
+                word = 0;
+                count = 0;
             }
         }
+    }
+    result.append(word, count);
 
-        // 按行读取矩阵
-        for (int i = 0; i < rows; ++i) {
-            for (int j = 0; j < cols; ++j) {
-                result.push_back(matrix[i][j]);
+    return result;
+}
+
+// 全局解交织函数(打包比特版本)
+BitBuffer deinterleave(const BitSpan& interleavedData, int rows, int cols) {
+    if (interleavedData.empty()) {
+        return BitBuffer();
+    }
+
+    if (rows <= 0 || cols <= 0) {
+        LOG_ERROR("矩阵解交织器参数无效: rows=" + std::to_string(rows) + ", cols=" + std::to_string(cols));
+        BitBuffer result;
+        result.append(interleavedData);
+        return result;
+    }
+
+    const size_t matrixSize = static_cast<size_t>(rows) * cols;
+    if (interleavedData.size() % matrixSize != 0) {
+        LOG_WARNING("交织数据长度不是矩阵大小的整数倍，可能导致解交织错误");
+    }
+    const size_t numMatrices = interleavedData.size() / matrixSize;
+
+    BitBuffer result;
+    result.reserve(numMatrices * matrixSize);
+
+    const Permutation permutation(cols, rows);
+    uint64_t word = 0;
+    int count = 0;
+    for (size_t m = 0; m < numMatrices; ++m) {
+        const size_t base = m * matrixSize;
+        for (size_t k = 0; k < matrixSize; ++k) {
+            word = (word << 1) | (interleavedData[base + permutation[k]] ? 1 : 0);
+            if (++count == 64) {
+                result.append(word, 64);
+                word = 0;
+                count = 0;
             }
         }
     }
+    result.append(word, count);
 
     return result;
 }
 
+// 按符号交织比特序列
+BitBuffer interleaveSymbols(const BitSpan& data, int symbolBits, int rows, int cols) {
+    if (rows <= 0 || cols <= 0 || symbolBits <= 0 || symbolBits > 64) {
+        LOG_ERROR("符号交织参数无效: symbolBits=" + std::to_string(symbolBits) +
+                  ", rows=" + std::to_string(rows) + ", cols=" + std::to_string(cols));
+        BitBuffer result;
+        result.append(data);
+        return result;
+    }
+
+    return permuteSymbols(data, symbolBits, rows, cols);
+}
+
+// 按符号解交织比特序列
+BitBuffer deinterleaveSymbols(const BitSpan& interleavedData, int symbolBits, int rows, int cols) {
+    if (rows <= 0 || cols <= 0 || symbolBits <= 0 || symbolBits > 64) {
+        LOG_ERROR("符号解交织参数无效: symbolBits=" + std::to_string(symbolBits) +
+                  ", rows=" + std::to_string(rows) + ", cols=" + std::to_string(cols));
+        BitBuffer result;
+        result.append(interleavedData);
+        return result;
+    }
+
+    // 解交织即cols x rows矩阵的交织
+    return permuteSymbols(interleavedData, symbolBits, cols, rows);
+}
+
 } // namespace interleaving
 } // namespace coding
 } // namespace link16
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstdint>
+#include <cstddef>
 #include <string>
 #include <vector>
 #include <memory>
+#include "core/types/BitBuffer.h"
 
 namespace link16 {
 namespace coding {
@@ -39,6 +42,86 @@ public:
      */
     std::string deinterleave(const std::string& interleavedData);
     
+    /**
+     * @brief 交织函数(二进制版本)
+     * @param data 要交织的数据
+     * @return 交织后的数据
+     */
+    std::vector<bool> interleave(const std::vector<bool>& data);
+    
+    /**
+     * @brief 解交织函数(二进制版本)
+     * @param interleavedData 交织后的数据
+     * @return 解交织后的数据
+     */
+    std::vector<bool> deinterleave(const std::vector<bool>& interleavedData);
+    
+    /**
+     * @brief 交织函数(字节版本)
+     * @param data 要交织的数据
+     * @return 交织后的数据
+     */
+    std::vector<uint8_t> interleave(const std::vector<uint8_t>& data);
+    
+    /**
+     * @brief 解交织函数(字节版本)
+     * @param interleavedData 交织后的数据
+     * @return 解交织后的数据
+     */
+    std::vector<uint8_t> deinterleave(const std::vector<uint8_t>& interleavedData);
+    
+    /**
+     * @brief 交织函数(打包比特版本)
+     * @param data 要交织的比特
+     * @return 交织后的比特
+     */
+    BitBuffer interleave(const BitSpan& data);
+    
+    /**
+     * @brief 解交织函数(打包比特版本)
+     * @param interleavedData 交织后的比特
+     * @return 解交织后的比特
+     */
+    BitBuffer deinterleave(const BitSpan& interleavedData);
+    
+    /**
+     * @brief 交织到调用方缓冲区(字节版本)
+     * @param data 要交织的数据
+     * @param length 数据长度
+     * @param output 输出缓冲区，至少calculateInterleavedLength(length)字节，不能与data重叠
+     * @return 写入的字节数，末尾不足一个矩阵的部分补0
+     */
+    size_t interleave(const uint8_t* data, size_t length, uint8_t* output);
+    
+    /**
+     * @brief 解交织到调用方缓冲区(字节版本)
+     * @param interleavedData 交织后的数据
+     * @param length 数据长度
+     * @param output 输出缓冲区，至少length字节，不能与interleavedData重叠
+     * @return 写入的字节数，只处理完整的矩阵
+     */
+    size_t deinterleave(const uint8_t* interleavedData, size_t length, uint8_t* output);
+    
+    /**
+     * @brief 批量交织多个等长帧
+     * @param frames 连续存放的frameCount个帧
+     * @param frameCount 帧数
+     * @param frameLength 每帧长度
+     * @param output 输出缓冲区，每帧占calculateInterleavedLength(frameLength)字节
+     * @return 处理的帧数
+     */
+    size_t interleaveBatch(const uint8_t* frames, size_t frameCount, size_t frameLength, uint8_t* output);
+    
+    /**
+     * @brief 批量解交织多个等长帧
+     * @param frames 连续存放的frameCount个帧
+     * @param frameCount 帧数
+     * @param frameLength 每帧长度
+     * @param output 输出缓冲区，每帧占calculateOriginalLength(frameLength)字节
+     * @return 处理的帧数
+     */
+    size_t deinterleaveBatch(const uint8_t* frames, size_t frameCount, size_t frameLength, uint8_t* output);
+    
     /**
      * @brief 设置交织参数
      * @param rows 行数
@@ -152,6 +235,108 @@ std::vector<uint8_t> interleave(const std::vector<uint8_t>& data, int rows, int
  */
 std::vector<uint8_t> deinterleave(const std::vector<uint8_t>& interleavedData, int rows, int cols);
 
+/**
+ * @brief 全局交织函数(打包比特版本)
+ * @param data 原始比特，不足整个矩阵时补0
+ * @param rows 矩阵行数
+ * @param cols 矩阵列数
+ * @return 交织后的比特
+ */
+BitBuffer interleave(const BitSpan& data, int rows, int cols);
+
+/**
+ * @brief 全局解交织函数(打包比特版本)
+ * @param interleavedData 交织后的比特
+ * @param rows 矩阵行数
+ * @param cols 矩阵列数
+ * @return 解交织后的比特
+ */
+BitBuffer deinterleave(const BitSpan& interleavedData, int rows, int cols);
+
+/**
+ * @brief 全局交织函数(字节版本，输出到调用方缓冲区)
+ * 
+ * 使用按(rows, cols)缓存的置换表直接收集到output，不复制和填充输入；
+ * 大矩阵使用分块转置。
+ * @param data 原始字节数据
+ * @param length 数据长度
+ * @param output 输出缓冲区，至少为length向上取整到rows*cols的倍数，不能与data重叠
+ * @param rows 矩阵行数
+ * @param cols 矩阵列数
+ * @param padding 最后一个矩阵不足部分的填充字节，字符串版本为'0'
+ * @return 写入的字节数，参数无效时为0
+ */
+size_t interleave(const uint8_t* data, size_t length, uint8_t* output, int rows, int cols,
+                  uint8_t padding = 0);
+
+/**
+ * @brief 全局解交织函数(字节版本，输出到调用方缓冲区)
+ * @param interleavedData 交织后的字节数据
+ * @param length 数据长度
+ * @param output 输出缓冲区，至少length字节，不能与interleavedData重叠
+ * @param rows 矩阵行数
+ * @param cols 矩阵列数
+ * @return 写入的字节数，只处理完整的矩阵，参数无效时为0
+ */
+size_t deinterleave(const uint8_t* interleavedData, size_t length, uint8_t* output, int rows, int cols);
+
+/**
+ * @brief 全局批量交织函数
+ * @param frames 连续存放的frameCount个帧，每帧frameLength字节
+ * @param frameCount 帧数
+ * @param frameLength 每帧长度
+ * @param output 输出缓冲区，每帧占frameLength向上取整到rows*cols的倍数
+ * @param rows 矩阵行数
+ * @param cols 矩阵列数
+ * @return 处理的帧数
+ */
+size_t interleaveBatch(const uint8_t* frames, size_t frameCount, size_t frameLength,
+                       uint8_t* output, int rows, int cols);
+
+/**
+ * @brief 全局批量解交织函数
+ * @param frames 连续存放的frameCount个帧，每帧frameLength字节
+ * @param frameCount 帧数
+ * @param frameLength 每帧长度
+ * @param output 输出缓冲区，每帧占frameLength向下取整到rows*cols的倍数
+ * @param rows 矩阵行数
+ * @param cols 矩阵列数
+ * @return 处理的帧数
+ */
+size_t deinterleaveBatch(const uint8_t* frames, size_t frameCount, size_t frameLength,
+                         uint8_t* output, int rows, int cols);
+
+// STDP消息的符号交织布局: 108个5比特符号按9行12列交织，其后的比特不参与交织
+const int stdp_symbol_bits = 5;
+const int stdp_symbol_rows = 9;
+const int stdp_symbol_cols = 12;
+
+/**
+ * @brief 按符号交织比特序列
+ * 
+ * 每symbolBits个比特为一个符号，符号按行写入rows x cols矩阵、按列读出。
+ * 只处理完整的矩阵，末尾不足一个矩阵的比特原样保留。
+ * 默认参数对应STDP消息的9x12布局。
+ * @param data 原始比特
+ * @param symbolBits 每个符号的比特数(1~64)
+ * @param rows 矩阵行数
+ * @param cols 矩阵列数
+ * @return 交织后的比特
+ */
+BitBuffer interleaveSymbols(const BitSpan& data, int symbolBits = stdp_symbol_bits,
+                            int rows = stdp_symbol_rows, int cols = stdp_symbol_cols);
+
+/**
+ * @brief 按符号解交织比特序列，interleaveSymbols的逆操作
+ * @param interleavedData 交织后的比特
+ * @param symbolBits 每个符号的比特数(1~64)
+ * @param rows 矩阵行数
+ * @param cols 矩阵列数
+ * @return 解交织后的比特
+ */
+BitBuffer deinterleaveSymbols(const BitSpan& interleavedData, int symbolBits = stdp_symbol_bits,
+                              int rows = stdp_symbol_rows, int cols = stdp_symbol_cols);
+
 } // namespace interleaving
 } // namespace coding
 } // namespace link16
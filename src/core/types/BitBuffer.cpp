@@ -0,0 +1,255 @@
+#include "BitBuffer.h"
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+
+namespace link16 {
+
+namespace {
+
+// 统计64位字中1的个数
+inline size_t popcount64(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(__builtin_popcountll(value));
+#else
+    return std::bitset<64>(value).count();
+#endif
+}
+
+// 高count位的掩码
+inline uint64_t highMask(int count) {
+    return count >= 64 ? ~uint64_t(0) : ~(~uint64_t(0) >> count);
+}
+
+// 按大端读取8字节
+inline uint64_t loadBigEndian(const uint8_t* bytes) {
+    uint64_t value = 0;
+    for (int i = 0; i < 8; ++i) {
+        value = (value << 8) | bytes[i];
+    }
+    return value;
+}
+
+// 每个字节值对应的8个'0'/'1'字符
+struct ByteStringTable {
+    char chars[256][8];
+
+    ByteStringTable() {
+        for (int b = 0; b < 256; ++b) {
+            for (int i = 0; i < 8; ++i) {
+                chars[b][i] = ((b >> (7 - i)) & 1) ? '1' : '0';
+            }
+        }
+    }
+};
+
+const ByteStringTable& byteStringTable() {
+    static const ByteStringTable table;
+    return table;
+}
+
+} // namespace
+
+// 读取从pos开始的count个比特
+uint64_t BitSpan::getBits(size_t pos, int count) const {
+    const size_t absolute = bitOffset + pos;
+    const size_t index = absolute / 64;
+    const int shift = static_cast<int>(absolute % 64);
+
+    uint64_t value = words[index] << shift;
+    if (shift + count > 64) {
+        value |= words[index + 1] >> (64 - shift);
+    }
+    return value >> (64 - count);
+}
+
+// 统计1的个数
+size_t BitSpan::count() const {
+    size_t total = 0;
+    size_t pos = 0;
+    for (; pos + 64 <= bitCount; pos += 64) {
+        total += popcount64(getBits(pos, 64));
+    }
+    if (pos < bitCount) {
+        total += popcount64(getBits(pos, static_cast<int>(bitCount - pos)));
+    }
+    return total;
+}
+
+// 转换为'0'/'1'字符串，每次展开一个字节
+std::string BitSpan::toString() const {
+    std::string result(bitCount, '0');
+    const ByteStringTable& table = byteStringTable();
+
+    size_t pos = 0;
+    for (; pos + 8 <= bitCount; pos += 8) {
+        std::memcpy(&result[pos], table.chars[getBits(pos, 8)], 8);
+    }
+    for (; pos < bitCount; ++pos) {
+        result[pos] = (*this)[pos] ? '1' : '0';
+    }
+    return result;
+}
+
+// 构造函数
+BitBuffer::BitBuffer(size_t size, bool value)
+    : words((size + 63) / 64, value ? ~uint64_t(0) : 0), bitCount(size) {
+    if (value && size % 64 != 0) {
+        words.back() &= highMask(static_cast<int>(size % 64));
+    }
+}
+
+// 从'0'/'1'字符串构造，每次处理8个字符
+BitBuffer BitBuffer::fromString(const std::string& bits, bool* ok) {
+    BitBuffer buffer;
+    buffer.reserve(bits.length());
+
+    const char* chars = bits.data();
+    const size_t length = bits.length();
+    size_t pos = 0;
+
+    for (; pos + 8 <= length; pos += 8) {
+        uint64_t chunk;
+        std::memcpy(&chunk, chars + pos, 8);
+        chunk -= 0x3030303030303030ULL;
+        if ((chunk & 0xFEFEFEFEFEFEFEFEULL) != 0) {
+            break;
+        }
+        // 逐字节取最低位，首字符为最高位
+        uint64_t byte = 0;
+        for (int i = 0; i < 8; ++i) {
+            byte = (byte << 1) | static_cast<uint64_t>(chars[pos + i] - '0');
+        }
+        buffer.append(byte, 8);
+    }
+
+    for (; pos < length; ++pos) {
+        const char c = chars[pos];
+        if (c != '0' && c != '1') {
+            if (ok) {
+                *ok = false;
+            }
+            return buffer;
+        }
+        buffer.pushBack(c == '1');
+    }
+
+    if (ok) {
+        *ok = true;
+    }
+    return buffer;
+}
+
+// 从字节数组构造
+BitBuffer BitBuffer::fromBytes(const uint8_t* bytes, size_t length) {
+    BitBuffer buffer;
+    buffer.bitCount = length * 8;
+    buffer.words.assign((length + 7) / 8, 0);
+
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        buffer.words[i / 8] = loadBigEndian(bytes + i);
+    }
+    for (int shift = 56; i < length; ++i, shift -= 8) {
+        buffer.words[i / 8] |= static_cast<uint64_t>(bytes[i]) << shift;
+    }
+    return buffer;
+}
+
+// 调整大小
+void BitBuffer::resize(size_t size) {
+    if (size < bitCount && size % 64 != 0) {
+        words[size / 64] &= highMask(static_cast<int>(size % 64));
+    }
+    words.resize((size + 63) / 64, 0);
+    bitCount = size;
+}
+
+// 追加value的低count个比特
+void BitBuffer::append(uint64_t value, int count) {
+    if (count <= 0) {
+        return;
+    }
+    if (count < 64) {
+        value &= (uint64_t(1) << count) - 1;
+    }
+
+    const int used = static_cast<int>(bitCount % 64);
+    if (used == 0) {
+        words.push_back(value << (64 - count));
+    } else {
+        const int free = 64 - used;
+        if (count <= free) {
+            words.back() |= value << (free - count);
+        } else {
+            words.back() |= value >> (count - free);
+            words.push_back(value << (64 - (count - free)));
+        }
+    }
+    bitCount += count;
+}
+
+// 追加一段比特
+void BitBuffer::append(const BitSpan& bits) {
+    reserve(bitCount + bits.size());
+    size_t pos = 0;
+    for (; pos + 64 <= bits.size(); pos += 64) {
+        append(bits.getBits(pos, 64), 64);
+    }
+    if (pos < bits.size()) {
+        const int rest = static_cast<int>(bits.size() - pos);
+        append(bits.getBits(pos, rest), rest);
+    }
+}
+
+// 将value的低count个比特写到pos开始的位置
+void BitBuffer::setBits(size_t pos, int count, uint64_t value) {
+    if (count <= 0) {
+        return;
+    }
+    // 左对齐后按字写入
+    value <<= (64 - count);
+    const size_t index = pos / 64;
+    const int shift = static_cast<int>(pos % 64);
+    const uint64_t mask = highMask(count);
+
+    words[index] = (words[index] & ~(mask >> shift)) | (value >> shift);
+    if (shift + count > 64) {
+        words[index + 1] = (words[index + 1] & ~(mask << (64 - shift))) | (value << (64 - shift));
+    }
+}
+
+// 按高位在前打包为字节
+void BitBuffer::toBytes(uint8_t* bytes) const {
+    const size_t length = (bitCount + 7) / 8;
+    for (size_t i = 0; i < length; ++i) {
+        bytes[i] = static_cast<uint8_t>(words[i / 8] >> (56 - 8 * (i % 8)));
+    }
+}
+
+// 计算汉明距离，每次比较64个比特
+size_t hammingDistance(const BitSpan& a, const BitSpan& b) {
+    const size_t length = std::min(a.size(), b.size());
+    size_t distance = 0;
+    size_t pos = 0;
+
+    if (a.offset() == 0 && b.offset() == 0) {
+        const uint64_t* x = a.data();
+        const uint64_t* y = b.data();
+        for (; pos + 64 <= length; pos += 64) {
+            distance += popcount64(x[pos / 64] ^ y[pos / 64]);
+        }
+    } else {
+        for (; pos + 64 <= length; pos += 64) {
+            distance += popcount64(a.getBits(pos, 64) ^ b.getBits(pos, 64));
+        }
+    }
+
+    if (pos < length) {
+        const int rest = static_cast<int>(length - pos);
+        distance += popcount64(a.getBits(pos, rest) ^ b.getBits(pos, rest));
+    }
+    return distance;
+}
+
+} // namespace link16
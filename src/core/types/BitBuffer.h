@@ -0,0 +1,199 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace link16 {
+
+/**
+ * @brief 只读比特视图
+ *
+ * 引用一段以uint64_t字存放的比特序列，不拥有内存。比特按MSB优先排列：
+ * 第i个比特位于第(offset+i)/64个字的第63-(offset+i)%64位，
+ * 因此与'0'/'1'字符串以及按字节大端展开的顺序一致。
+ */
+class BitSpan {
+public:
+    BitSpan() : words(nullptr), bitOffset(0), bitCount(0) {}
+
+    /**
+     * @brief 构造函数
+     * @param words 比特所在的字数组
+     * @param size 比特数
+     * @param offset 起始比特在字数组中的偏移
+     */
+    BitSpan(const uint64_t* words, size_t size, size_t offset = 0)
+        : words(words + offset / 64), bitOffset(offset % 64), bitCount(size) {}
+
+    // 比特数
+    size_t size() const { return bitCount; }
+
+    // 是否为空
+    bool empty() const { return bitCount == 0; }
+
+    // 获取第i个比特
+    bool operator[](size_t i) const {
+        const size_t pos = bitOffset + i;
+        return (words[pos / 64] >> (63 - pos % 64)) & 1;
+    }
+
+    /**
+     * @brief 读取从pos开始的count个比特(1 <= count <= 64)
+     * @return 右对齐的值，第一个比特为最高位
+     */
+    uint64_t getBits(size_t pos, int count) const;
+
+    // 子视图
+    BitSpan subspan(size_t pos, size_t count) const {
+        return BitSpan(words, count, bitOffset + pos);
+    }
+
+    // 统计1的个数
+    size_t count() const;
+
+    // 转换为'0'/'1'字符串
+    std::string toString() const;
+
+    // 底层字数组与起始偏移
+    const uint64_t* data() const { return words; }
+    size_t offset() const { return bitOffset; }
+
+private:
+    const uint64_t* words;
+    size_t bitOffset;
+    size_t bitCount;
+};
+
+/**
+ * @brief 以uint64_t字存放的比特缓冲区
+ *
+ * 替代每比特占一个字节的'0'/'1'字符串，在协议、编码、物理层和仿真指标之间传递比特。
+ * 比特顺序与BitSpan相同，最后一个字中超出size()的比特始终为0。
+ */
+class BitBuffer {
+public:
+    BitBuffer() : bitCount(0) {}
+
+    /**
+     * @brief 构造函数
+     * @param size 比特数
+     * @param value 初始值
+     */
+    explicit BitBuffer(size_t size, bool value = false);
+
+    /**
+     * @brief 从'0'/'1'字符串构造，其他字符视为非法
+     * @param bits 比特字符串
+     * @param ok 输出是否全部合法，可为空；非法时返回已解析的前缀
+     */
+    static BitBuffer fromString(const std::string& bits, bool* ok = nullptr);
+
+    /**
+     * @brief 从字节数组构造，每字节按高位在前展开为8个比特
+     * @param bytes 字节数组
+     * @param length 字节数
+     */
+    static BitBuffer fromBytes(const uint8_t* bytes, size_t length);
+
+    // 比特数
+    size_t size() const { return bitCount; }
+
+    // 是否为空
+    bool empty() const { return bitCount == 0; }
+
+    // 预留容量(比特)
+    void reserve(size_t bits) { words.reserve((bits + 63) / 64); }
+
+    // 清空
+    void clear() {
+        words.clear();
+        bitCount = 0;
+    }
+
+    // 调整大小，新增比特为0
+    void resize(size_t size);
+
+    // 获取第i个比特
+    bool operator[](size_t i) const {
+        return (words[i / 64] >> (63 - i % 64)) & 1;
+    }
+
+    // 设置第i个比特
+    void set(size_t i, bool value) {
+        const uint64_t mask = uint64_t(1) << (63 - i % 64);
+        if (value) {
+            words[i / 64] |= mask;
+        } else {
+            words[i / 64] &= ~mask;
+        }
+    }
+
+    // 翻转第i个比特
+    void flip(size_t i) {
+        words[i / 64] ^= uint64_t(1) << (63 - i % 64);
+    }
+
+    // 追加一个比特
+    void pushBack(bool value) {
+        append(value ? 1 : 0, 1);
+    }
+
+    /**
+     * @brief 追加value的低count个比特(0 <= count <= 64)，高位先追加
+     */
+    void append(uint64_t value, int count);
+
+    // 追加一段比特
+    void append(const BitSpan& bits);
+
+    // 读取从pos开始的count个比特(1 <= count <= 64)
+    uint64_t getBits(size_t pos, int count) const {
+        return span().getBits(pos, count);
+    }
+
+    // 将value的低count个比特写到pos开始的位置
+    void setBits(size_t pos, int count, uint64_t value);
+
+    // 只读视图
+    BitSpan span() const { return BitSpan(words.data(), bitCount); }
+    operator BitSpan() const { return span(); }
+
+    // 统计1的个数
+    size_t count() const { return span().count(); }
+
+    // 转换为'0'/'1'字符串
+    std::string toString() const { return span().toString(); }
+
+    /**
+     * @brief 按高位在前打包为字节，不足8比特的末尾补0
+     * @param bytes 输出缓冲区，至少(size()+7)/8字节
+     */
+    void toBytes(uint8_t* bytes) const;
+
+    // 底层字数组
+    uint64_t* data() { return words.data(); }
+    const uint64_t* data() const { return words.data(); }
+    size_t wordCount() const { return words.size(); }
+
+    bool operator==(const BitBuffer& other) const {
+        return bitCount == other.bitCount && words == other.words;
+    }
+    bool operator!=(const BitBuffer& other) const {
+        return !(*this == other);
+    }
+
+private:
+    std::vector<uint64_t> words;
+    size_t bitCount;
+};
+
+/**
+ * @brief 计算两段比特的汉明距离，长度不同时只比较较短的部分
+ * @param a 比特序列
+ * @param b 比特序列
+ * @return 不同比特的数量
+ */
+size_t hammingDistance(const BitSpan& a, const BitSpan& b);
+
+} // namespace link16
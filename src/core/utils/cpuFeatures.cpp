@@ -0,0 +1,83 @@
+#include "cpuFeatures.h"
+
+#if defined(LINK16_ARCH_X86)
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#endif
+
+namespace link16 {
+namespace utils {
+
+namespace {
+
+#if defined(LINK16_ARCH_X86)
+// 执行CPUID指令
+void cpuid(unsigned int leaf, unsigned int subleaf, unsigned int regs[4]) {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (int i = 0; i < 4; ++i) {
+        regs[i] = static_cast<unsigned int>(info[i]);
+    }
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+// 读取XCR0，判断操作系统是否保存YMM寄存器状态
+unsigned long long readXCR0() {
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    unsigned int eax = 0;
+    unsigned int edx = 0;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+}
+#endif
+
+} // namespace
+
+// 获取当前CPU支持的指令集
+const CpuFeatures& CpuFeatures::get() {
+    static const CpuFeatures features;
+    return features;
+}
+
+// 构造函数，执行一次检测
+CpuFeatures::CpuFeatures()
+    : sse41(false), sse42(false), avx2(false), fma(false), pclmul(false), aesni(false) {
+#if defined(LINK16_ARCH_X86)
+    unsigned int regs[4] = {0, 0, 0, 0};
+    cpuid(0, 0, regs);
+    const unsigned int maxLeaf = regs[0];
+    if (maxLeaf < 1) {
+        return;
+    }
+
+    cpuid(1, 0, regs);
+    const unsigned int ecx = regs[2];
+    sse41  = (ecx & (1u << 19)) != 0;
+    sse42  = (ecx & (1u << 20)) != 0;
+    pclmul = (ecx & (1u << 1)) != 0;
+    aesni  = (ecx & (1u << 25)) != 0;
+
+    // AVX/FMA需要操作系统开启XSAVE并保存XMM/YMM状态
+    const bool osxsave = (ecx & (1u << 27)) != 0;
+    const bool avx = (ecx & (1u << 28)) != 0;
+    const bool ymmEnabled = osxsave && avx && ((readXCR0() & 0x6) == 0x6);
+    fma = ymmEnabled && (ecx & (1u << 12)) != 0;
+
+    if (maxLeaf >= 7 && ymmEnabled) {
+        cpuid(7, 0, regs);
+        avx2 = (regs[1] & (1u << 5)) != 0;
+    }
+#endif
+}
+
+} // namespace utils
+} // namespace link16
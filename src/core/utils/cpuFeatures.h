@@ -0,0 +1,40 @@
+#pragma once
+
+// 指令集架构检测
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define LINK16_ARCH_X86
+#endif
+
+// 为单个函数开启指定指令集(GCC/Clang)，MSVC无需开启即可使用intrinsics
+#if defined(LINK16_ARCH_X86) && (defined(__GNUC__) || defined(__clang__))
+    #define LINK16_TARGET(features) __attribute__((target(features)))
+#else
+    #define LINK16_TARGET(features)
+#endif
+
+namespace link16 {
+namespace utils {
+
+/**
+ * @brief 运行时CPU指令集检测
+ *
+ * 各加速路径在运行时根据检测结果选择实现，编译时无需开启对应的编译选项。
+ */
+class CpuFeatures {
+public:
+    // 获取当前CPU支持的指令集
+    static const CpuFeatures& get();
+
+    bool sse41;   // SSE4.1 (含SSSE3 PSHUFB)
+    bool sse42;   // SSE4.2 (CRC32C)
+    bool avx2;    // AVX2 (需要操作系统支持YMM状态保存)
+    bool fma;     // FMA3
+    bool pclmul;  // PCLMULQDQ
+    bool aesni;   // AES-NI
+
+private:
+    CpuFeatures();
+};
+
+} // namespace utils
+} // namespace link16
@@ -1,42 +1,175 @@
 #include "logger.h"
 #include <iostream>
 #include <chrono>
-#include <iomanip>
-#include <sstream>
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
 
 namespace link16 {
 namespace utils {
 
+// 一条待写出的日志，时间戳在调用线程获取，格式化推迟到写线程
+struct LogRecord {
+    std::chrono::system_clock::time_point time;
+    LogLevel level;
+    std::string message;
+};
+
+namespace {
+
+// 每个线程的环形缓冲区容量(条)，必须为2的幂
+const size_t log_buffer_capacity = 1024;
+
+// 写线程空闲时的最长等待时间
+const std::chrono::milliseconds writer_interval(5);
+
+// 按秒缓存的时间前缀，同一秒内的记录只调用一次strftime
+class TimeFormatter {
+public:
+    TimeFormatter() : cachedSecond(-1), cachedText() {}
+
+    // 追加"YYYY-mm-dd HH:MM:SS.mmm"
+    void append(std::chrono::system_clock::time_point time, std::string& out) {
+        const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count();
+        const long long second = ms / 1000;
+        if (second != cachedSecond) {
+            const std::time_t t = static_cast<std::time_t>(second);
+            std::tm local;
+#if defined(_WIN32)
+            localtime_s(&local, &t);
+#else
+            localtime_r(&t, &local);
+#endif
+            std::strftime(cachedText, sizeof(cachedText), "%Y-%m-%d %H:%M:%S", &local);
+            cachedSecond = second;
+        }
+        char millis[8];
+        std::snprintf(millis, sizeof(millis), ".%03d", static_cast<int>(ms % 1000));
+        out += cachedText;
+        out += millis;
+    }
+
+private:
+    long long cachedSecond;
+    char cachedText[32];
+};
+
+// 由fileMutex保护
+TimeFormatter time_formatter;
+
+} // namespace
+
+// 单生产者单消费者环形缓冲区，生产者为所属线程，消费者为写线程
+struct LogBuffer {
+    LogRecord records[log_buffer_capacity];
+
+    // 下一个写入位置，只由生产者修改
+    std::atomic<size_t> head{0};
+
+    // 下一个读取位置，只由消费者修改
+    std::atomic<size_t> tail{0};
+
+    // 所属线程已退出，写线程取完剩余记录后释放
+    std::atomic<bool> retired{false};
+
+    // 移入一条记录，缓冲区已满时返回false且不修改record
+    bool push(LogRecord& record) {
+        const size_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) == log_buffer_capacity) {
+            return false;
+        }
+        records[h & (log_buffer_capacity - 1)] = std::move(record);
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 取出全部记录追加到out
+    void drain(std::vector<LogRecord>& out) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        const size_t h = head.load(std::memory_order_acquire);
+        for (; t != h; ++t) {
+            out.push_back(std::move(records[t & (log_buffer_capacity - 1)]));
+        }
+        tail.store(t, std::memory_order_release);
+    }
+
+    bool empty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_relaxed);
+    }
+};
+
+namespace {
+
+// 线程退出时标记缓冲区，由写线程写完剩余记录后释放
+struct LogBufferHandle {
+    std::shared_ptr<LogBuffer> buffer;
+
+    ~LogBufferHandle() {
+        if (buffer) {
+            buffer->retired.store(true, std::memory_order_release);
+        }
+    }
+};
+
+} // namespace
+
 // 获取单例实例
 Logger& Logger::getInstance() {
     static Logger instance;
     return instance;
 }
 
-// 构造函数
-Logger::Logger() : currentLevel(LogLevel::INFO), initialized(false) {
+// 构造函数，启动后台写线程
+Logger::Logger()
+    : currentLevel(LogLevel::INFO), initialized(false), flushRequested(0), flushCompleted(0),
+      stopping(false), writerRunning(true) {
+    writerThread = std::thread(&Logger::writerLoop, this);
+}
+
+// 析构函数，写出剩余日志后停止写线程
+Logger::~Logger() {
+    {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        stopping = true;
+    }
+    writerCondition.notify_one();
+    if (writerThread.joinable()) {
+        writerThread.join();
+    }
+
+    std::lock_guard<std::mutex> lock(fileMutex);
+    if (logFile.is_open()) {
+        logFile.close();
+    }
 }
 
 // 初始化日志系统
 bool Logger::initialize(const std::string& logFilePath, LogLevel minLevel) {
-    std::lock_guard<std::mutex> lock(logMutex);
-    
-    if (initialized) {
-        // 如果已经初始化，先关闭之前的日志文件
-        if (logFile.is_open()) {
-            logFile.close();
+    // 此前的日志仍按原来的目标写出
+    flush();
+
+    {
+        std::lock_guard<std::mutex> lock(fileMutex);
+
+        if (initialized) {
+            // 如果已经初始化，先关闭之前的日志文件
+            if (logFile.is_open()) {
+                logFile.close();
+            }
+            initialized = false;
         }
+
+        logFile.open(logFilePath, std::ios::out | std::ios::app);
+        if (!logFile.is_open()) {
+            std::cerr << "无法打开日志文件: " << logFilePath << std::endl;
+            return false;
+        }
+
+        initialized = true;
     }
-    
-    logFile.open(logFilePath, std::ios::out | std::ios::app);
-    if (!logFile.is_open()) {
-        std::cerr << "无法打开日志文件: " << logFilePath << std::endl;
-        return false;
-    }
-    
-    currentLevel = minLevel;
-    initialized = true;
-    
+
+    currentLevel.store(minLevel, std::memory_order_relaxed);
+
     // 记录初始化信息
     log(LogLevel::INFO, "日志系统初始化成功");
     return true;
@@ -44,74 +177,205 @@ bool Logger::initialize(const std::string& logFilePath, LogLevel minLevel) {
 
 // 关闭日志系统
 void Logger::shutdown() {
-    std::lock_guard<std::mutex> lock(logMutex);
-    
-    if (initialized && logFile.is_open()) {
-        log(LogLevel::INFO, "日志系统关闭");
-        logFile.close();
-        initialized = false;
+    {
+        std::lock_guard<std::mutex> lock(fileMutex);
+        if (!initialized || !logFile.is_open()) {
+            return;
+        }
     }
+
+    log(LogLevel::INFO, "日志系统关闭");
+    flush();
+
+    std::lock_guard<std::mutex> lock(fileMutex);
+    logFile.close();
+    initialized = false;
 }
 
 // 日志记录方法
-void Logger::debug(const std::string& message) {
-    log(LogLevel::DEBUG, message);
+void Logger::debug(std::string message) {
+    log(LogLevel::DEBUG, std::move(message));
 }
 
-void Logger::info(const std::string& message) {
-    log(LogLevel::INFO, message);
+void Logger::info(std::string message) {
+    log(LogLevel::INFO, std::move(message));
 }
 
-void Logger::warning(const std::string& message) {
-    log(LogLevel::WARNING, message);
+void Logger::warning(std::string message) {
+    log(LogLevel::WARNING, std::move(message));
 }
 
-void Logger::error(const std::string& message) {
-    log(LogLevel::ERROR, message);
+void Logger::error(std::string message) {
+    log(LogLevel::ERROR, std::move(message));
 }
 
-void Logger::fatal(const std::string& message) {
-    log(LogLevel::FATAL, message);
+void Logger::fatal(std::string message) {
+    log(LogLevel::FATAL, std::move(message));
 }
 
 // 设置日志级别
 void Logger::setLogLevel(LogLevel level) {
-    std::lock_guard<std::mutex> lock(logMutex);
-    currentLevel = level;
+    currentLevel.store(level, std::memory_order_relaxed);
 }
 
 // 获取当前日志级别
 LogLevel Logger::getLogLevel() const {
-    return currentLevel;
+    return currentLevel.load(std::memory_order_relaxed);
+}
+
+// 等待此前记录的日志全部写出
+void Logger::flush() {
+    if (std::this_thread::get_id() == writerThread.get_id()) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(writerMutex);
+    const uint64_t target = ++flushRequested;
+    writerCondition.notify_one();
+    flushCondition.wait(lock, [&]() {
+        return flushCompleted >= target || !writerRunning.load(std::memory_order_acquire);
+    });
 }
 
 // 日志记录实现
-void Logger::log(LogLevel level, const std::string& message) {
+void Logger::log(LogLevel level, std::string message) {
     // 检查日志级别
-    if (level < currentLevel) {
+    if (!isEnabled(level)) {
+        return;
+    }
+
+    LogRecord record{std::chrono::system_clock::now(), level, std::move(message)};
+
+    // 写线程已停止(进程退出阶段)时直接同步写出
+    if (!writerRunning.load(std::memory_order_acquire)) {
+        std::vector<LogRecord> records;
+        records.push_back(std::move(record));
+        std::lock_guard<std::mutex> lock(fileMutex);
+        writeRecords(records);
         return;
     }
-    
-    std::lock_guard<std::mutex> lock(logMutex);
-    
+
+    // 缓冲区满时唤醒写线程并让出CPU，直到有空位
+    LogBuffer& buffer = getThreadBuffer();
+    while (!buffer.push(record)) {
+        writerCondition.notify_one();
+        std::this_thread::yield();
+    }
+
+    if (level >= LogLevel::ERROR) {
+        writerCondition.notify_one();
+    }
+    if (level == LogLevel::FATAL) {
+        flush();
+    }
+}
+
+// 获取当前线程的环形缓冲区，首次调用时注册
+LogBuffer& Logger::getThreadBuffer() {
+    thread_local LogBufferHandle handle;
+    if (!handle.buffer) {
+        handle.buffer = std::make_shared<LogBuffer>();
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        buffers.push_back(handle.buffer);
+    }
+    return *handle.buffer;
+}
+
+// 后台写线程主循环
+void Logger::writerLoop() {
+    std::vector<std::shared_ptr<LogBuffer>> snapshot;
+    std::vector<LogRecord> records;
+
+    for (;;) {
+        uint64_t target;
+        bool stop;
+        {
+            std::unique_lock<std::mutex> lock(writerMutex);
+            if (!stopping && flushRequested == flushCompleted) {
+                writerCondition.wait_for(lock, writer_interval);
+            }
+            target = flushRequested;
+            stop = stopping;
+        }
+
+        // 复制缓冲区列表，取记录时不阻塞新线程注册
+        {
+            std::lock_guard<std::mutex> lock(buffersMutex);
+            snapshot = buffers;
+        }
+        for (const auto& buffer : snapshot) {
+            buffer->drain(records);
+        }
+
+        if (!records.empty()) {
+            // 各线程内已有序，合并后按时间排序
+            std::stable_sort(records.begin(), records.end(), [](const LogRecord& a, const LogRecord& b) {
+                return a.time < b.time;
+            });
+            std::lock_guard<std::mutex> lock(fileMutex);
+            writeRecords(records);
+            records.clear();
+        }
+
+        // 释放所属线程已退出且已取空的缓冲区
+        {
+            std::lock_guard<std::mutex> lock(buffersMutex);
+            buffers.erase(std::remove_if(buffers.begin(), buffers.end(), [](const std::shared_ptr<LogBuffer>& b) {
+                return b->retired.load(std::memory_order_acquire) && b->empty();
+            }), buffers.end());
+        }
+        snapshot.clear();
+
+        {
+            std::lock_guard<std::mutex> lock(writerMutex);
+            flushCompleted = std::max(flushCompleted, target);
+            if (stop) {
+                writerRunning.store(false, std::memory_order_release);
+            }
+        }
+        flushCondition.notify_all();
+
+        if (stop) {
+            return;
+        }
+    }
+}
+
+// 格式化并写出一批记录，调用者持有fileMutex
+void Logger::writeRecords(const std::vector<LogRecord>& records) {
+    std::string text;
+    std::string errors;
+    for (const LogRecord& record : records) {
+        const size_t start = text.size();
+        time_formatter.append(record.time, text);
+        text += " [";
+        text += getLevelString(record.level);
+        text += "] ";
+        text += record.message;
+        text += '\n';
+
+        // 错误和致命错误同时输出到控制台
+        if (initialized && record.level >= LogLevel::ERROR) {
+            errors.append(text, start, std::string::npos);
+        }
+    }
+
     // 如果未初始化，输出到控制台
     if (!initialized || !logFile.is_open()) {
-        std::cout << getCurrentTimeString() << " [" << getLevelString(level) << "] " << message << std::endl;
+        std::cout << text << std::flush;
         return;
     }
-    
-    // 写入日志文件
-    logFile << getCurrentTimeString() << " [" << getLevelString(level) << "] " << message << std::endl;
+
+    // 每批只写一次并刷新一次
+    logFile << text;
     logFile.flush();
-    
-    // 错误和致命错误同时输出到控制台
-    if (level >= LogLevel::ERROR) {
-        std::cerr << getCurrentTimeString() << " [" << getLevelString(level) << "] " << message << std::endl;
+    if (!errors.empty()) {
+        std::cerr << errors << std::flush;
     }
 }
 
 // 获取日志级别字符串
-std::string Logger::getLevelString(LogLevel level) const {
+const char* Logger::getLevelString(LogLevel level) {
     switch (level) {
         case LogLevel::DEBUG:   return "DEBUG";
         case LogLevel::INFO:    return "INFO";
@@ -122,18 +386,5 @@ std::string Logger::getLevelString(LogLevel level) const {
     }
 }
 
-// 获取当前时间字符串
-std::string Logger::getCurrentTimeString() const {
-    auto now = std::chrono::system_clock::now();
-    auto time = std::chrono::system_clock::to_time_t(now);
-    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
-    
-    std::stringstream ss;
-    ss << std::put_time(std::localtime(&time), "%Y-%m-%d %H:%M:%S");
-    ss << '.' << std::setfill('0') << std::setw(3) << ms.count();
-    
-    return ss.str();
-}
-
 } // namespace utils
 } // namespace link16
@@ -2,6 +2,18 @@
 #include <string>
 #include <fstream>
 #include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// 编译期最低日志级别(0=DEBUG, 1=INFO, 2=WARNING, 3=ERROR, 4=FATAL)
+// 低于该级别的LOG_*调用连同消息拼接一起被编译器移除
+#ifndef LINK16_LOG_MIN_LEVEL
+#define LINK16_LOG_MIN_LEVEL 0
+#endif
 
 namespace link16 {
 namespace utils {
@@ -15,66 +27,118 @@ enum class LogLevel {
     FATAL
 };
 
+// 日志记录和每个线程的环形缓冲区，定义在logger.cpp中
+struct LogRecord;
+struct LogBuffer;
+
+/**
+ * @brief 异步日志
+ *
+ * 调用线程只把时间戳、级别和消息移入本线程的无锁环形缓冲区，
+ * 由后台写线程合并各线程的记录，按时间排序后格式化并批量写出。
+ * ERROR及以上级别立即唤醒写线程，FATAL等待写出后才返回。
+ */
 class Logger {
 public:
     // 获取单例实例
     static Logger& getInstance();
-    
+
     // 初始化日志系统
     bool initialize(const std::string& logFilePath, LogLevel minLevel = LogLevel::INFO);
-    
+
     // 关闭日志系统
     void shutdown();
-    
+
     // 日志记录方法
-    void debug(const std::string& message);
-    void info(const std::string& message);
-    void warning(const std::string& message);
-    void error(const std::string& message);
-    void fatal(const std::string& message);
-    
+    void debug(std::string message);
+    void info(std::string message);
+    void warning(std::string message);
+    void error(std::string message);
+    void fatal(std::string message);
+
     // 设置日志级别
     void setLogLevel(LogLevel level);
-    
+
     // 获取当前日志级别
     LogLevel getLogLevel() const;
 
+    // 该级别的日志是否会被记录
+    bool isEnabled(LogLevel level) const {
+        return level >= currentLevel.load(std::memory_order_relaxed);
+    }
+
+    // 等待此前记录的日志全部写出
+    void flush();
+
 private:
     // 私有构造函数(单例模式)
     Logger();
-    
+
+    ~Logger();
+
     // 禁止拷贝和赋值
     Logger(const Logger&) = delete;
     Logger& operator=(const Logger&) = delete;
-    
+
     // 日志记录实现
-    void log(LogLevel level, const std::string& message);
-    
+    void log(LogLevel level, std::string message);
+
+    // 获取当前线程的环形缓冲区，首次调用时注册
+    LogBuffer& getThreadBuffer();
+
+    // 后台写线程主循环
+    void writerLoop();
+
+    // 格式化并写出一批记录
+    void writeRecords(const std::vector<LogRecord>& records);
+
     // 获取日志级别字符串
-    std::string getLevelString(LogLevel level) const;
-    
-    // 获取当前时间字符串
-    std::string getCurrentTimeString() const;
-    
-    // 日志文件
+    static const char* getLevelString(LogLevel level);
+
+    // 日志文件，由fileMutex保护
     std::ofstream logFile;
-    
+
     // 日志级别
-    LogLevel currentLevel;
-    
-    // 互斥锁，保证线程安全
-    std::mutex logMutex;
-    
+    std::atomic<LogLevel> currentLevel;
+
+    // 保护日志文件和初始化状态
+    std::mutex fileMutex;
+
     // 是否已初始化
     bool initialized;
+
+    // 已注册的线程缓冲区，由buffersMutex保护
+    std::vector<std::shared_ptr<LogBuffer>> buffers;
+    std::mutex buffersMutex;
+
+    // 写线程的唤醒、停止和flush同步
+    std::mutex writerMutex;
+    std::condition_variable writerCondition;
+    std::condition_variable flushCondition;
+    uint64_t flushRequested;
+    uint64_t flushCompleted;
+    bool stopping;
+
+    // 写线程是否在运行，未运行时日志同步写出
+    std::atomic<bool> writerRunning;
+
+    std::thread writerThread;
 };
 
-// 便捷宏定义
-#define LOG_DEBUG(message) link16::utils::Logger::getInstance().debug(message)
-#define LOG_INFO(message) link16::utils::Logger::getInstance().info(message)
-#define LOG_WARNING(message) link16::utils::Logger::getInstance().warning(message)
-#define LOG_ERROR(message) link16::utils::Logger::getInstance().error(message)
-#define LOG_FATAL(message) link16::utils::Logger::getInstance().fatal(message)
+// 便捷宏定义，先检查级别再构造消息
+#define LINK16_LOG(level, method, message) \
+    do { \
+        if (static_cast<int>(level) >= LINK16_LOG_MIN_LEVEL && \
+            link16::utils::Logger::getInstance().isEnabled(level)) { \
+            link16::utils::Logger::getInstance().method(message); \
+        } \
+    } while (0)
+
+#define LOG_DEBUG(message) LINK16_LOG(link16::utils::LogLevel::DEBUG, debug, message)
+#define LOG_INFO(message) LINK16_LOG(link16::utils::LogLevel::INFO, info, message)
+#define LOG_WARNING(message) LINK16_LOG(link16::utils::LogLevel::WARNING, warning, message)
+#define LOG_ERROR(message) LINK16_LOG(link16::utils::LogLevel::ERROR, error, message)
+#define LOG_FATAL(message) LINK16_LOG(link16::utils::LogLevel::FATAL, fatal, message)
 
 } // namespace utils
 } // namespace link16
@@ -84,12 +84,7 @@ std::vector<std::string> Tools::splitString(const std::string& str, char delimit
 
 // 字符串转二进制字符串
 std::string Tools::stringToBitString(const std::string& str) {
-    std::string result;
-    for (char c : str) {
-        std::bitset<8> bits(c);
-        result += bits.to_string();
-    }
-    return result;
+    return stringToBitBuffer(str).toString();
 }
 
 // 二进制字符串转字符串
@@ -104,6 +99,20 @@ std::string Tools::bitStringToString(const std::string& bitStr) {
     return result;
 }
 
+// 字符串转比特缓冲区，每个字符高位在前展开为8个比特
+BitBuffer Tools::stringToBitBuffer(const std::string& str) {
+    return BitBuffer::fromBytes(reinterpret_cast<const uint8_t*>(str.data()), str.length());
+}
+
+// 比特缓冲区转字符串，不足8比特的末尾被丢弃
+std::string Tools::bitBufferToString(const BitSpan& bits) {
+    std::string result(bits.size() / 8, '\0');
+    for (size_t i = 0; i < result.length(); ++i) {
+        result[i] = static_cast<char>(bits.getBits(i * 8, 8));
+    }
+    return result;
+}
+
 // 字符串转字符数组
 uint8_t* Tools::stringToCharArray(const std::string& strData, int charLength) {
     if (strData.length() % 8 != 0) {
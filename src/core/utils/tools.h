@@ -3,6 +3,7 @@
 #include <vector>
 #include <bitset>
 #include <cstdint>
+#include "core/types/BitBuffer.h"
 
 namespace link16 {
 namespace utils {
@@ -19,6 +20,8 @@ public:
     static std::vector<std::string> splitString(const std::string& str, char delimiter);
     static std::string stringToBitString(const std::string& str);
     static std::string bitStringToString(const std::string& bitStr);
+    static BitBuffer stringToBitBuffer(const std::string& str);
+    static std::string bitBufferToString(const BitSpan& bits);
     
     // 数据转换
     static uint8_t* stringToCharArray(const std::string& strData, int charLength);
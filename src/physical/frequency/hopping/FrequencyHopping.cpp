@@ -3,11 +3,14 @@
 #include <iostream>
 #include <random>
 #include <algorithm>
+#include <utility>
 
 namespace link16 {
 namespace physical {
 namespace frequency {
 
+const int FrequencyHopping::time_slot_pattern;
+
 // 构造函数
 FrequencyHopping::FrequencyHopping()
     : pattern(1), seed(0), currentIndex(0) {
@@ -31,6 +34,12 @@ bool FrequencyHopping::initialize(int pattern, uint32_t seed) {
 
 // 获取下一个跳频频率
 double FrequencyHopping::getNextFrequency() {
+    if (schedule) {
+        double freq = getFrequencyAt(currentIndex);
+        currentIndex = (currentIndex + 1) % getSequenceLength();
+        return freq;
+    }
+    
     if (sequence.empty()) {
         LOG_ERROR("跳频序列为空");
         return 0.0;
@@ -43,6 +52,13 @@ double FrequencyHopping::getNextFrequency() {
 
 // 获取指定索引的跳频频率
 double FrequencyHopping::getFrequencyAt(size_t index) {
+    if (schedule) {
+        // 全局脉冲序号按时元回绕，不需要警告
+        index %= getSequenceLength();
+        return schedule->getFrequency(static_cast<uint32_t>(index / HopSchedule::pulses_per_slot),
+                                      static_cast<uint32_t>(index % HopSchedule::pulses_per_slot));
+    }
+    
     if (sequence.empty()) {
         LOG_ERROR("跳频序列为空");
         return 0.0;
@@ -86,6 +102,9 @@ uint32_t FrequencyHopping::getSeed() const {
 
 // 获取跳频序列长度
 size_t FrequencyHopping::getSequenceLength() const {
+    if (schedule) {
+        return static_cast<size_t>(HopSchedule::slots_per_epoch) * HopSchedule::pulses_per_slot;
+    }
     return sequence.size();
 }
 
@@ -94,10 +113,71 @@ std::vector<double> FrequencyHopping::getSequence() const {
     return sequence;
 }
 
+// 获取指定时隙中指定脉冲的频率
+double FrequencyHopping::getFrequency(uint32_t slot, uint32_t pulse) const {
+    if (schedule) {
+        return schedule->getFrequency(slot, pulse);
+    }
+    if (sequence.empty()) {
+        return 0.0;
+    }
+    
+    // 跳频表按全局脉冲序号循环
+    uint64_t index = static_cast<uint64_t>(slot) * HopSchedule::pulses_per_slot + pulse;
+    return sequence[index % sequence.size()];
+}
+
+// 获取时隙跳频图样
+std::shared_ptr<const HopSchedule> FrequencyHopping::getSchedule() const {
+    return schedule;
+}
+
+// 使用已有的时隙跳频图样
+bool FrequencyHopping::setSchedule(std::shared_ptr<const HopSchedule> schedule) {
+    if (!schedule) {
+        LOG_ERROR("跳频图样为空");
+        return false;
+    }
+    
+    this->pattern = time_slot_pattern;
+    this->seed = schedule->getSeed();
+    this->schedule = std::move(schedule);
+    sequence = getSlotSequence(0);
+    currentIndex = 0;
+    return true;
+}
+
+// 预先计算时隙跳频图样的频道表
+bool FrequencyHopping::precomputeSchedule(uint32_t firstSlot, uint32_t slotCount) {
+    if (!schedule) {
+        LOG_ERROR("当前跳频模式不是时隙跳频: " + std::to_string(pattern));
+        return false;
+    }
+    
+    // 共享中的图样不能修改，建一个新的
+    auto precomputed = std::make_shared<HopSchedule>(schedule->getSeed(), schedule->getNet());
+    precomputed->precompute(firstSlot, slotCount);
+    schedule = precomputed;
+    return true;
+}
+
+// 生成一个时隙的跳频频率
+std::vector<double> FrequencyHopping::getSlotSequence(uint32_t slot) const {
+    uint8_t channels[HopSchedule::pulses_per_slot];
+    schedule->generateSlot(slot, channels);
+    
+    std::vector<double> frequencies(HopSchedule::pulses_per_slot);
+    for (uint32_t i = 0; i < HopSchedule::pulses_per_slot; ++i) {
+        frequencies[i] = HopSchedule::getChannelFrequency(channels[i]);
+    }
+    return frequencies;
+}
+
 // 生成跳频序列
 void FrequencyHopping::generateSequence() {
     // 清空序列
     sequence.clear();
+    schedule.reset();
 
     // Link16频率范围
     double baseFreq = 969.0e6;  // 969MHz
@@ -167,26 +247,11 @@ void FrequencyHopping::generateSequence() {
             }
             break;
         }
-        case 6: {
+        case time_slot_pattern: {
             // 模式6: 基于时隙的跳频(Link16标准)
-            // 在实际的Link16系统中，跳频是基于时隙的
-            // 这里简化实现，使用伪随机序列
-
-            std::mt19937 gen(seed);
-
-            // 生成基本跳频集
-            std::vector<double> baseSet;
-            for (int i = 0; i < numFrequencies; ++i) {
-                baseSet.push_back(baseFreq + i * hopStep);
-            }
-
-            // 打乱基本跳频集
-            std::shuffle(baseSet.begin(), baseSet.end(), gen);
-
-            // 选择51个频率
-            for (int i = 0; i < std::min(51, static_cast<int>(baseSet.size())); ++i) {
-                sequence.push_back(baseSet[i]);
-            }
+            // 每个脉冲的频道由(种子, 时隙, 脉冲)直接算出，不预先生成整个序列
+            schedule = std::make_shared<HopSchedule>(seed);
+            sequence = getSlotSequence(0);
             break;
         }
         default: {
@@ -209,7 +274,7 @@ void FrequencyHopping::generateSequence() {
     // 重置索引
     currentIndex = 0;
 
-    LOG_INFO("生成跳频序列，长度: " + std::to_string(sequence.size()) + " 个频点");
+    LOG_INFO("生成跳频序列，长度: " + std::to_string(getSequenceLength()) + " 个频点");
 }
 
 } // namespace frequency
@@ -2,13 +2,25 @@
 #include <vector>
 #include <string>
 #include <cstdint>
+#include <memory>
+#include "HopSchedule.h"
 
 namespace link16 {
 namespace physical {
 namespace frequency {
 
+/**
+ * @brief 跳频序列
+ *
+ * 模式1-5使用固定长度的跳频表，按索引循环。模式6(time_slot_pattern)按时隙生成脉冲级
+ * 跳频图样(见HopSchedule)，索引为整个时元内的全局脉冲序号，可直接访问任意时隙，
+ * 更换种子只需重新设置密钥。
+ */
 class FrequencyHopping {
 public:
+    // 基于时隙的跳频模式
+    static const int time_slot_pattern = 6;
+    
     // 构造函数
     FrequencyHopping();
     
@@ -42,8 +54,34 @@ public:
     // 获取跳频序列长度
     size_t getSequenceLength() const;
     
-    // 获取跳频序列
+    // 获取跳频序列，模式6返回第0时隙的跳频图样
     std::vector<double> getSequence() const;
+    
+    /**
+     * @brief 获取指定时隙中指定脉冲的频率
+     * @param slot 时隙号
+     * @param pulse 时隙内的脉冲序号
+     * @return 频率(Hz)，序列为空时为0
+     */
+    double getFrequency(uint32_t slot, uint32_t pulse) const;
+    
+    // 获取时隙跳频图样，模式6以外为空
+    std::shared_ptr<const HopSchedule> getSchedule() const;
+    
+    /**
+     * @brief 使用已有的时隙跳频图样(例如与发射端共享)，切换到模式6
+     * @param schedule 跳频图样
+     * @return 图样是否有效
+     */
+    bool setSchedule(std::shared_ptr<const HopSchedule> schedule);
+    
+    /**
+     * @brief 预先计算时隙跳频图样的频道表，仅模式6有效
+     * @param firstSlot 起始时隙
+     * @param slotCount 时隙数，默认为整个时元
+     * @return 是否成功
+     */
+    bool precomputeSchedule(uint32_t firstSlot = 0, uint32_t slotCount = HopSchedule::slots_per_epoch);
 
 private:
     // 跳频模式
@@ -58,8 +96,14 @@ private:
     // 跳频序列
     std::vector<double> sequence;
     
+    // 时隙跳频图样(模式6)
+    std::shared_ptr<const HopSchedule> schedule;
+    
     // 生成跳频序列
     void generateSequence();
+    
+    // 生成一个时隙的跳频频率(模式6)
+    std::vector<double> getSlotSequence(uint32_t slot) const;
 };
 
 } // namespace frequency
@@ -0,0 +1,191 @@
+#include "HopSchedule.h"
+#include "core/utils/logger.h"
+#include <algorithm>
+#include <cstring>
+
+namespace link16 {
+namespace physical {
+namespace frequency {
+
+namespace {
+
+// Philox4x32的乘数和密钥增量
+const uint32_t philox_m0 = 0xD2511F53u;
+const uint32_t philox_m1 = 0xCD9E8D57u;
+const uint32_t philox_w0 = 0x9E3779B9u;
+const uint32_t philox_w1 = 0xBB67AE85u;
+const int philox_rounds = 10;
+
+// 每次生成的脉冲数
+const uint32_t pulses_per_group = 4;
+const uint32_t groups_per_slot = (HopSchedule::pulses_per_slot + pulses_per_group - 1) / pulses_per_group;
+
+// 频道分三段: 969-1008MHz、1053-1065MHz、1113-1206MHz
+const int low_band_channels = 14;
+const int middle_band_channels = 5;
+const double channel_spacing = 3.0e6;
+
+// 32位随机数均匀映射到频道号
+inline uint8_t toChannel(uint32_t value) {
+    return static_cast<uint8_t>((static_cast<uint64_t>(value) * HopSchedule::channel_count) >> 32);
+}
+
+} // namespace
+
+const int HopSchedule::channel_count;
+const uint32_t HopSchedule::pulses_per_slot;
+const uint32_t HopSchedule::slots_per_epoch;
+
+// 构造函数
+HopSchedule::HopSchedule(uint32_t seed, uint32_t net)
+    : seed(seed), net(net), tableFirstSlot(0), tableSlotCount(0) {
+}
+
+// 获取跳频种子
+uint32_t HopSchedule::getSeed() const {
+    return seed;
+}
+
+// 获取网号
+uint32_t HopSchedule::getNet() const {
+    return net;
+}
+
+// 预先计算一段时隙的频道表
+void HopSchedule::precompute(uint32_t firstSlot, uint32_t slotCount) {
+    tableFirstSlot = firstSlot % slots_per_epoch;
+    tableSlotCount = std::min(slotCount, slots_per_epoch);
+
+    std::vector<uint8_t> channels(static_cast<size_t>(tableSlotCount) * pulses_per_slot);
+    for (uint32_t s = 0; s < tableSlotCount; ++s) {
+        const uint32_t slot = (tableFirstSlot + s) % slots_per_epoch;
+        for (uint32_t group = 0; group < groups_per_slot; ++group) {
+            uint8_t values[pulses_per_group];
+            generateGroup(slot, group, values);
+            const uint32_t first = group * pulses_per_group;
+            const uint32_t count = std::min(pulses_per_group, pulses_per_slot - first);
+            std::memcpy(&channels[static_cast<size_t>(s) * pulses_per_slot + first], values, count);
+        }
+    }
+    table.swap(channels);
+
+    LOG_INFO("预计算跳频图样: 时隙" + std::to_string(tableFirstSlot) + "起共" + std::to_string(tableSlotCount) +
+             "个时隙，" + std::to_string(table.size()) + "字节");
+}
+
+// 时隙是否已在频道表中
+bool HopSchedule::isPrecomputed(uint32_t slot) const {
+    return getSlotChannels(slot) != nullptr;
+}
+
+// 获取指定脉冲的频道
+uint8_t HopSchedule::getChannel(uint32_t slot, uint32_t pulse) const {
+    if (pulse >= pulses_per_slot) {
+        slot += pulse / pulses_per_slot;
+        pulse %= pulses_per_slot;
+    }
+    const uint8_t* channels = getSlotChannels(slot);
+    if (channels) {
+        return channels[pulse];
+    }
+
+    // 只需计算所在的一组
+    uint8_t values[pulses_per_group];
+    generateGroup(slot % slots_per_epoch, pulse / pulses_per_group, values);
+    return values[pulse % pulses_per_group];
+}
+
+// 获取指定脉冲的频率
+double HopSchedule::getFrequency(uint32_t slot, uint32_t pulse) const {
+    return getChannelFrequency(getChannel(slot, pulse));
+}
+
+// 获取整个时隙的频道
+void HopSchedule::generateSlot(uint32_t slot, uint8_t* channels) const {
+    const uint8_t* precomputed = getSlotChannels(slot);
+    if (precomputed) {
+        std::memcpy(channels, precomputed, pulses_per_slot);
+        return;
+    }
+
+    slot %= slots_per_epoch;
+    const uint32_t fullGroups = pulses_per_slot / pulses_per_group;
+    for (uint32_t group = 0; group < fullGroups; ++group) {
+        generateGroup(slot, group, channels + group * pulses_per_group);
+    }
+    if (fullGroups < groups_per_slot) {
+        uint8_t values[pulses_per_group];
+        generateGroup(slot, fullGroups, values);
+        std::memcpy(channels + fullGroups * pulses_per_group, values,
+                    pulses_per_slot - fullGroups * pulses_per_group);
+    }
+}
+
+// 获取频道表中某个时隙的频道
+const uint8_t* HopSchedule::getSlotChannels(uint32_t slot) const {
+    if (table.empty()) {
+        return nullptr;
+    }
+    // 相对表起点的时隙数，回绕到时元内
+    const uint32_t offset = (slot % slots_per_epoch + slots_per_epoch - tableFirstSlot) % slots_per_epoch;
+    if (offset >= tableSlotCount) {
+        return nullptr;
+    }
+    return &table[static_cast<size_t>(offset) * pulses_per_slot];
+}
+
+// 获取频道的频率
+double HopSchedule::getChannelFrequency(int channel) {
+    if (channel < low_band_channels) {
+        return 969.0e6 + channel * channel_spacing;
+    }
+    if (channel < low_band_channels + middle_band_channels) {
+        return 1053.0e6 + (channel - low_band_channels) * channel_spacing;
+    }
+    return 1113.0e6 + (channel - low_band_channels - middle_band_channels) * channel_spacing;
+}
+
+// Philox4x32-10
+void HopSchedule::philox(const uint32_t counter[4], const uint32_t key[2], uint32_t output[4]) {
+    uint32_t c0 = counter[0];
+    uint32_t c1 = counter[1];
+    uint32_t c2 = counter[2];
+    uint32_t c3 = counter[3];
+    uint32_t k0 = key[0];
+    uint32_t k1 = key[1];
+
+    for (int round = 0; round < philox_rounds; ++round) {
+        const uint64_t p0 = static_cast<uint64_t>(philox_m0) * c0;
+        const uint64_t p1 = static_cast<uint64_t>(philox_m1) * c2;
+        const uint32_t hi0 = static_cast<uint32_t>(p0 >> 32);
+        const uint32_t lo0 = static_cast<uint32_t>(p0);
+        const uint32_t hi1 = static_cast<uint32_t>(p1 >> 32);
+        const uint32_t lo1 = static_cast<uint32_t>(p1);
+        c0 = hi1 ^ c1 ^ k0;
+        c1 = lo1;
+        c2 = hi0 ^ c3 ^ k1;
+        c3 = lo0;
+        k0 += philox_w0;
+        k1 += philox_w1;
+    }
+
+    output[0] = c0;
+    output[1] = c1;
+    output[2] = c2;
+    output[3] = c3;
+}
+
+// 直接生成一组4个脉冲的频道
+void HopSchedule::generateGroup(uint32_t slot, uint32_t group, uint8_t* channels) const {
+    const uint32_t counter[4] = {group, slot, 0, 0};
+    const uint32_t key[2] = {seed, net};
+    uint32_t random[4];
+    philox(counter, key, random);
+    for (uint32_t i = 0; i < pulses_per_group; ++i) {
+        channels[i] = toChannel(random[i]);
+    }
+}
+
+} // namespace frequency
+} // namespace physical
+} // namespace link16
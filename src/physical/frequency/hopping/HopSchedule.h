@@ -0,0 +1,113 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace link16 {
+namespace physical {
+namespace frequency {
+
+/**
+ * @brief 基于时隙的脉冲级跳频图样
+ *
+ * 每个脉冲的频道由计数器型伪随机数发生器Philox4x32-10生成，密钥为(种子, 网号)，
+ * 计数器为(脉冲组, 时隙)，每次调用产生4个脉冲的频道。任意时隙、任意脉冲都能
+ * 直接算出，不依赖前面的序列状态，收发双方只要时隙号一致即可得到相同的图样。
+ * 可选择预先计算一段时隙(默认整个时元)的频道表，每个脉冲只占1字节；
+ * 预计算之后对象不再修改，可通过std::shared_ptr<const HopSchedule>在收发之间共享。
+ */
+class HopSchedule {
+public:
+    // 跳频频道数(969-1206MHz，间隔3MHz，避开1030/1090MHz附近的敌我识别频段)
+    static const int channel_count = 51;
+
+    // 每个时隙的脉冲数(标准双脉冲结构，3.354ms内每13us一个脉冲)
+    static const uint32_t pulses_per_slot = 258;
+
+    // 每个时元的时隙数(12.8分钟，时隙长7.8125ms)
+    static const uint32_t slots_per_epoch = 98304;
+
+    /**
+     * @brief 构造函数
+     * @param seed 跳频种子
+     * @param net 网号
+     */
+    explicit HopSchedule(uint32_t seed = 0, uint32_t net = 0);
+
+    // 获取跳频种子
+    uint32_t getSeed() const;
+
+    // 获取网号
+    uint32_t getNet() const;
+
+    /**
+     * @brief 预先计算一段时隙的频道表，之前的表被替换
+     * @param firstSlot 起始时隙
+     * @param slotCount 时隙数，超出时元的部分回绕到时元开头
+     */
+    void precompute(uint32_t firstSlot = 0, uint32_t slotCount = slots_per_epoch);
+
+    // 时隙是否已在频道表中
+    bool isPrecomputed(uint32_t slot) const;
+
+    /**
+     * @brief 获取指定脉冲的频道，已预计算时查表，否则直接生成
+     * @param slot 时隙号，按时元回绕
+     * @param pulse 时隙内的脉冲序号，不小于pulses_per_slot时进位到后面的时隙
+     * @return 频道号[0, channel_count)
+     */
+    uint8_t getChannel(uint32_t slot, uint32_t pulse) const;
+
+    // 获取指定脉冲的频率(Hz)
+    double getFrequency(uint32_t slot, uint32_t pulse) const;
+
+    /**
+     * @brief 获取整个时隙的频道，已预计算时复制表中的内容
+     * @param slot 时隙号
+     * @param channels 输出，pulses_per_slot个
+     */
+    void generateSlot(uint32_t slot, uint8_t* channels) const;
+
+    /**
+     * @brief 获取频道表中某个时隙的频道
+     * @param slot 时隙号
+     * @return pulses_per_slot个频道，未预计算时为空指针
+     */
+    const uint8_t* getSlotChannels(uint32_t slot) const;
+
+    /**
+     * @brief 获取频道的频率
+     * @param channel 频道号[0, channel_count)
+     * @return 频率(Hz)
+     */
+    static double getChannelFrequency(int channel);
+
+    /**
+     * @brief Philox4x32-10计数器型伪随机数发生器
+     * @param counter 计数器
+     * @param key 密钥
+     * @param output 输出4个32位随机数
+     */
+    static void philox(const uint32_t counter[4], const uint32_t key[2], uint32_t output[4]);
+
+private:
+    // 直接生成一组4个脉冲的频道
+    void generateGroup(uint32_t slot, uint32_t group, uint8_t* channels) const;
+
+    // 跳频种子
+    uint32_t seed;
+
+    // 网号
+    uint32_t net;
+
+    // 频道表的起始时隙和时隙数
+    uint32_t tableFirstSlot;
+    uint32_t tableSlotCount;
+
+    // 频道表，每个时隙pulses_per_slot字节
+    std::vector<uint8_t> table;
+};
+
+} // namespace frequency
+} // namespace physical
+} // namespace link16
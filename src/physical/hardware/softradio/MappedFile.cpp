@@ -0,0 +1,177 @@
+#include "MappedFile.h"
+#include "core/utils/fileUtils.h"
+#include "core/utils/logger.h"
+#include <algorithm>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define LINK16_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace link16 {
+namespace physical {
+namespace hardware {
+
+// 构造函数
+MappedFile::MappedFile() : mapping(nullptr), mappingSize(0), writable(false), fd(-1) {
+}
+
+// 析构函数
+MappedFile::~MappedFile() {
+    close();
+}
+
+// 只读映射已有文件
+bool MappedFile::openRead(const std::string& filePath) {
+    close();
+
+#if defined(LINK16_HAS_MMAP)
+    fd = ::open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        LOG_ERROR("无法打开文件: " + filePath);
+        return false;
+    }
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        LOG_ERROR("无法获取文件大小: " + filePath);
+        ::close(fd);
+        fd = -1;
+        return false;
+    }
+
+    mappingSize = static_cast<size_t>(info.st_size);
+    if (mappingSize > 0) {
+        void* address = ::mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, fd, 0);
+        if (address == MAP_FAILED) {
+            LOG_ERROR("无法映射文件: " + filePath);
+            ::close(fd);
+            fd = -1;
+            mappingSize = 0;
+            return false;
+        }
+        mapping = static_cast<char*>(address);
+
+        // 顺序读取，提示内核预读
+        ::madvise(address, mappingSize, MADV_SEQUENTIAL);
+    }
+#else
+    if (!utils::FileUtils::fileExists(filePath)) {
+        LOG_ERROR("无法打开文件: " + filePath);
+        return false;
+    }
+    fallback = utils::FileUtils::readBinaryFile(filePath);
+    mapping = fallback.empty() ? nullptr : fallback.data();
+    mappingSize = fallback.size();
+#endif
+
+    path = filePath;
+    writable = false;
+    return true;
+}
+
+// 创建文件并读写映射
+bool MappedFile::create(const std::string& filePath, size_t size) {
+    close();
+
+#if defined(LINK16_HAS_MMAP)
+    fd = ::open(filePath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        LOG_ERROR("无法创建文件: " + filePath);
+        return false;
+    }
+
+    // 扩展为稀疏文件，未写入的部分读出为0
+    if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        LOG_ERROR("无法设置文件大小: " + filePath);
+        ::close(fd);
+        fd = -1;
+        return false;
+    }
+
+    if (size > 0) {
+        void* address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (address == MAP_FAILED) {
+            LOG_ERROR("无法映射文件: " + filePath);
+            ::close(fd);
+            fd = -1;
+            return false;
+        }
+        mapping = static_cast<char*>(address);
+    }
+#else
+    fallback.assign(size, 0);
+    mapping = fallback.empty() ? nullptr : fallback.data();
+#endif
+
+    path = filePath;
+    mappingSize = size;
+    writable = true;
+    return true;
+}
+
+// 关闭文件
+void MappedFile::close(size_t finalSize) {
+    if (!isOpen()) {
+        return;
+    }
+    const size_t keep = std::min(finalSize, mappingSize);
+
+#if defined(LINK16_HAS_MMAP)
+    if (mapping) {
+        ::munmap(mapping, mappingSize);
+    }
+    if (writable && keep < mappingSize && ::ftruncate(fd, static_cast<off_t>(keep)) != 0) {
+        LOG_WARNING("无法截断文件: " + path);
+    }
+    ::close(fd);
+    fd = -1;
+#else
+    if (writable && !utils::FileUtils::writeBinaryFile(path, fallback.data(), keep)) {
+        LOG_WARNING("无法写入文件: " + path);
+    }
+    fallback.clear();
+    fallback.shrink_to_fit();
+#endif
+
+    mapping = nullptr;
+    mappingSize = 0;
+    writable = false;
+    path.clear();
+}
+
+// 是否已打开
+bool MappedFile::isOpen() const {
+    return !path.empty();
+}
+
+// 是否可写
+bool MappedFile::isWritable() const {
+    return writable;
+}
+
+// 映射的内容
+char* MappedFile::data() {
+    return mapping;
+}
+
+const char* MappedFile::data() const {
+    return mapping;
+}
+
+// 映射的大小
+size_t MappedFile::size() const {
+    return mappingSize;
+}
+
+// 文件路径
+const std::string& MappedFile::getPath() const {
+    return path;
+}
+
+} // namespace hardware
+} // namespace physical
+} // namespace link16
@@ -0,0 +1,70 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace link16 {
+namespace physical {
+namespace hardware {
+
+/**
+ * @brief 内存映射文件
+ *
+ * POSIX平台使用mmap，读写都不经过额外的缓冲区；其他平台退化为整个文件读入内存、
+ * 关闭时写回。
+ */
+class MappedFile {
+public:
+    // 构造函数
+    MappedFile();
+
+    // 析构函数，关闭文件
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // 只读映射已有文件
+    bool openRead(const std::string& path);
+
+    // 创建(或覆盖)大小为size字节的文件并读写映射，内容初始为0
+    bool create(const std::string& path, size_t size);
+
+    /**
+     * @brief 关闭文件
+     * @param finalSize 可写映射时文件截断到的大小，超过映射大小时不截断
+     */
+    void close(size_t finalSize = static_cast<size_t>(-1));
+
+    // 是否已打开
+    bool isOpen() const;
+
+    // 是否可写
+    bool isWritable() const;
+
+    // 映射的内容
+    char* data();
+    const char* data() const;
+
+    // 映射的大小(字节)
+    size_t size() const;
+
+    // 文件路径
+    const std::string& getPath() const;
+
+private:
+    std::string path;
+    char* mapping;
+    size_t mappingSize;
+    bool writable;
+
+    // POSIX文件描述符
+    int fd;
+
+    // 不支持mmap时的内存副本
+    std::vector<char> fallback;
+};
+
+} // namespace hardware
+} // namespace physical
+} // namespace link16
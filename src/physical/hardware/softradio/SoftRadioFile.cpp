@@ -0,0 +1,418 @@
+#include "SoftRadioFile.h"
+#include "core/utils/fileUtils.h"
+#include "core/utils/logger.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+namespace link16 {
+namespace physical {
+namespace hardware {
+
+namespace {
+
+// 每个样本的字节数
+const size_t sample_bytes = sizeof(std::complex<float>);
+
+// 默认发送文件容量(样本)
+const size_t default_tx_capacity = 1 << 24;
+
+// 查找JSON中"key": 之后的值的起点
+size_t findValue(const std::string& json, const std::string& key) {
+    const size_t position = json.find("\"" + key + "\"");
+    if (position == std::string::npos) {
+        return std::string::npos;
+    }
+    const size_t colon = json.find(':', position + key.size() + 2);
+    if (colon == std::string::npos) {
+        return std::string::npos;
+    }
+    return json.find_first_not_of(" \t\r\n", colon + 1);
+}
+
+// 读取数值字段
+bool findNumber(const std::string& json, const std::string& key, double& value) {
+    const size_t position = findValue(json, key);
+    if (position == std::string::npos) {
+        return false;
+    }
+    const char* begin = json.c_str() + position;
+    char* end = nullptr;
+    value = std::strtod(begin, &end);
+    return end != begin;
+}
+
+// 读取字符串字段
+bool findString(const std::string& json, const std::string& key, std::string& value) {
+    const size_t position = findValue(json, key);
+    if (position == std::string::npos || json[position] != '"') {
+        return false;
+    }
+    const size_t end = json.find('"', position + 1);
+    if (end == std::string::npos) {
+        return false;
+    }
+    value = json.substr(position + 1, end - position - 1);
+    return true;
+}
+
+} // namespace
+
+const char* const SoftRadioFile::data_extension = ".sigmf-data";
+const char* const SoftRadioFile::meta_extension = ".sigmf-meta";
+
+// 构造函数
+SoftRadioFile::SoftRadioFile()
+    : frequency(969.0e6), sampleRate(1.0e6), gain(0.0), bandwidth(1.0e6), antenna("FILE"), realTime(true),
+      initialized(false), rxPosition(0), txLength(0), txDropped(0) {
+}
+
+// 析构函数
+SoftRadioFile::~SoftRadioFile() {
+    if (initialized) {
+        close();
+    }
+}
+
+// 初始化设备
+bool SoftRadioFile::initialize(const std::string& args) {
+    if (initialized) {
+        LOG_WARNING("文件设备已经初始化");
+        return true;
+    }
+
+    LOG_INFO("初始化文件设备: " + args);
+    deviceArgs = args;
+
+    // 解析key=value参数
+    std::string rxPath;
+    std::string txPath;
+    size_t txCapacity = default_tx_capacity;
+    std::stringstream stream(args);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        const size_t equal = item.find('=');
+        if (equal == std::string::npos) {
+            continue;
+        }
+        const std::string key = item.substr(0, equal);
+        const std::string value = item.substr(equal + 1);
+        if (key == "rx") {
+            rxPath = value;
+        } else if (key == "tx") {
+            txPath = value;
+        } else if (key == "tx_capacity") {
+            txCapacity = static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10));
+        } else if (key == "realtime") {
+            realTime = value != "0";
+        } else {
+            LOG_WARNING("未知的文件设备参数: " + key);
+        }
+    }
+
+    if ((!rxPath.empty() && !openRx(rxPath)) || (!txPath.empty() && !openTx(txPath, txCapacity))) {
+        rxFile.close();
+        txFile.close();
+        return false;
+    }
+
+    initialized = true;
+    LOG_INFO("文件设备初始化成功");
+    return true;
+}
+
+// 关闭设备
+void SoftRadioFile::close() {
+    if (!initialized) {
+        return;
+    }
+
+    LOG_INFO("关闭文件设备");
+
+    rxFile.close();
+    if (txFile.isOpen()) {
+        const uint64_t length = txLength.load();
+        txFile.close(static_cast<size_t>(length * sample_bytes));
+        writeMeta(txBasePath + meta_extension);
+        LOG_INFO("写入发送文件: " + txBasePath + data_extension + "，" + std::to_string(length) + "个样本");
+    }
+
+    initialized = false;
+}
+
+// 设置频率
+bool SoftRadioFile::setFrequency(double freq) {
+    frequency = freq;
+    return true;
+}
+
+// 获取频率
+double SoftRadioFile::getFrequency() const {
+    return frequency;
+}
+
+// 设置采样率
+bool SoftRadioFile::setSampleRate(double rate) {
+    if (rate <= 0.0) {
+        LOG_ERROR("无效的采样率: " + std::to_string(rate));
+        return false;
+    }
+    sampleRate = rate;
+    return true;
+}
+
+// 获取采样率
+double SoftRadioFile::getSampleRate() const {
+    return sampleRate;
+}
+
+// 设置增益
+bool SoftRadioFile::setGain(double value) {
+    gain = value;
+    return true;
+}
+
+// 获取增益
+double SoftRadioFile::getGain() const {
+    return gain;
+}
+
+// 设置带宽
+bool SoftRadioFile::setBandwidth(double value) {
+    bandwidth = value;
+    return true;
+}
+
+// 获取带宽
+double SoftRadioFile::getBandwidth() const {
+    return bandwidth;
+}
+
+// 设置天线
+bool SoftRadioFile::setAntenna(const std::string& value) {
+    antenna = value;
+    return true;
+}
+
+// 获取天线
+std::string SoftRadioFile::getAntenna() const {
+    return antenna;
+}
+
+// 获取设备信息
+std::string SoftRadioFile::getDeviceInfo() const {
+    if (!initialized) {
+        return "文件设备未初始化";
+    }
+
+    std::string info = "文件设备信息:\n";
+    info += "  设备参数: " + deviceArgs + "\n";
+    info += "  频率: " + std::to_string(frequency / 1e6) + " MHz\n";
+    info += "  采样率: " + std::to_string(sampleRate / 1e6) + " Msps\n";
+    info += "  接收文件: " + (rxFile.isOpen() ? rxFile.getPath() : std::string("无")) + "\n";
+    info += "  发送文件: " + (txFile.isOpen() ? txFile.getPath() : std::string("无")) + "\n";
+    info += std::string("  实时: ") + (realTime ? "是" : "否");
+
+    return info;
+}
+
+// 检查设备是否已初始化
+bool SoftRadioFile::isInitialized() const {
+    return initialized;
+}
+
+// 打开接收文件
+bool SoftRadioFile::openRx(const std::string& basePath) {
+    const std::string metaPath = basePath + meta_extension;
+    if (utils::FileUtils::fileExists(metaPath) && !readMeta(metaPath)) {
+        return false;
+    }
+
+    if (!rxFile.openRead(basePath + data_extension)) {
+        return false;
+    }
+    if (rxFile.size() % sample_bytes != 0) {
+        LOG_WARNING("接收文件长度不是整数个样本: " + rxFile.getPath());
+    }
+
+    rxBasePath = basePath;
+    rxPosition = 0;
+    LOG_INFO("打开接收文件: " + rxFile.getPath() + "，" + std::to_string(getRxLength()) + "个样本");
+    return true;
+}
+
+// 创建发送文件
+bool SoftRadioFile::openTx(const std::string& basePath, size_t capacity) {
+    if (!txFile.create(basePath + data_extension, capacity * sample_bytes)) {
+        return false;
+    }
+
+    txBasePath = basePath;
+    txLength = 0;
+    txDropped = 0;
+    LOG_INFO("创建发送文件: " + txFile.getPath() + "，容量" + std::to_string(capacity) + "个样本");
+    return true;
+}
+
+// 设置是否按采样率实时读写
+void SoftRadioFile::setRealTime(bool enable) {
+    realTime = enable;
+}
+
+// 是否按采样率实时读写
+bool SoftRadioFile::isRealTime() const {
+    return realTime;
+}
+
+// 从接收文件读出样本
+size_t SoftRadioFile::read(std::complex<float>* samples, size_t numSamples) {
+    const uint64_t position = rxPosition.load(std::memory_order_relaxed);
+    const size_t length = getRxLength();
+    if (position >= length) {
+        return 0;
+    }
+
+    const size_t count = std::min<size_t>(numSamples, length - position);
+    std::memcpy(static_cast<void*>(samples), getRxData() + position, count * sample_bytes);
+    rxPosition.store(position + count, std::memory_order_relaxed);
+    return count;
+}
+
+// 设置接收文件的读取位置
+bool SoftRadioFile::seek(uint64_t position) {
+    if (position > getRxLength()) {
+        return false;
+    }
+    rxPosition = position;
+    return true;
+}
+
+// 接收文件的读取位置
+uint64_t SoftRadioFile::getRxPosition() const {
+    return rxPosition.load();
+}
+
+// 接收文件的样本数
+size_t SoftRadioFile::getRxLength() const {
+    return rxFile.size() / sample_bytes;
+}
+
+// 接收文件的全部样本
+const std::complex<float>* SoftRadioFile::getRxData() const {
+    // mmap按页对齐，可以直接按样本访问
+    return reinterpret_cast<const std::complex<float>*>(rxFile.data());
+}
+
+// 把样本写入发送文件
+size_t SoftRadioFile::write(const std::complex<float>* samples, size_t numSamples, uint64_t timestamp) {
+    const size_t capacity = txFile.size() / sample_bytes;
+    size_t count = 0;
+    if (timestamp < capacity) {
+        count = std::min<size_t>(numSamples, capacity - timestamp);
+        std::memcpy(txFile.data() + timestamp * sample_bytes, samples, count * sample_bytes);
+    }
+    if (count < numSamples) {
+        txDropped.fetch_add(numSamples - count, std::memory_order_relaxed);
+    }
+
+    // 只有发送线程写入，直接比较后更新
+    const uint64_t end = timestamp + count;
+    if (count > 0 && end > txLength.load(std::memory_order_relaxed)) {
+        txLength.store(end, std::memory_order_relaxed);
+    }
+    return count;
+}
+
+// 发送文件的长度
+uint64_t SoftRadioFile::getTxLength() const {
+    return txLength.load();
+}
+
+// 超出容量丢弃的样本数
+uint64_t SoftRadioFile::getTxDropped() const {
+    return txDropped.load();
+}
+
+// 接收器从接收文件取样本
+bool SoftRadioFile::attach(USRPReceiver& receiver) {
+    if (!rxFile.isOpen()) {
+        LOG_ERROR("没有打开接收文件");
+        return false;
+    }
+
+    if (!receiver.setSampleRate(sampleRate) || !receiver.setRealTime(realTime)) {
+        return false;
+    }
+    return receiver.setSampleSource([this](std::complex<float>* samples, size_t& numSamples, uint64_t) {
+        numSamples = read(samples, numSamples);
+        return numSamples > 0;
+    });
+}
+
+// 发送器发出的样本写入发送文件
+bool SoftRadioFile::attach(USRPTransmitter& transmitter) {
+    if (!txFile.isOpen()) {
+        LOG_ERROR("没有打开发送文件");
+        return false;
+    }
+
+    if (!transmitter.setSampleRate(sampleRate) || !transmitter.setRealTime(realTime)) {
+        return false;
+    }
+    return transmitter.setSendCallback(
+        [this](const std::complex<float>* samples, size_t length, uint64_t timestamp) {
+            write(samples, length, timestamp);
+        });
+}
+
+// 读取元数据文件
+bool SoftRadioFile::readMeta(const std::string& path) {
+    const std::string json = utils::FileUtils::readTextFile(path);
+
+    std::string datatype;
+    if (findString(json, "core:datatype", datatype) && datatype != "cf32_le") {
+        LOG_ERROR("不支持的样本格式: " + datatype);
+        return false;
+    }
+
+    double value = 0.0;
+    if (findNumber(json, "core:sample_rate", value) && value > 0.0) {
+        sampleRate = value;
+    }
+    if (findNumber(json, "core:frequency", value)) {
+        frequency = value;
+    }
+    return true;
+}
+
+// 写元数据文件
+bool SoftRadioFile::writeMeta(const std::string& path) const {
+    std::ostringstream json;
+    json.precision(17);
+    json << "{\n"
+         << "  \"global\": {\n"
+         << "    \"core:datatype\": \"cf32_le\",\n"
+         << "    \"core:sample_rate\": " << sampleRate << ",\n"
+         << "    \"core:version\": \"1.0.0\",\n"
+         << "    \"core:hw\": \"link16 SoftRadioFile\"\n"
+         << "  },\n"
+         << "  \"captures\": [\n"
+         << "    {\n"
+         << "      \"core:sample_start\": 0,\n"
+         << "      \"core:frequency\": " << frequency << "\n"
+         << "    }\n"
+         << "  ],\n"
+         << "  \"annotations\": []\n"
+         << "}\n";
+
+    if (!utils::FileUtils::writeTextFile(path, json.str())) {
+        LOG_ERROR("无法写入元数据文件: " + path);
+        return false;
+    }
+    return true;
+}
+
+} // namespace hardware
+} // namespace physical
+} // namespace link16
@@ -0,0 +1,136 @@
+#pragma once
+#include "physical/hardware/usrp/USRPInterface.h"
+#include "physical/hardware/usrp/USRPReceiver.h"
+#include "physical/hardware/usrp/USRPTransmitter.h"
+#include "MappedFile.h"
+#include <atomic>
+#include <complex>
+#include <cstdint>
+#include <string>
+
+namespace link16 {
+namespace physical {
+namespace hardware {
+
+/**
+ * @brief 文件软件无线电设备
+ *
+ * 接收端从SigMF格式的录制文件(<基名>.sigmf-data为cf32_le原始样本，<基名>.sigmf-meta为
+ * JSON元数据)读出样本，发送端把样本写入同样格式的文件，数据文件都通过内存映射访问。
+ * attach()把文件接到USRPReceiver的样本源或USRPTransmitter的发送回调，接收和发送的
+ * 线程、缓冲区和统计都和真实设备相同；实时模式按采样率节拍，非实时模式尽快读写。
+ * 关闭前应先停止接上的接收器和发送器。
+ */
+class SoftRadioFile : public USRPInterface {
+public:
+    // 数据文件和元数据文件的扩展名
+    static const char* const data_extension;
+    static const char* const meta_extension;
+
+    // 构造函数
+    SoftRadioFile();
+
+    // 析构函数
+    virtual ~SoftRadioFile();
+
+    /**
+     * @brief 初始化设备
+     * @param args 逗号分隔的key=value: rx=接收文件基名, tx=发送文件基名,
+     *             tx_capacity=发送文件最多样本数, realtime=0或1
+     */
+    virtual bool initialize(const std::string& args = "") override;
+    virtual void close() override;
+    virtual bool setFrequency(double freq) override;
+    virtual double getFrequency() const override;
+    virtual bool setSampleRate(double rate) override;
+    virtual double getSampleRate() const override;
+    virtual bool setGain(double gain) override;
+    virtual double getGain() const override;
+    virtual bool setBandwidth(double bandwidth) override;
+    virtual double getBandwidth() const override;
+    virtual bool setAntenna(const std::string& antenna) override;
+    virtual std::string getAntenna() const override;
+    virtual std::string getDeviceInfo() const override;
+    virtual bool isInitialized() const override;
+
+    // 打开接收文件，采样率和中心频率取自元数据
+    bool openRx(const std::string& basePath);
+
+    // 创建发送文件，最多capacity个样本，关闭时截断到实际长度并写元数据
+    bool openTx(const std::string& basePath, size_t capacity);
+
+    // 设置是否按采样率实时读写，attach()时传给接收器和发送器
+    void setRealTime(bool enable);
+
+    // 是否按采样率实时读写
+    bool isRealTime() const;
+
+    /**
+     * @brief 从接收文件的当前位置读出样本
+     * @return 读出的样本数，到文件结尾时为0
+     */
+    size_t read(std::complex<float>* samples, size_t numSamples);
+
+    // 设置接收文件的读取位置(样本)
+    bool seek(uint64_t position);
+
+    // 接收文件的读取位置(样本)
+    uint64_t getRxPosition() const;
+
+    // 接收文件的样本数
+    size_t getRxLength() const;
+
+    // 接收文件的全部样本，不复制
+    const std::complex<float>* getRxData() const;
+
+    /**
+     * @brief 把样本写入发送文件
+     * @param timestamp 第一个样本在文件中的位置(样本)，中间没有写入的部分为0
+     * @return 写入的样本数，超出容量的部分丢弃
+     */
+    size_t write(const std::complex<float>* samples, size_t numSamples, uint64_t timestamp);
+
+    // 发送文件的长度(样本)，为写入过的最远位置
+    uint64_t getTxLength() const;
+
+    // 超出发送文件容量而丢弃的样本数
+    uint64_t getTxDropped() const;
+
+    // 接收器从接收文件取样本，文件读完后接收线程结束
+    bool attach(USRPReceiver& receiver);
+
+    // 发送器发出的样本写入发送文件，位置为发送时刻
+    bool attach(USRPTransmitter& transmitter);
+
+private:
+    // 读取元数据文件
+    bool readMeta(const std::string& path);
+
+    // 写元数据文件
+    bool writeMeta(const std::string& path) const;
+
+    // 设备参数
+    std::string deviceArgs;
+    double frequency;
+    double sampleRate;
+    double gain;
+    double bandwidth;
+    std::string antenna;
+    bool realTime;
+    bool initialized;
+
+    // 接收文件
+    MappedFile rxFile;
+    std::string rxBasePath;
+    std::atomic<uint64_t> rxPosition;
+
+    // 发送文件
+    MappedFile txFile;
+    std::string txBasePath;
+    std::atomic<uint64_t> txLength;
+    std::atomic<uint64_t> txDropped;
+};
+
+} // namespace hardware
+} // namespace physical
+} // namespace link16
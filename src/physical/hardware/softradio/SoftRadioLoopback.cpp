@@ -0,0 +1,275 @@
+#include "SoftRadioLoopback.h"
+#include "core/utils/logger.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace link16 {
+namespace physical {
+namespace hardware {
+
+namespace {
+
+// 非实时接收等待发送端数据的超时，用于检查是否已关闭
+const std::chrono::milliseconds loopback_wait_timeout(10);
+
+} // namespace
+
+// 构造函数
+SoftRadioLoopback::SoftRadioLoopback(size_t blockSize, size_t blockCount)
+    : ring(blockSize, blockCount), currentBlock(), currentOffset(0), hasBlock(false), realTime(true),
+      initialized(false), running(false), deliveredSamples(0) {
+}
+
+// 析构函数
+SoftRadioLoopback::~SoftRadioLoopback() {
+    if (initialized) {
+        close();
+    }
+}
+
+// 初始化设备
+bool SoftRadioLoopback::initialize(const std::string& args) {
+    if (initialized) {
+        LOG_WARNING("回环设备已经初始化");
+        return true;
+    }
+
+    LOG_INFO("初始化回环设备: " + args);
+
+    if (!transmitter.initialize(args) || !receiver.initialize(args)) {
+        transmitter.close();
+        receiver.close();
+        return false;
+    }
+
+    ring.reset();
+    hasBlock = false;
+    currentOffset = 0;
+    deliveredSamples = 0;
+    running = true;
+
+    // 连接发送端和接收端
+    transmitter.setRealTime(realTime);
+    receiver.setRealTime(realTime);
+    transmitter.setSendCallback([this](const std::complex<float>* samples, size_t length, uint64_t) {
+        deliver(samples, length);
+    });
+    receiver.setSampleSource([this](std::complex<float>* samples, size_t& numSamples, uint64_t) {
+        return fill(samples, numSamples);
+    });
+
+    initialized = true;
+    LOG_INFO("回环设备初始化成功");
+    return true;
+}
+
+// 关闭设备
+void SoftRadioLoopback::close() {
+    if (!initialized) {
+        return;
+    }
+
+    LOG_INFO("关闭回环设备");
+
+    // 先唤醒在回环缓冲区上等待的收发线程
+    running = false;
+    ring.close();
+    transmitter.close();
+    receiver.close();
+
+    initialized = false;
+}
+
+// 设置频率
+bool SoftRadioLoopback::setFrequency(double freq) {
+    return transmitter.setFrequency(freq) && receiver.setFrequency(freq);
+}
+
+// 获取频率
+double SoftRadioLoopback::getFrequency() const {
+    return transmitter.getFrequency();
+}
+
+// 设置采样率
+bool SoftRadioLoopback::setSampleRate(double rate) {
+    return transmitter.setSampleRate(rate) && receiver.setSampleRate(rate);
+}
+
+// 获取采样率
+double SoftRadioLoopback::getSampleRate() const {
+    return transmitter.getSampleRate();
+}
+
+// 设置增益
+bool SoftRadioLoopback::setGain(double gain) {
+    return transmitter.setGain(gain) && receiver.setGain(gain);
+}
+
+// 获取增益
+double SoftRadioLoopback::getGain() const {
+    return transmitter.getGain();
+}
+
+// 设置带宽
+bool SoftRadioLoopback::setBandwidth(double bandwidth) {
+    return transmitter.setBandwidth(bandwidth) && receiver.setBandwidth(bandwidth);
+}
+
+// 获取带宽
+double SoftRadioLoopback::getBandwidth() const {
+    return transmitter.getBandwidth();
+}
+
+// 设置天线
+bool SoftRadioLoopback::setAntenna(const std::string& antenna) {
+    return transmitter.setAntenna(antenna) && receiver.setAntenna(antenna);
+}
+
+// 获取天线
+std::string SoftRadioLoopback::getAntenna() const {
+    return transmitter.getAntenna();
+}
+
+// 获取设备信息
+std::string SoftRadioLoopback::getDeviceInfo() const {
+    if (!initialized) {
+        return "回环设备未初始化";
+    }
+
+    std::string info = "回环设备信息:\n";
+    info += "  频率: " + std::to_string(transmitter.getFrequency() / 1e6) + " MHz\n";
+    info += "  采样率: " + std::to_string(transmitter.getSampleRate() / 1e6) + " Msps\n";
+    info += "  信道: " + (channel ? channelName : std::string("直通")) + "\n";
+    info += std::string("  实时: ") + (realTime ? "是" : "否");
+
+    return info;
+}
+
+// 检查设备是否已初始化
+bool SoftRadioLoopback::isInitialized() const {
+    return initialized;
+}
+
+// 设置信道函数
+bool SoftRadioLoopback::setChannel(ChannelFunction function, const std::string& name) {
+    if (transmitter.isStreaming()) {
+        LOG_ERROR("发送时不能修改信道");
+        return false;
+    }
+    channel = std::move(function);
+    channelName = channel ? name : std::string();
+    return true;
+}
+
+// 信道名称
+std::string SoftRadioLoopback::getChannelName() const {
+    return channelName;
+}
+
+// 设置是否按采样率实时收发
+bool SoftRadioLoopback::setRealTime(bool enable) {
+    if (!transmitter.setRealTime(enable) || !receiver.setRealTime(enable)) {
+        transmitter.setRealTime(realTime);
+        receiver.setRealTime(realTime);
+        return false;
+    }
+    realTime = enable;
+    return true;
+}
+
+// 是否按采样率实时收发
+bool SoftRadioLoopback::isRealTime() const {
+    return realTime;
+}
+
+// 发送端
+USRPTransmitter& SoftRadioLoopback::getTransmitter() {
+    return transmitter;
+}
+
+// 接收端
+USRPReceiver& SoftRadioLoopback::getReceiver() {
+    return receiver;
+}
+
+// 经回环送到接收端的发射样本数
+uint64_t SoftRadioLoopback::getDeliveredSamples() const {
+    return deliveredSamples.load();
+}
+
+// 回环缓冲区满而丢弃的样本数
+uint64_t SoftRadioLoopback::getDroppedSamples() const {
+    return ring.getDroppedSamples();
+}
+
+// 发出的样本经信道写入回环缓冲区
+void SoftRadioLoopback::deliver(const std::complex<float>* samples, size_t length) {
+    if (!channel) {
+        push(samples, length);
+        return;
+    }
+
+    channel(samples, length, channelOutput);
+    push(channelOutput.data(), channelOutput.size());
+}
+
+// 写入回环缓冲区
+void SoftRadioLoopback::push(const std::complex<float>* samples, size_t length) {
+    const size_t blockSize = ring.getBlockSize();
+    size_t offset = 0;
+    while (offset < length && running) {
+        const size_t count = std::min(blockSize, length - offset);
+        if (ring.write(samples + offset, count, offset)) {
+            offset += count;
+        } else if (realTime) {
+            // 实时发送不能等待接收端
+            ring.recordOverrun(count);
+            offset += count;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+// 从回环缓冲区取样本
+bool SoftRadioLoopback::fill(std::complex<float>* samples, size_t& numSamples) {
+    size_t produced = 0;
+    while (produced < numSamples) {
+        if (!hasBlock) {
+            bool acquired = ring.tryAcquireRead(currentBlock);
+            if (!acquired && !realTime && produced == 0) {
+                // 非实时接收等待发送端，有部分数据时先返回
+                acquired = ring.waitRead(currentBlock, loopback_wait_timeout);
+            }
+            if (!acquired) {
+                break;
+            }
+            hasBlock = true;
+            currentOffset = 0;
+        }
+
+        const size_t count = std::min(numSamples - produced, currentBlock.length - currentOffset);
+        std::copy(currentBlock.data + currentOffset, currentBlock.data + currentOffset + count, samples + produced);
+        produced += count;
+        currentOffset += count;
+        if (currentOffset == currentBlock.length) {
+            ring.releaseRead();
+            hasBlock = false;
+        }
+    }
+    deliveredSamples.fetch_add(produced);
+
+    if (realTime) {
+        // 没有发射时接收到0
+        std::fill(samples + produced, samples + numSamples, std::complex<float>(0.0f, 0.0f));
+        return running;
+    }
+
+    numSamples = produced;
+    return running || produced > 0;
+}
+
+} // namespace hardware
+} // namespace physical
+} // namespace link16
@@ -0,0 +1,120 @@
+#pragma once
+#include "physical/hardware/usrp/USRPInterface.h"
+#include "physical/hardware/usrp/USRPReceiver.h"
+#include "physical/hardware/usrp/USRPTransmitter.h"
+#include "physical/hardware/usrp/SampleRing.h"
+#include <atomic>
+#include <complex>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace link16 {
+namespace physical {
+namespace hardware {
+
+/**
+ * @brief 回环软件无线电设备
+ *
+ * 包含一个USRPTransmitter和一个USRPReceiver，发送线程发出的样本经可选的信道函数
+ * 写入回环缓冲区，接收线程从中取出作为接收样本，收发两端都走真实设备的线程和缓冲区，
+ * 可以在没有硬件的机器上测量端到端吞吐量和时延。
+ * 实时模式下收发都按采样率节拍，接收时没有发射的部分为0，回环缓冲区满时丢弃；
+ * 非实时模式下收发尽快进行，接收端等待发送端的数据，不丢样本。
+ */
+class SoftRadioLoopback : public USRPInterface {
+public:
+    /**
+     * @brief 信道函数，在发送线程中调用
+     *
+     * 输入length个发射样本，把经过信道的样本写入output(长度可以不同)。
+     * 仿真层的信道模型可以包装成该函数接入，物理层不依赖仿真层。
+     */
+    typedef std::function<void(const std::complex<float>* samples, size_t length,
+                               std::vector<std::complex<float>>& output)> ChannelFunction;
+
+    /**
+     * @brief 构造函数
+     * @param blockSize 回环缓冲区每块样本数
+     * @param blockCount 回环缓冲区块数
+     */
+    SoftRadioLoopback(size_t blockSize = 1024, size_t blockCount = 64);
+
+    // 析构函数
+    virtual ~SoftRadioLoopback();
+
+    // 实现USRPInterface接口，参数同时设置到发送器和接收器
+    virtual bool initialize(const std::string& args = "") override;
+    virtual void close() override;
+    virtual bool setFrequency(double freq) override;
+    virtual double getFrequency() const override;
+    virtual bool setSampleRate(double rate) override;
+    virtual double getSampleRate() const override;
+    virtual bool setGain(double gain) override;
+    virtual double getGain() const override;
+    virtual bool setBandwidth(double bandwidth) override;
+    virtual double getBandwidth() const override;
+    virtual bool setAntenna(const std::string& antenna) override;
+    virtual std::string getAntenna() const override;
+    virtual std::string getDeviceInfo() const override;
+    virtual bool isInitialized() const override;
+
+    // 设置信道函数和显示用的名称，为空时直通；发送时不能修改
+    bool setChannel(ChannelFunction channel, const std::string& name = "自定义信道");
+
+    // 信道名称，直通时为空
+    std::string getChannelName() const;
+
+    // 设置是否按采样率实时收发，收发时不能修改
+    bool setRealTime(bool enable);
+
+    // 是否按采样率实时收发
+    bool isRealTime() const;
+
+    // 发送端
+    USRPTransmitter& getTransmitter();
+
+    // 接收端
+    USRPReceiver& getReceiver();
+
+    // 经回环送到接收端的发射样本数(不含空闲时填充的0)
+    uint64_t getDeliveredSamples() const;
+
+    // 回环缓冲区满而丢弃的样本数
+    uint64_t getDroppedSamples() const;
+
+private:
+    // 发送线程: 发出的样本经信道写入回环缓冲区
+    void deliver(const std::complex<float>* samples, size_t length);
+
+    // 接收线程: 从回环缓冲区取样本
+    bool fill(std::complex<float>* samples, size_t& numSamples);
+
+    // 写入回环缓冲区
+    void push(const std::complex<float>* samples, size_t length);
+
+    USRPTransmitter transmitter;
+    USRPReceiver receiver;
+
+    // 发送线程到接收线程的回环缓冲区
+    SampleRing ring;
+
+    // 信道函数和输出缓冲区，只在发送线程中使用
+    ChannelFunction channel;
+    std::string channelName;
+    std::vector<std::complex<float>> channelOutput;
+
+    // 接收线程正在读取的块
+    SampleBlock currentBlock;
+    size_t currentOffset;
+    bool hasBlock;
+
+    bool realTime;
+    bool initialized;
+    std::atomic<bool> running;
+    std::atomic<uint64_t> deliveredSamples;
+};
+
+} // namespace hardware
+} // namespace physical
+} // namespace link16
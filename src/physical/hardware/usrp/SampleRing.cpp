@@ -0,0 +1,211 @@
+#include "SampleRing.h"
+#include <algorithm>
+#include <cstring>
+
+namespace link16 {
+namespace physical {
+namespace hardware {
+
+namespace {
+
+// 每个缓存行容纳的样本数
+const size_t samples_per_cache_line = 64 / sizeof(std::complex<float>);
+
+// 向上取整为2的幂
+size_t roundUpToPowerOfTwo(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+} // namespace
+
+// 构造函数
+SampleRing::SampleRing(size_t blockSize, size_t blockCount)
+    : blockSize(std::max<size_t>(blockSize, 1)), blockCount(roundUpToPowerOfTwo(std::max<size_t>(blockCount, 2))),
+      mask(0), blockStride(0), samples(nullptr), head(0), cachedTail(0), tail(0), cachedHead(0), overrunCount(0),
+      droppedCount(0), highWater(0), consumerWaiting(false), closed(false) {
+    mask = this->blockCount - 1;
+    blockStride = (this->blockSize + samples_per_cache_line - 1) / samples_per_cache_line * samples_per_cache_line;
+
+    // 多分配一个缓存行用于对齐
+    storage.reset(new std::complex<float>[blockStride * this->blockCount + samples_per_cache_line]);
+    const uintptr_t address = reinterpret_cast<uintptr_t>(storage.get());
+    samples = reinterpret_cast<std::complex<float>*>((address + 63) & ~static_cast<uintptr_t>(63));
+
+    blocks.reset(new BlockInfo[this->blockCount]);
+    for (size_t i = 0; i < this->blockCount; ++i) {
+        blocks[i].length = 0;
+        blocks[i].timestamp = 0;
+    }
+}
+
+// 每块样本数
+size_t SampleRing::getBlockSize() const {
+    return blockSize;
+}
+
+// 块数
+size_t SampleRing::getBlockCount() const {
+    return blockCount;
+}
+
+// 获取下一个空闲块
+std::complex<float>* SampleRing::tryAcquireWrite() {
+    const uint64_t position = head.load(std::memory_order_relaxed);
+    if (position - cachedTail >= blockCount) {
+        // 只在看起来已满时才读取消费者的位置
+        cachedTail = tail.load(std::memory_order_acquire);
+        if (position - cachedTail >= blockCount) {
+            return nullptr;
+        }
+    }
+    return samples + (position & mask) * blockStride;
+}
+
+// 发布块
+void SampleRing::commitWrite(size_t length, uint64_t timestamp) {
+    const uint64_t position = head.load(std::memory_order_relaxed);
+    BlockInfo& info = blocks[position & mask];
+    info.length = std::min(length, blockSize);
+    info.timestamp = timestamp;
+
+    const size_t used = static_cast<size_t>(position + 1 - tail.load(std::memory_order_relaxed));
+    if (used > highWater.load(std::memory_order_relaxed)) {
+        highWater.store(used, std::memory_order_relaxed);
+    }
+
+    head.store(position + 1, std::memory_order_release);
+
+    // 消费者正在等待时才加锁唤醒；与waitRead中的栅栏配对，不会漏掉唤醒
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (consumerWaiting.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> lock(waitMutex);
+        dataCondition.notify_one();
+    }
+}
+
+// 复制样本并发布
+bool SampleRing::write(const std::complex<float>* data, size_t length, uint64_t timestamp) {
+    std::complex<float>* block = tryAcquireWrite();
+    if (!block) {
+        return false;
+    }
+    length = std::min(length, blockSize);
+    std::memcpy(static_cast<void*>(block), data, length * sizeof(std::complex<float>));
+    commitWrite(length, timestamp);
+    return true;
+}
+
+// 记录一次溢出
+void SampleRing::recordOverrun(size_t samples) {
+    overrunCount.fetch_add(1, std::memory_order_relaxed);
+    droppedCount.fetch_add(samples, std::memory_order_relaxed);
+}
+
+// 取得最早的块
+bool SampleRing::tryAcquireRead(SampleBlock& block) {
+    const uint64_t position = tail.load(std::memory_order_relaxed);
+    if (position == cachedHead) {
+        cachedHead = head.load(std::memory_order_acquire);
+        if (position == cachedHead) {
+            return false;
+        }
+    }
+
+    const BlockInfo& info = blocks[position & mask];
+    block.data = samples + (position & mask) * blockStride;
+    block.length = info.length;
+    block.sequence = position;
+    block.timestamp = info.timestamp;
+    return true;
+}
+
+// 等待并取得最早的块
+bool SampleRing::waitRead(SampleBlock& block, std::chrono::nanoseconds timeout) {
+    if (tryAcquireRead(block)) {
+        return true;
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    std::unique_lock<std::mutex> lock(waitMutex);
+    consumerWaiting.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    bool acquired = false;
+    while (true) {
+        // 设置等待标志之后再检查一次，生产者发布后一定能看到该标志
+        acquired = tryAcquireRead(block);
+        if (acquired || closed.load(std::memory_order_acquire)) {
+            break;
+        }
+        if (dataCondition.wait_until(lock, deadline) == std::cv_status::timeout) {
+            acquired = tryAcquireRead(block);
+            break;
+        }
+    }
+    consumerWaiting.store(false, std::memory_order_relaxed);
+    return acquired;
+}
+
+// 归还最早取得的块
+void SampleRing::releaseRead() {
+    const uint64_t position = tail.load(std::memory_order_relaxed);
+    if (position != head.load(std::memory_order_acquire)) {
+        tail.store(position + 1, std::memory_order_release);
+    }
+}
+
+// 关闭缓冲区
+void SampleRing::close() {
+    closed.store(true, std::memory_order_release);
+    std::lock_guard<std::mutex> lock(waitMutex);
+    dataCondition.notify_all();
+}
+
+// 是否已关闭
+bool SampleRing::isClosed() const {
+    return closed.load(std::memory_order_acquire);
+}
+
+// 清空并重新打开
+void SampleRing::reset() {
+    head.store(0);
+    tail.store(0);
+    cachedTail = 0;
+    cachedHead = 0;
+    overrunCount.store(0);
+    droppedCount.store(0);
+    highWater.store(0);
+    closed.store(false);
+}
+
+// 已发布未归还的块数
+size_t SampleRing::size() const {
+    return static_cast<size_t>(head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire));
+}
+
+// 累计溢出次数
+uint64_t SampleRing::getOverrunCount() const {
+    return overrunCount.load(std::memory_order_relaxed);
+}
+
+// 因溢出丢弃的样本数
+uint64_t SampleRing::getDroppedSamples() const {
+    return droppedCount.load(std::memory_order_relaxed);
+}
+
+// 累计发布的块数
+uint64_t SampleRing::getWrittenBlocks() const {
+    return head.load(std::memory_order_acquire);
+}
+
+// 缓冲区中曾经同时存在的最多块数
+size_t SampleRing::getHighWaterMark() const {
+    return highWater.load(std::memory_order_relaxed);
+}
+
+} // namespace hardware
+} // namespace physical
+} // namespace link16
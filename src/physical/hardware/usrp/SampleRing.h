@@ -0,0 +1,155 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <complex>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace link16 {
+namespace physical {
+namespace hardware {
+
+// 环形缓冲区中一个样本块的只读视图，releaseRead()之前有效
+struct SampleBlock {
+    const std::complex<float>* data;
+
+    // 样本数
+    size_t length;
+
+    // 块序号，从0开始连续递增(溢出丢弃的块不占序号)
+    uint64_t sequence;
+
+    // 第一个样本在流中的序号(含丢弃的样本)，可换算为接收时刻
+    uint64_t timestamp;
+};
+
+/**
+ * @brief 单生产者单消费者的样本块环形缓冲区
+ *
+ * 容量固定为blockCount个块，每块最多blockSize个std::complex<float>，存储按缓存行对齐、
+ * 构造后不再分配。生产者(接收线程)用tryAcquireWrite()直接写入空闲块，commitWrite()发布；
+ * 消费者(DSP线程)用tryAcquireRead()/waitRead()取得块的视图，处理完后releaseRead()归还，
+ * 不复制样本。读写位置分别只由一方修改并位于不同的缓存行，发布和归还都不加锁；只有消费者
+ * 在空缓冲区上等待时，生产者才通过条件变量唤醒它。
+ * 缓冲区满时生产者应丢弃数据并调用recordOverrun()，不阻塞接收线程。
+ */
+class SampleRing {
+public:
+    /**
+     * @brief 构造函数
+     * @param blockSize 每块样本数
+     * @param blockCount 块数，向上取整为2的幂
+     */
+    SampleRing(size_t blockSize = 1024, size_t blockCount = 64);
+
+    SampleRing(const SampleRing&) = delete;
+    SampleRing& operator=(const SampleRing&) = delete;
+
+    // 每块样本数
+    size_t getBlockSize() const;
+
+    // 块数
+    size_t getBlockCount() const;
+
+    // 生产者: 获取下一个空闲块，缓冲区满时返回空指针
+    std::complex<float>* tryAcquireWrite();
+
+    /**
+     * @brief 生产者: 发布tryAcquireWrite()取得的块
+     * @param length 写入的样本数(不超过blockSize)
+     * @param timestamp 第一个样本在流中的序号
+     */
+    void commitWrite(size_t length, uint64_t timestamp);
+
+    /**
+     * @brief 生产者: 复制样本到下一个空闲块并发布
+     * @return 是否写入，缓冲区满时为false(不计溢出)
+     */
+    bool write(const std::complex<float>* samples, size_t length, uint64_t timestamp);
+
+    // 生产者: 记录一次溢出，samples为丢弃的样本数
+    void recordOverrun(size_t samples);
+
+    // 消费者: 取得最早的块，缓冲区空时返回false
+    bool tryAcquireRead(SampleBlock& block);
+
+    /**
+     * @brief 消费者: 等待并取得最早的块
+     * @param block 输出
+     * @param timeout 最长等待时间
+     * @return 是否取得，超时或缓冲区已关闭且为空时为false
+     */
+    bool waitRead(SampleBlock& block, std::chrono::nanoseconds timeout);
+
+    // 消费者: 归还最早取得的块
+    void releaseRead();
+
+    // 关闭缓冲区并唤醒等待的消费者，已发布的块仍可读出
+    void close();
+
+    // 是否已关闭
+    bool isClosed() const;
+
+    // 清空缓冲区和计数器并重新打开，只能在生产者和消费者都停止时调用
+    void reset();
+
+    // 已发布未归还的块数
+    size_t size() const;
+
+    // 累计溢出次数
+    uint64_t getOverrunCount() const;
+
+    // 因溢出丢弃的样本数
+    uint64_t getDroppedSamples() const;
+
+    // 累计发布的块数
+    uint64_t getWrittenBlocks() const;
+
+    // 缓冲区中曾经同时存在的最多块数
+    size_t getHighWaterMark() const;
+
+private:
+    // 每块的描述
+    struct BlockInfo {
+        size_t length;
+        uint64_t timestamp;
+    };
+
+    size_t blockSize;
+    size_t blockCount;
+    size_t mask;
+
+    // 相邻块的间隔(样本数)，按缓存行取整
+    size_t blockStride;
+
+    // 样本存储，samples为其中按缓存行对齐的起点
+    std::unique_ptr<std::complex<float>[]> storage;
+    std::complex<float>* samples;
+    std::unique_ptr<BlockInfo[]> blocks;
+
+    // 写位置，只由生产者修改；cachedTail为生产者看到的读位置
+    alignas(64) std::atomic<uint64_t> head;
+    uint64_t cachedTail;
+
+    // 读位置，只由消费者修改；cachedHead为消费者看到的写位置
+    alignas(64) std::atomic<uint64_t> tail;
+    uint64_t cachedHead;
+
+    // 统计，只由生产者累加
+    alignas(64) std::atomic<uint64_t> overrunCount;
+    std::atomic<uint64_t> droppedCount;
+    std::atomic<size_t> highWater;
+
+    // 消费者等待
+    alignas(64) std::atomic<bool> consumerWaiting;
+    std::atomic<bool> closed;
+    std::mutex waitMutex;
+    std::condition_variable dataCondition;
+};
+
+} // namespace hardware
+} // namespace physical
+} // namespace link16
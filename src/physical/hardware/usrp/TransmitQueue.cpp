@@ -0,0 +1,218 @@
+#include "TransmitQueue.h"
+#include <algorithm>
+
+namespace link16 {
+namespace physical {
+namespace hardware {
+
+namespace {
+
+// 每个缓存行容纳的样本数
+const size_t samples_per_cache_line = 64 / sizeof(std::complex<float>);
+
+} // namespace
+
+const uint64_t TransmitQueue::asap;
+
+// 构造函数
+TransmitQueue::TransmitQueue(size_t bufferSize, size_t bufferCount)
+    : bufferSize(std::max<size_t>(bufferSize, 1)), bufferCount(std::max<size_t>(bufferCount, 2)), pendingHead(0),
+      pendingSize(0), inFlight(0), closed(false) {
+    const size_t stride =
+        (this->bufferSize + samples_per_cache_line - 1) / samples_per_cache_line * samples_per_cache_line;
+
+    // 多分配一个缓存行用于对齐
+    storage.reset(new std::complex<float>[stride * this->bufferCount + samples_per_cache_line]);
+    const uintptr_t address = reinterpret_cast<uintptr_t>(storage.get());
+    std::complex<float>* samples =
+        reinterpret_cast<std::complex<float>*>((address + 63) & ~static_cast<uintptr_t>(63));
+
+    buffers.reset(new TxBuffer[this->bufferCount]);
+    freeList.reserve(this->bufferCount);
+    pending.assign(this->bufferCount, nullptr);
+    for (size_t i = 0; i < this->bufferCount; ++i) {
+        buffers[i].data = samples + i * stride;
+        buffers[i].capacity = this->bufferSize;
+        buffers[i].length = 0;
+        buffers[i].timestamp = asap;
+        buffers[i].endOfBurst = true;
+        freeList.push_back(&buffers[this->bufferCount - 1 - i]);
+    }
+}
+
+// 每个缓冲区的样本数
+size_t TransmitQueue::getBufferSize() const {
+    return bufferSize;
+}
+
+// 缓冲区个数
+size_t TransmitQueue::getBufferCount() const {
+    return bufferCount;
+}
+
+// 取得空闲缓冲区
+TxBuffer* TransmitQueue::tryAcquire() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (closed || freeList.empty()) {
+        return nullptr;
+    }
+    TxBuffer* buffer = freeList.back();
+    freeList.pop_back();
+    return buffer;
+}
+
+// 等待空闲缓冲区
+TxBuffer* TransmitQueue::acquire(std::chrono::nanoseconds timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!freeCondition.wait_for(lock, timeout, [this]() { return closed || !freeList.empty(); }) || closed) {
+        return nullptr;
+    }
+    TxBuffer* buffer = freeList.back();
+    freeList.pop_back();
+    return buffer;
+}
+
+// 归还未提交的缓冲区
+void TransmitQueue::release(TxBuffer* buffer) {
+    if (!owns(buffer)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        freeList.push_back(buffer);
+    }
+    freeCondition.notify_one();
+}
+
+// 提交缓冲区
+bool TransmitQueue::submit(TxBuffer* buffer) {
+    if (!owns(buffer)) {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!closed && buffer->length <= buffer->capacity) {
+            pending[(pendingHead + pendingSize) % bufferCount] = buffer;
+            ++pendingSize;
+            pendingCondition.notify_one();
+            return true;
+        }
+        freeList.push_back(buffer);
+    }
+    freeCondition.notify_one();
+    return false;
+}
+
+// 取出最早提交的缓冲区
+TxBuffer* TransmitQueue::popPending() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (pendingSize == 0) {
+        return nullptr;
+    }
+    TxBuffer* buffer = pending[pendingHead];
+    pendingHead = (pendingHead + 1) % bufferCount;
+    --pendingSize;
+    ++inFlight;
+    return buffer;
+}
+
+// 等待提交的缓冲区
+TxBuffer* TransmitQueue::waitPending(std::chrono::nanoseconds timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!pendingCondition.wait_for(lock, timeout, [this]() { return closed || pendingSize > 0; }) ||
+        pendingSize == 0) {
+        return nullptr;
+    }
+    TxBuffer* buffer = pending[pendingHead];
+    pendingHead = (pendingHead + 1) % bufferCount;
+    --pendingSize;
+    ++inFlight;
+    return buffer;
+}
+
+// 放回缓冲池
+void TransmitQueue::recycle(TxBuffer* buffer) {
+    if (!owns(buffer)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        freeList.push_back(buffer);
+        if (inFlight > 0) {
+            --inFlight;
+        }
+        if (pendingSize == 0 && inFlight == 0) {
+            idleCondition.notify_all();
+        }
+    }
+    freeCondition.notify_one();
+}
+
+// 等待所有提交的缓冲区都交给设备
+bool TransmitQueue::waitIdle(std::chrono::nanoseconds timeout) {
+    std::unique_lock<std::mutex> lock(mutex);
+    return idleCondition.wait_for(lock, timeout, [this]() { return pendingSize == 0 && inFlight == 0; });
+}
+
+// 关闭队列
+void TransmitQueue::close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+    }
+    freeCondition.notify_all();
+    pendingCondition.notify_all();
+}
+
+// 重新打开队列
+void TransmitQueue::open() {
+    std::lock_guard<std::mutex> lock(mutex);
+    closed = false;
+}
+
+// 是否已关闭
+bool TransmitQueue::isClosed() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return closed;
+}
+
+// 丢弃未发送的缓冲区
+size_t TransmitQueue::discardPending() {
+    size_t discarded = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        discarded = pendingSize;
+        while (pendingSize > 0) {
+            freeList.push_back(pending[pendingHead]);
+            pendingHead = (pendingHead + 1) % bufferCount;
+            --pendingSize;
+        }
+        if (inFlight == 0) {
+            idleCondition.notify_all();
+        }
+    }
+    freeCondition.notify_all();
+    return discarded;
+}
+
+// 已提交未发送的缓冲区个数
+size_t TransmitQueue::getPendingCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return pendingSize;
+}
+
+// 空闲缓冲区个数
+size_t TransmitQueue::getFreeCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return freeList.size();
+}
+
+// 缓冲区是否属于本缓冲池
+bool TransmitQueue::owns(const TxBuffer* buffer) const {
+    return buffer != nullptr && buffer >= buffers.get() && buffer < buffers.get() + bufferCount;
+}
+
+} // namespace hardware
+} // namespace physical
+} // namespace link16
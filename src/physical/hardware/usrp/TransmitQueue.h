@@ -0,0 +1,142 @@
+#pragma once
+#include <chrono>
+#include <complex>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace link16 {
+namespace physical {
+namespace hardware {
+
+// 发送缓冲区，从TransmitQueue的缓冲池取得，填好样本后提交
+struct TxBuffer {
+    // 样本存储，按缓存行对齐
+    std::complex<float>* data;
+
+    // 最多样本数
+    size_t capacity;
+
+    // 要发送的样本数
+    size_t length;
+
+    // 第一个样本的发送时刻(设备样本计数)，TransmitQueue::asap表示尽快发送
+    uint64_t timestamp;
+
+    // 是否为突发的最后一个缓冲区，突发中间缓冲区之间断流计为欠载
+    bool endOfBurst;
+};
+
+/**
+ * @brief 发送缓冲池和待发送队列
+ *
+ * 构造时分配bufferCount个缓冲区，之后不再分配。调用者用acquire()取得空闲缓冲区，
+ * 在自己的线程中完成编码和调制后submit()；发送线程按提交顺序popPending()取出，
+ * 交给设备后recycle()放回缓冲池。至少两个缓冲区时，调用者准备下一个突发和发送线程
+ * 发送当前突发同时进行。可以有多个提交线程，只能有一个发送线程。
+ */
+class TransmitQueue {
+public:
+    // 尽快发送: 突发中紧接上一个缓冲区，否则立即发送
+    static const uint64_t asap = ~static_cast<uint64_t>(0);
+
+    /**
+     * @brief 构造函数
+     * @param bufferSize 每个缓冲区的样本数
+     * @param bufferCount 缓冲区个数，至少为2
+     */
+    TransmitQueue(size_t bufferSize = 8192, size_t bufferCount = 4);
+
+    TransmitQueue(const TransmitQueue&) = delete;
+    TransmitQueue& operator=(const TransmitQueue&) = delete;
+
+    // 每个缓冲区的样本数
+    size_t getBufferSize() const;
+
+    // 缓冲区个数
+    size_t getBufferCount() const;
+
+    // 取得空闲缓冲区，没有时返回空指针
+    TxBuffer* tryAcquire();
+
+    // 等待空闲缓冲区，超时或队列已关闭时返回空指针
+    TxBuffer* acquire(std::chrono::nanoseconds timeout);
+
+    // 归还未提交的缓冲区
+    void release(TxBuffer* buffer);
+
+    /**
+     * @brief 提交缓冲区，按提交顺序发送
+     * @return 是否提交；队列已关闭或length超过容量时为false，缓冲区归还缓冲池
+     */
+    bool submit(TxBuffer* buffer);
+
+    // 发送线程: 取出最早提交的缓冲区，没有时返回空指针
+    TxBuffer* popPending();
+
+    // 发送线程: 等待提交的缓冲区，超时或队列已关闭且为空时返回空指针
+    TxBuffer* waitPending(std::chrono::nanoseconds timeout);
+
+    // 发送线程: 缓冲区已交给设备，放回缓冲池
+    void recycle(TxBuffer* buffer);
+
+    /**
+     * @brief 等待所有提交的缓冲区都交给设备
+     * @return 超时时为false
+     */
+    bool waitIdle(std::chrono::nanoseconds timeout);
+
+    // 关闭队列，之后的提交失败，唤醒所有等待者
+    void close();
+
+    // 重新打开队列
+    void open();
+
+    // 是否已关闭
+    bool isClosed() const;
+
+    // 丢弃未发送的缓冲区，放回缓冲池
+    size_t discardPending();
+
+    // 已提交未发送的缓冲区个数
+    size_t getPendingCount() const;
+
+    // 空闲缓冲区个数
+    size_t getFreeCount() const;
+
+private:
+    // 缓冲区是否属于本缓冲池
+    bool owns(const TxBuffer* buffer) const;
+
+    size_t bufferSize;
+    size_t bufferCount;
+
+    // 样本存储，按缓存行对齐后分给各缓冲区
+    std::unique_ptr<std::complex<float>[]> storage;
+    std::unique_ptr<TxBuffer[]> buffers;
+
+    // 空闲缓冲区，后进先出，刚归还的缓冲区仍在缓存中
+    std::vector<TxBuffer*> freeList;
+
+    // 待发送缓冲区，容量为bufferCount的循环队列
+    std::vector<TxBuffer*> pending;
+    size_t pendingHead;
+    size_t pendingSize;
+
+    // 已取出还未放回的缓冲区个数
+    size_t inFlight;
+
+    bool closed;
+
+    mutable std::mutex mutex;
+    std::condition_variable freeCondition;
+    std::condition_variable pendingCondition;
+    std::condition_variable idleCondition;
+};
+
+} // namespace hardware
+} // namespace physical
+} // namespace link16
@@ -4,17 +4,31 @@
 #include <random>
 #include <chrono>
 #include <cmath>
+#include <algorithm>
 
 namespace link16 {
 namespace physical {
 namespace hardware {
 
+namespace {
+
+// 连续接收默认每块样本数和块数
+const size_t default_block_size = 1024;
+const size_t default_block_count = 64;
+
+// DSP线程等待数据的超时，用于检查缓冲区是否已关闭
+const std::chrono::milliseconds dsp_wait_timeout(100);
+
+} // namespace
+
 // 构造函数
 USRPReceiver::USRPReceiver()
     : deviceHandle(nullptr), rxStream(nullptr),
       rxFrequency(969.0e6), rxSampleRate(1.0e6), rxGain(30.0), rxBandwidth(1.0e6),
       rxAntenna("RX2"), rxChannel(0),
-      initialized(false), agcEnabled(false), continuousReceiveRunning(false) {
+      initialized(false), agcEnabled(false), continuousReceiveRunning(false),
+      sampleRing(new SampleRing(default_block_size, default_block_count)), noiseGenerator(std::random_device()()),
+      realTime(true) {
 }
 
 // 析构函数
@@ -63,6 +77,9 @@ bool USRPReceiver::initialize(const std::string& args) {
 
 // 关闭接收器
 void USRPReceiver::close() {
+    // 停止连续接收，内部需要加锁，不能在持有deviceMutex时调用
+    stopContinuousReceive();
+
     std::lock_guard<std::mutex> lock(deviceMutex);
 
     if (!initialized) {
@@ -71,11 +88,6 @@ void USRPReceiver::close() {
 
     LOG_INFO("关闭USRP接收器");
 
-    // 停止连续接收
-    if (continuousReceiveRunning) {
-        stopContinuousReceive();
-    }
-
     // 释放资源
     if (rxStream) {
         delete static_cast<int*>(rxStream);
@@ -279,8 +291,53 @@ size_t USRPReceiver::getRxChannel() const {
     return rxChannel;
 }
 
+// 设置连续接收的环形缓冲区
+bool USRPReceiver::setStreamBuffer(size_t blockSize, size_t blockCount) {
+    std::lock_guard<std::mutex> lock(deviceMutex);
+
+    if (continuousReceiveRunning || blockSize == 0 || blockCount == 0) {
+        LOG_ERROR("无法设置接收缓冲区: " + std::to_string(blockCount) + " x " + std::to_string(blockSize));
+        return false;
+    }
+
+    // 样本源结束后自行退出的DSP线程可能还在处理旧缓冲区中的块
+    joinFinishedThreads();
+    sampleRing.reset(new SampleRing(blockSize, blockCount));
+    LOG_INFO("设置接收缓冲区: " + std::to_string(sampleRing->getBlockCount()) + " x " + std::to_string(blockSize));
+    return true;
+}
+
+// 启动连续接收，由调用者取数据
+bool USRPReceiver::startStreaming() {
+    return startReceiveThreads(BlockCallback());
+}
+
 // 启动连续接收
 bool USRPReceiver::startContinuousReceive(std::function<void(const std::vector<std::complex<float>>&)> callback) {
+    if (!callback) {
+        LOG_ERROR("接收回调为空");
+        return false;
+    }
+
+    // 兼容原接口: 在DSP线程中复制到复用的vector
+    auto buffer = std::make_shared<std::vector<std::complex<float>>>();
+    return startReceiveThreads([callback, buffer](const SampleBlock& block) {
+        buffer->assign(block.data, block.data + block.length);
+        callback(*buffer);
+    });
+}
+
+// 启动连续接收，不复制样本
+bool USRPReceiver::startContinuousReceive(BlockCallback callback) {
+    if (!callback) {
+        LOG_ERROR("接收回调为空");
+        return false;
+    }
+    return startReceiveThreads(std::move(callback));
+}
+
+// 启动接收线程
+bool USRPReceiver::startReceiveThreads(BlockCallback callback) {
     std::lock_guard<std::mutex> lock(deviceMutex);
 
     if (!initialized) {
@@ -295,42 +352,113 @@ bool USRPReceiver::startContinuousReceive(std::function<void(const std::vector<s
 
     LOG_INFO("启动连续接收");
 
-    // 保存回调函数
-    receiveCallback = callback;
+    // 上一次样本源结束后自行退出的线程
+    joinFinishedThreads();
+
+    // 保存回调函数，清空上一次的缓冲区
+    blockCallback = std::move(callback);
+    sampleRing->reset();
 
     // 设置运行标志
     continuousReceiveRunning = true;
 
-    // 启动接收线程
+    // 启动接收线程和DSP线程
     receiveThread = std::thread(&USRPReceiver::continuousReceiveThread, this);
+    if (blockCallback) {
+        dspThread = std::thread(&USRPReceiver::dspProcessThread, this);
+    }
 
     return true;
 }
 
+// 回收样本源结束后自行退出的线程，调用时持有deviceMutex且未在接收
+void USRPReceiver::joinFinishedThreads() {
+    if (receiveThread.joinable()) {
+        receiveThread.join();
+    }
+    if (dspThread.joinable()) {
+        dspThread.join();
+    }
+}
+
 // 停止连续接收
 void USRPReceiver::stopContinuousReceive() {
     {
         std::lock_guard<std::mutex> lock(deviceMutex);
 
-        if (!continuousReceiveRunning) {
-            return;
-        }
-
-        LOG_INFO("停止连续接收");
+        if (continuousReceiveRunning) {
+            LOG_INFO("停止连续接收");
 
-        // 清除运行标志
-        continuousReceiveRunning = false;
+            // 清除运行标志
+            continuousReceiveRunning = false;
+        }
     }
 
     // 通知线程停止
     stopCondition.notify_all();
 
-    // 等待线程结束
-    if (receiveThread.joinable()) {
-        receiveThread.join();
+    // 等待接收线程结束，再让DSP线程处理完剩余的块；样本源结束后自行退出的线程也在这里回收
+    if (!receiveThread.joinable()) {
+        return;
+    }
+    receiveThread.join();
+    sampleRing->close();
+    if (dspThread.joinable()) {
+        dspThread.join();
+    }
+
+    if (sampleRing->getOverrunCount() > 0) {
+        LOG_WARNING("连续接收溢出" + std::to_string(sampleRing->getOverrunCount()) + "次，丢弃" +
+                    std::to_string(sampleRing->getDroppedSamples()) + "个样本");
     }
 }
 
+// 是否正在连续接收
+bool USRPReceiver::isReceiving() const {
+    return continuousReceiveRunning;
+}
+
+// 设置样本源
+bool USRPReceiver::setSampleSource(SampleSource source) {
+    std::lock_guard<std::mutex> lock(deviceMutex);
+
+    if (continuousReceiveRunning) {
+        LOG_ERROR("接收中不能设置样本源");
+        return false;
+    }
+
+    sampleSource = std::move(source);
+    return true;
+}
+
+// 设置是否按采样率实时接收
+bool USRPReceiver::setRealTime(bool enable) {
+    std::lock_guard<std::mutex> lock(deviceMutex);
+
+    if (continuousReceiveRunning) {
+        LOG_ERROR("接收中不能修改实时模式");
+        return false;
+    }
+
+    realTime = enable;
+    return true;
+}
+
+// 是否按采样率实时接收
+bool USRPReceiver::isRealTime() const {
+    return realTime;
+}
+
+// 连续接收的环形缓冲区
+SampleRing& USRPReceiver::getSampleRing() {
+    return *sampleRing;
+}
+
+// 连续接收的溢出次数
+uint64_t USRPReceiver::getOverrunCount() const {
+    return sampleRing->getOverrunCount();
+}
+
 // 获取信号强度
 double USRPReceiver::getSignalStrength() const {
     if (!initialized) {
@@ -426,30 +554,99 @@ double USRPReceiver::getRxFrequency() const {
 void USRPReceiver::continuousReceiveThread() {
     LOG_INFO("连续接收线程启动");
 
-    // 缓冲区大小
-    const size_t bufferSize = 1024;
-
-    // 接收缓冲区
-    std::vector<std::complex<float>> buffer(bufferSize);
+    double sampleRate = 0.0;
+    bool paced = true;
+    {
+        std::lock_guard<std::mutex> lock(deviceMutex);
+        sampleRate = rxSampleRate;
+        paced = realTime;
+    }
+    const size_t blockSize = sampleRing->getBlockSize();
+    const auto start = std::chrono::steady_clock::now();
+    uint64_t timestamp = 0;
+    bool exhausted = false;
 
     // 线程循环
     while (continuousReceiveRunning) {
-        // 接收数据
-        if (receive(buffer, bufferSize, 0.1)) {
-            // 调用回调函数
-            if (receiveCallback) {
-                receiveCallback(buffer);
+        // 模拟设备: 一块样本全部到达后才能读出，按样本时钟而不是固定间隔等待
+        if (paced) {
+            const auto ready = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                           std::chrono::duration<double>((timestamp + blockSize) / sampleRate));
+            std::unique_lock<std::mutex> lock(deviceMutex);
+            if (stopCondition.wait_until(lock, ready, [this] { return !continuousReceiveRunning; })) {
+                break;
+            }
+        }
+
+        // 直接写入环形缓冲区的空闲块
+        std::complex<float>* block = sampleRing->tryAcquireWrite();
+        if (!block) {
+            if (paced) {
+                // 实时接收时丢弃该块
+                sampleRing->recordOverrun(blockSize);
+                timestamp += blockSize;
+            } else {
+                // 非实时接收时等待消费者归还
+                std::this_thread::yield();
             }
+            continue;
         }
 
-        // 检查是否需要停止
-        std::unique_lock<std::mutex> lock(deviceMutex);
-        stopCondition.wait_for(lock, std::chrono::milliseconds(10), [this] { return !continuousReceiveRunning; });
+        size_t length = blockSize;
+        if (sampleSource) {
+            if (!sampleSource(block, length, timestamp)) {
+                LOG_INFO("样本源结束，设备时间: " + std::to_string(timestamp));
+                exhausted = true;
+                break;
+            }
+            length = std::min(length, blockSize);
+        } else {
+            generateSamples(block, length);
+        }
+
+        if (length > 0) {
+            sampleRing->commitWrite(length, timestamp);
+            timestamp += length;
+        } else if (paced) {
+            // 样本源这一块没有数据，时间照常前进
+            timestamp += blockSize;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    // 不再写入，DSP线程处理完剩余的块后退出
+    sampleRing->close();
+
+    // 样本源结束时自行停止，线程由下一次启动或stopContinuousReceive()回收
+    if (exhausted) {
+        continuousReceiveRunning = false;
     }
 
     LOG_INFO("连续接收线程结束");
 }
 
+// DSP线程函数
+void USRPReceiver::dspProcessThread() {
+    SampleBlock block;
+    while (true) {
+        if (sampleRing->waitRead(block, dsp_wait_timeout)) {
+            blockCallback(block);
+            sampleRing->releaseRead();
+        } else if (sampleRing->isClosed() && sampleRing->size() == 0) {
+            break;
+        }
+    }
+}
+
+// 生成模拟的接收样本
+void USRPReceiver::generateSamples(std::complex<float>* samples, size_t numSamples) {
+    std::normal_distribution<float> dist(0.0f, 0.1f);
+    for (size_t i = 0; i < numSamples; ++i) {
+        samples[i] = std::complex<float>(dist(noiseGenerator), dist(noiseGenerator));
+    }
+}
+
 // 计算信号强度
 double USRPReceiver::calculateSignalStrength(const std::vector<std::complex<float>>& samples) const {
     if (samples.empty()) {
@@ -1,5 +1,6 @@
 #pragma once
 #include "USRPInterface.h"
+#include "SampleRing.h"
 #include <vector>
 #include <complex>
 #include <string>
@@ -8,6 +9,8 @@
 #include <condition_variable>
 #include <functional>
 #include <atomic>
+#include <memory>
+#include <random>
 
 namespace link16 {
 namespace physical {
@@ -15,6 +18,17 @@ namespace hardware {
 
 class USRPReceiver : public USRPInterface {
 public:
+    // 零拷贝的块回调，block在回调返回后归还给环形缓冲区
+    typedef std::function<void(const SampleBlock& block)> BlockCallback;
+
+    /**
+     * 样本源，在接收线程中调用，代替模拟噪声
+     * numSamples: 输入为最多样本数，输出为写入的样本数(可以为0，表示暂时没有数据)
+     * timestamp: 第一个样本在流中的序号
+     * 返回false表示数据结束，接收线程随后关闭环形缓冲区
+     */
+    typedef std::function<bool(std::complex<float>* samples, size_t& numSamples, uint64_t timestamp)> SampleSource;
+
     // 构造函数
     USRPReceiver();
 
@@ -39,6 +53,24 @@ public:
 
     // 接收器特有方法
 
+    // 设置接收频率
+    bool setRxFrequency(double freq);
+
+    // 获取接收频率
+    double getRxFrequency() const;
+
+    // 设置接收增益
+    bool setRxGain(double gain);
+
+    // 获取接收增益
+    double getRxGain() const;
+
+    // 设置接收天线
+    bool setRxAntenna(const std::string& antenna);
+
+    // 获取接收天线
+    std::string getRxAntenna() const;
+
     // 接收复数样本
     bool receive(std::vector<std::complex<float>>& samples, size_t numSamples, double timeout = 1.0);
 
@@ -54,12 +86,53 @@ public:
     // 获取接收通道
     size_t getRxChannel() const;
 
-    // 启动连续接收
+    /**
+     * @brief 设置连续接收的环形缓冲区，接收中不能修改
+     * @param blockSize 每块样本数
+     * @param blockCount 块数
+     */
+    bool setStreamBuffer(size_t blockSize, size_t blockCount);
+
+    /**
+     * @brief 启动连续接收，由调用者从getSampleRing()取数据
+     *
+     * 接收线程按采样率把样本块写入环形缓冲区，缓冲区满时丢弃该块并计入溢出。
+     * 调用者作为唯一的消费者使用SampleRing::waitRead()/releaseRead()。
+     */
+    bool startStreaming();
+
+    // 启动连续接收，DSP线程从环形缓冲区取块调用callback(复制到vector)
     bool startContinuousReceive(std::function<void(const std::vector<std::complex<float>>&)> callback);
 
-    // 停止连续接收
+    // 启动连续接收，DSP线程从环形缓冲区取块直接调用callback，不复制样本
+    bool startContinuousReceive(BlockCallback callback);
+
+    // 停止连续接收，DSP线程处理完已接收的块后退出
     void stopContinuousReceive();
 
+    // 是否正在连续接收，样本源结束后自行停止
+    bool isReceiving() const;
+
+    // 设置样本源，为空时接收模拟噪声；接收中不能修改
+    bool setSampleSource(SampleSource source);
+
+    /**
+     * @brief 设置是否按采样率实时接收，接收中不能修改
+     *
+     * 默认实时: 接收线程按采样时钟产生样本块，缓冲区满时丢弃。
+     * 非实时时不等待采样时钟，缓冲区满时等待消费者归还，不丢样本，用于回放文件测吞吐量。
+     */
+    bool setRealTime(bool enable);
+
+    // 是否按采样率实时接收
+    bool isRealTime() const;
+
+    // 连续接收的环形缓冲区
+    SampleRing& getSampleRing();
+
+    // 连续接收的溢出次数
+    uint64_t getOverrunCount() const;
+
     // 获取信号强度
     double getSignalStrength() const;
 
@@ -99,12 +172,37 @@ private:
     // 条件变量
     std::condition_variable stopCondition;
 
+    // 接收线程和DSP线程之间的环形缓冲区
+    std::unique_ptr<SampleRing> sampleRing;
+
+    // DSP线程
+    std::thread dspThread;
+
     // 连续接收回调函数
-    std::function<void(const std::vector<std::complex<float>>&)> receiveCallback;
+    BlockCallback blockCallback;
+
+    // 模拟接收的噪声发生器，只在接收线程中使用
+    std::mt19937 noiseGenerator;
+
+    // 样本源和是否实时接收
+    SampleSource sampleSource;
+    bool realTime;
+
+    // 启动接收线程，callback为空时不启动DSP线程
+    bool startReceiveThreads(BlockCallback callback);
+
+    // 回收样本源结束后自行退出的线程
+    void joinFinishedThreads();
 
     // 连续接收线程函数
     void continuousReceiveThread();
 
+    // DSP线程函数
+    void dspProcessThread();
+
+    // 生成模拟的接收样本
+    void generateSamples(std::complex<float>* samples, size_t numSamples);
+
     // 计算信号强度
     double calculateSignalStrength(const std::vector<std::complex<float>>& samples) const;
 };
@@ -4,17 +4,34 @@
 #include <random>
 #include <chrono>
 #include <cmath>
+#include <algorithm>
 
 namespace link16 {
 namespace physical {
 namespace hardware {
 
+namespace {
+
+// 默认每个发送缓冲区的样本数和缓冲区个数
+const size_t default_buffer_size = 8192;
+const size_t default_buffer_count = 4;
+
+// 发送线程和提交者等待的超时，用于检查是否已停止
+const std::chrono::milliseconds stream_wait_timeout(100);
+
+} // namespace
+
+const uint64_t USRPTransmitter::default_slot_length_ns;
+
 // 构造函数
 USRPTransmitter::USRPTransmitter()
     : deviceHandle(nullptr), txStream(nullptr),
       txFrequency(969.0e6), txSampleRate(1.0e6), txGain(20.0), txBandwidth(1.0e6),
       txAntenna("TX/RX"), txChannel(0), txPower(10.0),
-      initialized(false), continuousTransmitRunning(false) {
+      initialized(false), continuousTransmitRunning(false), streamingRunning(false), streamSampleRate(1.0e6),
+      realTime(true), streamCursor(0),
+      transmitQueue(new TransmitQueue(default_buffer_size, default_buffer_count)), underrunCount(0), lateCount(0),
+      sentBuffers(0), sentSamples(0), repeatCount(0) {
 }
 
 // 析构函数
@@ -63,6 +80,10 @@ bool USRPTransmitter::initialize(const std::string& args) {
 
 // 关闭发送器
 void USRPTransmitter::close() {
+    // 停止连续发送和流式发送，内部需要加锁，不能在持有deviceMutex时调用
+    stopContinuousTransmit();
+    stopStreaming();
+
     std::lock_guard<std::mutex> lock(deviceMutex);
 
     if (!initialized) {
@@ -71,11 +92,6 @@ void USRPTransmitter::close() {
 
     LOG_INFO("关闭USRP发送器");
 
-    // 停止连续发送
-    if (continuousTransmitRunning) {
-        stopContinuousTransmit();
-    }
-
     // 释放资源
     if (txStream) {
         delete static_cast<int*>(txStream);
@@ -184,20 +200,33 @@ bool USRPTransmitter::isInitialized() const {
 
 // 发送复数样本
 bool USRPTransmitter::transmit(const std::vector<std::complex<float>>& samples) {
-    std::lock_guard<std::mutex> lock(deviceMutex);
+    double sampleRate = 0.0;
+    {
+        std::lock_guard<std::mutex> lock(deviceMutex);
 
-    if (!initialized) {
-        LOG_ERROR("USRP发送器未初始化");
-        return false;
+        if (!initialized) {
+            LOG_ERROR("USRP发送器未初始化");
+            return false;
+        }
+        sampleRate = txSampleRate;
     }
 
     LOG_INFO("发送复数样本: " + std::to_string(samples.size()) + " 个样本");
 
+    // 流式发送时交给发送线程，不等待空中时间
+    if (streamingRunning) {
+        if (!submitSamples(samples.data(), samples.size(), true)) {
+            LOG_ERROR("提交发送样本失败");
+            return false;
+        }
+        return true;
+    }
+
     // 这里是一个模拟实现，实际应该使用UHD库
     // 在实际实现中，将使用UHD库发送复数样本
 
-    // 模拟发送延迟
-    std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int>(samples.size() / txSampleRate * 1000)));
+    // 模拟发送延迟，不持有设备锁
+    std::this_thread::sleep_for(std::chrono::duration<double>(samples.size() / sampleRate));
 
     return true;
 }
@@ -268,8 +297,210 @@ size_t USRPTransmitter::getTxChannel() const {
     return txChannel;
 }
 
+// 设置发送缓冲池
+bool USRPTransmitter::setTransmitQueue(size_t bufferSize, size_t bufferCount) {
+    std::lock_guard<std::mutex> lock(deviceMutex);
+
+    if (streamingRunning || bufferSize == 0 || bufferCount < 2) {
+        LOG_ERROR("无法设置发送缓冲池: " + std::to_string(bufferCount) + " x " + std::to_string(bufferSize));
+        return false;
+    }
+
+    transmitQueue.reset(new TransmitQueue(bufferSize, bufferCount));
+    LOG_INFO("设置发送缓冲池: " + std::to_string(bufferCount) + " x " + std::to_string(bufferSize));
+    return true;
+}
+
+// 设置模拟设备的发送回调
+bool USRPTransmitter::setSendCallback(SendCallback callback) {
+    std::lock_guard<std::mutex> lock(deviceMutex);
+
+    if (streamingRunning) {
+        LOG_ERROR("流式发送时不能设置发送回调");
+        return false;
+    }
+
+    sendCallback = std::move(callback);
+    return true;
+}
+
+// 设置是否按采样率实时发送
+bool USRPTransmitter::setRealTime(bool enable) {
+    std::lock_guard<std::mutex> lock(deviceMutex);
+
+    if (streamingRunning) {
+        LOG_ERROR("流式发送时不能修改实时模式");
+        return false;
+    }
+
+    realTime = enable;
+    return true;
+}
+
+// 是否按采样率实时发送
+bool USRPTransmitter::isRealTime() const {
+    return realTime;
+}
+
+// 启动流式发送线程
+bool USRPTransmitter::startStreaming() {
+    std::lock_guard<std::mutex> lock(deviceMutex);
+
+    if (!initialized) {
+        LOG_ERROR("USRP发送器未初始化");
+        return false;
+    }
+
+    if (streamingRunning) {
+        LOG_WARNING("流式发送已经在运行");
+        return true;
+    }
+
+    LOG_INFO("启动流式发送");
+
+    // 清空上一次的队列和统计
+    transmitQueue->discardPending();
+    transmitQueue->open();
+    underrunCount = 0;
+    lateCount = 0;
+    sentBuffers = 0;
+    sentSamples = 0;
+    streamCursor = 0;
+
+    // 当前时刻为设备时间0
+    streamSampleRate = txSampleRate;
+    streamEpoch = std::chrono::steady_clock::now();
+
+    streamingRunning = true;
+    streamThread = std::thread(&USRPTransmitter::streamTransmitThread, this);
+
+    return true;
+}
+
+// 停止流式发送
+void USRPTransmitter::stopStreaming() {
+    // 连续发送依赖流式发送线程，先停止
+    stopContinuousTransmit();
+
+    {
+        std::lock_guard<std::mutex> lock(deviceMutex);
+
+        if (!streamingRunning) {
+            return;
+        }
+
+        LOG_INFO("停止流式发送");
+        streamingRunning = false;
+    }
+
+    // 唤醒等待发送时刻的发送线程和等待缓冲区的提交者
+    stopCondition.notify_all();
+    transmitQueue->close();
+
+    if (streamThread.joinable()) {
+        streamThread.join();
+    }
+
+    const size_t discarded = transmitQueue->discardPending();
+    if (discarded > 0) {
+        LOG_WARNING("丢弃" + std::to_string(discarded) + "个未发送的缓冲区");
+    }
+}
+
+// 是否正在流式发送
+bool USRPTransmitter::isStreaming() const {
+    return streamingRunning;
+}
+
+// 取得空闲的发送缓冲区
+TxBuffer* USRPTransmitter::acquireBuffer(std::chrono::nanoseconds timeout) {
+    if (!streamingRunning) {
+        LOG_ERROR("流式发送未启动");
+        return nullptr;
+    }
+    return transmitQueue->acquire(timeout);
+}
+
+// 归还未提交的缓冲区
+void USRPTransmitter::releaseBuffer(TxBuffer* buffer) {
+    transmitQueue->release(buffer);
+}
+
+// 提交缓冲区
+bool USRPTransmitter::submit(TxBuffer* buffer, size_t length, uint64_t timestamp, bool endOfBurst) {
+    if (!buffer) {
+        return false;
+    }
+
+    buffer->length = length;
+    buffer->timestamp = timestamp;
+    buffer->endOfBurst = endOfBurst;
+    return transmitQueue->submit(buffer);
+}
+
+// 提交缓冲区在时隙开始时发送
+bool USRPTransmitter::submitAtSlot(TxBuffer* buffer, size_t length, uint64_t slot, uint64_t slotLength) {
+    double sampleRate = 0.0;
+    {
+        std::lock_guard<std::mutex> lock(deviceMutex);
+        sampleRate = streamSampleRate;
+    }
+
+    // 时隙边界换算为样本计数，按整个时隙号计算避免误差累积
+    const long double seconds = static_cast<long double>(slot) * slotLength * 1e-9L;
+    const uint64_t timestamp = static_cast<uint64_t>(std::llround(seconds * sampleRate));
+    return submit(buffer, length, timestamp, true);
+}
+
+// 等待已提交的缓冲区都交给设备
+bool USRPTransmitter::flush(std::chrono::nanoseconds timeout) {
+    return transmitQueue->waitIdle(timeout);
+}
+
+// 当前设备时间
+uint64_t USRPTransmitter::getDeviceTime() const {
+    if (!streamingRunning) {
+        return 0;
+    }
+    if (!realTime) {
+        return streamCursor.load();
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - streamEpoch;
+    return static_cast<uint64_t>(elapsed.count() * streamSampleRate);
+}
+
+// 设备时间0对应的时刻
+std::chrono::steady_clock::time_point USRPTransmitter::getStreamEpoch() const {
+    return streamEpoch;
+}
+
+// 欠载次数
+uint64_t USRPTransmitter::getUnderrunCount() const {
+    return underrunCount.load();
+}
+
+// 迟到丢弃的缓冲区个数
+uint64_t USRPTransmitter::getLateCount() const {
+    return lateCount.load();
+}
+
+// 已发送的缓冲区个数
+uint64_t USRPTransmitter::getSentBuffers() const {
+    return sentBuffers.load();
+}
+
+// 已发送的样本数
+uint64_t USRPTransmitter::getSentSamples() const {
+    return sentSamples.load();
+}
+
 // 启动连续发送
 bool USRPTransmitter::startContinuousTransmit(const std::vector<std::complex<float>>& samples, size_t repeatCount) {
+    // 连续发送经过发送队列，需要流式发送线程
+    if (!streamingRunning && !startStreaming()) {
+        return false;
+    }
+
     std::lock_guard<std::mutex> lock(deviceMutex);
 
     if (!initialized) {
@@ -284,6 +515,11 @@ bool USRPTransmitter::startContinuousTransmit(const std::vector<std::complex<flo
 
     LOG_INFO("启动连续发送，重复次数: " + std::to_string(repeatCount));
 
+    // 上一次达到重复次数后自行结束的线程
+    if (transmitThread.joinable()) {
+        transmitThread.join();
+    }
+
     // 保存发送数据
     transmitBuffer = samples;
     this->repeatCount = repeatCount;
@@ -302,20 +538,15 @@ void USRPTransmitter::stopContinuousTransmit() {
     {
         std::lock_guard<std::mutex> lock(deviceMutex);
 
-        if (!continuousTransmitRunning) {
-            return;
-        }
-
-        LOG_INFO("停止连续发送");
+        if (continuousTransmitRunning) {
+            LOG_INFO("停止连续发送");
 
-        // 清除运行标志
-        continuousTransmitRunning = false;
+            // 清除运行标志
+            continuousTransmitRunning = false;
+        }
     }
 
-    // 通知线程停止
-    stopCondition.notify_all();
-
-    // 等待线程结束
+    // 等待线程结束，达到重复次数后自行结束的线程也在这里回收
     if (transmitThread.joinable()) {
         transmitThread.join();
     }
@@ -403,30 +634,144 @@ void USRPTransmitter::continuousTransmitThread() {
 
     // 发送计数
     size_t count = 0;
+    bool burstEnded = false;
 
-    // 线程循环
+    // 线程循环: 重复提交到发送队列，各次之间首尾相接
     while (continuousTransmitRunning) {
-        // 发送数据
-        transmit(transmitBuffer);
+        const bool last = repeatCount > 0 && count + 1 >= repeatCount;
+        if (!submitSamples(transmitBuffer.data(), transmitBuffer.size(), last)) {
+            break;
+        }
 
         // 更新计数
         count++;
 
         // 检查是否达到重复次数
-        if (repeatCount > 0 && count >= repeatCount) {
+        if (last) {
             LOG_INFO("达到重复次数，停止连续发送");
             continuousTransmitRunning = false;
+            burstEnded = true;
             break;
         }
+    }
 
-        // 检查是否需要停止
-        std::unique_lock<std::mutex> lock(deviceMutex);
-        stopCondition.wait_for(lock, std::chrono::milliseconds(10), [this] { return !continuousTransmitRunning; });
+    // 被停止时用空缓冲区结束突发，不计为欠载
+    if (!burstEnded) {
+        submitSamples(nullptr, 0, true);
     }
 
     LOG_INFO("连续发送线程结束");
 }
 
+// 流式发送线程函数
+void USRPTransmitter::streamTransmitThread() {
+    LOG_INFO("流式发送线程启动");
+
+    const double sampleRate = streamSampleRate;
+    const auto epoch = streamEpoch;
+    const bool paced = realTime;
+    auto timeOf = [&](uint64_t samples) {
+        return epoch + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                           std::chrono::duration<double>(samples / sampleRate));
+    };
+
+    // 上一个缓冲区结束时的设备时间
+    uint64_t cursor = 0;
+
+    // 上一个缓冲区不是突发结尾，下一个应首尾相接
+    bool inBurst = false;
+
+    // 突发的开头迟到，丢弃到突发结尾
+    bool dropping = false;
+
+    while (streamingRunning) {
+        TxBuffer* buffer = transmitQueue->popPending();
+        if (!buffer) {
+            // 上一个缓冲区发完时突发的下一个缓冲区还没有提交
+            if (inBurst && paced) {
+                underrunCount.fetch_add(1);
+                inBurst = false;
+                LOG_WARNING("发送欠载，设备时间: " + std::to_string(cursor));
+            }
+            buffer = transmitQueue->waitPending(stream_wait_timeout);
+            if (!buffer) {
+                continue;
+            }
+        }
+
+        // 非实时发送时设备时间就是已发送的样本数
+        uint64_t now = cursor;
+        if (paced) {
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - epoch;
+            now = static_cast<uint64_t>(elapsed.count() * sampleRate);
+        }
+        const uint64_t earliest = inBurst ? cursor : std::max(now, cursor);
+
+        // 已错过发送时刻
+        if (dropping || (buffer->timestamp != TransmitQueue::asap && buffer->timestamp < earliest)) {
+            lateCount.fetch_add(1);
+            dropping = !buffer->endOfBurst;
+            inBurst = false;
+            transmitQueue->recycle(buffer);
+            continue;
+        }
+
+        const uint64_t start = buffer->timestamp == TransmitQueue::asap ? earliest : buffer->timestamp;
+        if (paced && start > now && !waitUntil(timeOf(start))) {
+            transmitQueue->recycle(buffer);
+            break;
+        }
+
+        // 这里是一个模拟实现，实际应该把样本写入UHD发送流
+        if (sendCallback && buffer->length > 0) {
+            sendCallback(buffer->data, buffer->length, start);
+        }
+        sentBuffers.fetch_add(1);
+        sentSamples.fetch_add(buffer->length);
+
+        cursor = start + buffer->length;
+        streamCursor.store(cursor);
+        inBurst = !buffer->endOfBurst;
+        transmitQueue->recycle(buffer);
+
+        // 模拟空中时间: 设备发完这个缓冲区前不接收下一个
+        if (paced && !waitUntil(timeOf(cursor))) {
+            break;
+        }
+    }
+
+    LOG_INFO("流式发送线程结束");
+}
+
+// 把样本复制到发送缓冲区并提交
+bool USRPTransmitter::submitSamples(const std::complex<float>* samples, size_t numSamples, bool endOfBurst) {
+    size_t offset = 0;
+    do {
+        // 没有空闲缓冲区时等待发送线程归还
+        TxBuffer* buffer = nullptr;
+        while (!buffer && streamingRunning) {
+            buffer = transmitQueue->acquire(stream_wait_timeout);
+        }
+        if (!buffer) {
+            return false;
+        }
+
+        const size_t length = std::min(numSamples - offset, buffer->capacity);
+        std::copy(samples + offset, samples + offset + length, buffer->data);
+        offset += length;
+        if (!submit(buffer, length, TransmitQueue::asap, endOfBurst && offset == numSamples)) {
+            return false;
+        }
+    } while (offset < numSamples);
+    return true;
+}
+
+// 可被停止打断的等待
+bool USRPTransmitter::waitUntil(std::chrono::steady_clock::time_point deadline) {
+    std::unique_lock<std::mutex> lock(deviceMutex);
+    return !stopCondition.wait_until(lock, deadline, [this] { return !streamingRunning; });
+}
+
 } // namespace hardware
 } // namespace physical
 } // namespace link16
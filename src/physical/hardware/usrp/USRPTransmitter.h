@@ -1,5 +1,6 @@
 #pragma once
 #include "USRPInterface.h"
+#include "TransmitQueue.h"
 #include <vector>
 #include <complex>
 #include <string>
@@ -8,6 +9,8 @@
 #include <condition_variable>
 #include <functional>
 #include <atomic>
+#include <chrono>
+#include <memory>
 
 namespace link16 {
 namespace physical {
@@ -15,6 +18,15 @@ namespace hardware {
 
 class USRPTransmitter : public USRPInterface {
 public:
+    /**
+     * 模拟设备的发送回调，在发送线程中对每个缓冲区调用
+     * timestamp: 第一个样本的实际发送时刻(设备样本计数)
+     */
+    typedef std::function<void(const std::complex<float>* samples, size_t length, uint64_t timestamp)> SendCallback;
+
+    // Link16时隙长度(纳秒)
+    static const uint64_t default_slot_length_ns = 7812500;
+
     // 构造函数
     USRPTransmitter();
 
@@ -39,7 +51,25 @@ public:
 
     // 发送器特有方法
 
-    // 发送复数样本
+    // 设置发送频率
+    bool setTxFrequency(double freq);
+
+    // 获取发送频率
+    double getTxFrequency() const;
+
+    // 设置发送增益
+    bool setTxGain(double gain);
+
+    // 获取发送增益
+    double getTxGain() const;
+
+    // 设置发送天线
+    bool setTxAntenna(const std::string& antenna);
+
+    // 获取发送天线
+    std::string getTxAntenna() const;
+
+    // 发送复数样本，流式发送时复制到缓冲池后立即返回，否则阻塞到发送完成
     bool transmit(const std::vector<std::complex<float>>& samples);
 
     // 发送实数样本
@@ -54,10 +84,95 @@ public:
     // 获取发送通道
     size_t getTxChannel() const;
 
-    // 启动连续发送
+    /**
+     * @brief 设置发送缓冲池，流式发送时不能修改
+     * @param bufferSize 每个缓冲区的样本数
+     * @param bufferCount 缓冲区个数
+     */
+    bool setTransmitQueue(size_t bufferSize, size_t bufferCount);
+
+    // 设置模拟设备的发送回调，流式发送时不能修改
+    bool setSendCallback(SendCallback callback);
+
+    /**
+     * @brief 设置是否按采样率实时发送，流式发送时不能修改
+     *
+     * 默认实时: 每个缓冲区在发送时刻交给设备并占用其空中时间，断流计为欠载。
+     * 非实时时设备时间等于已发送的样本数，不等待也不计欠载，用于写文件测吞吐量。
+     */
+    bool setRealTime(bool enable);
+
+    // 是否按采样率实时发送
+    bool isRealTime() const;
+
+    /**
+     * @brief 启动流式发送线程
+     *
+     * 当前时刻为设备时间0。发送线程按提交顺序发送缓冲区，突发中的缓冲区首尾相接。
+     */
+    bool startStreaming();
+
+    // 停止流式发送，丢弃未发送的缓冲区
+    void stopStreaming();
+
+    // 是否正在流式发送
+    bool isStreaming() const;
+
+    /**
+     * @brief 取得空闲的发送缓冲区，在调用者线程中填充样本
+     * @param timeout 没有空闲缓冲区时的最长等待时间
+     * @return 缓冲区，超时或未在流式发送时为空指针
+     */
+    TxBuffer* acquireBuffer(std::chrono::nanoseconds timeout = std::chrono::seconds(1));
+
+    // 归还未提交的缓冲区
+    void releaseBuffer(TxBuffer* buffer);
+
+    /**
+     * @brief 提交缓冲区，立即返回
+     * @param buffer acquireBuffer()取得的缓冲区
+     * @param length 样本数
+     * @param timestamp 发送时刻(设备样本计数)，TransmitQueue::asap表示尽快发送
+     * @param endOfBurst 是否为突发的最后一个缓冲区
+     * @return 是否提交，失败时缓冲区已归还
+     */
+    bool submit(TxBuffer* buffer, size_t length, uint64_t timestamp = TransmitQueue::asap, bool endOfBurst = true);
+
+    /**
+     * @brief 提交缓冲区在时隙开始时发送
+     * @param slot 时隙号，时隙n从设备时间n * slotLength开始
+     * @param slotLength 时隙长度(纳秒)
+     */
+    bool submitAtSlot(TxBuffer* buffer, size_t length, uint64_t slot, uint64_t slotLength = default_slot_length_ns);
+
+    /**
+     * @brief 等待已提交的缓冲区都交给设备
+     * @return 超时时为false
+     */
+    bool flush(std::chrono::nanoseconds timeout);
+
+    // 当前设备时间(样本计数)
+    uint64_t getDeviceTime() const;
+
+    // 设备时间0对应的时刻，可作为TdmaScheduler的起点
+    std::chrono::steady_clock::time_point getStreamEpoch() const;
+
+    // 突发中下一个缓冲区没有及时提交的次数
+    uint64_t getUnderrunCount() const;
+
+    // 提交时已错过发送时刻而被丢弃的缓冲区个数
+    uint64_t getLateCount() const;
+
+    // 已发送的缓冲区个数
+    uint64_t getSentBuffers() const;
+
+    // 已发送的样本数
+    uint64_t getSentSamples() const;
+
+    // 启动连续发送，在流式发送线程中重复发送samples，repeatCount为0时一直发送
     bool startContinuousTransmit(const std::vector<std::complex<float>>& samples, size_t repeatCount = 0);
 
-    // 停止连续发送
+    // 停止连续发送，已提交的缓冲区仍会发出，流式发送继续运行
     void stopContinuousTransmit();
 
     // 设置发送功率
@@ -87,9 +202,29 @@ private:
     bool initialized;
     std::atomic<bool> continuousTransmitRunning;
 
-    // 发送线程
+    // 连续发送线程，向发送队列重复提交transmitBuffer
     std::thread transmitThread;
 
+    // 流式发送线程，从发送队列取出缓冲区交给设备
+    std::thread streamThread;
+    std::atomic<bool> streamingRunning;
+    std::chrono::steady_clock::time_point streamEpoch;
+    double streamSampleRate;
+    bool realTime;
+
+    // 非实时发送时的设备时间，只由流式发送线程修改
+    std::atomic<uint64_t> streamCursor;
+
+    // 发送缓冲池和待发送队列
+    std::unique_ptr<TransmitQueue> transmitQueue;
+    SendCallback sendCallback;
+
+    // 发送统计，只由流式发送线程累加
+    std::atomic<uint64_t> underrunCount;
+    std::atomic<uint64_t> lateCount;
+    std::atomic<uint64_t> sentBuffers;
+    std::atomic<uint64_t> sentSamples;
+
     // 互斥锁
     std::mutex deviceMutex;
 
@@ -102,6 +237,15 @@ private:
 
     // 连续发送线程函数
     void continuousTransmitThread();
+
+    // 流式发送线程函数
+    void streamTransmitThread();
+
+    // 把样本复制到发送缓冲区并提交，返回是否全部提交
+    bool submitSamples(const std::complex<float>* samples, size_t numSamples, bool endOfBurst);
+
+    // 可被停止打断的等待，返回是否仍在流式发送
+    bool waitUntil(std::chrono::steady_clock::time_point deadline);
 };
 
 } // namespace hardware
@@ -9,7 +9,8 @@ namespace modulation {
 
 // 构造函数
 BPSKModulator::BPSKModulator()
-    : sampleRate(1.0e6), symbolRate(1.0e5), samplesPerSymbol(10), filterLength(32) {
+    : sampleRate(1.0e6), symbolRate(1.0e5), samplesPerSymbol(10), filterLength(32), noiseVariance(1.0) {
+    updatePulseShaper();
 }
 
 // 析构函数
@@ -25,71 +26,141 @@ bool BPSKModulator::initialize() {
     symbolRate = 1.0e5;     // 100kHz
     samplesPerSymbol = 10;  // 每符号10个样本
     filterLength = 32;      // 32点滤波器
+    updatePulseShaper();
     
     return true;
 }
 
 // 调制二进制数据
 std::vector<std::complex<double>> BPSKModulator::modulate(const std::string& bits) {
-    LOG_INFO("BPSK调制: " + std::to_string(bits.length()) + " 位");
-    
-    // 生成基带信号
-    std::vector<std::complex<double>> baseband;
-    baseband.reserve(bits.length() * samplesPerSymbol);
-    
+    // '0'映射为-1，其他字符映射为+1
+    BitBuffer packed;
+    packed.reserve(bits.length());
     for (char bit : bits) {
-        double amplitude = (bit == '0') ? -1.0 : 1.0;
-        
-        // 每个符号生成多个样本
-        for (int i = 0; i < samplesPerSymbol; ++i) {
-            baseband.push_back(std::complex<double>(amplitude, 0.0));
-        }
+        packed.pushBack(bit != '0');
     }
+    return modulate(packed.span());
+}
+
+// 调制二进制数据(打包比特版本)
+std::vector<std::complex<double>> BPSKModulator::modulate(const BitSpan& bits) {
+    LOG_INFO("BPSK调制: " + std::to_string(bits.size()) + " 位");
     
-    // 应用脉冲整形滤波器
-    std::vector<double> filter = generatePulseShapingFilter();
-    std::vector<std::complex<double>> filteredSignal = applyFilter(baseband, filter);
+    std::vector<std::complex<double>> signal(getModulatedLength(bits.size()));
+    signal.resize(modulate(bits, signal.data(), signal.size()));
+    return signal;
+}
+
+// 调制打包比特，输出写入调用者提供的缓冲区
+size_t BPSKModulator::modulate(const BitSpan& bits, std::complex<double>* output, size_t capacity) {
+    if (!pulseShaper.isConfigured()) {
+        LOG_ERROR("每符号样本数无效: " + std::to_string(samplesPerSymbol));
+        return 0;
+    }
     
-    return filteredSignal;
+    const size_t length = getModulatedLength(bits.size());
+    if (capacity < length) {
+        LOG_ERROR("BPSK输出缓冲区容量不足: " + std::to_string(capacity) + " < " + std::to_string(length));
+        return 0;
+    }
+    
+    return pulseShaper.shape(bits, 1, output);
+}
+
+// 调制numBits个比特产生的样本数
+size_t BPSKModulator::getModulatedLength(size_t numBits) const {
+    return pulseShaper.getOutputLength(numBits);
 }
 
 // 解调复数信号
 std::string BPSKModulator::demodulate(const std::vector<std::complex<double>>& signal) {
+    std::vector<double> llr = demodulateSoft(signal);
+    
+    // 按LLR符号硬判决
+    std::string bits;
+    bits.reserve(llr.size());
+    for (double value : llr) {
+        bits.push_back(value > 0.0 ? '1' : '0');
+    }
+    return bits;
+}
+
+// 解调复数信号(打包比特版本)
+bool BPSKModulator::demodulate(const std::vector<std::complex<double>>& signal, BitBuffer& bits) {
+    bits.clear();
+    
+    std::vector<double> llr = demodulateSoft(signal);
+    if (llr.empty()) {
+        return false;
+    }
+    
+    // 按LLR符号硬判决，每64个符号写入一个字
+    bits.reserve(llr.size());
+    uint64_t word = 0;
+    int count = 0;
+    for (double value : llr) {
+        word = (word << 1) | (value > 0.0 ? 1 : 0);
+        if (++count == 64) {
+            bits.append(word, 64);
+            word = 0;
+            count = 0;
+        }
+    }
+    bits.append(word, count);
+    
+    return true;
+}
+
+// 软解调复数信号
+std::vector<double> BPSKModulator::demodulateSoft(const std::vector<std::complex<double>>& signal) {
     LOG_INFO("BPSK解调: " + std::to_string(signal.size()) + " 个样本");
     
     if (signal.empty()) {
         LOG_ERROR("信号为空，无法解调");
-        return "";
+        return std::vector<double>();
     }
     
-    // 计算每个符号的样本数
-    if (samplesPerSymbol <= 0) {
+    std::vector<double> llr(getDemodulatedLength(signal.size()));
+    llr.resize(demodulateSoft(signal.data(), signal.size(), llr.data(), llr.size()));
+    return llr;
+}
+
+// 软解调，LLR写入调用者提供的缓冲区
+size_t BPSKModulator::demodulateSoft(const std::complex<double>* signal, size_t length, double* llr,
+                                       size_t capacity) {
+    if (!pulseShaper.isConfigured()) {
         LOG_ERROR("每符号样本数无效: " + std::to_string(samplesPerSymbol));
-        return "";
+        return 0;
     }
     
-    // 估计符号数量
-    size_t numSymbols = signal.size() / samplesPerSymbol;
-    
-    // 解调
-    std::string bits;
-    bits.reserve(numSymbols);
-    
-    for (size_t i = 0; i < numSymbols; ++i) {
-        // 计算符号中心位置
-        size_t centerIndex = i * samplesPerSymbol + samplesPerSymbol / 2;
-        
-        // 确保索引有效
-        if (centerIndex >= signal.size()) {
-            break;
-        }
-        
-        // 判断符号
-        double realPart = std::real(signal[centerIndex]);
-        bits.push_back((realPart < 0.0) ? '0' : '1');
+    const size_t count = getDemodulatedLength(length);
+    if (capacity < count) {
+        LOG_ERROR("BPSKLLR缓冲区容量不足: " + std::to_string(capacity) + " < " + std::to_string(count));
+        return 0;
     }
     
-    return bits;
+    // 积分结果y = A*a + n，n每维方差为sps*N0/2，LLR = 4*A*y/(sps*N0)
+    const double scale = 4.0 * pulseShaper.getIntegrationGain() / (samplesPerSymbol * noiseVariance);
+    return pulseShaper.integrate(signal, length, 1, scale, llr);
+}
+
+// length个样本软解调得到的LLR个数，每个比特一个LLR
+size_t BPSKModulator::getDemodulatedLength(size_t length) const {
+    return pulseShaper.getSymbolCount(length) * 1;
+}
+
+// 设置噪声方差
+void BPSKModulator::setNoiseVariance(double variance) {
+    if (variance <= 0.0) {
+        LOG_ERROR("噪声方差无效: " + std::to_string(variance));
+        return;
+    }
+    noiseVariance = variance;
+}
+
+// 获取噪声方差
+double BPSKModulator::getNoiseVariance() const {
+    return noiseVariance;
 }
 
 // 设置采样率
@@ -111,6 +182,7 @@ void BPSKModulator::setSymbolRate(double rate) {
     // 更新每符号样本数
     samplesPerSymbol = static_cast<int>(sampleRate / symbolRate);
     LOG_INFO("更新每符号样本数: " + std::to_string(samplesPerSymbol));
+    updatePulseShaper();
 }
 
 // 获取符号率
@@ -126,6 +198,7 @@ void BPSKModulator::setSamplesPerSymbol(int samples) {
     // 更新符号率
     symbolRate = sampleRate / samplesPerSymbol;
     LOG_INFO("更新符号率: " + std::to_string(symbolRate) + " Hz");
+    updatePulseShaper();
 }
 
 // 获取每符号样本数
@@ -137,6 +210,7 @@ int BPSKModulator::getSamplesPerSymbol() const {
 void BPSKModulator::setFilterLength(int length) {
     filterLength = length;
     LOG_INFO("设置滤波器长度: " + std::to_string(length));
+    updatePulseShaper();
 }
 
 // 获取滤波器长度
@@ -185,28 +259,13 @@ std::vector<double> BPSKModulator::generatePulseShapingFilter() const {
     return filter;
 }
 
-// 应用脉冲整形滤波器
-std::vector<std::complex<double>> BPSKModulator::applyFilter(const std::vector<std::complex<double>>& signal, const std::vector<double>& filter) const {
-    if (signal.empty() || filter.empty()) {
-        return signal;
+// 按当前参数重新计算整形滤波器和符号波形表
+void BPSKModulator::updatePulseShaper() {
+    std::vector<double> filter;
+    if (samplesPerSymbol > 0 && filterLength > 0) {
+        filter = generatePulseShapingFilter();
     }
-    
-    // 卷积
-    std::vector<std::complex<double>> filteredSignal(signal.size() + filter.size() - 1);
-    
-    for (size_t i = 0; i < filteredSignal.size(); ++i) {
-        std::complex<double> sum(0.0, 0.0);
-        
-        for (size_t j = 0; j < filter.size(); ++j) {
-            if (i >= j && i - j < signal.size()) {
-                sum += signal[i - j] * filter[j];
-            }
-        }
-        
-        filteredSignal[i] = sum;
-    }
-    
-    return filteredSignal;
+    pulseShaper.configure(filter, samplesPerSymbol);
 }
 
 } // namespace modulation
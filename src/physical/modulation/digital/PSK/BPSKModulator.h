@@ -2,6 +2,8 @@
 #include <vector>
 #include <complex>
 #include <string>
+#include "core/types/BitBuffer.h"
+#include "PulseShaper.h"
 
 namespace link16 {
 namespace physical {
@@ -21,9 +23,49 @@ public:
     // 调制二进制数据
     std::vector<std::complex<double>> modulate(const std::string& bits);
     
+    // 调制二进制数据(打包比特版本)
+    std::vector<std::complex<double>> modulate(const BitSpan& bits);
+    
+    /**
+     * @brief 调制打包比特，输出写入调用者提供的缓冲区
+     * @param bits 比特
+     * @param output 输出
+     * @param capacity 输出缓冲区容量，不小于getModulatedLength(bits.size())
+     * @return 输出样本数，容量不足时为0
+     */
+    size_t modulate(const BitSpan& bits, std::complex<double>* output, size_t capacity);
+    
+    // 调制numBits个比特产生的样本数(含滤波器拖尾)
+    size_t getModulatedLength(size_t numBits) const;
+    
     // 解调复数信号
     std::string demodulate(const std::vector<std::complex<double>>& signal);
     
+    // 解调复数信号(打包比特版本)，结果写入bits
+    bool demodulate(const std::vector<std::complex<double>>& signal, BitBuffer& bits);
+    
+    // 软解调复数信号，每个比特一个LLR(正值为1)
+    std::vector<double> demodulateSoft(const std::vector<std::complex<double>>& signal);
+    
+    /**
+     * @brief 软解调，对每个符号积分一个符号周期后换算为LLR
+     * @param signal 接收信号，与modulate的输出对齐
+     * @param length 信号样本数
+     * @param llr 输出LLR，每个比特一个LLR
+     * @param capacity 输出缓冲区容量，不小于getDemodulatedLength(length)
+     * @return LLR个数，容量不足时为0
+     */
+    size_t demodulateSoft(const std::complex<double>* signal, size_t length, double* llr, size_t capacity);
+    
+    // length个样本软解调得到的LLR个数(只计完整包含在信号中的符号)
+    size_t getDemodulatedLength(size_t length) const;
+    
+    // 设置噪声方差(每个复样本的E|n|^2)，用于换算LLR
+    void setNoiseVariance(double variance);
+    
+    // 获取噪声方差
+    double getNoiseVariance() const;
+    
     // 设置采样率
     void setSampleRate(double rate);
     
@@ -61,11 +103,17 @@ private:
     // 滤波器长度
     int filterLength;
     
+    // 噪声方差
+    double noiseVariance;
+    
     // 生成脉冲整形滤波器
     std::vector<double> generatePulseShapingFilter() const;
     
-    // 应用脉冲整形滤波器
-    std::vector<std::complex<double>> applyFilter(const std::vector<std::complex<double>>& signal, const std::vector<double>& filter) const;
+    // 按当前参数重新计算整形滤波器和符号波形表
+    void updatePulseShaper();
+    
+    // 缓存的脉冲整形查找表
+    PulseShaper pulseShaper;
 };
 
 } // namespace modulation
@@ -0,0 +1,234 @@
+#include "PulseShaper.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace link16 {
+namespace physical {
+namespace modulation {
+
+namespace {
+
+// 第symbol个符号在指定支路上的比特，超出比特序列的部分按0处理
+inline bool symbolBit(const BitSpan& bits, int bitsPerSymbol, size_t symbol, int branch) {
+    const size_t pos = symbol * bitsPerSymbol + branch;
+    return pos < bits.size() && bits[pos];
+}
+
+} // namespace
+
+// 构造函数
+PulseShaper::PulseShaper()
+    : samplesPerSymbol(0), pulseLength(0), integrationDelay(0), integrationGain(0.0), patternSymbols(0),
+      tableGroups(0) {
+}
+
+// 预先计算符号波形和图样表
+bool PulseShaper::configure(const std::vector<double>& filter, int samplesPerSymbol) {
+    if (samplesPerSymbol <= 0) {
+        this->samplesPerSymbol = 0;
+        tableGroups = 0;
+        symbolPulse.clear();
+        patternTable.clear();
+        return false;
+    }
+
+    const size_t sps = static_cast<size_t>(samplesPerSymbol);
+    const std::vector<double> taps = filter.empty() ? std::vector<double>(1, 1.0) : filter;
+
+    // 单个符号的波形：长度为sps的矩形脉冲与滤波器的卷积
+    this->samplesPerSymbol = sps;
+    pulseLength = sps + taps.size() - 1;
+    patternSymbols = (pulseLength + sps - 1) / sps;
+    symbolPulse.assign(patternSymbols * sps, 0.0);
+    for (size_t i = 0; i < sps; ++i) {
+        for (size_t j = 0; j < taps.size(); ++j) {
+            symbolPulse[i + j] += taps[j];
+        }
+    }
+
+    // 积分窗口从滤波器中心开始，覆盖单个符号波形的主瓣
+    integrationDelay = filter.empty() ? 0 : filter.size() / 2;
+    integrationGain = 0.0;
+    for (size_t i = 0; i < sps; ++i) {
+        integrationGain += symbolPulse[integrationDelay + i];
+    }
+
+    // 每组的第pattern行为组内各符号按pattern取±1后的波形段之和
+    tableGroups = 0;
+    patternTable.clear();
+    if (patternSymbols <= static_cast<size_t>(max_table_symbols)) {
+        const size_t rows = static_cast<size_t>(1) << table_group_symbols;
+        tableGroups = (patternSymbols + table_group_symbols - 1) / table_group_symbols;
+        patternTable.assign(tableGroups * rows * sps, 0.0);
+        for (size_t g = 0; g < tableGroups; ++g) {
+            const size_t first = g * table_group_symbols;
+            const size_t count = std::min<size_t>(table_group_symbols, patternSymbols - first);
+            for (size_t pattern = 0; pattern < rows; ++pattern) {
+                double* row = &patternTable[(g * rows + pattern) * sps];
+                for (size_t d = 0; d < count; ++d) {
+                    const double amplitude = ((pattern >> d) & 1) ? 1.0 : -1.0;
+                    const double* segment = &symbolPulse[(first + d) * sps];
+                    for (size_t i = 0; i < sps; ++i) {
+                        row[i] += amplitude * segment[i];
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// 是否已配置
+bool PulseShaper::isConfigured() const {
+    return samplesPerSymbol > 0;
+}
+
+// numSymbols个符号整形后的样本数
+size_t PulseShaper::getOutputLength(size_t numSymbols) const {
+    if (numSymbols == 0 || samplesPerSymbol == 0) {
+        return 0;
+    }
+    return (numSymbols - 1) * samplesPerSymbol + pulseLength;
+}
+
+// 整形并写入output
+size_t PulseShaper::shape(const BitSpan& bits, int bitsPerSymbol, std::complex<double>* output) const {
+    if (samplesPerSymbol == 0 || (bitsPerSymbol != 1 && bitsPerSymbol != 2)) {
+        return 0;
+    }
+
+    const size_t numSymbols = (bits.size() + bitsPerSymbol - 1) / bitsPerSymbol;
+    const size_t total = getOutputLength(numSymbols);
+    if (total == 0) {
+        return 0;
+    }
+
+    const size_t sps = samplesPerSymbol;
+    const size_t segments = numSymbols - 1 + patternSymbols;
+    const size_t rows = static_cast<size_t>(1) << table_group_symbols;
+    const uint64_t rowMask = rows - 1;
+    const bool quadrature = bitsPerSymbol == 2;
+
+    // 按复数交错存放的实部和虚部
+    double* out = reinterpret_cast<double*>(output);
+
+    // 最近D个符号的比特，第d位为前第d个符号
+    uint64_t patternI = 0;
+    uint64_t patternQ = 0;
+    for (size_t j = 0; j < segments; ++j) {
+        const size_t offset = j * sps;
+        const size_t length = std::min(sps, total - offset);
+        double* segment = out + 2 * offset;
+
+        if (j < numSymbols) {
+            patternI = (patternI << 1) | (symbolBit(bits, bitsPerSymbol, j, 0) ? 1 : 0);
+            if (quadrature) {
+                patternQ = (patternQ << 1) | (symbolBit(bits, bitsPerSymbol, j, 1) ? 1 : 0);
+            }
+        }
+
+        // 最近D个符号都存在时按组查表
+        if (tableGroups == 0 || j + 1 < patternSymbols || j >= numSymbols) {
+            shapeSegment(bits, bitsPerSymbol, numSymbols, j, length, segment);
+            continue;
+        }
+
+        const double* rowI = &patternTable[(patternI & rowMask) * sps];
+        if (quadrature) {
+            const double* rowQ = &patternTable[(patternQ & rowMask) * sps];
+            for (size_t i = 0; i < sps; ++i) {
+                segment[2 * i] = rowI[i];
+                segment[2 * i + 1] = rowQ[i];
+            }
+        } else {
+            for (size_t i = 0; i < sps; ++i) {
+                segment[2 * i] = rowI[i];
+                segment[2 * i + 1] = 0.0;
+            }
+        }
+
+        for (size_t g = 1; g < tableGroups; ++g) {
+            const size_t shift = g * table_group_symbols;
+            rowI = &patternTable[(g * rows + ((patternI >> shift) & rowMask)) * sps];
+            for (size_t i = 0; i < sps; ++i) {
+                segment[2 * i] += rowI[i];
+            }
+            if (quadrature) {
+                const double* rowQ = &patternTable[(g * rows + ((patternQ >> shift) & rowMask)) * sps];
+                for (size_t i = 0; i < sps; ++i) {
+                    segment[2 * i + 1] += rowQ[i];
+                }
+            }
+        }
+    }
+    return total;
+}
+
+// 长度为length的信号中完整包含的符号数
+size_t PulseShaper::getSymbolCount(size_t length) const {
+    if (samplesPerSymbol == 0 || length < pulseLength) {
+        return 0;
+    }
+    return (length - pulseLength) / samplesPerSymbol + 1;
+}
+
+// 无噪声时积分一个符号得到的幅度
+double PulseShaper::getIntegrationGain() const {
+    return integrationGain;
+}
+
+// 逐符号积分
+size_t PulseShaper::integrate(const std::complex<double>* signal, size_t length, int bitsPerSymbol, double scale,
+                              double* output) const {
+    if (bitsPerSymbol != 1 && bitsPerSymbol != 2) {
+        return 0;
+    }
+
+    const size_t sps = samplesPerSymbol;
+    const size_t numSymbols = getSymbolCount(length);
+    const double* samples = reinterpret_cast<const double*>(signal);
+    for (size_t k = 0; k < numSymbols; ++k) {
+        const double* window = samples + 2 * (k * sps + integrationDelay);
+        double inPhase = 0.0;
+        double quadrature = 0.0;
+        for (size_t i = 0; i < sps; ++i) {
+            inPhase += window[2 * i];
+            quadrature += window[2 * i + 1];
+        }
+        if (bitsPerSymbol == 2) {
+            output[2 * k] = scale * inPhase;
+            output[2 * k + 1] = scale * quadrature;
+        } else {
+            output[k] = scale * inPhase;
+        }
+    }
+    return numSymbols * bitsPerSymbol;
+}
+
+// 叠加各符号的波形段计算第segment个符号周期
+void PulseShaper::shapeSegment(const BitSpan& bits, int bitsPerSymbol, size_t numSymbols, size_t segment,
+                               size_t length, double* output) const {
+    const size_t sps = samplesPerSymbol;
+    std::fill(output, output + 2 * length, 0.0);
+
+    // 对本周期有贡献的符号为segment-D+1到segment中存在的部分
+    const size_t first = segment + 1 >= patternSymbols ? segment + 1 - patternSymbols : 0;
+    const size_t last = std::min(segment, numSymbols - 1);
+    for (size_t k = first; k <= last; ++k) {
+        const double* pulse = &symbolPulse[(segment - k) * sps];
+        const double amplitudeI = symbolBit(bits, bitsPerSymbol, k, 0) ? 1.0 : -1.0;
+        for (size_t i = 0; i < length; ++i) {
+            output[2 * i] += amplitudeI * pulse[i];
+        }
+        if (bitsPerSymbol == 2) {
+            const double amplitudeQ = symbolBit(bits, bitsPerSymbol, k, 1) ? 1.0 : -1.0;
+            for (size_t i = 0; i < length; ++i) {
+                output[2 * i + 1] += amplitudeQ * pulse[i];
+            }
+        }
+    }
+}
+
+} // namespace modulation
+} // namespace physical
+} // namespace link16
@@ -0,0 +1,109 @@
+#pragma once
+#include <vector>
+#include <complex>
+#include <cstddef>
+#include "core/types/BitBuffer.h"
+
+namespace link16 {
+namespace physical {
+namespace modulation {
+
+/**
+ * @brief 查表实现的PSK脉冲整形
+ *
+ * 等价于把幅度为±1的符号各重复samplesPerSymbol次后与整形滤波器卷积。
+ * 单个符号的波形p(矩形脉冲与滤波器的卷积)跨越D个符号周期，
+ * 第j个符号周期的输出只取决于最近D个符号。把这D个符号按table_group_symbols个一组，
+ * 每组的比特图样对应一行预先计算好的波形段(已叠加组内各符号的拖尾)，
+ * 调制时每个符号周期只需复制一行并累加其余各组的行。
+ * 序列首尾不足D个符号的周期以及D超过max_table_symbols时逐个叠加各符号的波形段。
+ *
+ * 解调时对每个符号以滤波器中心为起点积分一个符号周期(积分-清除匹配滤波)，
+ * 得到的判决量保留幅度信息，可换算为比特LLR。
+ */
+class PulseShaper {
+public:
+    // 每组符号数，每组的表有2^table_group_symbols行
+    static const int table_group_symbols = 8;
+
+    // 可以查表的最大波形跨度D(符号数)
+    static const int max_table_symbols = 64;
+
+    // 构造函数
+    PulseShaper();
+
+    /**
+     * @brief 预先计算符号波形和图样表
+     * @param filter 整形滤波器系数，为空时不滤波(矩形脉冲)
+     * @param samplesPerSymbol 每符号样本数
+     * @return 参数是否有效
+     */
+    bool configure(const std::vector<double>& filter, int samplesPerSymbol);
+
+    // 是否已配置
+    bool isConfigured() const;
+
+    // numSymbols个符号整形后的样本数(含滤波器拖尾)
+    size_t getOutputLength(size_t numSymbols) const;
+
+    /**
+     * @brief 整形并写入output
+     * @param bits 比特，1映射为+1，0映射为-1
+     * @param bitsPerSymbol 1为BPSK(虚部为0)，2为QPSK(偶数位为同相、奇数位为正交支路，缺少的末位按0处理)
+     * @param output 输出，至少getOutputLength(符号数)个样本
+     * @return 输出样本数
+     */
+    size_t shape(const BitSpan& bits, int bitsPerSymbol, std::complex<double>* output) const;
+
+    // 长度为length的信号中完整包含的符号数，与shape的输出长度互逆
+    size_t getSymbolCount(size_t length) const;
+
+    // 无噪声时积分一个符号得到的幅度(窗口内单个符号波形之和)
+    double getIntegrationGain() const;
+
+    /**
+     * @brief 逐符号积分
+     * @param signal 接收信号
+     * @param length 信号样本数
+     * @param bitsPerSymbol 1为BPSK(只输出实部)，2为QPSK(依次输出实部和虚部)
+     * @param scale 积分结果的缩放系数
+     * @param output 输出，至少getSymbolCount(length) * bitsPerSymbol个
+     * @return 输出个数
+     */
+    size_t integrate(const std::complex<double>* signal, size_t length, int bitsPerSymbol, double scale,
+                     double* output) const;
+
+private:
+    // 叠加各符号的波形段计算第segment个符号周期，不查表
+    void shapeSegment(const BitSpan& bits, int bitsPerSymbol, size_t numSymbols, size_t segment,
+                      size_t length, double* output) const;
+
+    // 每符号样本数
+    size_t samplesPerSymbol;
+
+    // 单个+1符号的波形，补零到patternSymbols个符号周期
+    std::vector<double> symbolPulse;
+
+    // 单个符号波形的真实长度
+    size_t pulseLength;
+
+    // 积分窗口相对符号起点的偏移(滤波器中心)
+    size_t integrationDelay;
+
+    // 积分窗口内单个符号波形之和
+    double integrationGain;
+
+    // 单个符号波形跨越的符号周期数D
+    size_t patternSymbols;
+
+    // 分组数，为0时不查表
+    size_t tableGroups;
+
+    // 各组的图样表依次存放，每组2^table_group_symbols行、samplesPerSymbol列；
+    // 第g组第pattern行为前g*table_group_symbols+d个符号(pattern的第d位)在一个符号周期内的输出之和
+    std::vector<double> patternTable;
+};
+
+} // namespace modulation
+} // namespace physical
+} // namespace link16
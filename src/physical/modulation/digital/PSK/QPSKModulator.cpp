@@ -9,7 +9,8 @@ namespace modulation {
 
 // 构造函数
 QPSKModulator::QPSKModulator()
-    : sampleRate(1.0e6), symbolRate(5.0e4), samplesPerSymbol(20), filterLength(32) {
+    : sampleRate(1.0e6), symbolRate(5.0e4), samplesPerSymbol(20), filterLength(32), noiseVariance(1.0) {
+    updatePulseShaper();
 }
 
 // 析构函数
@@ -25,72 +26,115 @@ bool QPSKModulator::initialize() {
     symbolRate = 5.0e4;     // 50kHz
     samplesPerSymbol = 20;  // 每符号20个样本
     filterLength = 32;      // 32点滤波器
+    updatePulseShaper();
     
     return true;
 }
 
 // 调制二进制数据
 std::vector<std::complex<double>> QPSKModulator::modulate(const std::string& bits) {
-    LOG_INFO("QPSK调制: " + std::to_string(bits.length()) + " 位");
-    
-    // 将二进制数据转换为符号
-    std::vector<std::complex<double>> symbols = bitsToSymbols(bits);
-    
-    // 生成基带信号
-    std::vector<std::complex<double>> baseband;
-    baseband.reserve(symbols.size() * samplesPerSymbol);
+    // '0'映射为-1，其他字符映射为+1
+    BitBuffer packed;
+    packed.reserve(bits.length());
+    for (char bit : bits) {
+        packed.pushBack(bit != '0');
+    }
+    return modulate(packed.span());
+}
+
+// 调制二进制数据(打包比特版本)
+std::vector<std::complex<double>> QPSKModulator::modulate(const BitSpan& bits) {
+    LOG_INFO("QPSK调制: " + std::to_string(bits.size()) + " 位");
     
-    for (const auto& symbol : symbols) {
-        // 每个符号生成多个样本
-        for (int i = 0; i < samplesPerSymbol; ++i) {
-            baseband.push_back(symbol);
-        }
+    std::vector<std::complex<double>> signal(getModulatedLength(bits.size()));
+    signal.resize(modulate(bits, signal.data(), signal.size()));
+    return signal;
+}
+
+// 调制打包比特，输出写入调用者提供的缓冲区
+size_t QPSKModulator::modulate(const BitSpan& bits, std::complex<double>* output, size_t capacity) {
+    if (!pulseShaper.isConfigured()) {
+        LOG_ERROR("每符号样本数无效: " + std::to_string(samplesPerSymbol));
+        return 0;
     }
     
-    // 应用脉冲整形滤波器
-    std::vector<double> filter = generatePulseShapingFilter();
-    std::vector<std::complex<double>> filteredSignal = applyFilter(baseband, filter);
+    const size_t length = getModulatedLength(bits.size());
+    if (capacity < length) {
+        LOG_ERROR("QPSK输出缓冲区容量不足: " + std::to_string(capacity) + " < " + std::to_string(length));
+        return 0;
+    }
     
-    return filteredSignal;
+    return pulseShaper.shape(bits, 2, output);
+}
+
+// 调制numBits个比特产生的样本数，每2位一个符号
+size_t QPSKModulator::getModulatedLength(size_t numBits) const {
+    return pulseShaper.getOutputLength((numBits + 1) / 2);
 }
 
 // 解调复数信号
 std::string QPSKModulator::demodulate(const std::vector<std::complex<double>>& signal) {
+    std::vector<double> llr = demodulateSoft(signal);
+    
+    // 按LLR符号硬判决
+    std::string bits;
+    bits.reserve(llr.size());
+    for (double value : llr) {
+        bits.push_back(value > 0.0 ? '1' : '0');
+    }
+    return bits;
+}
+
+// 软解调复数信号
+std::vector<double> QPSKModulator::demodulateSoft(const std::vector<std::complex<double>>& signal) {
     LOG_INFO("QPSK解调: " + std::to_string(signal.size()) + " 个样本");
     
     if (signal.empty()) {
         LOG_ERROR("信号为空，无法解调");
-        return "";
+        return std::vector<double>();
     }
     
-    // 计算每个符号的样本数
-    if (samplesPerSymbol <= 0) {
+    std::vector<double> llr(getDemodulatedLength(signal.size()));
+    llr.resize(demodulateSoft(signal.data(), signal.size(), llr.data(), llr.size()));
+    return llr;
+}
+
+// 软解调，LLR写入调用者提供的缓冲区
+size_t QPSKModulator::demodulateSoft(const std::complex<double>* signal, size_t length, double* llr,
+                                       size_t capacity) {
+    if (!pulseShaper.isConfigured()) {
         LOG_ERROR("每符号样本数无效: " + std::to_string(samplesPerSymbol));
-        return "";
+        return 0;
     }
     
-    // 估计符号数量
-    size_t numSymbols = signal.size() / samplesPerSymbol;
-    
-    // 提取符号
-    std::vector<std::complex<double>> symbols;
-    symbols.reserve(numSymbols);
-    
-    for (size_t i = 0; i < numSymbols; ++i) {
-        // 计算符号中心位置
-        size_t centerIndex = i * samplesPerSymbol + samplesPerSymbol / 2;
-        
-        // 确保索引有效
-        if (centerIndex >= signal.size()) {
-            break;
-        }
-        
-        // 提取符号
-        symbols.push_back(signal[centerIndex]);
+    const size_t count = getDemodulatedLength(length);
+    if (capacity < count) {
+        LOG_ERROR("QPSKLLR缓冲区容量不足: " + std::to_string(capacity) + " < " + std::to_string(count));
+        return 0;
     }
     
-    // 将符号转换为二进制数据
-    return symbolsToBits(symbols);
+    // 积分结果y = A*a + n，n每维方差为sps*N0/2，LLR = 4*A*y/(sps*N0)
+    const double scale = 4.0 * pulseShaper.getIntegrationGain() / (samplesPerSymbol * noiseVariance);
+    return pulseShaper.integrate(signal, length, 2, scale, llr);
+}
+
+// length个样本软解调得到的LLR个数，每个符号依次输出同相和正交支路的LLR
+size_t QPSKModulator::getDemodulatedLength(size_t length) const {
+    return pulseShaper.getSymbolCount(length) * 2;
+}
+
+// 设置噪声方差
+void QPSKModulator::setNoiseVariance(double variance) {
+    if (variance <= 0.0) {
+        LOG_ERROR("噪声方差无效: " + std::to_string(variance));
+        return;
+    }
+    noiseVariance = variance;
+}
+
+// 获取噪声方差
+double QPSKModulator::getNoiseVariance() const {
+    return noiseVariance;
 }
 
 // 设置采样率
@@ -112,6 +156,7 @@ void QPSKModulator::setSymbolRate(double rate) {
     // 更新每符号样本数
     samplesPerSymbol = static_cast<int>(sampleRate / symbolRate);
     LOG_INFO("更新每符号样本数: " + std::to_string(samplesPerSymbol));
+    updatePulseShaper();
 }
 
 // 获取符号率
@@ -127,6 +172,7 @@ void QPSKModulator::setSamplesPerSymbol(int samples) {
     // 更新符号率
     symbolRate = sampleRate / samplesPerSymbol;
     LOG_INFO("更新符号率: " + std::to_string(symbolRate) + " Hz");
+    updatePulseShaper();
 }
 
 // 获取每符号样本数
@@ -138,6 +184,7 @@ int QPSKModulator::getSamplesPerSymbol() const {
 void QPSKModulator::setFilterLength(int length) {
     filterLength = length;
     LOG_INFO("设置滤波器长度: " + std::to_string(length));
+    updatePulseShaper();
 }
 
 // 获取滤波器长度
@@ -186,65 +233,13 @@ std::vector<double> QPSKModulator::generatePulseShapingFilter() const {
     return filter;
 }
 
-// 应用脉冲整形滤波器
-std::vector<std::complex<double>> QPSKModulator::applyFilter(const std::vector<std::complex<double>>& signal, const std::vector<double>& filter) const {
-    if (signal.empty() || filter.empty()) {
-        return signal;
-    }
-    
-    // 卷积
-    std::vector<std::complex<double>> filteredSignal(signal.size() + filter.size() - 1);
-    
-    for (size_t i = 0; i < filteredSignal.size(); ++i) {
-        std::complex<double> sum(0.0, 0.0);
-        
-        for (size_t j = 0; j < filter.size(); ++j) {
-            if (i >= j && i - j < signal.size()) {
-                sum += signal[i - j] * filter[j];
-            }
-        }
-        
-        filteredSignal[i] = sum;
+// 按当前参数重新计算整形滤波器和符号波形表
+void QPSKModulator::updatePulseShaper() {
+    std::vector<double> filter;
+    if (samplesPerSymbol > 0 && filterLength > 0) {
+        filter = generatePulseShapingFilter();
     }
-    
-    return filteredSignal;
-}
-
-// 将二进制数据转换为符号
-std::vector<std::complex<double>> QPSKModulator::bitsToSymbols(const std::string& bits) const {
-    // QPSK: 每2位对应一个符号
-    std::vector<std::complex<double>> symbols;
-    symbols.reserve((bits.length() + 1) / 2);
-    
-    for (size_t i = 0; i < bits.length(); i += 2) {
-        // 获取2位
-        char bit1 = bits[i];
-        char bit2 = (i + 1 < bits.length()) ? bits[i + 1] : '0';
-        
-        // 映射到复平面
-        double real = (bit1 == '0') ? -1.0 : 1.0;
-        double imag = (bit2 == '0') ? -1.0 : 1.0;
-        
-        symbols.push_back(std::complex<double>(real, imag));
-    }
-    
-    return symbols;
-}
-
-// 将符号转换为二进制数据
-std::string QPSKModulator::symbolsToBits(const std::vector<std::complex<double>>& symbols) const {
-    std::string bits;
-    bits.reserve(symbols.size() * 2);
-    
-    for (const auto& symbol : symbols) {
-        // 解码实部
-        bits.push_back((std::real(symbol) < 0.0) ? '0' : '1');
-        
-        // 解码虚部
-        bits.push_back((std::imag(symbol) < 0.0) ? '0' : '1');
-    }
-    
-    return bits;
+    pulseShaper.configure(filter, samplesPerSymbol);
 }
 
 } // namespace modulation
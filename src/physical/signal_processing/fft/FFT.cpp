@@ -0,0 +1,116 @@
+#include "FFT.h"
+#include <cmath>
+
+namespace link16 {
+namespace physical {
+namespace signal_processing {
+
+// 构造函数
+FFT::FFT() : size(0) {
+}
+
+// 初始化变换长度
+bool FFT::initialize(size_t size) {
+    if (size < 2 || (size & (size - 1)) != 0) {
+        return false;
+    }
+
+    this->size = size;
+
+    // 每级蝶形的旋转因子连续存放：跨度为half的一级占用twiddles[half, 2*half)
+    twiddles.resize(size);
+    for (size_t half = 1; half < size; half <<= 1) {
+        for (size_t k = 0; k < half; ++k) {
+            const double phase = -M_PI * static_cast<double>(k) / static_cast<double>(half);
+            twiddles[half + k] = std::complex<double>(std::cos(phase), std::sin(phase));
+        }
+    }
+
+    swaps.clear();
+    int bits = 0;
+    while ((static_cast<size_t>(1) << bits) < size) {
+        ++bits;
+    }
+    for (size_t i = 0; i < size; ++i) {
+        size_t reversed = 0;
+        for (int b = 0; b < bits; ++b) {
+            reversed |= ((i >> b) & 1) << (bits - 1 - b);
+        }
+        if (i < reversed) {
+            swaps.emplace_back(i, reversed);
+        }
+    }
+    return true;
+}
+
+// 获取变换点数
+size_t FFT::getSize() const {
+    return size;
+}
+
+// 原地正变换
+void FFT::forward(std::complex<double>* data) const {
+    transform(data, false);
+}
+
+// 原地逆变换
+void FFT::inverse(std::complex<double>* data) const {
+    transform(data, true);
+    const double scale = 1.0 / static_cast<double>(size);
+    for (size_t i = 0; i < size; ++i) {
+        data[i] *= scale;
+    }
+}
+
+// 不小于n的最小2的幂
+size_t FFT::nextPowerOfTwo(size_t n) {
+    size_t power = 1;
+    while (power < n) {
+        power <<= 1;
+    }
+    return power;
+}
+
+// 位反转重排后逐级蝶形运算
+void FFT::transform(std::complex<double>* data, bool inverse) const {
+    for (const auto& swap : swaps) {
+        std::swap(data[swap.first], data[swap.second]);
+    }
+
+    // 复数乘法展开为实数运算，避免std::complex乘法的NaN检查
+    double* d = reinterpret_cast<double*>(data);
+    const double* w = reinterpret_cast<const double*>(twiddles.data());
+    const double sign = inverse ? -1.0 : 1.0;
+
+    // 第一级旋转因子均为1
+    for (size_t i = 0; i < size; i += 2) {
+        const double ar = d[2 * i], ai = d[2 * i + 1];
+        const double br = d[2 * i + 2], bi = d[2 * i + 3];
+        d[2 * i] = ar + br;
+        d[2 * i + 1] = ai + bi;
+        d[2 * i + 2] = ar - br;
+        d[2 * i + 3] = ai - bi;
+    }
+
+    for (size_t half = 2; half < size; half <<= 1) {
+        const double* stage = w + 2 * half;
+        for (size_t start = 0; start < size; start += 2 * half) {
+            double* a = d + 2 * start;
+            double* b = d + 2 * (start + half);
+            for (size_t k = 0; k < half; ++k) {
+                const double wr = stage[2 * k];
+                const double wi = sign * stage[2 * k + 1];
+                const double tr = b[2 * k] * wr - b[2 * k + 1] * wi;
+                const double ti = b[2 * k] * wi + b[2 * k + 1] * wr;
+                b[2 * k] = a[2 * k] - tr;
+                b[2 * k + 1] = a[2 * k + 1] - ti;
+                a[2 * k] += tr;
+                a[2 * k + 1] += ti;
+            }
+        }
+    }
+}
+
+} // namespace signal_processing
+} // namespace physical
+} // namespace link16
@@ -0,0 +1,66 @@
+#pragma once
+#include <vector>
+#include <complex>
+#include <cstddef>
+
+namespace link16 {
+namespace physical {
+namespace signal_processing {
+
+/**
+ * @brief 基2复数FFT
+ *
+ * initialize时预先计算旋转因子和位反转表，之后的变换原地进行，不分配内存。
+ * 同一对象可被多个线程同时使用。
+ */
+class FFT {
+public:
+    // 构造函数
+    FFT();
+
+    /**
+     * @brief 初始化变换长度
+     * @param size 变换点数，必须为2的幂且不小于2
+     * @return 长度是否有效
+     */
+    bool initialize(size_t size);
+
+    // 获取变换点数，未初始化时为0
+    size_t getSize() const;
+
+    /**
+     * @brief 原地正变换 X[k] = sum x[n] * exp(-j*2*pi*k*n/N)
+     * @param data 数据，getSize()个点
+     */
+    void forward(std::complex<double>* data) const;
+
+    /**
+     * @brief 原地逆变换，结果已除以N
+     * @param data 数据，getSize()个点
+     */
+    void inverse(std::complex<double>* data) const;
+
+    /**
+     * @brief 不小于n的最小2的幂
+     * @param n 长度
+     * @return 2的幂
+     */
+    static size_t nextPowerOfTwo(size_t n);
+
+private:
+    // 位反转重排后逐级蝶形运算，逆变换使用共轭旋转因子
+    void transform(std::complex<double>* data, bool inverse) const;
+
+    // 变换点数
+    size_t size;
+
+    // 各级旋转因子，跨度为half的一级为exp(-j*pi*k/half)，存放在[half, 2*half)
+    std::vector<std::complex<double>> twiddles;
+
+    // 需要交换的位反转下标对
+    std::vector<std::pair<size_t, size_t>> swaps;
+};
+
+} // namespace signal_processing
+} // namespace physical
+} // namespace link16
@@ -1,16 +1,163 @@
 #include "FIRFilter.h"
 #include "core/utils/logger.h"
+#include "core/utils/cpuFeatures.h"
 #include <cmath>
 #include <algorithm>
+#include <atomic>
 #include <numeric>
 
+#if defined(LINK16_ARCH_X86)
+#include <immintrin.h>
+#endif
+
 namespace link16 {
 namespace physical {
 namespace signal_processing {
 
+namespace {
+
+// 每块处理的输入样本数
+const size_t fir_block_size = 4096;
+
+// 直接卷积 y[i] = sum taps[k] * work[i+k]，每次计算4个输出以便编译器向量化
+void convolveScalar(const double* taps, size_t numTaps, const double* work, double* output, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        double acc0 = 0.0, acc1 = 0.0, acc2 = 0.0, acc3 = 0.0;
+        const double* x = work + i;
+        for (size_t k = 0; k < numTaps; ++k) {
+            const double t = taps[k];
+            acc0 += t * x[k];
+            acc1 += t * x[k + 1];
+            acc2 += t * x[k + 2];
+            acc3 += t * x[k + 3];
+        }
+        output[i] = acc0;
+        output[i + 1] = acc1;
+        output[i + 2] = acc2;
+        output[i + 3] = acc3;
+    }
+
+    for (; i < count; ++i) {
+        double acc = 0.0;
+        for (size_t k = 0; k < numTaps; ++k) {
+            acc += taps[k] * work[i + k];
+        }
+        output[i] = acc;
+    }
+}
+
+#if defined(LINK16_ARCH_X86)
+
+// AVX2直接卷积，广播一个系数后与16个连续样本做FMA，无需水平求和
+LINK16_TARGET("avx2,fma")
+void convolveAvx2(const double* taps, size_t numTaps, const double* work, double* output, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256d acc0 = _mm256_setzero_pd();
+        __m256d acc1 = _mm256_setzero_pd();
+        __m256d acc2 = _mm256_setzero_pd();
+        __m256d acc3 = _mm256_setzero_pd();
+        const double* x = work + i;
+        for (size_t k = 0; k < numTaps; ++k) {
+            const __m256d t = _mm256_broadcast_sd(taps + k);
+            acc0 = _mm256_fmadd_pd(t, _mm256_loadu_pd(x + k), acc0);
+            acc1 = _mm256_fmadd_pd(t, _mm256_loadu_pd(x + k + 4), acc1);
+            acc2 = _mm256_fmadd_pd(t, _mm256_loadu_pd(x + k + 8), acc2);
+            acc3 = _mm256_fmadd_pd(t, _mm256_loadu_pd(x + k + 12), acc3);
+        }
+        _mm256_storeu_pd(output + i, acc0);
+        _mm256_storeu_pd(output + i + 4, acc1);
+        _mm256_storeu_pd(output + i + 8, acc2);
+        _mm256_storeu_pd(output + i + 12, acc3);
+    }
+
+    for (; i + 4 <= count; i += 4) {
+        __m256d acc = _mm256_setzero_pd();
+        const double* x = work + i;
+        for (size_t k = 0; k < numTaps; ++k) {
+            acc = _mm256_fmadd_pd(_mm256_broadcast_sd(taps + k), _mm256_loadu_pd(x + k), acc);
+        }
+        _mm256_storeu_pd(output + i, acc);
+    }
+
+    if (i < count) {
+        convolveScalar(taps, numTaps, work + i, output + i, count - i);
+    }
+}
+
+#endif
+
+// 频谱逐点相乘，复数乘法展开为实数运算
+void multiplySpectrum(std::complex<double>* data, const std::complex<double>* spectrum, size_t size) {
+    double* d = reinterpret_cast<double*>(data);
+    const double* h = reinterpret_cast<const double*>(spectrum);
+    for (size_t i = 0; i < size; ++i) {
+        const double xr = d[2 * i], xi = d[2 * i + 1];
+        const double hr = h[2 * i], hi = h[2 * i + 1];
+        d[2 * i] = xr * hr - xi * hi;
+        d[2 * i + 1] = xr * hi + xi * hr;
+    }
+}
+
+FIRKernelType resolveKernel(FIRKernelType kernel) {
+    return isFIRKernelSupported(kernel) ? kernel : FIRKernelType::SCALAR;
+}
+
+std::atomic<FIRKernelType>& defaultKernel() {
+    static std::atomic<FIRKernelType> kernel(detectFIRKernel());
+    return kernel;
+}
+
+} // namespace
+
+// 获取内核名称
+const char* getFIRKernelName(FIRKernelType type) {
+    switch (type) {
+        case FIRKernelType::SCALAR: return "scalar";
+        case FIRKernelType::AVX2:   return "avx2";
+        default:                    return "unknown";
+    }
+}
+
+// 检查当前CPU是否支持该内核
+bool isFIRKernelSupported(FIRKernelType type) {
+    switch (type) {
+        case FIRKernelType::SCALAR:
+            return true;
+        case FIRKernelType::AVX2:
+#if defined(LINK16_ARCH_X86)
+            return utils::CpuFeatures::get().avx2 && utils::CpuFeatures::get().fma;
+#else
+            return false;
+#endif
+        default:
+            return false;
+    }
+}
+
+// 获取当前CPU支持的最快内核
+FIRKernelType detectFIRKernel() {
+    if (isFIRKernelSupported(FIRKernelType::AVX2)) {
+        return FIRKernelType::AVX2;
+    }
+    return FIRKernelType::SCALAR;
+}
+
+// 设置默认FIR内核
+void setFIRKernel(FIRKernelType type) {
+    defaultKernel().store(resolveKernel(type), std::memory_order_relaxed);
+}
+
+// 获取默认FIR内核
+FIRKernelType getFIRKernel() {
+    return defaultKernel().load(std::memory_order_relaxed);
+}
+
 // 构造函数
 FIRFilter::FIRFilter() 
     : filterType(FilterType::LOWPASS), windowType(WindowType::HAMMING),
+      filterMode(FilterMode::AUTO), useFFT(false), fftBlockLength(0),
       numTaps(0), cutoffFreq(0.0), lowCutoffFreq(0.0), highCutoffFreq(0.0),
       samplingRate(0.0), windowParam(0.0) {
 }
@@ -49,13 +196,9 @@ bool FIRFilter::initialize(FilterType type, int numTaps, double cutoffFreq, doub
             return false;
     }
     
-    // 应用窗函数
+    // 应用窗函数(同时清空延迟线)
     applyWindow();
     
-    // 初始化状态
-    stateReal.resize(numTaps - 1, 0.0);
-    stateComplex.resize(numTaps - 1, std::complex<double>(0.0, 0.0));
-    
     LOG_INFO("FIR滤波器初始化成功");
     return true;
 }
@@ -96,13 +239,9 @@ bool FIRFilter::initialize(FilterType type, int numTaps, double lowCutoffFreq, d
             return false;
     }
     
-    // 应用窗函数
+    // 应用窗函数(同时清空延迟线)
     applyWindow();
     
-    // 初始化状态
-    stateReal.resize(numTaps - 1, 0.0);
-    stateComplex.resize(numTaps - 1, std::complex<double>(0.0, 0.0));
-    
     LOG_INFO("FIR滤波器初始化成功");
     return true;
 }
@@ -122,8 +261,7 @@ void FIRFilter::setCoefficients(const std::vector<double>& coeffs) {
     numTaps = static_cast<int>(coeffs.size());
     
     // 重置状态
-    stateReal.resize(numTaps - 1, 0.0);
-    stateComplex.resize(numTaps - 1, std::complex<double>(0.0, 0.0));
+    prepare();
 }
 
 // 获取滤波器系数
@@ -133,60 +271,211 @@ std::vector<double> FIRFilter::getCoefficients() const {
 
 // 滤波实数信号
 std::vector<double> FIRFilter::filter(const std::vector<double>& input) {
+    std::vector<double> output(input.size());
+    filter(input.data(), output.data(), input.size());
+    return output;
+}
+
+// 滤波复数信号
+std::vector<std::complex<double>> FIRFilter::filter(const std::vector<std::complex<double>>& input) {
+    std::vector<std::complex<double>> output(input.size());
+    filter(input.data(), output.data(), input.size());
+    return output;
+}
+
+// 流式滤波实数信号
+bool FIRFilter::filter(const double* input, double* output, size_t length) {
     if (coefficients.empty()) {
         LOG_ERROR("滤波器系数为空");
-        return input;
+        std::copy(input, input + length, output);
+        return false;
     }
-    
-    std::vector<double> output(input.size());
-    
-    for (size_t i = 0; i < input.size(); ++i) {
-        // 移动状态
-        for (int j = numTaps - 2; j > 0; --j) {
-            stateReal[j] = stateReal[j - 1];
-        }
-        stateReal[0] = input[i];
-        
-        // 计算输出
-        double sum = 0.0;
-        for (int j = 0; j < numTaps - 1; ++j) {
-            sum += coefficients[j] * stateReal[j];
+
+    const size_t history = coefficients.size() - 1;
+    const size_t block = workReal.size() - history;
+    while (length > 0) {
+        // 先复制输入再写输出，支持原地滤波
+        const size_t count = std::min(length, block);
+        std::copy(input, input + count, workReal.begin() + history);
+
+        if (useFFT) {
+            convolveFFTReal(workReal.data(), output, count);
+        } else {
+            convolveDirect(workReal.data(), output, count);
         }
-        sum += coefficients[numTaps - 1] * input[i];
-        
-        output[i] = sum;
+
+        // 保留最后numTaps-1个样本作为下一块的历史
+        std::copy(workReal.begin() + count, workReal.begin() + count + history, workReal.begin());
+        input += count;
+        output += count;
+        length -= count;
     }
-    
-    return output;
+    return true;
 }
 
-// 滤波复数信号
-std::vector<std::complex<double>> FIRFilter::filter(const std::vector<std::complex<double>>& input) {
+// 流式滤波复数信号
+bool FIRFilter::filter(const std::complex<double>* input, std::complex<double>* output, size_t length) {
     if (coefficients.empty()) {
         LOG_ERROR("滤波器系数为空");
-        return input;
+        std::copy(input, input + length, output);
+        return false;
     }
-    
-    std::vector<std::complex<double>> output(input.size());
-    
-    for (size_t i = 0; i < input.size(); ++i) {
-        // 移动状态
-        for (int j = numTaps - 2; j > 0; --j) {
-            stateComplex[j] = stateComplex[j - 1];
+
+    std::vector<double>& real = workComplex[0];
+    std::vector<double>& imag = workComplex[1];
+    const size_t history = coefficients.size() - 1;
+    const size_t block = real.size() - history;
+    while (length > 0) {
+        const size_t count = std::min(length, block);
+        for (size_t i = 0; i < count; ++i) {
+            real[history + i] = input[i].real();
+            imag[history + i] = input[i].imag();
         }
-        stateComplex[0] = input[i];
-        
-        // 计算输出
-        std::complex<double> sum(0.0, 0.0);
-        for (int j = 0; j < numTaps - 1; ++j) {
-            sum += coefficients[j] * stateComplex[j];
+
+        if (useFFT) {
+            convolveFFTComplex(real.data(), imag.data(), output, count);
+        } else {
+            convolveDirect(real.data(), outputComplex[0].data(), count);
+            convolveDirect(imag.data(), outputComplex[1].data(), count);
+            for (size_t i = 0; i < count; ++i) {
+                output[i] = std::complex<double>(outputComplex[0][i], outputComplex[1][i]);
+            }
         }
-        sum += coefficients[numTaps - 1] * input[i];
-        
-        output[i] = sum;
+
+        std::copy(real.begin() + count, real.begin() + count + history, real.begin());
+        std::copy(imag.begin() + count, imag.begin() + count + history, imag.begin());
+        input += count;
+        output += count;
+        length -= count;
+    }
+    return true;
+}
+
+// 设置滤波实现方式
+void FIRFilter::setFilterMode(FilterMode mode) {
+    filterMode = mode;
+    prepare();
+}
+
+// 获取滤波实现方式
+FIRFilter::FilterMode FIRFilter::getFilterMode() const {
+    return filterMode;
+}
+
+// 当前是否使用FFT重叠保留法
+bool FIRFilter::isUsingFFT() const {
+    return useFFT;
+}
+
+// 系数变化后重建倒序系数、FFT频谱和工作区
+void FIRFilter::prepare() {
+    const size_t taps = coefficients.size();
+    useFFT = taps > 0 && (filterMode == FilterMode::FFT ||
+                          (filterMode == FilterMode::AUTO && taps >= static_cast<size_t>(fft_min_taps)));
+
+    reversedTaps.assign(coefficients.rbegin(), coefficients.rend());
+
+    size_t block = fir_block_size;
+    if (useFFT) {
+        // FFT点数取阶数的4倍左右，每次FFT产生N-numTaps+1个有效输出
+        fft.initialize(FFT::nextPowerOfTwo(std::max<size_t>(4 * taps, 64)));
+        const size_t size = fft.getSize();
+        fftBlockLength = size - taps + 1;
+
+        tapSpectrum.assign(size, std::complex<double>(0.0, 0.0));
+        std::copy(coefficients.begin(), coefficients.end(), tapSpectrum.begin());
+        fft.forward(tapSpectrum.data());
+        fftBuffer.assign(size, std::complex<double>(0.0, 0.0));
+
+        // 每块包含整数对FFT块，实数信号每次FFT处理相邻两块
+        block = 2 * fftBlockLength * std::max<size_t>(1, fir_block_size / (2 * fftBlockLength));
+    } else {
+        fftBlockLength = 0;
+        tapSpectrum.clear();
+        fftBuffer.clear();
+    }
+
+    if (taps == 0) {
+        workReal.clear();
+        for (int part = 0; part < 2; ++part) {
+            workComplex[part].clear();
+            outputComplex[part].clear();
+        }
+        return;
+    }
+
+    workReal.assign(taps - 1 + block, 0.0);
+    for (int part = 0; part < 2; ++part) {
+        workComplex[part].assign(taps - 1 + block, 0.0);
+        outputComplex[part].assign(useFFT ? 0 : block, 0.0);
+    }
+}
+
+// 对工作区中的一块数据直接卷积
+void FIRFilter::convolveDirect(const double* work, double* output, size_t count) const {
+#if defined(LINK16_ARCH_X86)
+    if (getFIRKernel() == FIRKernelType::AVX2) {
+        convolveAvx2(reversedTaps.data(), reversedTaps.size(), work, output, count);
+        return;
+    }
+#endif
+    convolveScalar(reversedTaps.data(), reversedTaps.size(), work, output, count);
+}
+
+// 重叠保留法滤波工作区中的一块实数数据
+void FIRFilter::convolveFFTReal(const double* work, double* output, size_t count) {
+    const size_t size = fft.getSize();
+    const size_t history = coefficients.size() - 1;
+    const size_t valid = history + count;
+    const size_t step = fftBlockLength;
+
+    // 系数为实数，相邻两块分别放在实部和虚部，一次FFT得到两块的输出
+    for (size_t p = 0; p < count; p += 2 * step) {
+        for (size_t j = 0; j < size; ++j) {
+            const double first = p + j < valid ? work[p + j] : 0.0;
+            const double second = p + step + j < valid ? work[p + step + j] : 0.0;
+            fftBuffer[j] = std::complex<double>(first, second);
+        }
+
+        fft.forward(fftBuffer.data());
+        multiplySpectrum(fftBuffer.data(), tapSpectrum.data(), size);
+        fft.inverse(fftBuffer.data());
+
+        // 前numTaps-1个点受循环卷积回绕影响，丢弃
+        const size_t firstCount = std::min(step, count - p);
+        for (size_t i = 0; i < firstCount; ++i) {
+            output[p + i] = fftBuffer[history + i].real();
+        }
+        if (p + step < count) {
+            const size_t secondCount = std::min(step, count - p - step);
+            for (size_t i = 0; i < secondCount; ++i) {
+                output[p + step + i] = fftBuffer[history + i].imag();
+            }
+        }
+    }
+}
+
+// 重叠保留法滤波工作区中的一块复数数据
+void FIRFilter::convolveFFTComplex(const double* real, const double* imag, std::complex<double>* output,
+                                   size_t count) {
+    const size_t size = fft.getSize();
+    const size_t history = coefficients.size() - 1;
+    const size_t valid = history + count;
+    const size_t step = fftBlockLength;
+
+    for (size_t p = 0; p < count; p += step) {
+        for (size_t j = 0; j < size; ++j) {
+            fftBuffer[j] = p + j < valid ? std::complex<double>(real[p + j], imag[p + j])
+                                         : std::complex<double>(0.0, 0.0);
+        }
+
+        fft.forward(fftBuffer.data());
+        multiplySpectrum(fftBuffer.data(), tapSpectrum.data(), size);
+        fft.inverse(fftBuffer.data());
+
+        const size_t outputCount = std::min(step, count - p);
+        std::copy(fftBuffer.begin() + history, fftBuffer.begin() + history + outputCount, output + p);
     }
-    
-    return output;
 }
 
 // 获取滤波器类型
@@ -245,8 +534,10 @@ std::vector<std::complex<double>> FIRFilter::getFrequencyResponse(int numPoints)
 
 // 重置滤波器状态
 void FIRFilter::reset() {
-    std::fill(stateReal.begin(), stateReal.end(), 0.0);
-    std::fill(stateComplex.begin(), stateComplex.end(), std::complex<double>(0.0, 0.0));
+    std::fill(workReal.begin(), workReal.end(), 0.0);
+    for (int part = 0; part < 2; ++part) {
+        std::fill(workComplex[part].begin(), workComplex[part].end(), 0.0);
+    }
 }
 
 // 设计低通滤波器
@@ -366,6 +657,8 @@ void FIRFilter::applyWindow() {
             coefficients[i] /= sum;
         }
     }
+
+    prepare();
 }
 
 // 计算矩形窗
@@ -2,12 +2,61 @@
 #include <vector>
 #include <complex>
 #include <string>
+#include <cstddef>
+#include "../fft/FFT.h"
 
 namespace link16 {
 namespace physical {
 namespace signal_processing {
 
-// FIR滤波器类
+/**
+ * @brief FIR直接卷积内核类型
+ */
+enum class FIRKernelType {
+    SCALAR,  // 标量实现，所有平台可用
+    AVX2     // AVX2 + FMA，每次计算16个输出
+};
+
+/**
+ * @brief 获取内核名称
+ * @param type 内核类型
+ * @return 内核名称
+ */
+const char* getFIRKernelName(FIRKernelType type);
+
+/**
+ * @brief 检查当前CPU是否支持该内核
+ * @param type 内核类型
+ * @return 是否支持
+ */
+bool isFIRKernelSupported(FIRKernelType type);
+
+/**
+ * @brief 获取当前CPU支持的最快内核
+ * @return 内核类型
+ */
+FIRKernelType detectFIRKernel();
+
+/**
+ * @brief 设置默认FIR内核，不支持的内核退回到SCALAR
+ * @param type 内核类型
+ */
+void setFIRKernel(FIRKernelType type);
+
+/**
+ * @brief 获取默认FIR内核
+ * @return 内核类型
+ */
+FIRKernelType getFIRKernel();
+
+/**
+ * @brief 流式FIR滤波器
+ *
+ * 输出 y[n] = sum c[k] * x[n-k]，多次调用filter时延迟线在调用之间保持，
+ * 与一次性滤波整段信号的结果相同。延迟线与输入按块拼接在连续的工作区中，
+ * 每块只搬移一次numTaps-1个历史样本；复数信号的实部和虚部分开存放。
+ * 长滤波器自动切换为FFT重叠保留法，实数信号每次FFT同时处理相邻两块。
+ */
 class FIRFilter {
 public:
     // 滤波器类型
@@ -26,6 +75,16 @@ public:
         BLACKMAN,       // 布莱克曼窗
         KAISER          // 凯撒窗
     };
+
+    // 滤波实现方式
+    enum class FilterMode {
+        AUTO,       // 按阶数自动选择
+        DIRECT,     // 直接卷积
+        FFT         // FFT重叠保留法
+    };
+
+    // AUTO模式下切换到FFT重叠保留法的最小阶数
+    static const int fft_min_taps = 192;
     
     // 构造函数
     FIRFilter();
@@ -53,6 +112,33 @@ public:
     
     // 滤波复数信号
     std::vector<std::complex<double>> filter(const std::vector<std::complex<double>>& input);
+
+    /**
+     * @brief 流式滤波实数信号，输出写入调用者提供的缓冲区
+     * @param input 输入
+     * @param output 输出，length个样本，可以与input相同
+     * @param length 样本数
+     * @return 是否已设置滤波器系数
+     */
+    bool filter(const double* input, double* output, size_t length);
+
+    /**
+     * @brief 流式滤波复数信号，输出写入调用者提供的缓冲区
+     * @param input 输入
+     * @param output 输出，length个样本，可以与input相同
+     * @param length 样本数
+     * @return 是否已设置滤波器系数
+     */
+    bool filter(const std::complex<double>* input, std::complex<double>* output, size_t length);
+
+    // 设置滤波实现方式，会清空延迟线
+    void setFilterMode(FilterMode mode);
+
+    // 获取滤波实现方式
+    FilterMode getFilterMode() const;
+
+    // 当前是否使用FFT重叠保留法
+    bool isUsingFFT() const;
     
     // 获取滤波器类型
     FilterType getFilterType() const;
@@ -91,11 +177,35 @@ private:
     // 滤波器系数
     std::vector<double> coefficients;
     
-    // 滤波器状态(用于实数信号)
-    std::vector<double> stateReal;
-    
-    // 滤波器状态(用于复数信号)
-    std::vector<std::complex<double>> stateComplex;
+    // 实数信号工作区，前numTaps-1个为历史样本，其后为本块输入
+    std::vector<double> workReal;
+
+    // 复数信号工作区(实部、虚部分开存放)，布局同workReal
+    std::vector<double> workComplex[2];
+
+    // 复数信号直接卷积的输出(实部、虚部)
+    std::vector<double> outputComplex[2];
+
+    // 按时间倒序排列的系数，直接卷积时 y[i] = sum reversedTaps[k] * work[i+k]
+    std::vector<double> reversedTaps;
+
+    // 滤波实现方式
+    FilterMode filterMode;
+
+    // 当前是否使用FFT重叠保留法
+    bool useFFT;
+
+    // 重叠保留法每次FFT产生的有效输出数
+    size_t fftBlockLength;
+
+    // FFT
+    FFT fft;
+
+    // 系数的频谱
+    std::vector<std::complex<double>> tapSpectrum;
+
+    // FFT工作区
+    std::vector<std::complex<double>> fftBuffer;
     
     // 滤波器阶数
     int numTaps;
@@ -129,6 +239,18 @@ private:
     
     // 应用窗函数
     void applyWindow();
+
+    // 系数变化后重建倒序系数、FFT频谱和工作区
+    void prepare();
+
+    // 对工作区中的一块数据直接卷积，输出count个样本
+    void convolveDirect(const double* work, double* output, size_t count) const;
+
+    // 重叠保留法滤波工作区中的一块实数数据
+    void convolveFFTReal(const double* work, double* output, size_t count);
+
+    // 重叠保留法滤波工作区中的一块复数数据
+    void convolveFFTComplex(const double* real, const double* imag, std::complex<double>* output, size_t count);
     
     // 计算矩形窗
     std::vector<double> rectangularWindow(int length) const;
@@ -1,16 +1,219 @@
 #include "Resampler.h"
+#include "../filter/FIRFilter.h"
 #include "core/utils/logger.h"
+#include "core/utils/cpuFeatures.h"
 #include <cmath>
 #include <algorithm>
 
+#if defined(LINK16_ARCH_X86)
+#include <immintrin.h>
+#endif
+
 namespace link16 {
 namespace physical {
 namespace signal_processing {
 
+namespace {
+
+// 每块处理的输入样本数
+const size_t resampler_block_size = 4096;
+
+// 多相系数表的最大系数数
+const size_t max_polyphase_coefficients = 1 << 20;
+
+// 多相滤波器组的最大抽取因子
+const long long max_decimation_factor = 1 << 20;
+
+// SINC方法Farrow结构的多项式阶数
+const int farrow_sinc_degree = 5;
+
+double sinc(double x) {
+    if (std::abs(x) < 1e-12) {
+        return 1.0;
+    }
+    return std::sin(M_PI * x) / (M_PI * x);
+}
+
+// 将ratio化为分数up/down，up不超过maxUp时返回true
+bool findRationalRatio(double ratio, int maxUp, int& up, int& down) {
+    // 连分数逼近
+    long long h0 = 0, h1 = 1;
+    long long k0 = 1, k1 = 0;
+    double x = ratio;
+    for (int i = 0; i < 64; ++i) {
+        const double a = std::floor(x);
+        const long long h2 = static_cast<long long>(a) * h1 + h0;
+        const long long k2 = static_cast<long long>(a) * k1 + k0;
+        if (h2 > maxUp || k2 > max_decimation_factor) {
+            return false;
+        }
+        if (std::abs(static_cast<double>(h2) / static_cast<double>(k2) - ratio) <= 1e-12 * ratio) {
+            up = static_cast<int>(h2);
+            down = static_cast<int>(k2);
+            return true;
+        }
+        const double remainder = x - a;
+        if (remainder < 1e-15) {
+            return false;
+        }
+        x = 1.0 / remainder;
+        h0 = h1;
+        h1 = h2;
+        k0 = k1;
+        k1 = k2;
+    }
+    return false;
+}
+
+// 求解n阶线性方程组 matrix * x = rhs，rhs有columns列，结果写回rhs
+void solveLinearSystem(std::vector<double>& matrix, std::vector<double>& rhs, int n, size_t columns) {
+    for (int col = 0; col < n; ++col) {
+        int pivot = col;
+        for (int row = col + 1; row < n; ++row) {
+            if (std::abs(matrix[row * n + col]) > std::abs(matrix[pivot * n + col])) {
+                pivot = row;
+            }
+        }
+        if (pivot != col) {
+            for (int k = 0; k < n; ++k) {
+                std::swap(matrix[col * n + k], matrix[pivot * n + k]);
+            }
+            for (size_t k = 0; k < columns; ++k) {
+                std::swap(rhs[col * columns + k], rhs[pivot * columns + k]);
+            }
+        }
+        for (int row = 0; row < n; ++row) {
+            if (row == col) {
+                continue;
+            }
+            const double factor = matrix[row * n + col] / matrix[col * n + col];
+            for (int k = col; k < n; ++k) {
+                matrix[row * n + k] -= factor * matrix[col * n + k];
+            }
+            for (size_t k = 0; k < columns; ++k) {
+                rhs[row * columns + k] -= factor * rhs[col * columns + k];
+            }
+        }
+    }
+    for (int row = 0; row < n; ++row) {
+        for (size_t k = 0; k < columns; ++k) {
+            rhs[row * columns + k] /= matrix[row * n + row];
+        }
+    }
+}
+
+// 点积，4个累加器以便编译器向量化
+double dotScalar(const double* weights, const double* x, size_t length) {
+    double acc0 = 0.0, acc1 = 0.0, acc2 = 0.0, acc3 = 0.0;
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        acc0 += weights[i] * x[i];
+        acc1 += weights[i + 1] * x[i + 1];
+        acc2 += weights[i + 2] * x[i + 2];
+        acc3 += weights[i + 3] * x[i + 3];
+    }
+    for (; i < length; ++i) {
+        acc0 += weights[i] * x[i];
+    }
+    return (acc0 + acc1) + (acc2 + acc3);
+}
+
+// 实部和虚部共用一次系数读取
+void dotComplexScalar(const double* weights, const double* real, const double* imag, size_t length,
+                      double& outReal, double& outImag) {
+    double r0 = 0.0, r1 = 0.0, i0 = 0.0, i1 = 0.0;
+    size_t i = 0;
+    for (; i + 2 <= length; i += 2) {
+        r0 += weights[i] * real[i];
+        i0 += weights[i] * imag[i];
+        r1 += weights[i + 1] * real[i + 1];
+        i1 += weights[i + 1] * imag[i + 1];
+    }
+    for (; i < length; ++i) {
+        r0 += weights[i] * real[i];
+        i0 += weights[i] * imag[i];
+    }
+    outReal = r0 + r1;
+    outImag = i0 + i1;
+}
+
+#if defined(LINK16_ARCH_X86)
+
+LINK16_TARGET("avx2,fma")
+double horizontalSum(__m256d v) {
+    const __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+}
+
+LINK16_TARGET("avx2,fma")
+double dotAvx2(const double* weights, const double* x, size_t length) {
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+        acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(weights + i), _mm256_loadu_pd(x + i), acc0);
+        acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(weights + i + 4), _mm256_loadu_pd(x + i + 4), acc1);
+    }
+    for (; i + 4 <= length; i += 4) {
+        acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(weights + i), _mm256_loadu_pd(x + i), acc0);
+    }
+    double sum = horizontalSum(_mm256_add_pd(acc0, acc1));
+    for (; i < length; ++i) {
+        sum += weights[i] * x[i];
+    }
+    return sum;
+}
+
+LINK16_TARGET("avx2,fma")
+void dotComplexAvx2(const double* weights, const double* real, const double* imag, size_t length,
+                    double& outReal, double& outImag) {
+    __m256d accReal = _mm256_setzero_pd();
+    __m256d accImag = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+        const __m256d w = _mm256_loadu_pd(weights + i);
+        accReal = _mm256_fmadd_pd(w, _mm256_loadu_pd(real + i), accReal);
+        accImag = _mm256_fmadd_pd(w, _mm256_loadu_pd(imag + i), accImag);
+    }
+    outReal = horizontalSum(accReal);
+    outImag = horizontalSum(accImag);
+    for (; i < length; ++i) {
+        outReal += weights[i] * real[i];
+        outImag += weights[i] * imag[i];
+    }
+}
+
+#endif
+
+// 按FIR内核设置选择点积实现
+double dot(const double* weights, const double* x, size_t length) {
+#if defined(LINK16_ARCH_X86)
+    if (getFIRKernel() == FIRKernelType::AVX2) {
+        return dotAvx2(weights, x, length);
+    }
+#endif
+    return dotScalar(weights, x, length);
+}
+
+std::complex<double> dotComplex(const double* weights, const double* real, const double* imag, size_t length) {
+    double outReal, outImag;
+#if defined(LINK16_ARCH_X86)
+    if (getFIRKernel() == FIRKernelType::AVX2) {
+        dotComplexAvx2(weights, real, imag, length, outReal, outImag);
+        return std::complex<double>(outReal, outImag);
+    }
+#endif
+    dotComplexScalar(weights, real, imag, length, outReal, outImag);
+    return std::complex<double>(outReal, outImag);
+}
+
+} // namespace
+
 // 构造函数
-Resampler::Resampler() 
+Resampler::Resampler()
     : inputRate(0.0), outputRate(0.0), ratio(1.0), method(InterpolationMethod::SINC),
-      numTaps(64), cutoffFactor(0.5), position(0.0) {
+      numTaps(64), cutoffFactor(0.5), passthrough(true), usePolyphase(false), upFactor(0), downFactor(0),
+      kernelLength(0), farrowDegree(0), delay(0.0), windowEnd(0), phase(0), fraction(0.0) {
 }
 
 // 析构函数
@@ -23,31 +226,27 @@ bool Resampler::initialize(double inputRate, double outputRate, InterpolationMet
         LOG_ERROR("采样率必须为正数");
         return false;
     }
-    
+
     this->inputRate = inputRate;
     this->outputRate = outputRate;
     this->ratio = outputRate / inputRate;
     this->method = method;
-    
-    // 设计滤波器
+
+    // 设计滤波器并初始化延迟线
     designFilter();
-    
-    // 初始化缓存
-    int bufferSize = numTaps * 2;
-    bufferReal.resize(bufferSize, 0.0);
-    bufferComplex.resize(bufferSize, std::complex<double>(0.0, 0.0));
-    position = 0.0;
-    
-    LOG_INFO("重采样器初始化成功，输入采样率: " + std::to_string(inputRate) + 
-             " Hz，输出采样率: " + std::to_string(outputRate) + " Hz，比率: " + 
-             std::to_string(ratio));
-    
+
+    LOG_INFO("重采样器初始化成功，输入采样率: " + std::to_string(inputRate) +
+             " Hz，输出采样率: " + std::to_string(outputRate) + " Hz，比率: " +
+             std::to_string(ratio) + (usePolyphase ? "，多相滤波器组 L/M = " + std::to_string(upFactor) + "/" +
+                                      std::to_string(downFactor) : "，Farrow结构"));
+
     return true;
 }
 
 // 设置插值方法
 void Resampler::setInterpolationMethod(InterpolationMethod method) {
     this->method = method;
+    designFilter();
 }
 
 // 设置滤波器参数
@@ -56,180 +255,122 @@ void Resampler::setFilterParams(int numTaps, double cutoffFactor) {
         LOG_ERROR("滤波器参数无效");
         return;
     }
-    
+
     this->numTaps = numTaps;
     this->cutoffFactor = cutoffFactor;
-    
+
     // 重新设计滤波器
     designFilter();
-    
-    // 重新初始化缓存
-    int bufferSize = numTaps * 2;
-    bufferReal.resize(bufferSize, 0.0);
-    bufferComplex.resize(bufferSize, std::complex<double>(0.0, 0.0));
-    position = 0.0;
 }
 
 // 重采样实数信号
 std::vector<double> Resampler::resample(const std::vector<double>& input) {
-    if (input.empty()) {
-        return input;
-    }
-    
-    if (std::abs(ratio - 1.0) < 1e-6) {
-        // 采样率相同，直接返回输入
-        return input;
-    }
-    
-    // 估计输出大小
-    size_t outputSize = static_cast<size_t>(std::ceil(input.size() * ratio));
-    std::vector<double> output(outputSize);
-    
-    // 重置位置
-    position = 0.0;
-    
-    // 清空缓存
-    std::fill(bufferReal.begin(), bufferReal.end(), 0.0);
-    
-    // 将输入数据复制到缓存
-    size_t bufferSize = bufferReal.size();
-    for (size_t i = 0; i < std::min(input.size(), bufferSize); ++i) {
-        bufferReal[i] = input[i];
-    }
-    
-    // 重采样
-    size_t outputIndex = 0;
-    while (position < input.size() && outputIndex < outputSize) {
-        // 插值
-        double value = 0.0;
-        switch (method) {
-            case InterpolationMethod::NEAREST:
-                value = interpolateNearest(bufferReal, position);
-                break;
-            case InterpolationMethod::LINEAR:
-                value = interpolateLinear(bufferReal, position);
-                break;
-            case InterpolationMethod::CUBIC:
-                value = interpolateCubic(bufferReal, position);
-                break;
-            case InterpolationMethod::SINC:
-                value = interpolateSinc(bufferReal, position);
-                break;
-        }
-        
-        output[outputIndex++] = value;
-        
-        // 更新位置
-        position += 1.0 / ratio;
-        
-        // 如果位置超过了缓存的一半，移动缓存
-        if (position >= bufferSize / 2) {
-            // 移动缓存
-            size_t shift = static_cast<size_t>(std::floor(position));
-            for (size_t i = 0; i < bufferSize - shift; ++i) {
-                bufferReal[i] = bufferReal[i + shift];
-            }
-            
-            // 填充新数据
-            for (size_t i = bufferSize - shift; i < bufferSize; ++i) {
-                size_t inputIndex = i + input.size() - bufferSize;
-                if (inputIndex < input.size()) {
-                    bufferReal[i] = input[inputIndex];
-                } else {
-                    bufferReal[i] = 0.0;
-                }
-            }
-            
-            // 更新位置
-            position -= shift;
-        }
-    }
-    
-    // 调整输出大小
-    output.resize(outputIndex);
-    
+    std::vector<double> output(getMaxOutputLength(input.size()));
+    output.resize(resample(input.data(), input.size(), output.data(), output.size()));
     return output;
 }
 
 // 重采样复数信号
 std::vector<std::complex<double>> Resampler::resample(const std::vector<std::complex<double>>& input) {
-    if (input.empty()) {
-        return input;
-    }
-    
-    if (std::abs(ratio - 1.0) < 1e-6) {
-        // 采样率相同，直接返回输入
-        return input;
-    }
-    
-    // 估计输出大小
-    size_t outputSize = static_cast<size_t>(std::ceil(input.size() * ratio));
-    std::vector<std::complex<double>> output(outputSize);
-    
-    // 重置位置
-    position = 0.0;
-    
-    // 清空缓存
-    std::fill(bufferComplex.begin(), bufferComplex.end(), std::complex<double>(0.0, 0.0));
-    
-    // 将输入数据复制到缓存
-    size_t bufferSize = bufferComplex.size();
-    for (size_t i = 0; i < std::min(input.size(), bufferSize); ++i) {
-        bufferComplex[i] = input[i];
-    }
-    
-    // 重采样
-    size_t outputIndex = 0;
-    while (position < input.size() && outputIndex < outputSize) {
-        // 插值
-        std::complex<double> value(0.0, 0.0);
-        switch (method) {
-            case InterpolationMethod::NEAREST:
-                value = interpolateNearest(bufferComplex, position);
-                break;
-            case InterpolationMethod::LINEAR:
-                value = interpolateLinear(bufferComplex, position);
-                break;
-            case InterpolationMethod::CUBIC:
-                value = interpolateCubic(bufferComplex, position);
-                break;
-            case InterpolationMethod::SINC:
-                value = interpolateSinc(bufferComplex, position);
-                break;
+    std::vector<std::complex<double>> output(getMaxOutputLength(input.size()));
+    output.resize(resample(input.data(), input.size(), output.data(), output.size()));
+    return output;
+}
+
+// 流式重采样实数信号
+size_t Resampler::resample(const double* input, size_t length, double* output, size_t capacity) {
+    if (passthrough) {
+        if (capacity < length) {
+            LOG_ERROR("重采样输出缓冲区容量不足");
+            return 0;
         }
-        
-        output[outputIndex++] = value;
-        
-        // 更新位置
-        position += 1.0 / ratio;
-        
-        // 如果位置超过了缓存的一半，移动缓存
-        if (position >= bufferSize / 2) {
-            // 移动缓存
-            size_t shift = static_cast<size_t>(std::floor(position));
-            for (size_t i = 0; i < bufferSize - shift; ++i) {
-                bufferComplex[i] = bufferComplex[i + shift];
-            }
-            
-            // 填充新数据
-            for (size_t i = bufferSize - shift; i < bufferSize; ++i) {
-                size_t inputIndex = i + input.size() - bufferSize;
-                if (inputIndex < input.size()) {
-                    bufferComplex[i] = input[inputIndex];
-                } else {
-                    bufferComplex[i] = std::complex<double>(0.0, 0.0);
-                }
-            }
-            
-            // 更新位置
-            position -= shift;
+        std::copy(input, input + length, output);
+        return length;
+    }
+
+    if (kernelLength == 0 || capacity < getMaxOutputLength(length)) {
+        LOG_ERROR(kernelLength == 0 ? "重采样器未初始化" : "重采样输出缓冲区容量不足");
+        return 0;
+    }
+
+    const size_t history = kernelLength - 1;
+    const size_t block = workReal.size() - history;
+    size_t produced = 0;
+    while (length > 0) {
+        const size_t count = std::min(length, block);
+        std::copy(input, input + count, workReal.begin() + history);
+
+        const size_t end = history + count;
+        while (windowEnd < end) {
+            output[produced++] = dot(currentWeights(), workReal.data() + windowEnd - history, kernelLength);
+            advance();
         }
+
+        // 保留最后kernelLength-1个样本作为下一块的历史
+        std::copy(workReal.begin() + count, workReal.begin() + end, workReal.begin());
+        windowEnd -= count;
+        input += count;
+        length -= count;
     }
-    
-    // 调整输出大小
-    output.resize(outputIndex);
-    
-    return output;
+    return produced;
+}
+
+// 流式重采样复数信号
+size_t Resampler::resample(const std::complex<double>* input, size_t length, std::complex<double>* output,
+                           size_t capacity) {
+    if (passthrough) {
+        if (capacity < length) {
+            LOG_ERROR("重采样输出缓冲区容量不足");
+            return 0;
+        }
+        std::copy(input, input + length, output);
+        return length;
+    }
+
+    if (kernelLength == 0 || capacity < getMaxOutputLength(length)) {
+        LOG_ERROR(kernelLength == 0 ? "重采样器未初始化" : "重采样输出缓冲区容量不足");
+        return 0;
+    }
+
+    std::vector<double>& real = workComplex[0];
+    std::vector<double>& imag = workComplex[1];
+    const size_t history = kernelLength - 1;
+    const size_t block = real.size() - history;
+    size_t produced = 0;
+    while (length > 0) {
+        const size_t count = std::min(length, block);
+        for (size_t i = 0; i < count; ++i) {
+            real[history + i] = input[i].real();
+            imag[history + i] = input[i].imag();
+        }
+
+        const size_t end = history + count;
+        while (windowEnd < end) {
+            const size_t start = windowEnd - history;
+            output[produced++] = dotComplex(currentWeights(), real.data() + start, imag.data() + start, kernelLength);
+            advance();
+        }
+
+        std::copy(real.begin() + count, real.begin() + end, real.begin());
+        std::copy(imag.begin() + count, imag.begin() + end, imag.begin());
+        windowEnd -= count;
+        input += count;
+        length -= count;
+    }
+    return produced;
+}
+
+// 一次输入length个样本时最多产生的输出样本数
+size_t Resampler::getMaxOutputLength(size_t length) const {
+    if (passthrough) {
+        return length;
+    }
+    if (usePolyphase) {
+        const unsigned long long up = static_cast<unsigned long long>(upFactor);
+        const unsigned long long down = static_cast<unsigned long long>(downFactor);
+        return static_cast<size_t>((length * up + down - 1) / down + 1);
+    }
+    return static_cast<size_t>(std::ceil(static_cast<double>(length) * ratio)) + 2;
 }
 
 // 获取输入采样率
@@ -252,199 +393,211 @@ Resampler::InterpolationMethod Resampler::getInterpolationMethod() const {
     return method;
 }
 
+// 当前是否使用多相滤波器组
+bool Resampler::isPolyphase() const {
+    return usePolyphase;
+}
+
+// 多相滤波器组的插值因子L
+int Resampler::getInterpolationFactor() const {
+    return usePolyphase ? upFactor : 0;
+}
+
+// 多相滤波器组的抽取因子M
+int Resampler::getDecimationFactor() const {
+    return usePolyphase ? downFactor : 0;
+}
+
+// 输出相对输入的延迟
+double Resampler::getDelay() const {
+    return delay;
+}
+
 // 重置重采样器状态
 void Resampler::reset() {
-    std::fill(bufferReal.begin(), bufferReal.end(), 0.0);
-    std::fill(bufferComplex.begin(), bufferComplex.end(), std::complex<double>(0.0, 0.0));
-    position = 0.0;
+    std::fill(workReal.begin(), workReal.end(), 0.0);
+    for (int part = 0; part < 2; ++part) {
+        std::fill(workComplex[part].begin(), workComplex[part].end(), 0.0);
+    }
+    // 第一个输出以第一个输入样本为最新样本
+    windowEnd = kernelLength > 0 ? kernelLength - 1 : 0;
+    phase = 0;
+    fraction = 0.0;
 }
 
 // 设计滤波器
 void Resampler::designFilter() {
-    // 计算截止频率
-    double cutoffFreq = std::min(inputRate, outputRate) / 2.0 * cutoffFactor;
-    
-    // 初始化滤波器
-    filter.initialize(FIRFilter::FilterType::LOWPASS, numTaps, cutoffFreq, std::max(inputRate, outputRate));
-    
-    // 设置窗函数
-    filter.setWindow(FIRFilter::WindowType::HAMMING);
-}
-
-// 最近邻插值(实数)
-double Resampler::interpolateNearest(const std::vector<double>& buffer, double position) const {
-    int index = static_cast<int>(std::round(position));
-    if (index < 0 || index >= static_cast<int>(buffer.size())) {
-        return 0.0;
-    }
-    return buffer[index];
-}
-
-// 线性插值(实数)
-double Resampler::interpolateLinear(const std::vector<double>& buffer, double position) const {
-    int index = static_cast<int>(std::floor(position));
-    double frac = position - index;
-    
-    if (index < 0 || index + 1 >= static_cast<int>(buffer.size())) {
-        return 0.0;
-    }
-    
-    return buffer[index] * (1.0 - frac) + buffer[index + 1] * frac;
-}
-
-// 三次插值(实数)
-double Resampler::interpolateCubic(const std::vector<double>& buffer, double position) const {
-    int index = static_cast<int>(std::floor(position));
-    double frac = position - index;
-    
-    if (index < 1 || index + 2 >= static_cast<int>(buffer.size())) {
-        return interpolateLinear(buffer, position);
-    }
-    
-    double p0 = buffer[index - 1];
-    double p1 = buffer[index];
-    double p2 = buffer[index + 1];
-    double p3 = buffer[index + 2];
-    
-    double a = -0.5 * p0 + 1.5 * p1 - 1.5 * p2 + 0.5 * p3;
-    double b = p0 - 2.5 * p1 + 2.0 * p2 - 0.5 * p3;
-    double c = -0.5 * p0 + 0.5 * p2;
-    double d = p1;
-    
-    return ((a * frac + b) * frac + c) * frac + d;
-}
-
-// Sinc插值(实数)
-double Resampler::interpolateSinc(const std::vector<double>& buffer, double position) const {
-    int index = static_cast<int>(std::floor(position));
-    double frac = position - index;
-    
-    if (index < 0 || index >= static_cast<int>(buffer.size())) {
-        return 0.0;
-    }
-    
-    // 使用Lanczos窗口的Sinc插值
-    int windowSize = 4;
-    double sum = 0.0;
-    double weightSum = 0.0;
-    
-    for (int i = -windowSize + 1; i <= windowSize; ++i) {
-        int idx = index + i;
-        if (idx < 0 || idx >= static_cast<int>(buffer.size())) {
-            continue;
+    passthrough = inputRate <= 0.0 || std::abs(ratio - 1.0) < 1e-6;
+    usePolyphase = false;
+    polyphaseTable.clear();
+    farrowTable.clear();
+    kernelLength = 0;
+    delay = 0.0;
+
+    if (!passthrough) {
+        if (method == InterpolationMethod::SINC &&
+            findRationalRatio(ratio, max_polyphase_phases, upFactor, downFactor)) {
+            designPolyphase();
         }
-        
-        double x = frac - i;
-        double weight = 0.0;
-        
-        if (x != 0.0) {
-            weight = std::sin(M_PI * x) / (M_PI * x);
-            if (std::abs(x) < windowSize) {
-                weight *= std::sin(M_PI * x / windowSize) / (M_PI * x / windowSize);
-            } else {
-                weight = 0.0;
-            }
-        } else {
-            weight = 1.0;
+        if (!usePolyphase) {
+            upFactor = 0;
+            downFactor = 0;
+            designFarrow();
+        }
+    }
+
+    weights.assign(kernelLength, 0.0);
+    for (std::vector<double>* work : {&workReal, &workComplex[0], &workComplex[1]}) {
+        work->assign(kernelLength > 0 ? kernelLength - 1 + resampler_block_size : 0, 0.0);
+    }
+    reset();
+}
+
+// 设计多相滤波器组
+void Resampler::designPolyphase() {
+    // 抽取时按抽取倍数加长滤波器，使过渡带相对输出采样率不变
+    const double scale = std::max(1.0, static_cast<double>(downFactor) / upFactor);
+    const size_t length = static_cast<size_t>(std::ceil(numTaps * scale));
+    if (length * static_cast<size_t>(upFactor) > max_polyphase_coefficients) {
+        return;
+    }
+
+    // 原型低通工作在L倍输入采样率，截止频率为较低奈奎斯特频率乘以截止因子
+    const size_t total = length * upFactor;
+    const double cutoff = cutoffFactor * std::min(1.0, static_cast<double>(upFactor) / downFactor) / 2.0 / upFactor;
+    const double center = (total - 1) / 2.0;
+
+    kernelLength = length;
+    polyphaseTable.assign(total, 0.0);
+    for (int p = 0; p < upFactor; ++p) {
+        double* row = polyphaseTable.data() + p * length;
+        double sum = 0.0;
+        for (size_t i = 0; i < length; ++i) {
+            // 第p相对x[n-i]的系数为h[p + i*L]
+            const size_t q = p + i * upFactor;
+            const double window = total > 1 ? 0.54 - 0.46 * std::cos(2.0 * M_PI * q / (total - 1)) : 1.0;
+            row[length - 1 - i] = 2.0 * cutoff * sinc(2.0 * cutoff * (q - center)) * window;
+            sum += row[length - 1 - i];
         }
-        
-        sum += buffer[idx] * weight;
-        weightSum += weight;
-    }
-    
-    if (weightSum != 0.0) {
-        return sum / weightSum;
-    } else {
-        return 0.0;
-    }
-}
-
-// 最近邻插值(复数)
-std::complex<double> Resampler::interpolateNearest(const std::vector<std::complex<double>>& buffer, double position) const {
-    int index = static_cast<int>(std::round(position));
-    if (index < 0 || index >= static_cast<int>(buffer.size())) {
-        return std::complex<double>(0.0, 0.0);
-    }
-    return buffer[index];
-}
-
-// 线性插值(复数)
-std::complex<double> Resampler::interpolateLinear(const std::vector<std::complex<double>>& buffer, double position) const {
-    int index = static_cast<int>(std::floor(position));
-    double frac = position - index;
-    
-    if (index < 0 || index + 1 >= static_cast<int>(buffer.size())) {
-        return std::complex<double>(0.0, 0.0);
-    }
-    
-    return buffer[index] * (1.0 - frac) + buffer[index + 1] * frac;
-}
-
-// 三次插值(复数)
-std::complex<double> Resampler::interpolateCubic(const std::vector<std::complex<double>>& buffer, double position) const {
-    int index = static_cast<int>(std::floor(position));
-    double frac = position - index;
-    
-    if (index < 1 || index + 2 >= static_cast<int>(buffer.size())) {
-        return interpolateLinear(buffer, position);
-    }
-    
-    std::complex<double> p0 = buffer[index - 1];
-    std::complex<double> p1 = buffer[index];
-    std::complex<double> p2 = buffer[index + 1];
-    std::complex<double> p3 = buffer[index + 2];
-    
-    std::complex<double> a = -0.5 * p0 + 1.5 * p1 - 1.5 * p2 + 0.5 * p3;
-    std::complex<double> b = p0 - 2.5 * p1 + 2.0 * p2 - 0.5 * p3;
-    std::complex<double> c = -0.5 * p0 + 0.5 * p2;
-    std::complex<double> d = p1;
-    
-    return ((a * frac + b) * frac + c) * frac + d;
-}
-
-// Sinc插值(复数)
-std::complex<double> Resampler::interpolateSinc(const std::vector<std::complex<double>>& buffer, double position) const {
-    int index = static_cast<int>(std::floor(position));
-    double frac = position - index;
-    
-    if (index < 0 || index >= static_cast<int>(buffer.size())) {
-        return std::complex<double>(0.0, 0.0);
-    }
-    
-    // 使用Lanczos窗口的Sinc插值
-    int windowSize = 4;
-    std::complex<double> sum(0.0, 0.0);
-    double weightSum = 0.0;
-    
-    for (int i = -windowSize + 1; i <= windowSize; ++i) {
-        int idx = index + i;
-        if (idx < 0 || idx >= static_cast<int>(buffer.size())) {
-            continue;
+        // 每相单独归一化，保证各相的直流增益都为1
+        for (size_t i = 0; i < length; ++i) {
+            row[i] /= sum;
         }
-        
-        double x = frac - i;
-        double weight = 0.0;
-        
-        if (x != 0.0) {
-            weight = std::sin(M_PI * x) / (M_PI * x);
-            if (std::abs(x) < windowSize) {
-                weight *= std::sin(M_PI * x / windowSize) / (M_PI * x / windowSize);
-            } else {
-                weight = 0.0;
+    }
+
+    delay = center / upFactor;
+    usePolyphase = true;
+}
+
+// 设计Farrow结构
+void Resampler::designFarrow() {
+    switch (method) {
+        case InterpolationMethod::NEAREST:
+            kernelLength = 2;
+            farrowDegree = 0;
+            farrowTable = {1.0, 0.0};
+            break;
+        case InterpolationMethod::LINEAR:
+            kernelLength = 2;
+            farrowDegree = 1;
+            farrowTable = {1.0, 0.0,
+                           -1.0, 1.0};
+            break;
+        case InterpolationMethod::CUBIC:
+            // Catmull-Rom样条，在window[1]和window[2]之间插值
+            kernelLength = 4;
+            farrowDegree = 3;
+            farrowTable = {0.0, 1.0, 0.0, 0.0,
+                           -0.5, 0.0, 0.5, 0.0,
+                           1.0, -2.5, 2.0, -0.5,
+                           -0.5, 1.5, -1.5, 0.5};
+            break;
+        case InterpolationMethod::SINC:
+        default: {
+            // 加窗Sinc原型，抽取时按比例展宽并降低截止频率
+            const double scale = std::max(1.0, 1.0 / ratio);
+            const size_t length = 2 * static_cast<size_t>(std::ceil(numTaps * scale / 2.0));
+            const double half = length / 2.0;
+            const double cutoff = cutoffFactor * std::min(1.0, ratio) / 2.0;
+            auto prototype = [&](double t) {
+                if (std::abs(t) >= half) {
+                    return 0.0;
+                }
+                return 2.0 * cutoff * sinc(2.0 * cutoff * t) * (0.54 + 0.46 * std::cos(M_PI * t / half));
+            };
+
+            // 在切比雪夫节点上对各抽头系数做多项式插值，
+            // 各节点的系数先归一化，多项式之和恒为1
+            const int nodes = farrow_sinc_degree + 1;
+            std::vector<double> vandermonde(nodes * nodes);
+            std::vector<double> values(nodes * length);
+            for (int i = 0; i < nodes; ++i) {
+                const double mu = 0.5 - 0.5 * std::cos(M_PI * (2 * i + 1) / (2.0 * nodes));
+                double power = 1.0;
+                for (int p = 0; p < nodes; ++p) {
+                    vandermonde[i * nodes + p] = power;
+                    power *= mu;
+                }
+                // 输出时刻为最新样本之前half-mu个样本，window[j]距其mu+half-1-j
+                double sum = 0.0;
+                for (size_t j = 0; j < length; ++j) {
+                    values[i * length + j] = prototype(mu + half - 1.0 - static_cast<double>(j));
+                    sum += values[i * length + j];
+                }
+                for (size_t j = 0; j < length; ++j) {
+                    values[i * length + j] /= sum;
+                }
             }
-        } else {
-            weight = 1.0;
+            solveLinearSystem(vandermonde, values, nodes, length);
+
+            kernelLength = length;
+            farrowDegree = farrow_sinc_degree;
+            farrowTable = values;
+            break;
         }
-        
-        sum += buffer[idx] * weight;
-        weightSum += weight;
     }
-    
-    if (weightSum != 0.0) {
-        return sum / weightSum;
-    } else {
-        return std::complex<double>(0.0, 0.0);
+
+    delay = kernelLength / 2.0;
+}
+
+// 当前输出时刻各输入样本的系数
+const double* Resampler::currentWeights() {
+    if (usePolyphase) {
+        return polyphaseTable.data() + phase * kernelLength;
+    }
+
+    if (method == InterpolationMethod::NEAREST) {
+        weights[0] = fraction < 0.5 ? 1.0 : 0.0;
+        weights[1] = 1.0 - weights[0];
+        return weights.data();
     }
+
+    // Horner法求各抽头系数 sum mu^p * C[p][j]，实部和虚部共用
+    const double* top = farrowTable.data() + farrowDegree * kernelLength;
+    std::copy(top, top + kernelLength, weights.begin());
+    for (int p = farrowDegree - 1; p >= 0; --p) {
+        const double* row = farrowTable.data() + p * kernelLength;
+        for (size_t j = 0; j < kernelLength; ++j) {
+            weights[j] = weights[j] * fraction + row[j];
+        }
+    }
+    return weights.data();
+}
+
+// 前进到下一个输出时刻
+void Resampler::advance() {
+    if (usePolyphase) {
+        // 相位以1/L输入样本为单位，整数运算没有累积误差
+        phase += downFactor;
+        windowEnd += phase / upFactor;
+        phase %= upFactor;
+        return;
+    }
+
+    fraction += 1.0 / ratio;
+    const double whole = std::floor(fraction);
+    windowEnd += static_cast<size_t>(whole);
+    fraction -= whole;
 }
 
 } // namespace signal_processing
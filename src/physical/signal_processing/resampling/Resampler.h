@@ -2,116 +2,184 @@
 #include <vector>
 #include <complex>
 #include <string>
-#include "../filter/FIRFilter.h"
+#include <cstddef>
 
 namespace link16 {
 namespace physical {
 namespace signal_processing {
 
-// 采样率转换类
+/**
+ * @brief 流式采样率转换
+ *
+ * SINC方法在采样率之比可化为L/M(L不超过max_polyphase_phases)时使用多相滤波器组，
+ * 否则与其他方法一样使用Farrow结构：每个抽头的系数是小数延迟mu的多项式，
+ * 每个输出先用Horner法求出各抽头系数再与输入做点积(实部和虚部共用)。
+ * 点积按FIR内核设置(setFIRKernel)选择AVX2或标量实现。
+ * 系数表在初始化时预先计算，延迟线在多次调用之间保持，
+ * 连续的输入块可以逐块转换，结果与一次转换整段信号相同。
+ * 输出相对输入延迟getDelay()个输入样本。
+ */
 class Resampler {
 public:
     // 插值方法
     enum class InterpolationMethod {
         NEAREST,    // 最近邻插值
         LINEAR,     // 线性插值
-        CUBIC,      // 三次插值
-        SINC        // Sinc插值
+        CUBIC,      // 三次插值(Catmull-Rom)
+        SINC        // 加窗Sinc插值(抗混叠)
     };
-    
+
+    // 多相滤波器组的最大相数L
+    static const int max_polyphase_phases = 1024;
+
     // 构造函数
     Resampler();
-    
+
     // 析构函数
     ~Resampler();
-    
+
     // 初始化
     bool initialize(double inputRate, double outputRate, InterpolationMethod method = InterpolationMethod::SINC);
-    
-    // 设置插值方法
+
+    // 设置插值方法，会清空延迟线
     void setInterpolationMethod(InterpolationMethod method);
-    
-    // 设置滤波器参数
+
+    // 设置滤波器参数(SINC方法每个输出使用的抽头数和相对于较低奈奎斯特频率的截止因子)
     void setFilterParams(int numTaps, double cutoffFactor = 0.5);
-    
+
     // 重采样实数信号
     std::vector<double> resample(const std::vector<double>& input);
-    
+
     // 重采样复数信号
     std::vector<std::complex<double>> resample(const std::vector<std::complex<double>>& input);
-    
+
+    /**
+     * @brief 流式重采样实数信号，输出写入调用者提供的缓冲区
+     * @param input 输入
+     * @param length 输入样本数
+     * @param output 输出
+     * @param capacity 输出缓冲区容量，不小于getMaxOutputLength(length)
+     * @return 输出样本数，容量不足或未初始化时为0且不消耗输入
+     */
+    size_t resample(const double* input, size_t length, double* output, size_t capacity);
+
+    /**
+     * @brief 流式重采样复数信号，输出写入调用者提供的缓冲区
+     * @param input 输入
+     * @param length 输入样本数
+     * @param output 输出
+     * @param capacity 输出缓冲区容量，不小于getMaxOutputLength(length)
+     * @return 输出样本数，容量不足或未初始化时为0且不消耗输入
+     */
+    size_t resample(const std::complex<double>* input, size_t length, std::complex<double>* output,
+                    size_t capacity);
+
+    // 一次输入length个样本时最多产生的输出样本数
+    size_t getMaxOutputLength(size_t length) const;
+
     // 获取输入采样率
     double getInputRate() const;
-    
+
     // 获取输出采样率
     double getOutputRate() const;
-    
+
     // 获取采样率比
     double getRatio() const;
-    
+
     // 获取插值方法
     InterpolationMethod getInterpolationMethod() const;
-    
+
+    // 当前是否使用多相滤波器组(否则为Farrow结构)
+    bool isPolyphase() const;
+
+    // 多相滤波器组的插值因子L，Farrow结构时为0
+    int getInterpolationFactor() const;
+
+    // 多相滤波器组的抽取因子M，Farrow结构时为0
+    int getDecimationFactor() const;
+
+    // 输出相对输入的延迟(输入样本数)
+    double getDelay() const;
+
     // 重置重采样器状态
     void reset();
 
 private:
     // 输入采样率
     double inputRate;
-    
+
     // 输出采样率
     double outputRate;
-    
+
     // 采样率比
     double ratio;
-    
+
     // 插值方法
     InterpolationMethod method;
-    
-    // 滤波器
-    FIRFilter filter;
-    
+
     // 滤波器阶数
     int numTaps;
-    
+
     // 截止频率因子
     double cutoffFactor;
-    
-    // 缓存(用于实数信号)
-    std::vector<double> bufferReal;
-    
-    // 缓存(用于复数信号)
-    std::vector<std::complex<double>> bufferComplex;
-    
-    // 缓存位置
-    double position;
-    
-    // 设计滤波器
+
+    // 采样率相同时直接复制
+    bool passthrough;
+
+    // 是否使用多相滤波器组
+    bool usePolyphase;
+
+    // 多相滤波器组的插值因子L和抽取因子M
+    int upFactor;
+    int downFactor;
+
+    // 每个输出使用的输入样本数
+    size_t kernelLength;
+
+    // 多相系数表，L行kernelLength列，每行按时间从旧到新排列
+    std::vector<double> polyphaseTable;
+
+    // Farrow多项式阶数
+    int farrowDegree;
+
+    // Farrow系数表，farrowDegree+1行kernelLength列，第p行为mu^p的系数
+    std::vector<double> farrowTable;
+
+    // 输出延迟(输入样本数)
+    double delay;
+
+    // Farrow结构当前输出时刻的系数
+    std::vector<double> weights;
+
+    // 实数信号工作区，前kernelLength-1个为历史样本，其后为本块输入
+    std::vector<double> workReal;
+
+    // 复数信号工作区(实部、虚部分开存放)，布局同workReal
+    std::vector<double> workComplex[2];
+
+    // 下一个输出所需的最新输入样本在工作区中的下标
+    size_t windowEnd;
+
+    // 下一个输出的相位(多相滤波器组，0~L-1)
+    int phase;
+
+    // 下一个输出的小数延迟(Farrow结构，0~1)
+    double fraction;
+
+    // 设计滤波器(计算系数表并清空延迟线)
     void designFilter();
-    
-    // 最近邻插值(实数)
-    double interpolateNearest(const std::vector<double>& buffer, double position) const;
-    
-    // 线性插值(实数)
-    double interpolateLinear(const std::vector<double>& buffer, double position) const;
-    
-    // 三次插值(实数)
-    double interpolateCubic(const std::vector<double>& buffer, double position) const;
-    
-    // Sinc插值(实数)
-    double interpolateSinc(const std::vector<double>& buffer, double position) const;
-    
-    // 最近邻插值(复数)
-    std::complex<double> interpolateNearest(const std::vector<std::complex<double>>& buffer, double position) const;
-    
-    // 线性插值(复数)
-    std::complex<double> interpolateLinear(const std::vector<std::complex<double>>& buffer, double position) const;
-    
-    // 三次插值(复数)
-    std::complex<double> interpolateCubic(const std::vector<std::complex<double>>& buffer, double position) const;
-    
-    // Sinc插值(复数)
-    std::complex<double> interpolateSinc(const std::vector<std::complex<double>>& buffer, double position) const;
+
+    // 设计多相滤波器组
+    void designPolyphase();
+
+    // 设计Farrow结构
+    void designFarrow();
+
+    // 当前输出时刻各输入样本的系数，与从旧到新的kernelLength个输入样本做点积
+    const double* currentWeights();
+
+    // 前进到下一个输出时刻
+    void advance();
 };
 
 } // namespace signal_processing
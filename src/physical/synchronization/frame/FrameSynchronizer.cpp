@@ -11,6 +11,7 @@ namespace synchronization {
 // 构造函数
 FrameSynchronizer::FrameSynchronizer()
     : syncSequence("0101010101010101"), correlationThreshold(0.7) {
+    updateSyncSignal();
 }
 
 // 析构函数
@@ -26,7 +27,7 @@ bool FrameSynchronizer::initialize() {
     correlationThreshold = 0.7;         // 70%相关阈值
     
     // 生成同步信号
-    generateSyncSignal();
+    updateSyncSignal();
     
     return true;
 }
@@ -37,7 +38,7 @@ void FrameSynchronizer::setSyncSequence(const std::string& sequence) {
     LOG_INFO("设置同步序列: " + sequence);
     
     // 重新生成同步信号
-    generateSyncSignal();
+    updateSyncSignal();
 }
 
 // 获取同步序列
@@ -57,14 +58,16 @@ bool FrameSynchronizer::detectSync(const std::vector<std::complex<double>>& sign
         return false;
     }
     
-    // 寻找最大相关性位置
+    // 一次算出全部位置的相关性，再寻找最大相关性位置
+    correlationBuffer.resize(signal.size() - syncSignal.size() + 1);
+    const size_t count = correlator.correlate(signal.data(), signal.size(), correlationBuffer.data());
+    
     double maxCorrelation = 0.0;
     syncPosition = 0;
     
-    for (size_t i = 0; i <= signal.size() - syncSignal.size(); ++i) {
-        double correlation = calculateCorrelation(signal, i);
-        if (correlation > maxCorrelation) {
-            maxCorrelation = correlation;
+    for (size_t i = 0; i < count; ++i) {
+        if (correlationBuffer[i] > maxCorrelation) {
+            maxCorrelation = correlationBuffer[i];
             syncPosition = i;
         }
     }
@@ -75,7 +78,35 @@ bool FrameSynchronizer::detectSync(const std::vector<std::complex<double>>& sign
     return maxCorrelation >= correlationThreshold;
 }
 
-// 计算相关性
+// 检测所有超过阈值的同步峰
+bool FrameSynchronizer::detectSyncPeaks(const std::vector<std::complex<double>>& signal,
+                                        std::vector<SyncPeak>& peaks) {
+    peaks.clear();
+    if (syncSignal.empty() || signal.size() < syncSignal.size()) {
+        LOG_ERROR("信号长度不足，无法检测同步序列");
+        return false;
+    }
+    
+    correlationBuffer.resize(signal.size() - syncSignal.size() + 1);
+    const size_t count = correlator.correlate(signal.data(), signal.size(), correlationBuffer.data());
+    SyncCorrelator::findPeaks(correlationBuffer.data(), count, correlationThreshold, 0, peaks);
+    
+    LOG_DEBUG("检出同步峰: " + std::to_string(peaks.size()) + " 个");
+    return !peaks.empty();
+}
+
+// 流式检测一块接收信号
+size_t FrameSynchronizer::processBlock(const std::complex<double>* block, size_t length,
+                                       std::vector<SyncPeak>& peaks) {
+    return correlator.process(block, length, correlationThreshold, peaks);
+}
+
+// 清空流式检测状态
+void FrameSynchronizer::resetStream() {
+    correlator.reset();
+}
+
+// 计算相关性(逐位置直接计算，作为SyncCorrelator的参考实现)
 double FrameSynchronizer::calculateCorrelation(const std::vector<std::complex<double>>& signal, size_t position) const {
     if (position + syncSignal.size() > signal.size()) {
         return 0.0;
@@ -119,7 +150,7 @@ double FrameSynchronizer::getCorrelationThreshold() const {
 }
 
 // 生成同步信号
-void FrameSynchronizer::generateSyncSignal() {
+void FrameSynchronizer::updateSyncSignal() {
     syncSignal.clear();
     syncSignal.reserve(syncSequence.length());
     
@@ -133,6 +164,9 @@ void FrameSynchronizer::generateSyncSignal() {
         }
     }
     
+    // 更换同步序列时流式检测状态一并清空
+    correlator.setReference(syncSignal);
+    
     LOG_INFO("生成同步信号: " + std::to_string(syncSignal.size()) + " 个样本");
 }
 
@@ -3,6 +3,7 @@
 #include <complex>
 #include <string>
 #include <cstdint>
+#include "SyncCorrelator.h"
 
 namespace link16 {
 namespace physical {
@@ -31,6 +32,26 @@ public:
     // 检测同步序列
     bool detectSync(const std::vector<std::complex<double>>& signal, size_t& syncPosition);
     
+    /**
+     * @brief 检测信号中所有超过相关阈值的同步峰
+     * @param signal 信号
+     * @param peaks 输出相关峰，按位置升序
+     * @return 是否检出同步序列
+     */
+    bool detectSyncPeaks(const std::vector<std::complex<double>>& signal, std::vector<SyncPeak>& peaks);
+    
+    /**
+     * @brief 流式检测一块接收信号，可以跨块检出同步序列
+     * @param block 信号块
+     * @param length 样本数
+     * @param peaks 追加检出的相关峰，位置为整个接收流中的样本下标
+     * @return 本块检出的峰值个数
+     */
+    size_t processBlock(const std::complex<double>* block, size_t length, std::vector<SyncPeak>& peaks);
+    
+    // 清空流式检测状态
+    void resetStream();
+    
     // 计算相关性
     double calculateCorrelation(const std::vector<std::complex<double>>& signal, size_t position) const;
     
@@ -50,8 +71,14 @@ private:
     // 同步信号
     std::vector<std::complex<double>> syncSignal;
     
+    // 滑动相关器
+    SyncCorrelator correlator;
+    
+    // 相关值缓冲区
+    std::vector<double> correlationBuffer;
+    
     // 生成同步信号
-    void generateSyncSignal();
+    void updateSyncSignal();
 };
 
 } // namespace synchronization
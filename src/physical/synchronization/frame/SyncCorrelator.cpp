@@ -0,0 +1,289 @@
+#include "SyncCorrelator.h"
+#include "physical/signal_processing/filter/FIRFilter.h"
+#include "core/utils/cpuFeatures.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(LINK16_ARCH_X86)
+#include <immintrin.h>
+#endif
+
+namespace link16 {
+namespace physical {
+namespace synchronization {
+
+using signal_processing::FIRKernelType;
+using signal_processing::getFIRKernel;
+
+namespace {
+
+// FFT的最小点数
+const size_t correlator_min_fft_size = 256;
+
+// 窗口能量低于本块最大窗口能量的该比例时视为0，避免滑动和的舍入误差被放大
+const double energy_floor_ratio = 1e-10;
+
+// out[p] = sum x[p+i]*r[i]，rImag为空时只计算实部
+void slidingDotScalar(const double* xReal, const double* xImag, const double* rReal, const double* rImag,
+                      size_t length, size_t begin, size_t count, double* output) {
+    for (size_t p = begin; p < count; ++p) {
+        double acc = 0.0;
+        for (size_t i = 0; i < length; ++i) {
+            acc += xReal[p + i] * rReal[i];
+        }
+        if (rImag) {
+            for (size_t i = 0; i < length; ++i) {
+                acc += xImag[p + i] * rImag[i];
+            }
+        }
+        output[p] = acc;
+    }
+}
+
+#if defined(LINK16_ARCH_X86)
+
+// 每次计算8个相邻位置，参考序列的每个点广播后与连续的信号样本相乘累加
+LINK16_TARGET("avx2,fma")
+void slidingDotAvx2(const double* xReal, const double* xImag, const double* rReal, const double* rImag,
+                    size_t length, size_t count, double* output) {
+    size_t p = 0;
+    for (; p + 8 <= count; p += 8) {
+        __m256d acc0 = _mm256_setzero_pd();
+        __m256d acc1 = _mm256_setzero_pd();
+        for (size_t i = 0; i < length; ++i) {
+            const __m256d r = _mm256_broadcast_sd(rReal + i);
+            acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(xReal + p + i), r, acc0);
+            acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(xReal + p + i + 4), r, acc1);
+        }
+        if (rImag) {
+            for (size_t i = 0; i < length; ++i) {
+                const __m256d r = _mm256_broadcast_sd(rImag + i);
+                acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(xImag + p + i), r, acc0);
+                acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(xImag + p + i + 4), r, acc1);
+            }
+        }
+        _mm256_storeu_pd(output + p, acc0);
+        _mm256_storeu_pd(output + p + 4, acc1);
+    }
+    slidingDotScalar(xReal, xImag, rReal, rImag, length, p, count, output);
+}
+
+#endif
+
+} // namespace
+
+// 构造函数
+SyncCorrelator::SyncCorrelator()
+    : referenceLength(0), referenceEnergy(0.0), realReference(true), fftReady(false), historyLength(0),
+      streamPosition(0), hasPending(false), pendingValue(0.0),
+      beforePendingValue(-std::numeric_limits<double>::infinity()) {
+}
+
+// 设置参考序列
+bool SyncCorrelator::setReference(const std::vector<std::complex<double>>& reference) {
+    reset();
+
+    double energy = 0.0;
+    bool real = true;
+    for (const auto& value : reference) {
+        energy += std::norm(value);
+        real = real && value.imag() == 0.0;
+    }
+    if (reference.empty() || energy <= 0.0) {
+        referenceLength = 0;
+        return false;
+    }
+
+    referenceLength = reference.size();
+    referenceEnergy = energy;
+    realReference = real;
+    referenceReal.resize(referenceLength);
+    referenceImag.resize(referenceLength);
+    for (size_t i = 0; i < referenceLength; ++i) {
+        // 相关使用参考序列的共轭: Re(x * conj(r)) = xr*rr + xi*ri
+        referenceReal[i] = reference[i].real();
+        referenceImag[i] = reference[i].imag();
+    }
+
+    fftReady = referenceLength >= fft_min_length;
+    if (fftReady) {
+        const size_t size = std::max(correlator_min_fft_size,
+                                     signal_processing::FFT::nextPowerOfTwo(4 * referenceLength));
+        fft.initialize(size);
+        referenceSpectrum.assign(size, std::complex<double>(0.0, 0.0));
+        std::copy(reference.begin(), reference.end(), referenceSpectrum.begin());
+        fft.forward(referenceSpectrum.data());
+        for (auto& value : referenceSpectrum) {
+            value = std::conj(value);
+        }
+        fftBuffer.resize(size);
+    }
+    return true;
+}
+
+// 获取参考序列长度
+size_t SyncCorrelator::getReferenceLength() const {
+    return referenceLength;
+}
+
+// 按当前FIR内核设置是否使用FFT计算相关
+bool SyncCorrelator::isUsingFFT() const {
+    if (!fftReady) {
+        return false;
+    }
+    return getFIRKernel() != FIRKernelType::AVX2 || referenceLength >= fft_min_length_avx2;
+}
+
+// 计算整段信号每个位置的归一化相关
+size_t SyncCorrelator::correlate(const std::complex<double>* signal, size_t length, double* output) {
+    if (referenceLength == 0 || length < referenceLength) {
+        return 0;
+    }
+    correlateBlock(signal, length, output);
+    return length - referenceLength + 1;
+}
+
+// 流式处理一块接收信号
+size_t SyncCorrelator::process(const std::complex<double>* block, size_t length, double threshold,
+                               std::vector<SyncPeak>& peaks) {
+    if (referenceLength == 0) {
+        return 0;
+    }
+
+    streamBuffer.resize(historyLength + length);
+    std::copy(block, block + length, streamBuffer.begin() + historyLength);
+
+    size_t found = 0;
+    const size_t total = streamBuffer.size();
+    if (total >= referenceLength) {
+        const size_t count = total - referenceLength + 1;
+        streamCorrelation.resize(count);
+        correlateBlock(streamBuffer.data(), total, streamCorrelation.data());
+
+        // 工作区第0个样本在整个流中的下标
+        const uint64_t base = streamPosition - historyLength;
+        for (size_t k = 0; k < count; ++k) {
+            const double value = streamCorrelation[k];
+            if (hasPending && pendingValue >= threshold && pendingValue >= beforePendingValue &&
+                pendingValue > value) {
+                peaks.push_back(SyncPeak{base + k - 1, pendingValue});
+                ++found;
+            }
+            beforePendingValue = hasPending ? pendingValue : -std::numeric_limits<double>::infinity();
+            pendingValue = value;
+            hasPending = true;
+        }
+    }
+
+    // 保留最后referenceLength-1个样本，与下一块拼接
+    historyLength = std::min(total, referenceLength - 1);
+    std::copy(streamBuffer.end() - historyLength, streamBuffer.end(), streamBuffer.begin());
+    streamBuffer.resize(historyLength);
+    streamPosition += length;
+    return found;
+}
+
+// 清空流式状态
+void SyncCorrelator::reset() {
+    streamBuffer.clear();
+    historyLength = 0;
+    streamPosition = 0;
+    hasPending = false;
+    pendingValue = 0.0;
+    beforePendingValue = -std::numeric_limits<double>::infinity();
+}
+
+// 流式处理已输入的样本数
+uint64_t SyncCorrelator::getStreamPosition() const {
+    return streamPosition;
+}
+
+// 查找不低于门限的局部最大值
+size_t SyncCorrelator::findPeaks(const double* correlation, size_t count, double threshold, uint64_t offset,
+                                 std::vector<SyncPeak>& peaks) {
+    const double lowest = -std::numeric_limits<double>::infinity();
+    size_t found = 0;
+    for (size_t k = 0; k < count; ++k) {
+        const double value = correlation[k];
+        const double left = k > 0 ? correlation[k - 1] : lowest;
+        const double right = k + 1 < count ? correlation[k + 1] : lowest;
+        if (value >= threshold && value >= left && value > right) {
+            peaks.push_back(SyncPeak{offset + k, value});
+            ++found;
+        }
+    }
+    return found;
+}
+
+// 计算全部位置的归一化相关
+void SyncCorrelator::correlateBlock(const std::complex<double>* signal, size_t length, double* output) {
+    const size_t count = length - referenceLength + 1;
+
+    if (isUsingFFT()) {
+        correlateFFT(signal, count, output);
+    } else {
+        workReal.resize(length);
+        workImag.resize(length);
+        for (size_t i = 0; i < length; ++i) {
+            workReal[i] = signal[i].real();
+            workImag[i] = signal[i].imag();
+        }
+        const double* imag = realReference ? nullptr : referenceImag.data();
+#if defined(LINK16_ARCH_X86)
+        if (getFIRKernel() == FIRKernelType::AVX2) {
+            slidingDotAvx2(workReal.data(), workImag.data(), referenceReal.data(), imag, referenceLength, count,
+                           output);
+        } else
+#endif
+        {
+            slidingDotScalar(workReal.data(), workImag.data(), referenceReal.data(), imag, referenceLength, 0,
+                             count, output);
+        }
+    }
+
+    // 窗口能量滑动递推，每块从头精确求和
+    double energy = 0.0;
+    for (size_t i = 0; i < referenceLength; ++i) {
+        energy += std::norm(signal[i]);
+    }
+    double maxEnergy = 0.0;
+    for (size_t p = 0; p < count; ++p) {
+        maxEnergy = std::max(maxEnergy, energy);
+        if (energy > energy_floor_ratio * maxEnergy && energy > 0.0) {
+            output[p] /= std::sqrt(energy * referenceEnergy);
+        } else {
+            output[p] = 0.0;
+        }
+        if (p + 1 < count) {
+            energy += std::norm(signal[p + referenceLength]) - std::norm(signal[p]);
+        }
+    }
+}
+
+// FFT重叠保留法计算未归一化的相关
+void SyncCorrelator::correlateFFT(const std::complex<double>* signal, size_t count, double* output) {
+    const size_t size = fft.getSize();
+    const size_t step = size - referenceLength + 1;
+
+    for (size_t start = 0; start < count; start += step) {
+        const size_t outputs = std::min(step, count - start);
+        const size_t inputs = outputs + referenceLength - 1;
+        std::copy(signal + start, signal + start + inputs, fftBuffer.begin());
+        std::fill(fftBuffer.begin() + inputs, fftBuffer.end(), std::complex<double>(0.0, 0.0));
+
+        // 循环互相关的前step个点没有回绕
+        fft.forward(fftBuffer.data());
+        for (size_t k = 0; k < size; ++k) {
+            fftBuffer[k] *= referenceSpectrum[k];
+        }
+        fft.inverse(fftBuffer.data());
+        for (size_t k = 0; k < outputs; ++k) {
+            output[start + k] = fftBuffer[k].real();
+        }
+    }
+}
+
+} // namespace synchronization
+} // namespace physical
+} // namespace link16
@@ -0,0 +1,147 @@
+#pragma once
+#include <vector>
+#include <complex>
+#include <cstdint>
+#include <cstddef>
+#include "physical/signal_processing/fft/FFT.h"
+
+namespace link16 {
+namespace physical {
+namespace synchronization {
+
+// 同步相关峰
+struct SyncPeak {
+    // 同步序列起点在信号(流式处理时为整个接收流)中的样本下标
+    uint64_t position;
+
+    // 归一化相关值
+    double correlation;
+};
+
+/**
+ * @brief 同步序列滑动相关器
+ *
+ * 每个位置的相关值为Re(sum x[p+i] * conj(r[i])) / sqrt(E_x(p) * E_r)，与
+ * FrameSynchronizer::calculateCorrelation相同。窗口能量E_x(p)用滑动和递推，
+ * 参考序列能量只算一次。参考序列较短时直接计算滑动点积(实部虚部分开存放，
+ * 按FIR内核设置选择AVX2或标量实现)，否则用FFT重叠保留法做互相关；AVX2直接计算
+ * 更快，切换长度也更长。
+ * 流式处理时保留最近referenceLength-1个样本，跨块的同步序列同样能检出，
+ * 结果与一次处理整段信号相同。
+ */
+class SyncCorrelator {
+public:
+    // 参考序列不短于该长度时使用FFT，分别对应标量和AVX2内核
+    static const size_t fft_min_length = 64;
+    static const size_t fft_min_length_avx2 = 192;
+
+    // 构造函数
+    SyncCorrelator();
+
+    /**
+     * @brief 设置参考(同步)序列，同时清空流式状态
+     * @param reference 参考序列
+     * @return 序列是否有效(非空且能量不为0)
+     */
+    bool setReference(const std::vector<std::complex<double>>& reference);
+
+    // 获取参考序列长度
+    size_t getReferenceLength() const;
+
+    // 按当前FIR内核设置是否使用FFT计算相关
+    bool isUsingFFT() const;
+
+    /**
+     * @brief 计算整段信号每个位置的归一化相关，不影响流式状态
+     * @param signal 信号
+     * @param length 信号样本数
+     * @param output 输出，length-referenceLength+1个
+     * @return 输出个数，信号短于参考序列时为0
+     */
+    size_t correlate(const std::complex<double>* signal, size_t length, double* output);
+
+    /**
+     * @brief 流式处理一块接收信号，追加本块内确定的相关峰
+     *
+     * 峰值为不低于门限的局部最大值；位置p是否为峰值要看到p+1的相关值才能确定，
+     * 因此最后一个位置留到下一块处理。
+     * @param block 信号块
+     * @param length 样本数
+     * @param threshold 相关门限
+     * @param peaks 追加检出的相关峰
+     * @return 本次检出的峰值个数
+     */
+    size_t process(const std::complex<double>* block, size_t length, double threshold,
+                   std::vector<SyncPeak>& peaks);
+
+    // 清空流式状态，之后的样本下标从0开始
+    void reset();
+
+    // 流式处理已输入的样本数
+    uint64_t getStreamPosition() const;
+
+    /**
+     * @brief 在相关序列中查找不低于门限的局部最大值，两端之外视为负无穷
+     * @param correlation 相关序列
+     * @param count 个数
+     * @param threshold 门限
+     * @param offset 第0个相关值对应的样本下标
+     * @param peaks 追加检出的相关峰
+     * @return 检出的峰值个数
+     */
+    static size_t findPeaks(const double* correlation, size_t count, double threshold, uint64_t offset,
+                            std::vector<SyncPeak>& peaks);
+
+private:
+    // 计算signal中全部length-referenceLength+1个位置的归一化相关
+    void correlateBlock(const std::complex<double>* signal, size_t length, double* output);
+
+    // FFT重叠保留法计算未归一化的相关
+    void correlateFFT(const std::complex<double>* signal, size_t count, double* output);
+
+    // 参考序列长度
+    size_t referenceLength;
+
+    // 参考序列实部和虚部
+    std::vector<double> referenceReal;
+    std::vector<double> referenceImag;
+
+    // 参考序列能量
+    double referenceEnergy;
+
+    // 参考序列是否为实数(虚部全为0时直接计算只需一半乘法)
+    bool realReference;
+
+    // FFT是否已准备好(参考序列不短于fft_min_length)
+    bool fftReady;
+
+    // FFT及参考序列频谱的共轭
+    signal_processing::FFT fft;
+    std::vector<std::complex<double>> referenceSpectrum;
+    std::vector<std::complex<double>> fftBuffer;
+
+    // 直接计算时的信号实部和虚部
+    std::vector<double> workReal;
+    std::vector<double> workImag;
+
+    // 流式处理的工作区，前referenceLength-1个为上一块留下的样本
+    std::vector<std::complex<double>> streamBuffer;
+
+    // 流式处理的相关值
+    std::vector<double> streamCorrelation;
+
+    // 工作区中保留的历史样本数
+    size_t historyLength;
+
+    // 已输入的样本数
+    uint64_t streamPosition;
+
+    // 尚未确定是否为峰值的最后一个相关值及其前一个值
+    bool hasPending;
+    double pendingValue;
+    double beforePendingValue;
+};
+
+} // namespace synchronization
+} // namespace physical
+} // namespace link16
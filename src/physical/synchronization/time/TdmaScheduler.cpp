@@ -0,0 +1,347 @@
+#include "TdmaScheduler.h"
+#include "core/utils/logger.h"
+#include "core/utils/cpuFeatures.h"
+#include <algorithm>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <time.h>
+#endif
+
+#if defined(LINK16_ARCH_X86)
+#include <immintrin.h>
+#endif
+
+namespace link16 {
+namespace physical {
+namespace synchronization {
+
+namespace {
+
+// 默认参数
+const uint32_t default_lookahead = 2;
+const uint64_t default_spin_time_ns = 100000;
+const uint64_t default_bin_width_ns = 1000;
+const size_t default_bin_count = 1000;
+
+// 忙等循环中让出流水线
+inline void cpuRelax() {
+#if defined(LINK16_ARCH_X86)
+    _mm_pause();
+#endif
+}
+
+} // namespace
+
+const uint64_t TdmaScheduler::default_slot_length_ns;
+const uint32_t TdmaScheduler::max_lookahead;
+
+// 按直方图估计分位数
+uint64_t SlotJitterHistogram::percentile(double fraction) const {
+    const double target = fraction * count;
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < bins.size(); ++i) {
+        cumulative += bins[i];
+        if (cumulative > 0 && cumulative >= target) {
+            return (i + 1) * binWidth;
+        }
+    }
+    return max;
+}
+
+// 构造函数
+TdmaScheduler::TdmaScheduler()
+    : slotLength(default_slot_length_ns), lookahead(default_lookahead), spinTime(default_spin_time_ns),
+      nextSlot(0), binWidth(default_bin_width_ns), binCount(default_bin_count), overflowCount(0), jitterCount(0),
+      jitterSum(0), jitterMax(0), missedSlots(0), latePreparations(0), running(false) {
+    bins.reset(new std::atomic<uint64_t>[binCount]);
+    resetStatistics();
+}
+
+// 析构函数
+TdmaScheduler::~TdmaScheduler() {
+    stop();
+}
+
+// 设置时隙长度
+bool TdmaScheduler::setSlotLength(uint64_t length) {
+    if (running.load() || length == 0) {
+        LOG_ERROR("无法设置时隙长度: " + std::to_string(length) + " 纳秒");
+        return false;
+    }
+    slotLength = length;
+    return true;
+}
+
+// 获取时隙长度
+uint64_t TdmaScheduler::getSlotLength() const {
+    return slotLength;
+}
+
+// 设置提前准备的时隙数
+bool TdmaScheduler::setLookahead(uint32_t slots) {
+    if (running.load() || slots < 1 || slots > max_lookahead) {
+        LOG_ERROR("无法设置提前准备的时隙数: " + std::to_string(slots));
+        return false;
+    }
+    lookahead = slots;
+    return true;
+}
+
+// 获取提前准备的时隙数
+uint32_t TdmaScheduler::getLookahead() const {
+    return lookahead;
+}
+
+// 设置忙等时间
+bool TdmaScheduler::setSpinTime(uint64_t time) {
+    if (time >= slotLength) {
+        LOG_ERROR("忙等时间必须小于时隙长度: " + std::to_string(time) + " 纳秒");
+        return false;
+    }
+    spinTime.store(time, std::memory_order_relaxed);
+    return true;
+}
+
+// 获取忙等时间
+uint64_t TdmaScheduler::getSpinTime() const {
+    return spinTime.load(std::memory_order_relaxed);
+}
+
+// 设置抖动直方图
+bool TdmaScheduler::setHistogram(uint64_t binWidth, size_t binCount) {
+    if (running.load() || binWidth == 0 || binCount == 0) {
+        LOG_ERROR("无法设置抖动直方图");
+        return false;
+    }
+    this->binWidth = binWidth;
+    this->binCount = binCount;
+    bins.reset(new std::atomic<uint64_t>[binCount]);
+    resetStatistics();
+    return true;
+}
+
+// 设置准备回调
+void TdmaScheduler::setPrepareCallback(PrepareCallback callback) {
+    if (running.load()) {
+        LOG_ERROR("调度运行中，无法设置准备回调");
+        return;
+    }
+    prepareCallback = std::move(callback);
+}
+
+// 设置发射回调
+void TdmaScheduler::setDispatchCallback(DispatchCallback callback) {
+    if (running.load()) {
+        LOG_ERROR("调度运行中，无法设置发射回调");
+        return;
+    }
+    dispatchCallback = std::move(callback);
+}
+
+// 开始调度
+bool TdmaScheduler::start(std::chrono::steady_clock::time_point epoch, uint64_t firstSlot) {
+    if (running.load()) {
+        LOG_WARNING("TDMA调度已在运行");
+        return false;
+    }
+
+    this->epoch = epoch;
+    nextSlot.store(firstSlot);
+    buffers.reset(new SlotBuffer[lookahead + 1]);
+    for (uint32_t i = 0; i <= lookahead; ++i) {
+        buffers[i].readySlot.store(0);
+        buffers[i].transmit = false;
+    }
+
+    running.store(true);
+    prepareThread = std::thread(&TdmaScheduler::prepareLoop, this);
+    timingThread = std::thread(&TdmaScheduler::timingLoop, this);
+
+    LOG_INFO("开始TDMA调度: 时隙长度" + std::to_string(slotLength) + "纳秒，提前准备" + std::to_string(lookahead) +
+             "个时隙，起始时隙" + std::to_string(firstSlot));
+    return true;
+}
+
+// 从当前时刻一个时隙之后开始调度
+bool TdmaScheduler::start() {
+    return start(std::chrono::steady_clock::now() + std::chrono::nanoseconds(slotLength), 0);
+}
+
+// 停止调度
+void TdmaScheduler::stop() {
+    if (!running.exchange(false)) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(prepareMutex);
+    }
+    prepareCondition.notify_all();
+
+    if (timingThread.joinable()) {
+        timingThread.join();
+    }
+    if (prepareThread.joinable()) {
+        prepareThread.join();
+    }
+
+    LOG_INFO("停止TDMA调度，下一个时隙: " + std::to_string(nextSlot.load()));
+}
+
+// 是否正在调度
+bool TdmaScheduler::isRunning() const {
+    return running.load();
+}
+
+// 下一个要分发的时隙
+uint64_t TdmaScheduler::getNextSlot() const {
+    return nextSlot.load(std::memory_order_acquire);
+}
+
+// 获取抖动统计
+SlotJitterHistogram TdmaScheduler::getJitterHistogram() const {
+    SlotJitterHistogram histogram;
+    histogram.binWidth = binWidth;
+    histogram.bins.resize(binCount);
+    for (size_t i = 0; i < binCount; ++i) {
+        histogram.bins[i] = bins[i].load(std::memory_order_relaxed);
+    }
+    histogram.overflow = overflowCount.load(std::memory_order_relaxed);
+    histogram.count = jitterCount.load(std::memory_order_relaxed);
+    histogram.mean = histogram.count > 0
+                         ? static_cast<double>(jitterSum.load(std::memory_order_relaxed)) / histogram.count
+                         : 0.0;
+    histogram.max = jitterMax.load(std::memory_order_relaxed);
+    histogram.missedSlots = missedSlots.load(std::memory_order_relaxed);
+    histogram.latePreparations = latePreparations.load(std::memory_order_relaxed);
+    return histogram;
+}
+
+// 清空抖动统计
+void TdmaScheduler::resetStatistics() {
+    for (size_t i = 0; i < binCount; ++i) {
+        bins[i].store(0, std::memory_order_relaxed);
+    }
+    overflowCount.store(0, std::memory_order_relaxed);
+    jitterCount.store(0, std::memory_order_relaxed);
+    jitterSum.store(0, std::memory_order_relaxed);
+    jitterMax.store(0, std::memory_order_relaxed);
+    missedSlots.store(0, std::memory_order_relaxed);
+    latePreparations.store(0, std::memory_order_relaxed);
+}
+
+// 定时线程主循环
+void TdmaScheduler::timingLoop() {
+    uint64_t slot = nextSlot.load(std::memory_order_relaxed);
+
+    while (running.load(std::memory_order_acquire)) {
+        const auto deadline = slotStart(slot);
+
+        // 落后一个时隙以上时直接跳到当前时隙，不补发过期的时隙
+        const auto behind = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now() - deadline).count();
+        if (behind >= static_cast<int64_t>(slotLength)) {
+            const uint64_t skipped = static_cast<uint64_t>(behind) / slotLength;
+            missedSlots.fetch_add(skipped, std::memory_order_relaxed);
+            slot += skipped;
+            nextSlot.store(slot, std::memory_order_release);
+            continue;
+        }
+
+        waitUntil(deadline);
+        const auto lateness = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                  std::chrono::steady_clock::now() - deadline).count();
+        recordJitter(static_cast<uint64_t>(std::max<int64_t>(lateness, 0)));
+
+        SlotBuffer& buffer = buffers[slot % (lookahead + 1)];
+        if (buffer.readySlot.load(std::memory_order_acquire) == slot + 1) {
+            if (buffer.transmit && dispatchCallback) {
+                dispatchCallback(slot, buffer.samples);
+            }
+        } else {
+            latePreparations.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // 腾出的缓冲区交给准备线程
+        ++slot;
+        nextSlot.store(slot, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(prepareMutex);
+        }
+        prepareCondition.notify_one();
+    }
+}
+
+// 准备线程主循环
+void TdmaScheduler::prepareLoop() {
+    uint64_t slot = nextSlot.load(std::memory_order_acquire);
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(prepareMutex);
+            prepareCondition.wait(lock, [&]() {
+                return !running.load(std::memory_order_acquire) ||
+                       slot <= nextSlot.load(std::memory_order_acquire) + lookahead;
+            });
+            if (!running.load(std::memory_order_acquire)) {
+                break;
+            }
+        }
+
+        // 已经错过的时隙不再准备
+        slot = std::max(slot, nextSlot.load(std::memory_order_acquire));
+
+        SlotBuffer& buffer = buffers[slot % (lookahead + 1)];
+        buffer.transmit = prepareCallback ? prepareCallback(slot, buffer.samples) : false;
+        buffer.readySlot.store(slot + 1, std::memory_order_release);
+        ++slot;
+    }
+}
+
+// 睡眠并忙等到deadline
+void TdmaScheduler::waitUntil(std::chrono::steady_clock::time_point deadline) const {
+    const auto wake = deadline - std::chrono::nanoseconds(spinTime.load(std::memory_order_relaxed));
+
+#if defined(__linux__)
+    // steady_clock即CLOCK_MONOTONIC，按绝对时刻睡眠，被信号打断时继续
+    const auto since = std::chrono::duration_cast<std::chrono::nanoseconds>(wake.time_since_epoch()).count();
+    if (since > 0) {
+        struct timespec target;
+        target.tv_sec = static_cast<time_t>(since / 1000000000);
+        target.tv_nsec = static_cast<long>(since % 1000000000);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &target, nullptr) == EINTR) {
+        }
+    }
+#else
+    std::this_thread::sleep_until(wake);
+#endif
+
+    while (std::chrono::steady_clock::now() < deadline) {
+        cpuRelax();
+    }
+}
+
+// 记录一个时隙的抖动
+void TdmaScheduler::recordJitter(uint64_t lateness) {
+    const uint64_t bin = lateness / binWidth;
+    if (bin < binCount) {
+        bins[bin].fetch_add(1, std::memory_order_relaxed);
+    } else {
+        overflowCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    jitterCount.fetch_add(1, std::memory_order_relaxed);
+    jitterSum.fetch_add(lateness, std::memory_order_relaxed);
+    if (lateness > jitterMax.load(std::memory_order_relaxed)) {
+        jitterMax.store(lateness, std::memory_order_relaxed);
+    }
+}
+
+// 获取时隙的开始时刻
+std::chrono::steady_clock::time_point TdmaScheduler::slotStart(uint64_t slot) const {
+    return epoch + std::chrono::nanoseconds(static_cast<int64_t>(slot * slotLength));
+}
+
+} // namespace synchronization
+} // namespace physical
+} // namespace link16
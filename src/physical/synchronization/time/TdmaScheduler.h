@@ -0,0 +1,210 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <complex>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace link16 {
+namespace physical {
+namespace synchronization {
+
+// 时隙边界抖动统计
+struct SlotJitterHistogram {
+    // 每个区间的宽度(纳秒)，第i个区间为[i*binWidth, (i+1)*binWidth)
+    uint64_t binWidth;
+
+    // 各区间的时隙数
+    std::vector<uint64_t> bins;
+
+    // 超出最后一个区间的时隙数
+    uint64_t overflow;
+
+    // 统计的时隙数
+    uint64_t count;
+
+    // 平均和最大抖动(纳秒)
+    double mean;
+    uint64_t max;
+
+    // 唤醒太晚整个跳过的时隙数
+    uint64_t missedSlots;
+
+    // 到时隙边界时发射缓冲区还没准备好的时隙数
+    uint64_t latePreparations;
+
+    /**
+     * @brief 按直方图估计分位数
+     * @param fraction 分位(0-1)
+     * @return 所在区间的上界(纳秒)，落在溢出区间时为最大抖动
+     */
+    uint64_t percentile(double fraction) const;
+};
+
+/**
+ * @brief TDMA时隙调度器
+ *
+ * 定时线程按绝对时刻睡眠到每个时隙边界之前spinTime处(Linux上为clock_nanosleep)，
+ * 再忙等到边界，然后把已经准备好的发射缓冲区交给发射回调；每个时隙记录实际分发时刻
+ * 相对边界的延迟。准备线程提前lookahead个时隙调用准备回调填充发射缓冲区(调制、编码等
+ * 耗时操作)，不占用定时线程。时隙n的边界为epoch + n * slotLength。
+ * 准备回调和发射回调分别只在准备线程和定时线程中调用。
+ */
+class TdmaScheduler {
+public:
+    // 发射缓冲区
+    typedef std::vector<std::complex<float>> SampleBuffer;
+
+    /**
+     * 准备回调: 填充时隙slot的发射样本，返回该时隙是否发射。
+     * buffer保留上一次使用时的容量，可直接resize后写入。
+     */
+    typedef std::function<bool(uint64_t slot, SampleBuffer& buffer)> PrepareCallback;
+
+    // 发射回调: 在时隙边界调用，只对准备回调返回true的时隙调用
+    typedef std::function<void(uint64_t slot, const SampleBuffer& buffer)> DispatchCallback;
+
+    // Link16时隙长度(纳秒)
+    static const uint64_t default_slot_length_ns = 7812500;
+
+    // 最多提前准备的时隙数
+    static const uint32_t max_lookahead = 4;
+
+    // 构造函数
+    TdmaScheduler();
+
+    // 析构函数，停止调度
+    ~TdmaScheduler();
+
+    // 设置时隙长度(纳秒)，运行中不能修改
+    bool setSlotLength(uint64_t length);
+
+    // 获取时隙长度(纳秒)
+    uint64_t getSlotLength() const;
+
+    // 设置提前准备的时隙数[1, max_lookahead]
+    bool setLookahead(uint32_t slots);
+
+    // 获取提前准备的时隙数
+    uint32_t getLookahead() const;
+
+    // 设置时隙边界前忙等的时间(纳秒)，0表示只睡眠
+    bool setSpinTime(uint64_t time);
+
+    // 获取忙等时间(纳秒)
+    uint64_t getSpinTime() const;
+
+    /**
+     * @brief 设置抖动直方图，运行中不能修改
+     * @param binWidth 区间宽度(纳秒)
+     * @param binCount 区间个数
+     */
+    bool setHistogram(uint64_t binWidth, size_t binCount);
+
+    // 设置准备回调
+    void setPrepareCallback(PrepareCallback callback);
+
+    // 设置发射回调
+    void setDispatchCallback(DispatchCallback callback);
+
+    /**
+     * @brief 开始调度
+     * @param epoch 第0个时隙的开始时刻
+     * @param firstSlot 第一个调度的时隙，早于当前时刻的时隙直接跳过(计入missedSlots)
+     * @return 是否成功启动
+     */
+    bool start(std::chrono::steady_clock::time_point epoch, uint64_t firstSlot = 0);
+
+    // 从当前时刻一个时隙之后开始调度，第一个时隙号为0
+    bool start();
+
+    // 停止调度，等待两个线程退出
+    void stop();
+
+    // 是否正在调度
+    bool isRunning() const;
+
+    // 下一个要分发的时隙
+    uint64_t getNextSlot() const;
+
+    // 获取抖动统计
+    SlotJitterHistogram getJitterHistogram() const;
+
+    // 清空抖动统计
+    void resetStatistics();
+
+private:
+    // 一个时隙的发射缓冲区
+    struct SlotBuffer {
+        SampleBuffer samples;
+
+        // 已准备好的时隙号加1，0表示空闲
+        std::atomic<uint64_t> readySlot;
+
+        // 该时隙是否发射
+        bool transmit;
+    };
+
+    // 定时线程主循环
+    void timingLoop();
+
+    // 准备线程主循环
+    void prepareLoop();
+
+    // 睡眠并忙等到deadline
+    void waitUntil(std::chrono::steady_clock::time_point deadline) const;
+
+    // 记录一个时隙的抖动
+    void recordJitter(uint64_t lateness);
+
+    // 获取时隙的开始时刻
+    std::chrono::steady_clock::time_point slotStart(uint64_t slot) const;
+
+    // 参数
+    uint64_t slotLength;
+    uint32_t lookahead;
+    std::atomic<uint64_t> spinTime;
+
+    // 回调
+    PrepareCallback prepareCallback;
+    DispatchCallback dispatchCallback;
+
+    // 时隙缓冲区，时隙n使用第n % (lookahead + 1)个
+    std::unique_ptr<SlotBuffer[]> buffers;
+
+    // 调度起点
+    std::chrono::steady_clock::time_point epoch;
+
+    // 下一个要分发的时隙，只由定时线程修改
+    std::atomic<uint64_t> nextSlot;
+
+    // 抖动直方图，只由定时线程累加
+    uint64_t binWidth;
+    size_t binCount;
+    std::unique_ptr<std::atomic<uint64_t>[]> bins;
+    std::atomic<uint64_t> overflowCount;
+    std::atomic<uint64_t> jitterCount;
+    std::atomic<uint64_t> jitterSum;
+    std::atomic<uint64_t> jitterMax;
+    std::atomic<uint64_t> missedSlots;
+    std::atomic<uint64_t> latePreparations;
+
+    // 运行状态
+    std::atomic<bool> running;
+
+    // 唤醒准备线程
+    std::mutex prepareMutex;
+    std::condition_variable prepareCondition;
+
+    std::thread timingThread;
+    std::thread prepareThread;
+};
+
+} // namespace synchronization
+} // namespace physical
+} // namespace link16
@@ -7,9 +7,11 @@ namespace link16 {
 namespace physical {
 namespace synchronization {
 
+const uint64_t TimeSynchronizer::default_slot_length_ns;
+
 // 构造函数
 TimeSynchronizer::TimeSynchronizer()
-    : timeSlotLength(7800), timeSlotOffset(0), synchronized(false) {
+    : timeSlotLengthNs(default_slot_length_ns), timeSlotOffset(0), synchronized(false) {
 }
 
 // 析构函数
@@ -24,7 +26,7 @@ bool TimeSynchronizer::initialize() {
     syncStartTime = std::chrono::steady_clock::now();
     
     // 设置默认参数
-    timeSlotLength = 7800;  // 7.8ms
+    timeSlotLengthNs = default_slot_length_ns;  // 7.8125ms
     timeSlotOffset = 0;
     
     synchronized = true;
@@ -53,8 +55,17 @@ uint32_t TimeSynchronizer::getCurrentTimeSlot() {
 uint64_t TimeSynchronizer::getNextTimeSlotStart() {
     uint64_t timestamp = getCurrentTimestamp();
     uint32_t currentSlot = calculateTimeSlotIndex(timestamp);
-    uint64_t nextSlotStart = (currentSlot + 1) * static_cast<uint64_t>(timeSlotLength) + timeSlotOffset;
-    return nextSlotStart;
+    auto nextSlotStart = getTimeSlotStart(currentSlot + 1) - syncStartTime;
+    
+    // 向上取整到微秒，保证返回时刻不早于时隙边界
+    auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(nextSlotStart).count();
+    return static_cast<uint64_t>((nanoseconds + 999) / 1000);
+}
+
+// 获取指定时隙的开始时刻
+std::chrono::steady_clock::time_point TimeSynchronizer::getTimeSlotStart(uint32_t slot) const {
+    return syncStartTime + std::chrono::microseconds(timeSlotOffset) +
+           std::chrono::nanoseconds(static_cast<int64_t>(slot * timeSlotLengthNs));
 }
 
 // 等待下一个时隙
@@ -64,29 +75,47 @@ bool TimeSynchronizer::waitForNextTimeSlot() {
         return false;
     }
     
-    uint64_t nextSlotStart = getNextTimeSlotStart();
-    uint64_t currentTime = getCurrentTimestamp();
+    // 按纳秒计算当前时隙，避免时间戳取整到微秒后落到前一个时隙
+    auto now = std::chrono::steady_clock::now();
+    int64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - syncStartTime).count() -
+                      static_cast<int64_t>(timeSlotOffset) * 1000;
+    uint32_t currentSlot = elapsed > 0 ? static_cast<uint32_t>(static_cast<uint64_t>(elapsed) / timeSlotLengthNs) : 0;
     
-    if (nextSlotStart > currentTime) {
-        uint64_t waitTime = nextSlotStart - currentTime;
-        LOG_INFO("等待下一个时隙: " + std::to_string(waitTime) + " 微秒");
-        std::this_thread::sleep_for(std::chrono::microseconds(waitTime));
-        return true;
-    } else {
+    // 睡眠到下一个时隙边界的绝对时刻，唤醒延迟不会累积到后面的时隙
+    auto nextSlotStart = getTimeSlotStart(currentSlot + 1);
+    if (nextSlotStart <= now) {
         LOG_WARNING("下一个时隙已经开始，无需等待");
         return false;
     }
+    
+    LOG_DEBUG("等待下一个时隙");
+    std::this_thread::sleep_until(nextSlotStart);
+    return true;
 }
 
 // 设置时隙长度(微秒)
 void TimeSynchronizer::setTimeSlotLength(uint32_t length) {
-    timeSlotLength = length;
-    LOG_INFO("设置时隙长度: " + std::to_string(length) + " 微秒");
+    setTimeSlotLengthNs(static_cast<uint64_t>(length) * 1000);
 }
 
 // 获取时隙长度(微秒)
 uint32_t TimeSynchronizer::getTimeSlotLength() const {
-    return timeSlotLength;
+    return static_cast<uint32_t>(timeSlotLengthNs / 1000);
+}
+
+// 设置时隙长度(纳秒)
+void TimeSynchronizer::setTimeSlotLengthNs(uint64_t length) {
+    if (length == 0) {
+        LOG_ERROR("时隙长度不能为0");
+        return;
+    }
+    timeSlotLengthNs = length;
+    LOG_INFO("设置时隙长度: " + std::to_string(length) + " 纳秒");
+}
+
+// 获取时隙长度(纳秒)
+uint64_t TimeSynchronizer::getTimeSlotLengthNs() const {
+    return timeSlotLengthNs;
 }
 
 // 设置时隙偏移(微秒)
@@ -129,7 +158,7 @@ uint32_t TimeSynchronizer::calculateTimeSlotIndex(uint64_t timestamp) const {
         adjustedTimestamp = 0;
     }
     
-    return static_cast<uint32_t>(adjustedTimestamp / timeSlotLength);
+    return static_cast<uint32_t>(static_cast<uint64_t>(adjustedTimestamp) * 1000 / timeSlotLengthNs);
 }
 
 } // namespace synchronization
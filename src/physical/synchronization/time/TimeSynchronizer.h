@@ -7,8 +7,17 @@ namespace link16 {
 namespace physical {
 namespace synchronization {
 
+/**
+ * @brief 时隙时间同步
+ *
+ * 时隙长度以纳秒保存(Link16时隙为7.8125ms，不是整数微秒)，对外的时间戳仍以微秒为单位。
+ * 需要在时隙边界准确发射时使用TdmaScheduler，以getTimeSlotStart()作为起点。
+ */
 class TimeSynchronizer {
 public:
+    // Link16时隙长度(纳秒)
+    static const uint64_t default_slot_length_ns = 7812500;
+    
     // 构造函数
     TimeSynchronizer();
     
@@ -27,15 +36,24 @@ public:
     // 获取下一个时隙开始时间
     uint64_t getNextTimeSlotStart();
     
-    // 等待下一个时隙
+    // 获取指定时隙的开始时刻
+    std::chrono::steady_clock::time_point getTimeSlotStart(uint32_t slot) const;
+    
+    // 等待下一个时隙(按绝对时刻睡眠，不累积误差)
     bool waitForNextTimeSlot();
     
     // 设置时隙长度(微秒)
     void setTimeSlotLength(uint32_t length);
     
-    // 获取时隙长度(微秒)
+    // 获取时隙长度(微秒，向下取整)
     uint32_t getTimeSlotLength() const;
     
+    // 设置时隙长度(纳秒)
+    void setTimeSlotLengthNs(uint64_t length);
+    
+    // 获取时隙长度(纳秒)
+    uint64_t getTimeSlotLengthNs() const;
+    
     // 设置时隙偏移(微秒)
     void setTimeSlotOffset(int32_t offset);
     
@@ -49,8 +67,8 @@ public:
     bool isSynchronized() const;
 
 private:
-    // 时隙长度(微秒)
-    uint32_t timeSlotLength;
+    // 时隙长度(纳秒)
+    uint64_t timeSlotLengthNs;
     
     // 时隙偏移(微秒)
     int32_t timeSlotOffset;
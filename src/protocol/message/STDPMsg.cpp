@@ -1,50 +1,89 @@
 #include "STDPMsg.h"
 
+namespace link16 {
+namespace protocol {
+
+STDPMsg::STDPMsg()
+	: m_headerWord(new HeaderWord(bitset<15>(0))),
+	  m_initialWord(new InitialWord()),
+	  m_extendWord(new ExtendWord()),
+	  m_continueWord(new ContinueWord()),
+	  m_priority(0),
+	  m_senderID(0),
+	  m_receiverID(0) {
+}
+
+STDPMsg::~STDPMsg() {
+}
+
 HeaderWord* STDPMsg::getHeaderWord() {
-	return m_headerword;
+	return m_headerWord.get();
 }
 
 InitialWord* STDPMsg::getInitialWord() {
-	return m_iword;
+	return m_initialWord.get();
 }
 
 ExtendWord* STDPMsg::getExtendWord() {
-	return m_eword;
+	return m_extendWord.get();
 }
 
 ContinueWord* STDPMsg::getContinueWord() {
-	return m_cword;
+	return m_continueWord.get();
+}
+
+const std::string& STDPMsg::getRawMsg() const {
+	return m_rawMsg;
 }
 
-void STDPMsg::setRawMsg(string& raw_msg) {
-	m_raw_msg = raw_msg;
+void STDPMsg::setRawMsg(const std::string& rawMsg) {
+	m_rawMsg = rawMsg;
 }
 
-void STDPMsg::setBitMsg(string& bit_msg) {
-	m_bit_msg = bit_msg;
+std::string STDPMsg::getBitMsg() const {
+	return m_bitMsg.toString();
 }
 
-void STDPMsg::setHeaderWord(string& bit_data) {
-	m_headerword->rewrite(bit_data);
+void STDPMsg::setBitMsg(const std::string& bitMsg) {
+	m_bitMsg = BitBuffer::fromString(bitMsg);
 }
 
-void STDPMsg::setInitialWord(string& bit_data) {
-	m_iword->rewrite(bit_data);
+const BitBuffer& STDPMsg::getBits() const {
+	return m_bitMsg;
 }
 
-void STDPMsg::setExtendWord(string& bit_data) {
-	m_eword->rewrite(bit_data);
+void STDPMsg::setBits(const BitBuffer& bits) {
+	m_bitMsg = bits;
 }
 
-void STDPMsg::setContinueWord(string& bit_data) {
-	m_cword->rewrite(bit_data);
+void STDPMsg::setHeaderWord(const std::string& bitData) {
+	std::string data = bitData;
+	m_headerWord->rewrite(data);
+}
+
+void STDPMsg::setInitialWord(const std::string& bitData) {
+	std::string data = bitData;
+	m_initialWord->rewrite(data);
+}
+
+void STDPMsg::setExtendWord(const std::string& bitData) {
+	std::string data = bitData;
+	m_extendWord->rewrite(data);
+}
+
+void STDPMsg::setContinueWord(const std::string& bitData) {
+	std::string data = bitData;
+	m_continueWord->rewrite(data);
 }
 
 void STDPMsg::clear() {
-	m_raw_msg.clear();
-	m_bit_msg.clear();
-	m_headerword->clear();
-	m_iword->clear();
-	m_eword->clear();
-	m_cword->clear();
+	m_rawMsg.clear();
+	m_bitMsg.clear();
+	m_headerWord->clear();
+	m_initialWord->clear();
+	m_extendWord->clear();
+	m_continueWord->clear();
 }
+
+} // namespace protocol
+} // namespace link16
@@ -1,5 +1,6 @@
 #pragma once
 #include "core/utils/tools.h"
+#include "core/types/BitBuffer.h"
 #include "word/HeaderWord.h"
 #include "word/InitialWord.h"
 #include "word/ExtendWord.h"
@@ -34,12 +35,18 @@ public:
     // 设置原始消息
     void setRawMsg(const std::string& rawMsg);
     
-    // 获取比特消息
-    const std::string& getBitMsg() const;
+    // 获取比特消息('0'/'1'字符串)
+    std::string getBitMsg() const;
     
-    // 设置比特消息
+    // 设置比特消息('0'/'1'字符串)
     void setBitMsg(const std::string& bitMsg);
     
+    // 获取比特消息(打包形式)
+    const BitBuffer& getBits() const;
+    
+    // 设置比特消息(打包形式)
+    void setBits(const BitBuffer& bits);
+    
     // 获取HeaderWord
     HeaderWord* getHeaderWord();
     
@@ -101,8 +108,8 @@ private:
     // 原始消息
     std::string m_rawMsg;
     
-    // 比特消息
-    std::string m_bitMsg;
+    // 比特消息，以打包形式存放
+    BitBuffer m_bitMsg;
     
     // HeaderWord
     std::unique_ptr<HeaderWord> m_headerWord;
@@ -1,5 +1,8 @@
 #pragma once
 #include "core/types/dataType.h"
+#include "core/types/BitBuffer.h"
+#include "coding/error_correction/reed_solomon/GF32RSCodec.h"
+#include <algorithm>
 #include <iostream>
 
 template <RS_Length codeLength, RS_Length dataLength>
@@ -21,61 +24,29 @@ public:
 		m_RS_word = nullptr;
 	}
 
-	//用RS纠错编码处理消息字，使用schifra库
+	//用RS纠错编码处理消息字，5bit符号直接作为GF(2^5)域元素编码
 	void RS_handler() {
-		symbol* symbol_word = this->getS_word();
-
-		////print
-		//std::cout << "编码前symbol_word = " << std::endl;
-		//for (int i = 0; i < dataLength; i++) {
-		//	std::cout << symbol_word[i].to_string();
-		//}
-		//std::cout << std::endl;
-
-		string message(dataLength, 0x00);
-		for (int i = 0; i < dataLength; i++) {
-			message[i] = static_cast<char>(symbol_word[i].to_ulong());
-		}
-
-		////print
-		//std::cout << "RS编码前转换后的symbol(二进制表示): " << std::endl;
-		//for (int i = 0; i < dataLength; i++) {
-		//	for (int j = 7; j >= 0; j--) {
-		//		std::cout << ((message[i] >> j) & 1);
-		//	}
-		//}
-		//std::cout << std::endl;
-
-		symbol* symbol_RS_word = this->getRS_word();
-		memset(symbol_RS_word, 0, sizeof(symbol) * codeLength);
-		memcpy(symbol_RS_word, symbol_word, sizeof(symbol) * dataLength);
-
-		if (!RS(codeLength, dataLength, message, symbol_RS_word)) {
-			std::cout << "RS编码成功" << std::endl;
-		}
-		else {
-			std::cout << "RS编码失败" << std::endl;
-		}
-
-		////print
-		//std::cout << "编码后symbol_RS_word = " << std::endl;
-		//for (int i = 0; i < codeLength; i++) {
-		//	std::cout << symbol_RS_word[i].to_string();
-		//}
-		//std::cout << std::endl;
+		link16::coding::error_correction::GF32RSCodec<codeLength, dataLength>::encode(
+			this->getS_word(), this->getRS_word());
 	}
 
 	virtual void clear() {
-		memset(m_S_word, 0, sizeof(symbol) * dataLength);
-		memset(m_RS_word, 0, sizeof(symbol) * codeLength);
+		std::fill(m_S_word, m_S_word + dataLength, symbol());
+		std::fill(m_RS_word, m_RS_word + codeLength, symbol());
 	}
 
 	string toString_STDP() {
-		string res;
+		link16::BitBuffer bits;
+		toBits_STDP(bits);
+		return bits.toString();
+	}
+
+	//将RS编码后的Word按5bit符号追加到bits，不经过字符串
+	void toBits_STDP(link16::BitBuffer& bits) const {
+		bits.reserve(bits.size() + codeLength * 5);
 		for (int i = 0; i < codeLength; i++) {
-			res += m_RS_word[i].to_string();
+			bits.append(m_RS_word[i].to_ulong(), 5);
 		}
-		return res;
 	}
 
 	symbol* getS_word() {
@@ -10,6 +10,8 @@
 #include "coding/error_correction/reed_solomon/RSCoder.h"
 #include "coding/error_detection/crc/CRCCoder.h"
 #include "coding/interleaving/matrix/MatrixInterleaver.h"
+#include "core/types/BitBuffer.h"
+#include <algorithm>
 #include <fstream>
 #include <random>
 #include <chrono>
@@ -17,8 +19,26 @@
 namespace link16 {
 namespace simulation {
 
+namespace {
+
+// 每个工作线程私有的处理链，跨迭代复用
+struct alignas(64) PipelineContext {
+    std::shared_ptr<channel::ChannelModel> channel;
+    physical::modulation::BPSKModulator modulator;
+    coding::interleaving::MatrixInterleaver interleaver;
+    metrics::BER berCalculator;
+    std::vector<double> llr;
+
+    // 线程私有的累加器，运行结束后合并
+    size_t bits;
+    size_t packets;
+};
+
+} // namespace
+
 // 构造函数
-EndToEndSimulation::EndToEndSimulation() : initialized(false), running(false), progress(0.0) {
+EndToEndSimulation::EndToEndSimulation()
+    : running(false), progress(0.0), threadCount(0), seed(1), initialized(false) {
 }
 
 // 析构函数
@@ -118,15 +138,22 @@ bool EndToEndSimulation::run() {
     // 设置信道模型
     simulationEngine->setChannelModel(channelModel);
 
-    // 创建调制器
-    std::shared_ptr<physical::modulation::BPSKModulator> modulator = std::make_shared<physical::modulation::BPSKModulator>();
-    modulator->initialize();
-
-    // 创建RS编码器
-    coding::error_correction::RSCoder rsCoder;
-
-    // 创建交织器
-    coding::interleaving::MatrixInterleaver interleaver;
+    // 线程数变化时重建线程池
+    const size_t requestedThreads = threadCount > 0 ? threadCount : std::max(1u, std::thread::hardware_concurrency());
+    if (!pool || pool->getThreadCount() != requestedThreads) {
+        pool.reset(new engine::WorkStealingPool(requestedThreads));
+    }
+    const size_t workers = pool->getThreadCount();
+
+    // 每个线程一套调制器、交织器和信道副本
+    std::vector<std::unique_ptr<PipelineContext>> contexts(workers);
+    for (auto& context : contexts) {
+        context.reset(new PipelineContext());
+        context->channel = channelModel->clone();
+        context->modulator.initialize();
+        context->bits = 0;
+        context->packets = 0;
+    }
 
     // 创建BER计算器
     metrics::BER berCalculator;
@@ -135,44 +162,69 @@ bool EndToEndSimulation::run() {
     metrics::Throughput throughputCalculator;
     throughputCalculator.start();
 
-    // 仿真主循环
-    for (int i = 0; i < simParams.iterations; ++i) {
-        // 更新进度
-        progress = static_cast<double>(i) / simParams.iterations;
+    const size_t iterations = simParams.iterations > 0 ? static_cast<size_t>(simParams.iterations) : 0;
+    results.assign(iterations, 0.0);
+    std::atomic<size_t> finished(0);
 
-        // 生成随机数据
+    // 仿真主循环，每次迭代一个任务
+    pool->run(iterations, [&](size_t i, size_t worker) {
+        if (!running.load(std::memory_order_relaxed)) {
+            return;
+        }
+        PipelineContext& context = *contexts[worker];
+        context.channel->setSeed(engine::SimulationEngine::streamSeed(seed, i));
+
+        // 生成数据
         std::string data = testMessage + " - Iteration " + std::to_string(i + 1);
+        BitBuffer bits = BitBuffer::fromBytes(reinterpret_cast<const uint8_t*>(data.data()), data.size());
 
         // 编码数据
-        std::string encodedData = data;
+        const BitBuffer& encodedData = bits;
 
         // 交织
-        std::string interleavedData = interleaver.interleave(encodedData, 8, 8);
+        BitBuffer interleavedData = context.interleaver.interleave(encodedData.span());
 
         // 调制
-        std::vector<std::complex<double>> modulatedSignal = modulator->modulate(interleavedData);
-
-        // 通过信道
-        std::vector<std::complex<double>> receivedSignal = channelModel->process(modulatedSignal);
-
-        // 解调
-        std::string demodulatedData = modulator->demodulate(receivedSignal);
+        std::vector<std::complex<double>> modulatedSignal(context.modulator.getModulatedLength(interleavedData.size()));
+        modulatedSignal.resize(context.modulator.modulate(interleavedData.span(), modulatedSignal.data(),
+                                                          modulatedSignal.size()));
+
+        // 通过信道，原地加噪声
+        context.channel->processInPlace(modulatedSignal.data(), modulatedSignal.size());
+
+        // 解调，按LLR符号硬判决，只保留交织后的比特数
+        context.llr.resize(context.modulator.getDemodulatedLength(modulatedSignal.size()));
+        context.llr.resize(context.modulator.demodulateSoft(modulatedSignal.data(), modulatedSignal.size(),
+                                                            context.llr.data(), context.llr.size()));
+        BitBuffer demodulatedData;
+        const size_t demodulatedBits = std::min(context.llr.size(), interleavedData.size());
+        demodulatedData.reserve(demodulatedBits);
+        for (size_t k = 0; k < demodulatedBits; ++k) {
+            demodulatedData.pushBack(context.llr[k] > 0.0);
+        }
 
         // 解交织
-        std::string deinterleavedData = interleaver.deinterleave(demodulatedData, 8, 8);
+        BitBuffer deinterleavedData = context.interleaver.deinterleave(demodulatedData.span());
 
         // 解码
-        std::string decodedData = deinterleavedData;
-
-        // 计算误码率
-        double ber = berCalculator.calculate(data, decodedData);
+        const size_t compared = std::min(bits.size(), deinterleavedData.size());
+        const BitSpan decodedData = deinterleavedData.span().subspan(0, compared);
 
-        // 记录结果
-        results.push_back(ber);
+        // 记录结果，各迭代写入不同的位置
+        results[i] = context.berCalculator.calculate(bits.span().subspan(0, compared), decodedData);
 
         // 更新吞吐量
-        throughputCalculator.addBits(data.length() * 8);
-        throughputCalculator.addPackets(1);
+        context.bits += data.length() * 8;
+        ++context.packets;
+
+        // 更新进度
+        progress.store(static_cast<double>(finished.fetch_add(1) + 1) / iterations, std::memory_order_relaxed);
+    });
+
+    // 合并各线程的吞吐量
+    for (const auto& context : contexts) {
+        throughputCalculator.addBits(context->bits);
+        throughputCalculator.addPackets(context->packets);
     }
 
     // 停止吞吐量计算
@@ -293,7 +345,17 @@ bool EndToEndSimulation::isRunning() const {
 
 // 获取仿真进度
 double EndToEndSimulation::getProgress() const {
-    return progress;
+    return progress.load();
+}
+
+// 设置工作线程数
+void EndToEndSimulation::setThreadCount(size_t count) {
+    threadCount = count;
+}
+
+// 设置随机数种子
+void EndToEndSimulation::setSeed(uint64_t seed) {
+    this->seed = seed;
 }
 
 } // namespace simulation
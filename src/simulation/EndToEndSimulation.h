@@ -2,8 +2,10 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <atomic>
 #include "core/types/Link16Types.h"
 #include "engine/SimulationEngine.h"
+#include "engine/WorkStealingPool.h"
 
 namespace link16 {
 namespace simulation {
@@ -64,6 +66,12 @@ public:
     
     // 获取仿真进度(0.0-1.0)
     double getProgress() const;
+    
+    // 设置工作线程数，0表示使用硬件线程数
+    void setThreadCount(size_t count);
+    
+    // 设置随机数种子，第i次迭代的信道噪声由(种子, i)决定
+    void setSeed(uint64_t seed);
 
 private:
     // 仿真参数
@@ -84,11 +92,18 @@ private:
     // 仿真结果
     std::vector<double> results;
     
-    // 仿真状态
-    bool running;
+    // 仿真状态，stop()可在其他线程调用
+    std::atomic<bool> running;
     
     // 仿真进度
-    double progress;
+    std::atomic<double> progress;
+    
+    // 并行参数
+    size_t threadCount;
+    uint64_t seed;
+    
+    // 线程池，线程数不变时在多次运行之间复用
+    std::unique_ptr<engine::WorkStealingPool> pool;
     
     // 初始化状态
     bool initialized;
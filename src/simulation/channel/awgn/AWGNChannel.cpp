@@ -6,7 +6,7 @@ namespace simulation {
 namespace channel {
 
 // 构造函数
-AWGNChannel::AWGNChannel(double snr) : ChannelModel(snr) {
+AWGNChannel::AWGNChannel(double snr) : ChannelModel(snr), noisePower(0.0) {
 }
 
 // 析构函数
@@ -15,14 +15,55 @@ AWGNChannel::~AWGNChannel() {
 
 // 处理信号
 std::vector<std::complex<double>> AWGNChannel::process(const std::vector<std::complex<double>>& input) {
-    // 计算信号功率
-    double signalPower = calculateSignalPower(input);
-    
-    // 计算噪声功率
-    double noisePower = signalPower / std::pow(10.0, snr / 10.0);
-    
-    // 添加噪声
-    return addNoise(input, noisePower);
+    std::vector<std::complex<double>> output = input;
+    processInPlace(output.data(), output.size());
+    return output;
+}
+
+// 原地处理信号
+void AWGNChannel::processInPlace(std::complex<double>* samples, size_t count) {
+    const double power = noisePower > 0.0 ? noisePower : resolveNoisePower(calculateSignalPower(samples, count));
+    addNoise(samples, count, power);
+}
+
+// 原地处理单精度信号
+void AWGNChannel::processInPlace(std::complex<float>* samples, size_t count) {
+    double power = noisePower;
+    if (power <= 0.0) {
+        double signalPower = 0.0;
+        for (size_t i = 0; i < count; ++i) {
+            signalPower += std::norm(samples[i]);
+        }
+        power = resolveNoisePower(count > 0 ? signalPower / count : 0.0);
+    }
+    noise.addNoise(samples, count, static_cast<float>(std::sqrt(power / 2.0)));
+}
+
+// 设置每个复数样本的噪声功率
+void AWGNChannel::setNoisePower(double noisePower) {
+    this->noisePower = noisePower > 0.0 ? noisePower : 0.0;
+}
+
+// 获取设定的噪声功率
+double AWGNChannel::getNoisePower() const {
+    return noisePower;
+}
+
+// 设置信道参数
+void AWGNChannel::setParameter(const std::string& name, double value) {
+    if (name == "noise_power") {
+        setNoisePower(value);
+    } else {
+        ChannelModel::setParameter(name, value);
+    }
+}
+
+// 获取信道参数
+double AWGNChannel::getParameter(const std::string& name) const {
+    if (name == "noise_power") {
+        return noisePower;
+    }
+    return ChannelModel::getParameter(name);
 }
 
 // 获取信道名称
@@ -32,9 +73,24 @@ std::string AWGNChannel::getName() const {
 
 // 获取信道描述
 std::string AWGNChannel::getDescription() const {
+    if (noisePower > 0.0) {
+        return "加性高斯白噪声信道，噪声功率 = " + std::to_string(noisePower);
+    }
     return "加性高斯白噪声信道，SNR = " + std::to_string(snr) + " dB";
 }
 
+// 复制信道模型，副本使用新的随机种子
+std::shared_ptr<ChannelModel> AWGNChannel::clone() const {
+    auto copy = std::make_shared<AWGNChannel>(snr);
+    copy->setNoisePower(noisePower);
+    return copy;
+}
+
+// 按信噪比由信号功率计算噪声功率
+double AWGNChannel::resolveNoisePower(double signalPower) const {
+    return signalPower / std::pow(10.0, snr / 10.0);
+}
+
 } // namespace channel
 } // namespace simulation
 } // namespace link16
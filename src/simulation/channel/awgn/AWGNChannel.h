@@ -5,7 +5,13 @@ namespace link16 {
 namespace simulation {
 namespace channel {
 
-// 加性高斯白噪声信道模型
+/**
+ * @brief 加性高斯白噪声信道模型
+ *
+ * 噪声由计数器型高斯发生器GaussianNoise按块生成，processInPlace()直接在调用者缓冲区上加噪声。
+ * 默认按信噪比和实测信号功率确定噪声功率；setNoisePower()设定已知噪声功率后不再测量信号功率，
+ * 信噪比不再起作用。
+ */
 class AWGNChannel : public ChannelModel {
 public:
     // 构造函数
@@ -17,11 +23,39 @@ public:
     // 处理信号
     virtual std::vector<std::complex<double>> process(const std::vector<std::complex<double>>& input) override;
     
+    // 原地处理信号
+    virtual void processInPlace(std::complex<double>* samples, size_t count) override;
+    
+    // 原地处理单精度信号
+    void processInPlace(std::complex<float>* samples, size_t count);
+    
+    // 设置每个复数样本的噪声功率，大于0时跳过信号功率测量，小于等于0时恢复按信噪比计算
+    void setNoisePower(double noisePower);
+    
+    // 获取设定的噪声功率，未设定时为0
+    double getNoisePower() const;
+    
+    // 设置信道参数("noise_power")
+    virtual void setParameter(const std::string& name, double value) override;
+    
+    // 获取信道参数
+    virtual double getParameter(const std::string& name) const override;
+    
     // 获取信道名称
     virtual std::string getName() const override;
     
     // 获取信道描述
     virtual std::string getDescription() const override;
+    
+    // 复制信道模型
+    virtual std::shared_ptr<ChannelModel> clone() const override;
+
+private:
+    // 本次处理的噪声功率
+    double resolveNoisePower(double signalPower) const;
+    
+    // 设定的噪声功率，0表示按信噪比计算
+    double noisePower;
 };
 
 } // namespace channel
@@ -2,13 +2,16 @@
 #include <random>
 #include <cmath>
 #include <stdexcept>
+#include <algorithm>
 
 namespace link16 {
 namespace simulation {
 namespace channel {
 
 // 构造函数
-ChannelModel::ChannelModel(double snr) : snr(snr) {
+ChannelModel::ChannelModel(double snr) : snr(snr), generator(std::random_device()()) {
+    std::random_device device;
+    noise.setSeed((static_cast<uint64_t>(device()) << 32) | device());
 }
 
 // 析构函数
@@ -25,6 +28,21 @@ double ChannelModel::getSnr() const {
     return snr;
 }
 
+// 设置随机数种子和流号
+void ChannelModel::setSeed(uint64_t seed, uint64_t stream) {
+    std::seed_seq sequence{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32),
+                           static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)};
+    generator.seed(sequence);
+    noise.setSeed(seed, stream);
+}
+
+// 原地处理信号
+void ChannelModel::processInPlace(std::complex<double>* samples, size_t count) {
+    const std::vector<std::complex<double>> input(samples, samples + count);
+    const std::vector<std::complex<double>> output = process(input);
+    std::copy(output.begin(), output.begin() + std::min(output.size(), count), samples);
+}
+
 // 设置信道参数
 void ChannelModel::setParameter(const std::string& name, double value) {
     throw std::runtime_error("参数 '" + name + "' 在基类中未定义");
@@ -37,29 +55,33 @@ double ChannelModel::getParameter(const std::string& name) const {
 
 // 添加高斯白噪声
 std::vector<std::complex<double>> ChannelModel::addNoise(const std::vector<std::complex<double>>& signal, double noiseLevel) {
-    // 创建随机数生成器
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::normal_distribution<double> dist(0.0, std::sqrt(noiseLevel / 2.0));
-    
-    // 添加噪声
     std::vector<std::complex<double>> result = signal;
-    for (auto& sample : result) {
-        double noiseReal = dist(gen);
-        double noiseImag = dist(gen);
-        sample += std::complex<double>(noiseReal, noiseImag);
-    }
-    
+    addNoise(result.data(), result.size(), noiseLevel);
     return result;
 }
 
+// 原地添加高斯白噪声，实部和虚部各占一半功率
+void ChannelModel::addNoise(std::complex<double>* samples, size_t count, double noiseLevel) {
+    noise.addNoise(samples, count, std::sqrt(noiseLevel / 2.0));
+}
+
 // 计算信号功率
 double ChannelModel::calculateSignalPower(const std::vector<std::complex<double>>& signal) {
-    double power = 0.0;
-    for (const auto& sample : signal) {
-        power += std::norm(sample);
+    return calculateSignalPower(signal.data(), signal.size());
+}
+
+// 计算调用者缓冲区中信号的功率，按实数展开以便向量化
+double ChannelModel::calculateSignalPower(const std::complex<double>* samples, size_t count) {
+    if (count == 0) {
+        return 0.0;
+    }
+    const double* values = reinterpret_cast<const double*>(samples);
+    double power0 = 0.0, power1 = 0.0;
+    for (size_t i = 0; i < 2 * count; i += 2) {
+        power0 += values[i] * values[i];
+        power1 += values[i + 1] * values[i + 1];
     }
-    return power / signal.size();
+    return (power0 + power1) / count;
 }
 
 } // namespace channel
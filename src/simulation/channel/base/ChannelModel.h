@@ -2,6 +2,11 @@
 #include <vector>
 #include <complex>
 #include <string>
+#include <memory>
+#include <random>
+#include <cstdint>
+#include <cstddef>
+#include "GaussianNoise.h"
 
 namespace link16 {
 namespace simulation {
@@ -19,6 +24,9 @@ public:
     // 处理信号
     virtual std::vector<std::complex<double>> process(const std::vector<std::complex<double>>& input) = 0;
     
+    // 原地处理调用者缓冲区中的信号，默认实现调用process()后复制回去
+    virtual void processInPlace(std::complex<double>* samples, size_t count);
+    
     // 设置信噪比(dB)
     void setSnr(double snr);
     
@@ -36,16 +44,34 @@ public:
     
     // 获取信道描述
     virtual std::string getDescription() const = 0;
+    
+    // 复制信道模型，副本参数相同、随机数发生器独立，供多线程仿真每个线程各用一个
+    virtual std::shared_ptr<ChannelModel> clone() const = 0;
+    
+    // 设置随机数种子和流号，(种子, 流号)相同时噪声和衰落序列相同，多线程时每个线程用不同流号；未设置时使用随机种子
+    virtual void setSeed(uint64_t seed, uint64_t stream = 0);
 
 protected:
     // 信噪比(dB)
     double snr;
     
+    // 噪声和衰落使用的随机数发生器，每个实例独立
+    std::mt19937_64 generator;
+    
+    // 噪声使用的计数器型高斯随机数发生器
+    GaussianNoise noise;
+    
     // 添加高斯白噪声
     std::vector<std::complex<double>> addNoise(const std::vector<std::complex<double>>& signal, double noiseLevel);
     
+    // 原地添加高斯白噪声，noiseLevel为每个复数样本的噪声功率
+    void addNoise(std::complex<double>* samples, size_t count, double noiseLevel);
+    
     // 计算信号功率
     double calculateSignalPower(const std::vector<std::complex<double>>& signal);
+    
+    // 计算调用者缓冲区中信号的功率
+    double calculateSignalPower(const std::complex<double>* samples, size_t count);
 };
 
 } // namespace channel
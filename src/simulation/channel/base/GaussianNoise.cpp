@@ -0,0 +1,467 @@
+#include "GaussianNoise.h"
+#include "core/utils/cpuFeatures.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+#if defined(LINK16_ARCH_X86)
+#include <immintrin.h>
+#endif
+
+namespace link16 {
+namespace simulation {
+namespace channel {
+
+namespace {
+
+// Philox4x32-10常数
+const uint32_t philox_m0 = 0xD2511F53u;
+const uint32_t philox_m1 = 0xCD9E8D57u;
+const uint32_t philox_w0 = 0x9E3779B9u;
+const uint32_t philox_w1 = 0xBB67AE85u;
+const int philox_rounds = 10;
+
+// 每组并行计算的Philox块数，每块4个32位输出变换为4个样本
+const uint32_t philox_lanes = 8;
+
+// 均匀数 u = (x >> 1) * 2^-31 + 2^-32，取值(0, 1]
+const float uniform_scale = 4.656612873077392578125e-10f;
+const float uniform_offset = 2.3283064365386962890625e-10f;
+
+// 角度取x的高24位，按四分之一周期取整后余数乘2^-22
+const float angle_scale = 2.384185791015625e-7f;
+const float half_pi = 1.57079632679489661923f;
+
+// log多项式(Cephes logf)
+const float sqrt_half = 0.707106781186547524f;
+const float log_p0 = 7.0376836292e-2f;
+const float log_p1 = -1.1514610310e-1f;
+const float log_p2 = 1.1676998740e-1f;
+const float log_p3 = -1.2420140846e-1f;
+const float log_p4 = 1.4249322787e-1f;
+const float log_p5 = -1.6668057665e-1f;
+const float log_p6 = 2.0000714765e-1f;
+const float log_p7 = -2.4999993993e-1f;
+const float log_p8 = 3.3333331174e-1f;
+const float log_q1 = -2.12194440e-4f;
+const float log_q2 = 0.693359375f;
+
+// [-pi/4, pi/4]上的sin/cos多项式(Cephes sinf/cosf)
+const float sin_p0 = -1.9515295891e-4f;
+const float sin_p1 = 8.3321608736e-3f;
+const float sin_p2 = -1.6666654611e-1f;
+const float cos_p0 = 2.443315711809948e-5f;
+const float cos_p1 = -1.388731625493765e-3f;
+const float cos_p2 = 4.166664568298827e-2f;
+
+// 每次加噪声时生成的样本数
+const size_t noise_chunk = 512;
+
+uint32_t floatBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float bitsFloat(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// 自然对数，x为(0, 1]内的正规数
+float logScalar(float x) {
+    const uint32_t bits = floatBits(x);
+    float e = static_cast<float>(static_cast<int32_t>(bits >> 23) - 126);
+    const float m = bitsFloat((bits & 0x807FFFFFu) | 0x3F000000u);
+
+    // 尾数映射到[sqrt(1/2), sqrt(2))后减1
+    const bool small = m < sqrt_half;
+    e = e - (small ? 1.0f : 0.0f);
+    x = (m - 1.0f) + (small ? m : 0.0f);
+
+    const float z = x * x;
+    float y = log_p0;
+    y = y * x + log_p1;
+    y = y * x + log_p2;
+    y = y * x + log_p3;
+    y = y * x + log_p4;
+    y = y * x + log_p5;
+    y = y * x + log_p6;
+    y = y * x + log_p7;
+    y = y * x + log_p8;
+    y = y * x;
+    y = y * z;
+    y = y + e * log_q1;
+    y = y - z * 0.5f;
+    x = x + y;
+    x = x + e * log_q2;
+    return x;
+}
+
+// Box-Muller: 两个32位随机数变换为一对独立的标准正态样本
+void boxMullerScalar(uint32_t a, uint32_t b, float& first, float& second) {
+    const float u = static_cast<float>(static_cast<int32_t>(a >> 1)) * uniform_scale + uniform_offset;
+    const float radius = std::sqrt(logScalar(u) * -2.0f);
+
+    // 角度 2*pi*v/2^24 = (q + r) * pi/2，r在[-1/2, 1/2)内
+    const int32_t v = static_cast<int32_t>(b >> 8);
+    const int32_t q = (v + (1 << 21)) >> 22;
+    const float r = static_cast<float>(v - (q << 22)) * angle_scale;
+    const float x = r * half_pi;
+    const float z = x * x;
+
+    float sine = sin_p0;
+    sine = sine * z + sin_p1;
+    sine = sine * z + sin_p2;
+    sine = sine * z;
+    sine = sine * x;
+    sine = sine + x;
+
+    float cosine = cos_p0;
+    cosine = cosine * z + cos_p1;
+    cosine = cosine * z + cos_p2;
+    cosine = cosine * z;
+    cosine = cosine * z;
+    cosine = cosine - z * 0.5f;
+    cosine = cosine + 1.0f;
+
+    // 按象限旋转
+    if (q & 1) {
+        std::swap(sine, cosine);
+    }
+    if ((q + 1) & 2) {
+        cosine = -cosine;
+    }
+    if (q & 2) {
+        sine = -sine;
+    }
+
+    first = radius * cosine;
+    second = radius * sine;
+}
+
+// 标量内核: 从第group组开始生成groups组样本
+void generateScalar(const uint32_t key[2], const uint32_t stream[2], uint64_t group, size_t groups, float* output) {
+    for (size_t g = 0; g < groups; ++g, output += GaussianNoise::block_size) {
+        // 每组第一个块的序号是8的倍数，低32位加lane不会进位
+        const uint64_t first = (group + g) * philox_lanes;
+        for (uint32_t lane = 0; lane < philox_lanes; ++lane) {
+            uint32_t c0 = static_cast<uint32_t>(first) + lane;
+            uint32_t c1 = static_cast<uint32_t>(first >> 32);
+            uint32_t c2 = stream[0];
+            uint32_t c3 = stream[1];
+            uint32_t k0 = key[0];
+            uint32_t k1 = key[1];
+            for (int round = 0; round < philox_rounds; ++round) {
+                const uint64_t p0 = static_cast<uint64_t>(philox_m0) * c0;
+                const uint64_t p1 = static_cast<uint64_t>(philox_m1) * c2;
+                c0 = static_cast<uint32_t>(p1 >> 32) ^ c1 ^ k0;
+                c1 = static_cast<uint32_t>(p1);
+                c2 = static_cast<uint32_t>(p0 >> 32) ^ c3 ^ k1;
+                c3 = static_cast<uint32_t>(p0);
+                k0 += philox_w0;
+                k1 += philox_w1;
+            }
+
+            // 组内按(输出序号, lane)排列，与AVX2内核的寄存器布局一致
+            boxMullerScalar(c0, c1, output[lane], output[philox_lanes + lane]);
+            boxMullerScalar(c2, c3, output[2 * philox_lanes + lane], output[3 * philox_lanes + lane]);
+        }
+    }
+}
+
+#if defined(LINK16_ARCH_X86)
+
+// 8路32x32位乘法的高低32位
+LINK16_TARGET("avx2")
+void mulhiloAvx2(__m256i a, __m256i m, __m256i& lo, __m256i& hi) {
+    const __m256i even = _mm256_mul_epu32(a, m);
+    const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), m);
+    lo = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+    hi = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+}
+
+// 与logScalar逐步相同的8路自然对数
+LINK16_TARGET("avx2")
+__m256 logAvx2(__m256 x) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256i bits = _mm256_castps_si256(x);
+    __m256 e = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(126)));
+    const __m256 m = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x807FFFFF)),
+                                                         _mm256_set1_epi32(0x3F000000)));
+
+    const __m256 small = _mm256_cmp_ps(m, _mm256_set1_ps(sqrt_half), _CMP_LT_OQ);
+    e = _mm256_sub_ps(e, _mm256_and_ps(small, one));
+    x = _mm256_add_ps(_mm256_sub_ps(m, one), _mm256_and_ps(small, m));
+
+    const __m256 z = _mm256_mul_ps(x, x);
+    __m256 y = _mm256_set1_ps(log_p0);
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(log_p1));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(log_p2));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(log_p3));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(log_p4));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(log_p5));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(log_p6));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(log_p7));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(log_p8));
+    y = _mm256_mul_ps(y, x);
+    y = _mm256_mul_ps(y, z);
+    y = _mm256_add_ps(y, _mm256_mul_ps(e, _mm256_set1_ps(log_q1)));
+    y = _mm256_sub_ps(y, _mm256_mul_ps(z, _mm256_set1_ps(0.5f)));
+    x = _mm256_add_ps(x, y);
+    x = _mm256_add_ps(x, _mm256_mul_ps(e, _mm256_set1_ps(log_q2)));
+    return x;
+}
+
+// 与boxMullerScalar逐步相同的8路Box-Muller变换
+LINK16_TARGET("avx2")
+void boxMullerAvx2(__m256i a, __m256i b, float* first, float* second) {
+    const __m256 u = _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(a, 1)),
+                                                 _mm256_set1_ps(uniform_scale)),
+                                   _mm256_set1_ps(uniform_offset));
+    const __m256 radius = _mm256_sqrt_ps(_mm256_mul_ps(logAvx2(u), _mm256_set1_ps(-2.0f)));
+
+    const __m256i v = _mm256_srli_epi32(b, 8);
+    const __m256i q = _mm256_srai_epi32(_mm256_add_epi32(v, _mm256_set1_epi32(1 << 21)), 22);
+    const __m256 r = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(v, _mm256_slli_epi32(q, 22))),
+                                   _mm256_set1_ps(angle_scale));
+    const __m256 x = _mm256_mul_ps(r, _mm256_set1_ps(half_pi));
+    const __m256 z = _mm256_mul_ps(x, x);
+
+    __m256 sine = _mm256_set1_ps(sin_p0);
+    sine = _mm256_add_ps(_mm256_mul_ps(sine, z), _mm256_set1_ps(sin_p1));
+    sine = _mm256_add_ps(_mm256_mul_ps(sine, z), _mm256_set1_ps(sin_p2));
+    sine = _mm256_mul_ps(sine, z);
+    sine = _mm256_mul_ps(sine, x);
+    sine = _mm256_add_ps(sine, x);
+
+    __m256 cosine = _mm256_set1_ps(cos_p0);
+    cosine = _mm256_add_ps(_mm256_mul_ps(cosine, z), _mm256_set1_ps(cos_p1));
+    cosine = _mm256_add_ps(_mm256_mul_ps(cosine, z), _mm256_set1_ps(cos_p2));
+    cosine = _mm256_mul_ps(cosine, z);
+    cosine = _mm256_mul_ps(cosine, z);
+    cosine = _mm256_sub_ps(cosine, _mm256_mul_ps(z, _mm256_set1_ps(0.5f)));
+    cosine = _mm256_add_ps(cosine, _mm256_set1_ps(1.0f));
+
+    // 按象限交换并翻转符号位
+    const __m256i oneBit = _mm256_set1_epi32(1);
+    const __m256i twoBit = _mm256_set1_epi32(2);
+    const __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(q, oneBit), oneBit));
+    const __m256 signCos =
+        _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(q, oneBit), twoBit), 30));
+    const __m256 signSin = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, twoBit), 30));
+    const __m256 c = _mm256_xor_ps(_mm256_blendv_ps(cosine, sine, swap), signCos);
+    const __m256 s = _mm256_xor_ps(_mm256_blendv_ps(sine, cosine, swap), signSin);
+
+    _mm256_storeu_ps(first, _mm256_mul_ps(radius, c));
+    _mm256_storeu_ps(second, _mm256_mul_ps(radius, s));
+}
+
+// AVX2内核: 8个Philox块并行计算，不使用FMA以保持与标量内核逐位相同
+LINK16_TARGET("avx2")
+void generateAvx2(const uint32_t key[2], const uint32_t stream[2], uint64_t group, size_t groups, float* output) {
+    const __m256i m0 = _mm256_set1_epi32(static_cast<int>(philox_m0));
+    const __m256i m1 = _mm256_set1_epi32(static_cast<int>(philox_m1));
+    const __m256i w0 = _mm256_set1_epi32(static_cast<int>(philox_w0));
+    const __m256i w1 = _mm256_set1_epi32(static_cast<int>(philox_w1));
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+    for (size_t g = 0; g < groups; ++g, output += GaussianNoise::block_size) {
+        const uint64_t first = (group + g) * philox_lanes;
+        __m256i c0 = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(static_cast<uint32_t>(first))), lanes);
+        __m256i c1 = _mm256_set1_epi32(static_cast<int>(static_cast<uint32_t>(first >> 32)));
+        __m256i c2 = _mm256_set1_epi32(static_cast<int>(stream[0]));
+        __m256i c3 = _mm256_set1_epi32(static_cast<int>(stream[1]));
+        __m256i k0 = _mm256_set1_epi32(static_cast<int>(key[0]));
+        __m256i k1 = _mm256_set1_epi32(static_cast<int>(key[1]));
+
+        for (int round = 0; round < philox_rounds; ++round) {
+            __m256i lo0, hi0, lo1, hi1;
+            mulhiloAvx2(c0, m0, lo0, hi0);
+            mulhiloAvx2(c2, m1, lo1, hi1);
+            c0 = _mm256_xor_si256(_mm256_xor_si256(hi1, c1), k0);
+            c1 = lo1;
+            c2 = _mm256_xor_si256(_mm256_xor_si256(hi0, c3), k1);
+            c3 = lo0;
+            k0 = _mm256_add_epi32(k0, w0);
+            k1 = _mm256_add_epi32(k1, w1);
+        }
+
+        boxMullerAvx2(c0, c1, output, output + philox_lanes);
+        boxMullerAvx2(c2, c3, output + 2 * philox_lanes, output + 3 * philox_lanes);
+    }
+}
+
+#endif
+
+GaussianKernelType resolveKernel(GaussianKernelType kernel) {
+    return isGaussianKernelSupported(kernel) ? kernel : GaussianKernelType::SCALAR;
+}
+
+std::atomic<GaussianKernelType>& defaultKernel() {
+    static std::atomic<GaussianKernelType> kernel(detectGaussianKernel());
+    return kernel;
+}
+
+// 按默认内核生成整组样本
+void generateGroups(uint64_t seed, uint64_t stream, uint64_t group, size_t groups, float* output) {
+    const uint32_t key[2] = {static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)};
+    const uint32_t words[2] = {static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)};
+#if defined(LINK16_ARCH_X86)
+    if (getGaussianKernel() == GaussianKernelType::AVX2) {
+        generateAvx2(key, words, group, groups, output);
+        return;
+    }
+#endif
+    generateScalar(key, words, group, groups, output);
+}
+
+} // namespace
+
+const size_t GaussianNoise::block_size;
+
+// 获取内核名称
+const char* getGaussianKernelName(GaussianKernelType type) {
+    switch (type) {
+        case GaussianKernelType::SCALAR: return "scalar";
+        case GaussianKernelType::AVX2:   return "avx2";
+        default:                         return "unknown";
+    }
+}
+
+// 检查当前CPU是否支持该内核
+bool isGaussianKernelSupported(GaussianKernelType type) {
+    switch (type) {
+        case GaussianKernelType::SCALAR:
+            return true;
+        case GaussianKernelType::AVX2:
+#if defined(LINK16_ARCH_X86)
+            return utils::CpuFeatures::get().avx2;
+#else
+            return false;
+#endif
+        default:
+            return false;
+    }
+}
+
+// 获取当前CPU支持的最快内核
+GaussianKernelType detectGaussianKernel() {
+    if (isGaussianKernelSupported(GaussianKernelType::AVX2)) {
+        return GaussianKernelType::AVX2;
+    }
+    return GaussianKernelType::SCALAR;
+}
+
+// 设置默认高斯内核
+void setGaussianKernel(GaussianKernelType type) {
+    defaultKernel().store(resolveKernel(type), std::memory_order_relaxed);
+}
+
+// 获取默认高斯内核
+GaussianKernelType getGaussianKernel() {
+    return defaultKernel().load(std::memory_order_relaxed);
+}
+
+// 构造函数
+GaussianNoise::GaussianNoise(uint64_t seed, uint64_t stream)
+    : seed(seed), stream(stream), nextGroup(0), cacheUsed(block_size) {
+}
+
+// 选择随机数流并回到流的起点
+void GaussianNoise::setSeed(uint64_t seed, uint64_t stream) {
+    this->seed = seed;
+    this->stream = stream;
+    seek(0);
+}
+
+// 获取种子
+uint64_t GaussianNoise::getSeed() const {
+    return seed;
+}
+
+// 获取流号
+uint64_t GaussianNoise::getStream() const {
+    return stream;
+}
+
+// 跳到流中第position个样本
+void GaussianNoise::seek(uint64_t position) {
+    nextGroup = position / block_size;
+    cacheUsed = block_size;
+    if (position % block_size != 0) {
+        refill();
+        cacheUsed = static_cast<size_t>(position % block_size);
+    }
+}
+
+// 下一个样本在流中的序号
+uint64_t GaussianNoise::tell() const {
+    return nextGroup * block_size - (block_size - cacheUsed);
+}
+
+// 生成标准正态分布样本
+void GaussianNoise::generate(float* output, size_t count) {
+    size_t done = 0;
+
+    // 先取出上一组剩下的样本
+    while (done < count && cacheUsed < block_size) {
+        output[done++] = cache[cacheUsed++];
+    }
+
+    // 整组直接写入输出
+    const size_t groups = (count - done) / block_size;
+    if (groups > 0) {
+        generateGroups(seed, stream, nextGroup, groups, output + done);
+        nextGroup += groups;
+        done += groups * block_size;
+    }
+
+    if (done < count) {
+        refill();
+        while (done < count) {
+            output[done++] = cache[cacheUsed++];
+        }
+    }
+}
+
+// 原地给复数样本加噪声
+void GaussianNoise::addNoise(std::complex<double>* samples, size_t count, double sigma) {
+    double* values = reinterpret_cast<double*>(samples);
+    const size_t total = 2 * count;
+    float noise[noise_chunk];
+    for (size_t offset = 0; offset < total; offset += noise_chunk) {
+        const size_t length = std::min(noise_chunk, total - offset);
+        generate(noise, length);
+        for (size_t i = 0; i < length; ++i) {
+            values[offset + i] += sigma * noise[i];
+        }
+    }
+}
+
+// 原地给单精度复数样本加噪声
+void GaussianNoise::addNoise(std::complex<float>* samples, size_t count, float sigma) {
+    float* values = reinterpret_cast<float*>(samples);
+    const size_t total = 2 * count;
+    float noise[noise_chunk];
+    for (size_t offset = 0; offset < total; offset += noise_chunk) {
+        const size_t length = std::min(noise_chunk, total - offset);
+        generate(noise, length);
+        for (size_t i = 0; i < length; ++i) {
+            values[offset + i] += sigma * noise[i];
+        }
+    }
+}
+
+// 生成下一组样本到cache
+void GaussianNoise::refill() {
+    generateGroups(seed, stream, nextGroup, 1, cache);
+    ++nextGroup;
+    cacheUsed = 0;
+}
+
+} // namespace channel
+} // namespace simulation
+} // namespace link16
@@ -0,0 +1,125 @@
+#pragma once
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+
+namespace link16 {
+namespace simulation {
+namespace channel {
+
+/**
+ * @brief 高斯随机数生成内核类型，各内核输出逐位相同
+ */
+enum class GaussianKernelType {
+    SCALAR,  // 标量实现，所有平台可用
+    AVX2     // AVX2，8路Philox并行，每次生成32个样本
+};
+
+/**
+ * @brief 获取内核名称
+ * @param type 内核类型
+ * @return 内核名称
+ */
+const char* getGaussianKernelName(GaussianKernelType type);
+
+/**
+ * @brief 检查当前CPU是否支持该内核
+ * @param type 内核类型
+ * @return 是否支持
+ */
+bool isGaussianKernelSupported(GaussianKernelType type);
+
+/**
+ * @brief 获取当前CPU支持的最快内核
+ * @return 内核类型
+ */
+GaussianKernelType detectGaussianKernel();
+
+/**
+ * @brief 设置默认高斯内核，不支持的内核退回到SCALAR
+ * @param type 内核类型
+ */
+void setGaussianKernel(GaussianKernelType type);
+
+/**
+ * @brief 获取默认高斯内核
+ * @return 内核类型
+ */
+GaussianKernelType getGaussianKernel();
+
+/**
+ * @brief 计数器型高斯随机数发生器
+ *
+ * 样本按组生成，每组block_size个：第g组由Philox4x32-10(计数器为(8g+i, 流号)，
+ * 密钥为种子，i = 0..7)的8个输出块经Box-Muller变换得到，log/sin/cos使用单精度多项式，
+ * 标量和AVX2内核逐位相同。第n个样本只由(种子, 流号, n)决定，与调用时的分块方式、
+ * 线程和CPU无关，每个线程用不同流号即可得到独立且可重现的噪声。
+ * 均匀数取32位，截断在约6.6个标准差处。
+ */
+class GaussianNoise {
+public:
+    // 每组样本数
+    static const size_t block_size = 32;
+
+    /**
+     * @brief 构造函数
+     * @param seed 种子
+     * @param stream 流号
+     */
+    GaussianNoise(uint64_t seed = 0, uint64_t stream = 0);
+
+    /**
+     * @brief 选择随机数流并回到流的起点
+     * @param seed 种子
+     * @param stream 流号
+     */
+    void setSeed(uint64_t seed, uint64_t stream = 0);
+
+    // 获取种子
+    uint64_t getSeed() const;
+
+    // 获取流号
+    uint64_t getStream() const;
+
+    // 跳到流中第position个样本
+    void seek(uint64_t position);
+
+    // 下一个样本在流中的序号
+    uint64_t tell() const;
+
+    /**
+     * @brief 生成标准正态分布(均值0，方差1)样本
+     * @param output 输出缓冲区
+     * @param count 样本数
+     */
+    void generate(float* output, size_t count);
+
+    /**
+     * @brief 原地给复数样本加噪声，实部和虚部各用一个样本
+     * @param samples 样本，原地修改
+     * @param count 复数样本数
+     * @param sigma 每个分量的噪声标准差
+     */
+    void addNoise(std::complex<double>* samples, size_t count, double sigma);
+
+    // 单精度样本版本
+    void addNoise(std::complex<float>* samples, size_t count, float sigma);
+
+private:
+    // 生成下一组样本到cache
+    void refill();
+
+    uint64_t seed;
+    uint64_t stream;
+
+    // 下一组的序号
+    uint64_t nextGroup;
+
+    // 当前组中未取出的样本
+    float cache[block_size];
+    size_t cacheUsed;
+};
+
+} // namespace channel
+} // namespace simulation
+} // namespace link16
@@ -0,0 +1,129 @@
+#include "JakesFader.h"
+#include <algorithm>
+#include <cmath>
+
+namespace link16 {
+namespace simulation {
+namespace channel {
+
+namespace {
+
+const double pi = 3.14159265358979323846;
+
+// 一个振荡器的整块输出累加到sum: sum[j] += Re(z * table[j])
+void accumulateBlock(double zr, double zi, const double* tableRe, const double* tableIm, double* sum) {
+    for (size_t j = 0; j < JakesFader::block_size; ++j) {
+        sum[j] += zr * tableRe[j] - zi * tableIm[j];
+    }
+}
+
+} // namespace
+
+const size_t JakesFader::default_oscillators;
+const size_t JakesFader::block_size;
+
+// 构造函数
+JakesFader::JakesFader(size_t oscillators)
+    : oscillators(std::max<size_t>(oscillators, 1)), normalizedDoppler(0.0),
+      amplitude(1.0 / std::sqrt(static_cast<double>(std::max<size_t>(oscillators, 1)))),
+      phaseRe(2 * this->oscillators, 1.0), phaseIm(2 * this->oscillators, 0.0), stepRe(2 * this->oscillators, 1.0),
+      stepIm(2 * this->oscillators, 0.0), tableRe(2 * this->oscillators * block_size, 1.0),
+      tableIm(2 * this->oscillators * block_size, 0.0), blockOffset(0) {
+}
+
+// 重新抽取随机相位和到达角
+void JakesFader::reset(double normalizedDoppler, std::mt19937_64& generator) {
+    this->normalizedDoppler = normalizedDoppler;
+    std::uniform_real_distribution<double> angle(-pi, pi);
+
+    const double theta = angle(generator);
+    const double wd = 2.0 * pi * normalizedDoppler;
+    for (size_t n = 0; n < oscillators; ++n) {
+        const double alpha = (2.0 * pi * (n + 1) - pi + theta) / (4.0 * oscillators);
+        const double phi = angle(generator);
+        const double psi = angle(generator);
+
+        // 同相分量频率wd*cos(a_n)，正交分量频率wd*sin(a_n)
+        const double frequencies[2] = {wd * std::cos(alpha), wd * std::sin(alpha)};
+        const double phases[2] = {phi, psi};
+        for (size_t part = 0; part < 2; ++part) {
+            const size_t index = part * oscillators + n;
+            phaseRe[index] = std::cos(phases[part]);
+            phaseIm[index] = std::sin(phases[part]);
+            stepRe[index] = std::cos(frequencies[part] * block_size);
+            stepIm[index] = std::sin(frequencies[part] * block_size);
+
+            // 块内旋转因子由r_n递推，块长很短，累积误差可以忽略
+            double* tr = tableRe.data() + index * block_size;
+            double* ti = tableIm.data() + index * block_size;
+            const double cr = std::cos(frequencies[part]);
+            const double ci = std::sin(frequencies[part]);
+            tr[0] = 1.0;
+            ti[0] = 0.0;
+            for (size_t j = 1; j < block_size; ++j) {
+                tr[j] = tr[j - 1] * cr - ti[j - 1] * ci;
+                ti[j] = tr[j - 1] * ci + ti[j - 1] * cr;
+            }
+        }
+    }
+    blockOffset = 0;
+}
+
+// 生成接下来count个衰落系数
+void JakesFader::generate(std::complex<double>* gains, size_t count) {
+    double inPhase[block_size];
+    double quadrature[block_size];
+
+    size_t done = 0;
+    while (done < count) {
+        // 总是计算整块，循环次数固定便于编译器向量化；块内第j个样本为Re(z_n * r_n^j)
+        std::fill(inPhase, inPhase + block_size, 0.0);
+        std::fill(quadrature, quadrature + block_size, 0.0);
+        for (size_t n = 0; n < oscillators; ++n) {
+            accumulateBlock(phaseRe[n], phaseIm[n], tableRe.data() + n * block_size,
+                            tableIm.data() + n * block_size, inPhase);
+        }
+        for (size_t n = oscillators; n < 2 * oscillators; ++n) {
+            accumulateBlock(phaseRe[n], phaseIm[n], tableRe.data() + n * block_size,
+                            tableIm.data() + n * block_size, quadrature);
+        }
+
+        const size_t begin = blockOffset;
+        const size_t length = std::min(count - done, block_size - begin);
+        for (size_t j = 0; j < length; ++j) {
+            gains[done + j] = std::complex<double>(amplitude * inPhase[begin + j], amplitude * quadrature[begin + j]);
+        }
+
+        done += length;
+        blockOffset += length;
+        if (blockOffset == block_size) {
+            advanceBlock();
+            blockOffset = 0;
+        }
+    }
+}
+
+// 归一化最大多普勒频移
+double JakesFader::getNormalizedDoppler() const {
+    return normalizedDoppler;
+}
+
+// 每个正交分量的振荡器个数
+size_t JakesFader::getOscillatorCount() const {
+    return oscillators;
+}
+
+// 所有振荡器推进一块，模接近1时一步牛顿迭代即可校正，无需开方
+void JakesFader::advanceBlock() {
+    for (size_t n = 0; n < 2 * oscillators; ++n) {
+        const double r = phaseRe[n] * stepRe[n] - phaseIm[n] * stepIm[n];
+        const double i = phaseRe[n] * stepIm[n] + phaseIm[n] * stepRe[n];
+        const double scale = 1.5 - 0.5 * (r * r + i * i);
+        phaseRe[n] = r * scale;
+        phaseIm[n] = i * scale;
+    }
+}
+
+} // namespace channel
+} // namespace simulation
+} // namespace link16
@@ -0,0 +1,81 @@
+#pragma once
+#include <complex>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace link16 {
+namespace simulation {
+namespace channel {
+
+/**
+ * @brief 正弦波叠加(Zheng-Xiao)瑞利衰落发生器
+ *
+ * h(k) = sqrt(1/M) * sum_n [cos(wd*k*cos(a_n) + phi_n) + j*cos(wd*k*sin(a_n) + psi_n)]，
+ * a_n = (2*pi*n - pi + theta) / (4M)，theta、phi_n、psi_n在reset()时随机抽取。
+ * E|h|^2 = 1，自相关为J0(2*pi*fd*tau)。振荡器状态保存为单位复数z_n，每block_size个样本
+ * 乘一次旋转因子r_n^block_size递推，块内第j个样本为z_n * r_n^j，r_n^j在reset()时预先算好，
+ * 不逐样本计算cos/sin，块内各样本之间也没有数据依赖，可以向量化。状态在多次generate()之间保持，
+ * 输出是连续的时间序列，且与调用的分块方式无关。
+ */
+class JakesFader {
+public:
+    // 默认每个正交分量的振荡器个数
+    static const size_t default_oscillators = 8;
+
+    // 每块样本数，块内的旋转因子预先算好
+    static const size_t block_size = 32;
+
+    /**
+     * @brief 构造函数
+     * @param oscillators 每个正交分量的振荡器个数
+     */
+    JakesFader(size_t oscillators = default_oscillators);
+
+    /**
+     * @brief 重新抽取随机相位和到达角，时间回到0
+     * @param normalizedDoppler 归一化最大多普勒频移 fd/采样率
+     * @param generator 随机数发生器
+     */
+    void reset(double normalizedDoppler, std::mt19937_64& generator);
+
+    /**
+     * @brief 生成接下来count个衰落系数
+     * @param gains 输出
+     * @param count 样本数
+     */
+    void generate(std::complex<double>* gains, size_t count);
+
+    // 归一化最大多普勒频移
+    double getNormalizedDoppler() const;
+
+    // 每个正交分量的振荡器个数
+    size_t getOscillatorCount() const;
+
+private:
+    // 所有振荡器推进一块，并把模校正为1以抵消递推累积的舍入误差
+    void advanceBlock();
+
+    size_t oscillators;
+    double normalizedDoppler;
+    double amplitude;
+
+    // 前M个为同相分量、后M个为正交分量的振荡器在当前块起点的相位z_n，按实部/虚部分开存放
+    std::vector<double> phaseRe;
+    std::vector<double> phaseIm;
+
+    // 每块的旋转因子r_n^block_size
+    std::vector<double> stepRe;
+    std::vector<double> stepIm;
+
+    // 块内旋转因子r_n^j，第n个振荡器占[n*block_size, (n+1)*block_size)
+    std::vector<double> tableRe;
+    std::vector<double> tableIm;
+
+    // 下一个样本在当前块中的位置
+    size_t blockOffset;
+};
+
+} // namespace channel
+} // namespace simulation
+} // namespace link16
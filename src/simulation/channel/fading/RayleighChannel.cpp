@@ -1,14 +1,38 @@
 #include "RayleighChannel.h"
-#include <random>
+#include <algorithm>
 #include <cmath>
 
 namespace link16 {
 namespace simulation {
 namespace channel {
 
+namespace {
+
+// 功率时延谱截断在几倍时延扩展处(约-21.7dB)
+const double delay_profile_span = 5.0;
+
+// 采样率无效时使用的采样率(Hz)
+const double default_sample_rate = 1.0e6;
+
+// 按实数展开的复数乘法，避免std::complex乘法对NaN/Inf的特殊处理
+inline std::complex<double> multiply(const std::complex<double>& a, const std::complex<double>& b) {
+    return std::complex<double>(a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real());
+}
+
+} // namespace
+
+const size_t RayleighChannel::max_taps;
+
 // 构造函数
-RayleighChannel::RayleighChannel(double snr, double dopplerShift) 
-    : ChannelModel(snr), dopplerShift(dopplerShift) {
+RayleighChannel::RayleighChannel(double snr, double dopplerShift, double sampleRate, double delaySpread)
+    : ChannelModel(snr), dopplerShift(dopplerShift), sampleRate(sampleRate > 0.0 ? sampleRate : default_sample_rate),
+      delaySpread(std::max(delaySpread, 0.0)) {
+    configureTaps();
+}
+
+// 按信道参数构造
+RayleighChannel::RayleighChannel(const ChannelParams& params, double sampleRate)
+    : RayleighChannel(params.snr, params.dopplerShift, sampleRate, params.delaySpread) {
 }
 
 // 析构函数
@@ -17,40 +41,60 @@ RayleighChannel::~RayleighChannel() {
 
 // 处理信号
 std::vector<std::complex<double>> RayleighChannel::process(const std::vector<std::complex<double>>& input) {
+    std::vector<std::complex<double>> output = input;
+    processInPlace(output.data(), output.size());
+    return output;
+}
+
+// 原地处理信号
+void RayleighChannel::processInPlace(std::complex<double>* samples, size_t count) {
     // 计算信号功率
-    double signalPower = calculateSignalPower(input);
+    const double signalPower = calculateSignalPower(samples, count);
     
-    // 生成瑞利衰落系数
-    std::vector<std::complex<double>> fadingCoefficients = generateRayleighFading(input.size());
-    
-    // 应用衰落
-    std::vector<std::complex<double>> fadedSignal(input.size());
-    for (size_t i = 0; i < input.size(); ++i) {
-        fadedSignal[i] = input[i] * fadingCoefficients[i];
-    }
-    
-    // 计算衰落后的信号功率
-    double fadedPower = calculateSignalPower(fadedSignal);
-    
-    // 归一化，保持信号功率不变
-    if (fadedPower > 0.0) {
-        double scale = std::sqrt(signalPower / fadedPower);
-        for (auto& sample : fadedSignal) {
-            sample *= scale;
+    gains.resize(count);
+    const size_t taps = faders.size();
+    if (taps == 1) {
+        // 平坦衰落
+        faders[0].generate(gains.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            samples[i] = multiply(samples[i], gains[i]);
+        }
+    } else {
+        // 延迟线: 上次调用的最后taps-1个样本接本次输入
+        delayLine.resize(taps - 1 + count);
+        std::copy(history.begin(), history.end(), delayLine.begin());
+        std::copy(samples, samples + count, delayLine.begin() + (taps - 1));
+        std::fill(samples, samples + count, std::complex<double>(0.0, 0.0));
+        
+        for (size_t tap = 0; tap < taps; ++tap) {
+            faders[tap].generate(gains.data(), count);
+            const double amplitude = tapGains[tap];
+            const std::complex<double>* delayed = delayLine.data() + (taps - 1 - tap);
+            for (size_t i = 0; i < count; ++i) {
+                samples[i] += amplitude * multiply(delayed[i], gains[i]);
+            }
         }
+        std::copy(delayLine.end() - (taps - 1), delayLine.end(), history.begin());
     }
     
-    // 计算噪声功率
-    double noisePower = signalPower / std::pow(10.0, snr / 10.0);
-    
-    // 添加噪声
-    return addNoise(fadedSignal, noisePower);
+    // 计算噪声功率并添加噪声
+    addNoise(samples, count, signalPower / std::pow(10.0, snr / 10.0));
+}
+
+// 设置随机数种子和流号，重新抽取信道
+void RayleighChannel::setSeed(uint64_t seed, uint64_t stream) {
+    ChannelModel::setSeed(seed, stream);
+    resetFading();
 }
 
 // 设置信道参数
 void RayleighChannel::setParameter(const std::string& name, double value) {
     if (name == "doppler_shift") {
-        dopplerShift = value;
+        setDopplerShift(value);
+    } else if (name == "sample_rate") {
+        setSampleRate(value);
+    } else if (name == "delay_spread") {
+        setDelaySpread(value);
     } else {
         ChannelModel::setParameter(name, value);
     }
@@ -60,6 +104,10 @@ void RayleighChannel::setParameter(const std::string& name, double value) {
 double RayleighChannel::getParameter(const std::string& name) const {
     if (name == "doppler_shift") {
         return dopplerShift;
+    } else if (name == "sample_rate") {
+        return sampleRate;
+    } else if (name == "delay_spread") {
+        return delaySpread;
     } else {
         return ChannelModel::getParameter(name);
     }
@@ -72,12 +120,19 @@ std::string RayleighChannel::getName() const {
 
 // 获取信道描述
 std::string RayleighChannel::getDescription() const {
-    return "瑞利衰落信道，SNR = " + std::to_string(snr) + " dB，多普勒频移 = " + std::to_string(dopplerShift) + " Hz";
+    return "瑞利衰落信道，SNR = " + std::to_string(snr) + " dB，多普勒频移 = " + std::to_string(dopplerShift) +
+           " Hz，时延扩展 = " + std::to_string(delaySpread) + " s，" + std::to_string(faders.size()) + "个抽头";
+}
+
+// 复制信道模型，副本使用新的随机种子
+std::shared_ptr<ChannelModel> RayleighChannel::clone() const {
+    return std::make_shared<RayleighChannel>(snr, dopplerShift, sampleRate, delaySpread);
 }
 
 // 设置多普勒频移
 void RayleighChannel::setDopplerShift(double shift) {
     dopplerShift = shift;
+    resetFading();
 }
 
 // 获取多普勒频移
@@ -85,32 +140,74 @@ double RayleighChannel::getDopplerShift() const {
     return dopplerShift;
 }
 
-// 生成瑞利衰落系数
-std::vector<std::complex<double>> RayleighChannel::generateRayleighFading(size_t length) {
-    // 创建随机数生成器
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::normal_distribution<double> dist(0.0, 1.0 / std::sqrt(2.0));
-    
-    // 生成瑞利衰落系数
-    std::vector<std::complex<double>> coefficients(length);
-    for (size_t i = 0; i < length; ++i) {
-        double real = dist(gen);
-        double imag = dist(gen);
-        coefficients[i] = std::complex<double>(real, imag);
+// 设置采样率
+void RayleighChannel::setSampleRate(double rate) {
+    if (rate <= 0.0) {
+        return;
+    }
+    sampleRate = rate;
+    configureTaps();
+}
+
+// 获取采样率
+double RayleighChannel::getSampleRate() const {
+    return sampleRate;
+}
+
+// 设置时延扩展
+void RayleighChannel::setDelaySpread(double spread) {
+    delaySpread = std::max(spread, 0.0);
+    configureTaps();
+}
+
+// 获取时延扩展
+double RayleighChannel::getDelaySpread() const {
+    return delaySpread;
+}
+
+// 获取抽头数
+size_t RayleighChannel::getTapCount() const {
+    return faders.size();
+}
+
+// 获取各抽头的平均功率
+std::vector<double> RayleighChannel::getTapPowers() const {
+    std::vector<double> powers(tapGains.size());
+    for (size_t i = 0; i < tapGains.size(); ++i) {
+        powers[i] = tapGains[i] * tapGains[i];
+    }
+    return powers;
+}
+
+// 按指数功率时延谱计算各抽头功率
+void RayleighChannel::configureTaps() {
+    const double spreadSamples = delaySpread * sampleRate;
+    size_t taps = 1;
+    if (spreadSamples > 0.0) {
+        taps = std::min(max_taps, static_cast<size_t>(std::ceil(delay_profile_span * spreadSamples)) + 1);
     }
     
-    // 如果有多普勒频移，应用频移
-    if (dopplerShift != 0.0) {
-        // 简化实现，实际应该使用Jake's模型或其他更复杂的模型
-        for (size_t i = 0; i < length; ++i) {
-            double phase = 2.0 * M_PI * dopplerShift * i / length;
-            std::complex<double> phasor(std::cos(phase), std::sin(phase));
-            coefficients[i] *= phasor;
-        }
+    std::vector<double> powers(taps, 1.0);
+    double total = 0.0;
+    for (size_t i = 0; i < taps; ++i) {
+        powers[i] = taps > 1 ? std::exp(-static_cast<double>(i) / spreadSamples) : 1.0;
+        total += powers[i];
     }
     
-    return coefficients;
+    tapGains.resize(taps);
+    for (size_t i = 0; i < taps; ++i) {
+        tapGains[i] = std::sqrt(powers[i] / total);
+    }
+    faders.assign(taps, JakesFader());
+    resetFading();
+}
+
+// 重新抽取各路径的衰落并清空延迟线
+void RayleighChannel::resetFading() {
+    for (auto& fader : faders) {
+        fader.reset(dopplerShift / sampleRate, generator);
+    }
+    history.assign(faders.size() - 1, std::complex<double>(0.0, 0.0));
 }
 
 } // namespace channel
@@ -1,15 +1,32 @@
 #pragma once
 #include "../base/ChannelModel.h"
+#include "JakesFader.h"
+#include "core/types/Link16Types.h"
 
 namespace link16 {
 namespace simulation {
 namespace channel {
 
-// 瑞利衰落信道模型
+/**
+ * @brief 瑞利衰落信道模型
+ *
+ * 每条路径的衰落系数由JakesFader按多普勒频移生成，衰落状态和延迟线在多次process()之间保持，
+ * 连续调用得到的是同一条连续信道；setSeed()或修改参数时重新抽取信道。
+ * 时延扩展大于0时使用指数功率时延谱的抽头延迟线，抽头间隔为一个采样周期，
+ * 第l个抽头的平均功率正比于exp(-l / (时延扩展 * 采样率))，取到5倍时延扩展，总功率为1。
+ * 噪声功率按信噪比和输入信号功率计算，即信噪比为平均接收信噪比。
+ */
 class RayleighChannel : public ChannelModel {
 public:
-    // 构造函数
-    RayleighChannel(double snr = 10.0, double dopplerShift = 0.0);
+    // 最多抽头数
+    static const size_t max_taps = 64;
+
+    // 构造函数，采样率默认与PhysicalParams相同
+    RayleighChannel(double snr = 10.0, double dopplerShift = 0.0, double sampleRate = 1.0e6,
+                    double delaySpread = 0.0);
+
+    // 按信道参数构造，使用其中的信噪比、多普勒频移和时延扩展
+    RayleighChannel(const ChannelParams& params, double sampleRate = 1.0e6);
     
     // 析构函数
     virtual ~RayleighChannel();
@@ -17,7 +34,13 @@ public:
     // 处理信号
     virtual std::vector<std::complex<double>> process(const std::vector<std::complex<double>>& input) override;
     
-    // 设置信道参数
+    // 原地处理信号
+    virtual void processInPlace(std::complex<double>* samples, size_t count) override;
+    
+    // 设置随机数种子和流号，重新抽取信道
+    virtual void setSeed(uint64_t seed, uint64_t stream = 0) override;
+    
+    // 设置信道参数("doppler_shift"、"sample_rate"、"delay_spread")
     virtual void setParameter(const std::string& name, double value) override;
     
     // 获取信道参数
@@ -29,18 +52,61 @@ public:
     // 获取信道描述
     virtual std::string getDescription() const override;
     
-    // 设置多普勒频移
+    // 复制信道模型
+    virtual std::shared_ptr<ChannelModel> clone() const override;
+    
+    // 设置多普勒频移(Hz)
     void setDopplerShift(double shift);
     
-    // 获取多普勒频移
+    // 获取多普勒频移(Hz)
     double getDopplerShift() const;
+    
+    // 设置采样率(Hz)
+    void setSampleRate(double rate);
+    
+    // 获取采样率(Hz)
+    double getSampleRate() const;
+    
+    // 设置时延扩展(秒)，0为平坦衰落
+    void setDelaySpread(double spread);
+    
+    // 获取时延扩展(秒)
+    double getDelaySpread() const;
+    
+    // 获取抽头数
+    size_t getTapCount() const;
+    
+    // 获取各抽头的平均功率
+    std::vector<double> getTapPowers() const;
 
 private:
+    // 按时延扩展计算功率时延谱并重建各路径的衰落发生器
+    void configureTaps();
+    
+    // 重新抽取各路径的衰落并清空延迟线
+    void resetFading();
+    
     // 多普勒频移(Hz)
     double dopplerShift;
     
-    // 生成瑞利衰落系数
-    std::vector<std::complex<double>> generateRayleighFading(size_t length);
+    // 采样率(Hz)
+    double sampleRate;
+    
+    // 时延扩展(秒)
+    double delaySpread;
+    
+    // 每个抽头一个衰落发生器
+    std::vector<JakesFader> faders;
+    
+    // 各抽头的幅度(平均功率的平方根)
+    std::vector<double> tapGains;
+    
+    // 上次调用的最后(抽头数-1)个输入样本
+    std::vector<std::complex<double>> history;
+    
+    // 复用的工作缓冲区
+    std::vector<std::complex<double>> gains;
+    std::vector<std::complex<double>> delayLine;
 };
 
 } // namespace channel
@@ -74,6 +74,10 @@ bool SimulationConfig::loadFromFile(const std::string& filePath) {
                 physParams.hoppingPattern = std::stoi(value);
             } else if (key == "channel_type") {
                 channelType = value;
+            } else if (key == "channel_doppler_shift") {
+                channelParams.dopplerShift = std::stod(value);
+            } else if (key == "channel_delay_spread") {
+                channelParams.delaySpread = std::stod(value);
             } else if (key == "result_file_path") {
                 resultFilePath = value;
             } else if (key == "verbose_logging") {
@@ -105,7 +109,9 @@ bool SimulationConfig::saveToFile(const std::string& filePath) const {
     oss << "physical_hopping_pattern=" << physParams.hoppingPattern << "\n\n";
     
     oss << "# 信道参数\n";
-    oss << "channel_type=" << channelType << "\n\n";
+    oss << "channel_type=" << channelType << "\n";
+    oss << "channel_doppler_shift=" << channelParams.dopplerShift << "\n";
+    oss << "channel_delay_spread=" << channelParams.delaySpread << "\n\n";
     
     oss << "# 输出设置\n";
     oss << "result_file_path=" << resultFilePath << "\n";
@@ -151,6 +157,16 @@ std::string SimulationConfig::getChannelType() const {
     return channelType;
 }
 
+// 设置信道参数
+void SimulationConfig::setChannelParams(const ChannelParams& params) {
+    channelParams = params;
+}
+
+// 获取信道参数
+ChannelParams SimulationConfig::getChannelParams() const {
+    return channelParams;
+}
+
 // 设置结果文件路径
 void SimulationConfig::setResultFilePath(const std::string& path) {
     resultFilePath = path;
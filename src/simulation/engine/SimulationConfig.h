@@ -37,6 +37,12 @@ public:
     // 获取信道类型
     std::string getChannelType() const;
     
+    // 设置信道参数(多普勒频移、时延扩展等，信噪比以仿真参数为准)
+    void setChannelParams(const ChannelParams& params);
+    
+    // 获取信道参数
+    ChannelParams getChannelParams() const;
+    
     // 设置结果文件路径
     void setResultFilePath(const std::string& path);
     
@@ -59,6 +65,9 @@ private:
     // 信道类型
     std::string channelType;
     
+    // 信道参数
+    ChannelParams channelParams;
+    
     // 结果文件路径
     std::string resultFilePath;
     
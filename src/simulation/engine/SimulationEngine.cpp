@@ -4,8 +4,13 @@
 #include "../channel/awgn/AWGNChannel.h"
 #include "../channel/fading/RayleighChannel.h"
 #include "../metrics/BER.h"
-#include "../metrics/Throughput.h"
+#include "physical/modulation/digital/PSK/BPSKModulator.h"
+#include "physical/modulation/digital/PSK/QPSKModulator.h"
+#include "core/types/BitBuffer.h"
+#include <algorithm>
+#include <cmath>
 #include <fstream>
+#include <iomanip>
 #include <random>
 #include <chrono>
 
@@ -13,8 +18,156 @@ namespace link16 {
 namespace simulation {
 namespace engine {
 
+namespace {
+
+// 默认随机数种子
+const uint64_t default_seed = 1;
+
+// 自动选择块大小时每个线程分到的任务数，多留一些供窃取
+const size_t tasks_per_thread = 8;
+
+// 扫描时每轮每个线程分到的批次数，越大同步越少，但停止后多算的批次也越多
+const size_t sweep_batches_per_thread = 2;
+
+// 95%置信区间对应的正态分位数
+const double confidence_z = 1.96;
+
+// 一个扫描批次的统计
+struct BatchCount {
+    uint64_t errorBits;
+    uint64_t totalBits;
+    uint64_t frames;
+};
+
+// 误码率的Wilson置信区间
+void wilsonInterval(uint64_t errors, uint64_t bits, double& low, double& high) {
+    if (bits == 0) {
+        low = 0.0;
+        high = 1.0;
+        return;
+    }
+    const double n = static_cast<double>(bits);
+    const double p = errors / n;
+    const double z2 = confidence_z * confidence_z;
+    const double denominator = 1.0 + z2 / n;
+    const double center = (p + z2 / (2.0 * n)) / denominator;
+    const double half = confidence_z * std::sqrt(p * (1.0 - p) / n + z2 / (4.0 * n * n)) / denominator;
+    low = std::max(0.0, center - half);
+    high = std::min(1.0, center + half);
+}
+
+// 是否满足扫描的收敛条件
+bool isConverged(const SweepParams& params, uint64_t errors, uint64_t bits) {
+    if (bits < params.minBits) {
+        return false;
+    }
+    if (params.targetErrors > 0 && errors >= params.targetErrors) {
+        return true;
+    }
+    if (params.relativeWidth > 0.0 && errors > 0) {
+        double low = 0.0;
+        double high = 0.0;
+        wilsonInterval(errors, bits, low, high);
+        const double ber = static_cast<double>(errors) / bits;
+        return (high - low) / 2.0 <= params.relativeWidth * ber;
+    }
+    return false;
+}
+
+// 每个工作线程私有的仿真状态，跨迭代复用
+struct alignas(64) WorkerContext {
+    std::shared_ptr<channel::ChannelModel> channel;
+    physical::modulation::BPSKModulator bpsk;
+    physical::modulation::QPSKModulator qpsk;
+    metrics::BER berCalculator;
+
+    // 复用的缓冲区
+    BitBuffer bits;
+    BitBuffer decided;
+    std::vector<std::complex<double>> signal;
+    std::vector<double> llr;
+
+    // 线程私有的累加器，运行结束后合并
+    uint64_t errorBits;
+    uint64_t totalBits;
+    uint64_t frames;
+};
+
+// 生成numBits个随机比特，超出部分清零
+void generateBits(std::mt19937_64& generator, size_t numBits, BitBuffer& bits) {
+    bits.resize(numBits);
+    uint64_t* words = bits.data();
+    const size_t wordCount = bits.wordCount();
+    for (size_t i = 0; i < wordCount; ++i) {
+        words[i] = generator();
+    }
+    if (numBits % 64 != 0) {
+        words[wordCount - 1] &= ~uint64_t(0) << (64 - numBits % 64);
+    }
+}
+
+// 调制、过信道、硬判决解调，返回比较的比特数，错误数写入errors
+template <typename Modulator>
+size_t simulateFrame(Modulator& modulator, WorkerContext& context, size_t& errors) {
+    context.signal.resize(modulator.getModulatedLength(context.bits.size()));
+    context.signal.resize(modulator.modulate(context.bits.span(), context.signal.data(), context.signal.size()));
+
+    // 原地加噪声，不分配新的接收缓冲区
+    context.channel->processInPlace(context.signal.data(), context.signal.size());
+
+    context.llr.resize(modulator.getDemodulatedLength(context.signal.size()));
+    context.llr.resize(modulator.demodulateSoft(context.signal.data(), context.signal.size(), context.llr.data(),
+                                                context.llr.size()));
+
+    // 按LLR符号硬判决，每64个符号写入一个字
+    const size_t compared = std::min(context.llr.size(), context.bits.size());
+    context.decided.clear();
+    uint64_t word = 0;
+    int count = 0;
+    for (size_t i = 0; i < compared; ++i) {
+        word = (word << 1) | (context.llr[i] > 0.0 ? 1 : 0);
+        if (++count == 64) {
+            context.decided.append(word, 64);
+            word = 0;
+            count = 0;
+        }
+    }
+    context.decided.append(word, count);
+
+    errors = context.berCalculator.countErrors(context.bits.span().subspan(0, compared), context.decided.span());
+    return compared;
+}
+
+// 仿真一次迭代，随机数由(种子, 迭代序号)决定，返回比较的比特数
+size_t simulateIteration(WorkerContext& context, uint64_t seed, uint64_t index, size_t numBits, bool useQPSK,
+                         size_t& errors) {
+    // 数据和信道各用一个导出的随机数流
+    std::mt19937_64 generator(SimulationEngine::streamSeed(seed, 2 * index));
+    context.channel->setSeed(SimulationEngine::streamSeed(seed, 2 * index + 1));
+    generateBits(generator, numBits, context.bits);
+
+    return useQPSK ? simulateFrame(context.qpsk, context, errors) : simulateFrame(context.bpsk, context, errors);
+}
+
+// 为每个工作线程创建私有状态
+std::vector<std::unique_ptr<WorkerContext>> createContexts(const channel::ChannelModel& prototype, size_t workers) {
+    std::vector<std::unique_ptr<WorkerContext>> contexts(workers);
+    for (auto& context : contexts) {
+        context.reset(new WorkerContext());
+        context->channel = prototype.clone();
+        context->errorBits = 0;
+        context->totalBits = 0;
+        context->frames = 0;
+    }
+    return contexts;
+}
+
+} // namespace
+
 // 构造函数
-SimulationEngine::SimulationEngine() : initialized(false), completed(false) {
+SimulationEngine::SimulationEngine()
+    : threadCount(0), seed(default_seed), chunkSize(0), errorBits(0), totalBits(0), initialized(false),
+      completed(false) {
 }
 
 // 析构函数
@@ -35,8 +188,10 @@ bool SimulationEngine::initialize(const SimulationConfig& config) {
         channelModel = std::make_shared<channel::AWGNChannel>(simParams.snr);
         LOG_INFO("已创建AWGN信道模型，SNR = " + std::to_string(simParams.snr) + " dB");
     } else if (channelType == "Rayleigh") {
-        channelModel = std::make_shared<channel::RayleighChannel>(simParams.snr);
-        LOG_INFO("已创建瑞利衰落信道模型，SNR = " + std::to_string(simParams.snr) + " dB");
+        ChannelParams channelParams = config.getChannelParams();
+        channelParams.snr = simParams.snr;
+        channelModel = std::make_shared<channel::RayleighChannel>(channelParams, config.getPhysicalParams().sampleRate);
+        LOG_INFO("已创建" + channelModel->getDescription());
     } else {
         LOG_ERROR("不支持的信道类型: " + channelType);
         return false;
@@ -54,46 +209,274 @@ bool SimulationEngine::initialize(const SimulationConfig& config) {
 
 // 运行仿真
 bool SimulationEngine::run() {
-    if (!initialized) {
+    if (!initialized || !channelModel) {
         LOG_ERROR("仿真引擎未初始化，无法运行");
         return false;
     }
 
-    LOG_INFO("开始运行仿真...");
-
     SimulationParams simParams = config.getSimulationParams();
     PhysicalParams physParams = config.getPhysicalParams();
 
+    bool useQPSK = false;
+    if (!checkModulation(useQPSK)) {
+        return false;
+    }
+    const size_t workers = preparePool();
+
+    const size_t iterations = simParams.iterations > 0 ? static_cast<size_t>(simParams.iterations) : 0;
+    const size_t chunk = chunkSize > 0 ? chunkSize : std::max<size_t>(1, iterations / (workers * tasks_per_thread));
+    const size_t chunks = (iterations + chunk - 1) / chunk;
+    const size_t numBits = simParams.numSamples;
+
+    LOG_INFO("开始运行仿真: " + std::to_string(iterations) + "次迭代，每次" + std::to_string(numBits) + "比特，" +
+             std::to_string(workers) + "个线程，" + std::to_string(chunks) + "个任务");
+
+    // 每个线程一份信道副本和调制器
+    std::vector<std::unique_ptr<WorkerContext>> contexts = createContexts(*channelModel, workers);
+
+    results.assign(iterations, 0.0);
+    throughput.reset();
+    throughput.start();
+
     // 记录开始时间
     auto startTime = std::chrono::high_resolution_clock::now();
 
-    // 仿真主循环
-    for (int i = 0; i < simParams.iterations; ++i) {
+    pool->run(chunks, [&](size_t task, size_t worker) {
+        WorkerContext& context = *contexts[worker];
+        const size_t first = task * chunk;
+        const size_t last = std::min(first + chunk, iterations);
+        for (size_t i = first; i < last; ++i) {
+            size_t errors = 0;
+            const size_t compared = simulateIteration(context, seed, i, numBits, useQPSK, errors);
+
+            // 各迭代写入不同的位置，不需要加锁
+            results[i] = compared > 0 ? static_cast<double>(errors) / compared : 0.0;
+            context.errorBits += errors;
+            context.totalBits += compared;
+            ++context.frames;
+        }
+    });
+
+    // 合并各线程的统计
+    errorBits = 0;
+    totalBits = 0;
+    uint64_t frames = 0;
+    for (size_t w = 0; w < workers; ++w) {
+        errorBits += contexts[w]->errorBits;
+        totalBits += contexts[w]->totalBits;
+        frames += contexts[w]->frames;
         if (config.getVerboseLogging()) {
-            LOG_INFO("正在执行仿真迭代 " + std::to_string(i + 1) + "/" + std::to_string(simParams.iterations));
+            LOG_INFO("线程" + std::to_string(w) + ": " + std::to_string(contexts[w]->frames) + "次迭代，" +
+                     std::to_string(contexts[w]->errorBits) + "个错误比特");
         }
-
-        // 这里将添加实际的仿真逻辑
-        // 1. 生成随机数据
-        // 2. 通过信道模型处理数据
-        // 3. 计算误码率
-        // 4. 记录结果
-
-        // 模拟仿真结果
-        double ber = 0.5 * std::exp(-simParams.snr / 10.0);
-        results.push_back(ber);
     }
+    throughput.stop();
+    throughput.addBits(totalBits);
+    throughput.addPackets(frames);
 
     // 记录结束时间
     auto endTime = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count();
 
-    LOG_INFO("仿真完成，耗时: " + std::to_string(duration) + " ms");
+    LOG_INFO("仿真完成，耗时: " + std::to_string(duration) + " ms，误码率: " + std::to_string(getBitErrorRate()) +
+             "，窃取" + std::to_string(pool->getStealCount()) + "次");
 
     completed = true;
     return true;
 }
 
+// 扫描误码率-信噪比曲线
+bool SimulationEngine::runSweep(const SweepParams& params, std::vector<SweepPoint>& points, SweepCallback callback) {
+    points.clear();
+
+    if (!initialized || !channelModel) {
+        LOG_ERROR("仿真引擎未初始化，无法扫描");
+        return false;
+    }
+    if (params.snrStep <= 0.0 || params.snrStop < params.snrStart || params.framesPerBatch == 0 ||
+        params.maxBits == 0 || (params.targetErrors == 0 && params.relativeWidth <= 0.0)) {
+        LOG_ERROR("扫描参数无效");
+        return false;
+    }
+
+    bool useQPSK = false;
+    if (!checkModulation(useQPSK)) {
+        return false;
+    }
+    const size_t numBits = config.getSimulationParams().numSamples;
+    if (numBits == 0) {
+        LOG_ERROR("每次迭代的比特数为0，无法扫描");
+        return false;
+    }
+    const size_t workers = preparePool();
+    const size_t concurrent = std::max<size_t>(params.concurrentPoints, 1);
+
+    // 各信噪比点，每个点的随机数流由(种子, 点序号)导出
+    const size_t pointCount =
+        static_cast<size_t>(std::floor((params.snrStop - params.snrStart) / params.snrStep + 1e-9)) + 1;
+    std::vector<SweepPoint> states(pointCount);
+    std::vector<uint64_t> pointSeeds(pointCount);
+    std::vector<uint64_t> mergedBatches(pointCount, 0);
+    for (size_t i = 0; i < pointCount; ++i) {
+        SweepPoint& point = states[i];
+        point.snr = params.snrStart + i * params.snrStep;
+        point.errorBits = 0;
+        point.totalBits = 0;
+        point.frames = 0;
+        point.ber = 0.0;
+        point.confidenceLow = 0.0;
+        point.confidenceHigh = 1.0;
+        point.converged = false;
+        point.elapsedTime = 0.0;
+        pointSeeds[i] = streamSeed(seed, i);
+    }
+
+    LOG_INFO("开始扫描: " + std::to_string(pointCount) + "个信噪比点，同时" + std::to_string(concurrent) + "个，" +
+             std::to_string(workers) + "个线程");
+
+    std::vector<std::unique_ptr<WorkerContext>> contexts = createContexts(*channelModel, workers);
+    std::vector<size_t> active;
+    size_t nextPoint = 0;
+    const auto startTime = std::chrono::steady_clock::now();
+
+    // 本轮的任务: (点序号, 批次序号)，同一个点的批次连续且按序号递增
+    std::vector<std::pair<size_t, uint64_t>> tasks;
+    std::vector<BatchCount> counts;
+
+    while (true) {
+        while (active.size() < concurrent && nextPoint < pointCount) {
+            active.push_back(nextPoint++);
+        }
+        if (active.empty()) {
+            break;
+        }
+
+        // 活动的点平分本轮的批次，不超过达到maxBits所需的批次数
+        const uint64_t batchBits = static_cast<uint64_t>(params.framesPerBatch) * numBits;
+        const size_t perPoint =
+            std::max<size_t>(1, (workers * sweep_batches_per_thread + active.size() - 1) / active.size());
+        tasks.clear();
+        for (size_t index : active) {
+            const uint64_t remaining = params.maxBits - std::min(params.maxBits, states[index].totalBits);
+            const uint64_t needed = std::max<uint64_t>(1, (remaining + batchBits - 1) / batchBits);
+            const uint64_t batches = std::min<uint64_t>(perPoint, needed);
+            for (uint64_t b = 0; b < batches; ++b) {
+                tasks.emplace_back(index, mergedBatches[index] + b);
+            }
+        }
+        counts.assign(tasks.size(), BatchCount{0, 0, 0});
+
+        pool->run(tasks.size(), [&](size_t task, size_t worker) {
+            WorkerContext& context = *contexts[worker];
+            const size_t index = tasks[task].first;
+            context.channel->setSnr(states[index].snr);
+
+            // 各任务写入不同的位置，不需要加锁
+            BatchCount& count = counts[task];
+            const uint64_t firstFrame = tasks[task].second * params.framesPerBatch;
+            for (uint64_t frame = firstFrame; frame < firstFrame + params.framesPerBatch; ++frame) {
+                size_t errors = 0;
+                count.totalBits += simulateIteration(context, pointSeeds[index], frame, numBits, useQPSK, errors);
+                count.errorBits += errors;
+                ++count.frames;
+            }
+        });
+
+        // 按批次序号合并，满足停止条件后丢弃同一个点后面的批次
+        std::vector<size_t> finished;
+        for (size_t t = 0; t < tasks.size(); ++t) {
+            const size_t index = tasks[t].first;
+            SweepPoint& point = states[index];
+            if (std::find(finished.begin(), finished.end(), index) != finished.end()) {
+                continue;
+            }
+            point.errorBits += counts[t].errorBits;
+            point.totalBits += counts[t].totalBits;
+            point.frames += counts[t].frames;
+            ++mergedBatches[index];
+
+            point.converged = isConverged(params, point.errorBits, point.totalBits);
+            if (point.converged || point.totalBits >= params.maxBits) {
+                finished.push_back(index);
+            }
+        }
+
+        // 完成的点按完成顺序输出，由后面的点补上
+        for (size_t index : finished) {
+            SweepPoint& point = states[index];
+            point.ber = point.totalBits > 0 ? static_cast<double>(point.errorBits) / point.totalBits : 0.0;
+            wilsonInterval(point.errorBits, point.totalBits, point.confidenceLow, point.confidenceHigh);
+            point.elapsedTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+            LOG_INFO("SNR = " + std::to_string(point.snr) + " dB: 误码率" + std::to_string(point.ber) + "，" +
+                     std::to_string(point.errorBits) + "/" + std::to_string(point.totalBits) + "比特" +
+                     (point.converged ? "" : "，未收敛"));
+            if (callback) {
+                callback(point);
+            }
+            active.erase(std::find(active.begin(), active.end(), index));
+        }
+    }
+
+    points.swap(states);
+    LOG_INFO("扫描完成，耗时: " +
+             std::to_string(std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count()) + " s");
+    return true;
+}
+
+// 扫描误码率-信噪比曲线并写入CSV文件
+bool SimulationEngine::runSweep(const SweepParams& params, const std::string& csvFile,
+                                std::vector<SweepPoint>* points) {
+    std::ofstream file(csvFile);
+    if (!file.is_open()) {
+        LOG_ERROR("无法打开文件进行写入: " + csvFile);
+        return false;
+    }
+
+    file << "snr_db,ber,error_bits,total_bits,frames,ci_low,ci_high,converged,elapsed_s\n";
+    file.flush();
+    file << std::setprecision(8);
+
+    // 每个点完成后立即写入，扫描中途也能读取已完成的点
+    std::vector<SweepPoint> results;
+    const bool success = runSweep(params, results, [&](const SweepPoint& point) {
+        file << point.snr << "," << point.ber << "," << point.errorBits << "," << point.totalBits << ","
+             << point.frames << "," << point.confidenceLow << "," << point.confidenceHigh << ","
+             << (point.converged ? 1 : 0) << "," << point.elapsedTime << "\n";
+        file.flush();
+    });
+
+    file.close();
+    if (success) {
+        LOG_INFO("扫描结果已保存到: " + csvFile);
+    }
+    if (points) {
+        points->swap(results);
+    }
+    return success;
+}
+
+// 检查调制方式
+bool SimulationEngine::checkModulation(bool& useQPSK) const {
+    const std::string modulation = config.getPhysicalParams().modulation;
+    useQPSK = modulation == "QPSK";
+    if (!useQPSK && modulation != "BPSK") {
+        LOG_ERROR("不支持的调制方式: " + modulation);
+        return false;
+    }
+    return true;
+}
+
+// 按线程数准备线程池
+size_t SimulationEngine::preparePool() {
+    // 线程数变化时重建线程池
+    const size_t requestedThreads = threadCount > 0 ? threadCount : std::max(1u, std::thread::hardware_concurrency());
+    if (!pool || pool->getThreadCount() != requestedThreads) {
+        pool.reset(new WorkStealingPool(requestedThreads));
+    }
+    return pool->getThreadCount();
+}
+
 // 设置信道模型
 void SimulationEngine::setChannelModel(std::shared_ptr<channel::ChannelModel> model) {
     channelModel = model;
@@ -119,6 +502,64 @@ std::vector<double> SimulationEngine::getResults() const {
     return results;
 }
 
+// 设置工作线程数
+void SimulationEngine::setThreadCount(size_t count) {
+    threadCount = count;
+}
+
+// 获取工作线程数
+size_t SimulationEngine::getThreadCount() const {
+    return threadCount;
+}
+
+// 设置随机数种子
+void SimulationEngine::setSeed(uint64_t seed) {
+    this->seed = seed;
+}
+
+// 获取随机数种子
+uint64_t SimulationEngine::getSeed() const {
+    return seed;
+}
+
+// 设置每个任务的迭代次数
+void SimulationEngine::setChunkSize(size_t size) {
+    chunkSize = size;
+}
+
+// 获取每个任务的迭代次数
+size_t SimulationEngine::getChunkSize() const {
+    return chunkSize;
+}
+
+// 由(种子, 序号)导出子种子(splitmix64)
+uint64_t SimulationEngine::streamSeed(uint64_t seed, uint64_t index) {
+    uint64_t z = seed + (index + 1) * 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// 获取总误码率
+double SimulationEngine::getBitErrorRate() const {
+    return totalBits > 0 ? static_cast<double>(errorBits) / totalBits : 0.0;
+}
+
+// 获取错误比特数
+uint64_t SimulationEngine::getErrorBits() const {
+    return errorBits;
+}
+
+// 获取仿真的总比特数
+uint64_t SimulationEngine::getTotalBits() const {
+    return totalBits;
+}
+
+// 获取仿真吞吐量统计
+metrics::Throughput SimulationEngine::getThroughput() const {
+    return throughput;
+}
+
 // 保存仿真结果
 bool SimulationEngine::saveResults(const std::string& filePath) const {
     if (!completed) {
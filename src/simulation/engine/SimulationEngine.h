@@ -2,14 +2,73 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <cstdint>
+#include <functional>
 #include "SimulationConfig.h"
+#include "WorkStealingPool.h"
 #include "../channel/base/ChannelModel.h"
+#include "../metrics/Throughput.h"
 
 namespace link16 {
 namespace simulation {
 namespace engine {
 
-// 仿真引擎类
+// 误码率-信噪比曲线扫描参数
+struct SweepParams {
+    // 信噪比范围(dB)，包含两端
+    double snrStart;
+    double snrStop;
+    double snrStep;
+
+    // 错误比特数达到该值后停止，0表示不使用
+    uint64_t targetErrors;
+
+    // 95%置信区间半宽与误码率之比低于该值后停止，0表示不使用
+    double relativeWidth;
+
+    // 每个点至少和至多仿真的比特数，达到上限时按未收敛结束
+    uint64_t minBits;
+    uint64_t maxBits;
+
+    // 每个任务仿真的迭代数
+    size_t framesPerBatch;
+
+    // 同时仿真的信噪比点数
+    size_t concurrentPoints;
+
+    SweepParams()
+        : snrStart(0.0), snrStop(10.0), snrStep(1.0), targetErrors(100), relativeWidth(0.0), minBits(10000),
+          maxBits(100000000), framesPerBatch(8), concurrentPoints(4) {
+    }
+};
+
+// 一个信噪比点的扫描结果
+struct SweepPoint {
+    double snr;
+    uint64_t errorBits;
+    uint64_t totalBits;
+    uint64_t frames;
+    double ber;
+
+    // 误码率的95%置信区间(Wilson)
+    double confidenceLow;
+    double confidenceHigh;
+
+    // 是否满足停止条件(否则为达到maxBits)
+    bool converged;
+
+    // 从开始扫描到该点结束的时间(秒)
+    double elapsedTime;
+};
+
+/**
+ * @brief 仿真引擎类
+ *
+ * 蒙特卡洛仿真: 每次迭代生成numSamples个随机比特，调制(physParams.modulation，支持BPSK/QPSK)
+ * 后通过信道，硬判决解调并统计误码。迭代按块分给工作窃取线程池，每个工作线程复用自己的
+ * 调制器、信道副本和缓冲区，误码和比特数累加在线程私有的计数器里，全部完成后再合并。
+ * 第i次迭代的数据和信道随机数都由(种子, i)决定，结果与线程数和调度顺序无关。
+ */
 class SimulationEngine {
 public:
     // 构造函数
@@ -36,13 +95,81 @@ public:
     // 获取仿真配置
     SimulationConfig getConfig() const;
     
-    // 获取仿真结果
+    // 每个信噪比点结束时的回调，在调用runSweep的线程中按完成顺序调用
+    typedef std::function<void(const SweepPoint& point)> SweepCallback;
+    
+    /**
+     * @brief 扫描误码率-信噪比曲线
+     * @param params 扫描参数，调制方式、信道类型和每次迭代的比特数取自当前配置
+     * @param points 输出，按信噪比从小到大排列
+     * @param callback 每个点结束时调用，可为空
+     * @return 是否成功
+     *
+     * 同时仿真concurrentPoints个点，每个点按批次分给线程池，批次按序号合并后检查停止条件，
+     * 点完成后由下一个未开始的点补上。停止位置只取决于批次序号，结果与线程数无关。
+     */
+    bool runSweep(const SweepParams& params, std::vector<SweepPoint>& points, SweepCallback callback = SweepCallback());
+    
+    /**
+     * @brief 扫描误码率-信噪比曲线，每个点完成时追加一行到CSV文件
+     * @param params 扫描参数
+     * @param csvFile 输出文件，先写表头
+     * @param points 输出全部点的结果，可为空
+     * @return 是否成功
+     */
+    bool runSweep(const SweepParams& params, const std::string& csvFile, std::vector<SweepPoint>* points = nullptr);
+    
+    // 获取仿真结果(每次迭代的误码率)
     std::vector<double> getResults() const;
     
+    // 设置工作线程数，0表示使用硬件线程数
+    void setThreadCount(size_t count);
+    
+    // 获取工作线程数
+    size_t getThreadCount() const;
+    
+    // 设置随机数种子
+    void setSeed(uint64_t seed);
+    
+    // 获取随机数种子
+    uint64_t getSeed() const;
+    
+    // 设置每个任务的迭代次数，0表示按线程数自动选择
+    void setChunkSize(size_t size);
+    
+    // 获取每个任务的迭代次数
+    size_t getChunkSize() const;
+    
+    /**
+     * @brief 由(种子, 序号)导出互不相关的子种子(splitmix64)
+     * @param seed 种子
+     * @param index 随机数流序号
+     * @return 子种子
+     */
+    static uint64_t streamSeed(uint64_t seed, uint64_t index);
+    
+    // 获取总误码率
+    double getBitErrorRate() const;
+    
+    // 获取错误比特数
+    uint64_t getErrorBits() const;
+    
+    // 获取仿真的总比特数
+    uint64_t getTotalBits() const;
+    
+    // 获取仿真吞吐量统计(仿真比特数和帧数，按实际运行时间计)
+    metrics::Throughput getThroughput() const;
+    
     // 保存仿真结果
     bool saveResults(const std::string& filePath) const;
 
 private:
+    // 检查调制方式，useQPSK输出是否为QPSK
+    bool checkModulation(bool& useQPSK) const;
+    
+    // 按线程数准备线程池，返回工作线程数
+    size_t preparePool();
+    
     // 仿真配置
     SimulationConfig config;
     
@@ -52,6 +179,19 @@ private:
     // 仿真结果
     std::vector<double> results;
     
+    // 并行参数
+    size_t threadCount;
+    uint64_t seed;
+    size_t chunkSize;
+    
+    // 线程池，线程数不变时在多次运行之间复用
+    std::unique_ptr<WorkStealingPool> pool;
+    
+    // 合并后的统计
+    uint64_t errorBits;
+    uint64_t totalBits;
+    metrics::Throughput throughput;
+    
     // 仿真状态
     bool initialized;
     bool completed;
@@ -0,0 +1,172 @@
+#include "WorkStealingPool.h"
+#include <algorithm>
+
+namespace link16 {
+namespace simulation {
+namespace engine {
+
+// 构造函数
+WorkStealingPool::WorkStealingPool(size_t threadCount)
+    : currentTask(nullptr), generation(0), activeWorkers(0), stopping(false), stealCount(0) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    ranges.reset(new TaskRange[threadCount]);
+    for (size_t i = 0; i < threadCount; ++i) {
+        ranges[i].begin = 0;
+        ranges[i].end = 0;
+    }
+
+    threads.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back(&WorkStealingPool::workerLoop, this, i);
+    }
+}
+
+// 析构函数
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    startCondition.notify_all();
+
+    for (auto& thread : threads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+// 获取工作线程数
+size_t WorkStealingPool::getThreadCount() const {
+    return threads.size();
+}
+
+// 并行执行一批任务
+void WorkStealingPool::run(size_t taskCount, const Task& task) {
+    if (taskCount == 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> runLock(runMutex);
+    const size_t threadCount = threads.size();
+
+    // 按连续区间平均分配，相邻任务留在同一个线程
+    for (size_t i = 0; i < threadCount; ++i) {
+        std::lock_guard<std::mutex> lock(ranges[i].mutex);
+        ranges[i].begin = taskCount * i / threadCount;
+        ranges[i].end = taskCount * (i + 1) / threadCount;
+    }
+
+    std::exception_ptr exception;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        currentTask = &task;
+        activeWorkers = threadCount;
+        firstException = nullptr;
+        ++generation;
+        startCondition.notify_all();
+
+        doneCondition.wait(lock, [this]() { return activeWorkers == 0; });
+        currentTask = nullptr;
+        exception = firstException;
+        firstException = nullptr;
+    }
+
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+// 累计窃取次数
+uint64_t WorkStealingPool::getStealCount() const {
+    return stealCount.load(std::memory_order_relaxed);
+}
+
+// 工作线程主循环
+void WorkStealingPool::workerLoop(size_t worker) {
+    uint64_t seen = 0;
+
+    while (true) {
+        const Task* task = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            startCondition.wait(lock, [&]() { return stopping || generation != seen; });
+            if (stopping) {
+                return;
+            }
+            seen = generation;
+            task = currentTask;
+        }
+
+        // 先做完自己的区间，再去窃取，直到所有区间都为空
+        size_t index = 0;
+        while (popTask(worker, index) || (stealTasks(worker) && popTask(worker, index))) {
+            try {
+                (*task)(index, worker);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!firstException) {
+                    firstException = std::current_exception();
+                }
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--activeWorkers == 0) {
+                doneCondition.notify_all();
+            }
+        }
+    }
+}
+
+// 从自己的区间头部取一个任务
+bool WorkStealingPool::popTask(size_t worker, size_t& task) {
+    TaskRange& range = ranges[worker];
+    std::lock_guard<std::mutex> lock(range.mutex);
+    if (range.begin >= range.end) {
+        return false;
+    }
+    task = range.begin++;
+    return true;
+}
+
+// 从其他线程的区间尾部窃取一半任务
+bool WorkStealingPool::stealTasks(size_t worker) {
+    const size_t threadCount = threads.size();
+
+    for (size_t offset = 1; offset < threadCount; ++offset) {
+        TaskRange& victim = ranges[(worker + offset) % threadCount];
+        size_t begin = 0;
+        size_t end = 0;
+        {
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.begin >= victim.end) {
+                continue;
+            }
+            // 只剩一个任务时整个拿走
+            const size_t remaining = victim.end - victim.begin;
+            end = victim.end;
+            begin = victim.end - std::max<size_t>(remaining / 2, 1);
+            victim.end = begin;
+        }
+
+        // 不同时持有两把锁，避免两个线程互相窃取时死锁
+        TaskRange& own = ranges[worker];
+        {
+            std::lock_guard<std::mutex> lock(own.mutex);
+            own.begin = begin;
+            own.end = end;
+        }
+        stealCount.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+} // namespace engine
+} // namespace simulation
+} // namespace link16
@@ -0,0 +1,100 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace link16 {
+namespace simulation {
+namespace engine {
+
+/**
+ * @brief 工作窃取线程池
+ *
+ * run()把任务0..taskCount-1按连续区间平均分给各工作线程，每个线程从自己区间的头部
+ * 取任务；自己的区间做完后，从其他线程区间的尾部窃取剩余任务的一半，直到所有区间
+ * 都为空。任务耗时不均匀(如低信噪比下解码更慢)时负载仍然均衡。
+ * 工作线程在构造时创建，多次run()之间复用。
+ */
+class WorkStealingPool {
+public:
+    /**
+     * 任务函数
+     * task: 任务序号[0, taskCount)
+     * worker: 执行该任务的工作线程序号[0, getThreadCount())，可用来索引每个线程私有的状态
+     */
+    typedef std::function<void(size_t task, size_t worker)> Task;
+
+    /**
+     * @brief 构造函数
+     * @param threadCount 工作线程数，0表示使用硬件线程数
+     */
+    explicit WorkStealingPool(size_t threadCount = 0);
+
+    // 析构函数，等待工作线程退出
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    // 获取工作线程数
+    size_t getThreadCount() const;
+
+    /**
+     * @brief 并行执行一批任务，阻塞到全部完成
+     * @param taskCount 任务数
+     * @param task 任务函数，同一个worker上的调用不会并发
+     *
+     * 任务抛出的第一个异常在所有任务结束后由run()重新抛出。
+     */
+    void run(size_t taskCount, const Task& task);
+
+    // 累计窃取次数
+    uint64_t getStealCount() const;
+
+private:
+    // 一个工作线程的任务区间[begin, end)
+    struct alignas(64) TaskRange {
+        std::mutex mutex;
+        size_t begin;
+        size_t end;
+    };
+
+    // 工作线程主循环
+    void workerLoop(size_t worker);
+
+    // 从自己的区间头部取一个任务
+    bool popTask(size_t worker, size_t& task);
+
+    // 从其他线程的区间尾部窃取一半任务，放到自己的区间
+    bool stealTasks(size_t worker);
+
+    std::vector<std::thread> threads;
+    std::unique_ptr<TaskRange[]> ranges;
+
+    // 当前批次
+    const Task* currentTask;
+    uint64_t generation;
+    size_t activeWorkers;
+    std::exception_ptr firstException;
+    bool stopping;
+
+    std::mutex mutex;
+    std::condition_variable startCondition;
+    std::condition_variable doneCondition;
+
+    // 同一时刻只执行一个批次
+    std::mutex runMutex;
+
+    std::atomic<uint64_t> stealCount;
+};
+
+} // namespace engine
+} // namespace simulation
+} // namespace link16
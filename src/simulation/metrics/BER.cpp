@@ -18,11 +18,11 @@ BER::~BER() {
 
 // 计算误码率
 double BER::calculate(const std::string& original, const std::string& received) {
-    // 将字符串转换为比特向量
-    std::vector<bool> originalBits = stringToBits(original);
-    std::vector<bool> receivedBits = stringToBits(received);
+    // 每个字符按8个比特打包，无需展开为比特向量
+    BitBuffer originalBits = BitBuffer::fromBytes(reinterpret_cast<const uint8_t*>(original.data()), original.length());
+    BitBuffer receivedBits = BitBuffer::fromBytes(reinterpret_cast<const uint8_t*>(received.data()), received.length());
     
-    return calculate(originalBits, receivedBits);
+    return calculate(originalBits.span(), receivedBits.span());
 }
 
 // 计算误码率(比特向量版本)
@@ -52,6 +52,29 @@ double BER::calculate(const std::vector<bool>& original, const std::vector<bool>
     return static_cast<double>(errorCount) / length;
 }
 
+// 计算误码率(打包比特版本)
+double BER::calculate(const BitSpan& original, const BitSpan& received) {
+    // 检查长度是否一致
+    if (original.size() != received.size()) {
+        LOG_WARNING("原始数据和接收数据长度不一致，将使用较短的长度");
+    }
+    
+    // 使用较短的长度
+    size_t length = std::min(original.size(), received.size());
+    
+    if (length == 0) {
+        LOG_ERROR("数据长度为0，无法计算误码率");
+        return 0.0;
+    }
+    
+    return static_cast<double>(hammingDistance(original, received)) / length;
+}
+
+// 统计错误比特数(打包比特版本)
+size_t BER::countErrors(const BitSpan& original, const BitSpan& received) {
+    return hammingDistance(original, received);
+}
+
 // 计算误码率(字符串向量版本)
 std::vector<double> BER::calculateBatch(const std::vector<std::string>& originals, const std::vector<std::string>& receiveds) {
     // 检查长度是否一致
@@ -1,6 +1,7 @@
 #pragma once
 #include <string>
 #include <vector>
+#include "core/types/BitBuffer.h"
 
 namespace link16 {
 namespace simulation {
@@ -21,6 +22,12 @@ public:
     // 计算误码率(比特向量版本)
     double calculate(const std::vector<bool>& original, const std::vector<bool>& received);
     
+    // 计算误码率(打包比特版本)，按64位字异或并统计1的个数
+    double calculate(const BitSpan& original, const BitSpan& received);
+    
+    // 统计错误比特数(打包比特版本)
+    size_t countErrors(const BitSpan& original, const BitSpan& received);
+    
     // 计算误码率(字符串向量版本)
     std::vector<double> calculateBatch(const std::vector<std::string>& originals, const std::vector<std::string>& receiveds);
     
@@ -0,0 +1,159 @@
+#include "gtest/gtest.h"
+#include "coding/CodingProcessor.h"
+#include "coding/error_correction/reed_solomon/RSCoder.h"
+#include "coding/interleaving/matrix/MatrixInterleaver.h"
+#include "coding/crypto/symmetric/aes/AESCrypto.h"
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+// 本文件单独生成可执行文件：替换全局operator new会影响同一进程中的所有测试
+// 统计当前线程的堆分配次数(不计日志写线程等后台线程)
+namespace {
+thread_local size_t g_allocation_count = 0;
+}
+
+void* operator new(size_t size) {
+    ++g_allocation_count;
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
+
+using namespace link16::coding;
+
+namespace {
+
+// 标准STDP消息按33字节计
+const size_t stdp_message_bytes = 33;
+
+std::string randomPayload(size_t length, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::string payload(length, '\0');
+    for (auto& c : payload) {
+        c = static_cast<char>(1 + rng() % 255);
+    }
+    return payload;
+}
+
+// 帧头的数据符号：原始数据长度(4字节大端)，其余为0
+std::string frameHeader(size_t length) {
+    std::string header(15, '\0');
+    for (int i = 0; i < 4; ++i) {
+        header[i] = static_cast<char>(length >> (8 * (3 - i)));
+    }
+    return header;
+}
+
+// 字符串流程：帧头与数据一起RS编码后按字符串交织
+std::string legacyEncode(const std::string& raw) {
+    error_correction::RSCoder coder(31, 15);
+    return interleaving::interleave(coder.encode(frameHeader(raw.length()) + raw), 8, 8);
+}
+
+// 字符串流程(有密钥)：数据RS编码后AES加密为十六进制字符串，帧头码字不加密，再交织
+std::string legacyEncode(const std::string& raw, const std::string& key) {
+    error_correction::RSCoder coder(31, 15);
+    crypto::AESCrypto aes;
+    return interleaving::interleave(coder.encode(frameHeader(raw.length())) + aes.encrypt(coder.encode(raw), key),
+                                    8, 8);
+}
+
+} // namespace
+
+TEST(CodingProcessorAllocationTest, SteadyStateEncodeDoesNotAllocate) {
+    CodingProcessor processor;
+    ASSERT_TRUE(processor.initialize());
+
+    const std::string raw = randomPayload(stdp_message_bytes, 11);
+    std::vector<uint8_t> encoded(processor.getEncodedLength(raw.length()));
+    size_t encodedLength = 0;
+
+    // 预热：构建置换表和每线程暂存区
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(processor.encodeData(reinterpret_cast<const uint8_t*>(raw.data()), raw.length(),
+                                         encoded.data(), encoded.size(), encodedLength));
+    }
+
+    const size_t before = g_allocation_count;
+    for (int i = 0; i < 1000; ++i) {
+        processor.encodeData(reinterpret_cast<const uint8_t*>(raw.data()), raw.length(),
+                             encoded.data(), encoded.size(), encodedLength);
+    }
+    EXPECT_EQ(g_allocation_count - before, 0u);
+
+    EXPECT_EQ(std::string(encoded.begin(), encoded.begin() + encodedLength), legacyEncode(raw));
+}
+
+TEST(CodingProcessorAllocationTest, SteadyStateDecodeDoesNotAllocate) {
+    CodingProcessor processor;
+    ASSERT_TRUE(processor.initialize());
+
+    const std::string raw = randomPayload(64 * 15, 13);
+    std::vector<uint8_t> encoded(processor.getEncodedLength(raw.length()));
+    std::vector<uint8_t> decoded(processor.getDecodedCapacity(encoded.size()));
+    size_t encodedLength = 0;
+    size_t decodedLength = 0;
+    ASSERT_TRUE(processor.encodeData(reinterpret_cast<const uint8_t*>(raw.data()), raw.length(),
+                                     encoded.data(), encoded.size(), encodedLength));
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(processor.decodeData(encoded.data(), encodedLength,
+                                         decoded.data(), decoded.size(), decodedLength));
+    }
+
+    const size_t before = g_allocation_count;
+    for (int i = 0; i < 1000; ++i) {
+        processor.decodeData(encoded.data(), encodedLength, decoded.data(), decoded.size(), decodedLength);
+    }
+    EXPECT_EQ(g_allocation_count - before, 0u);
+
+    EXPECT_EQ(std::string(decoded.begin(), decoded.begin() + decodedLength), raw);
+}
+
+TEST(CodingProcessorAllocationTest, EncryptedPipelineDoesNotAllocate) {
+    CodingProcessor processor;
+    ASSERT_TRUE(processor.initialize());
+    const std::string key = "0123456789abcdef";
+    processor.setEncryptionKey(key);
+
+    const std::string raw = randomPayload(stdp_message_bytes, 17);
+    std::vector<uint8_t> encoded(processor.getEncodedLength(raw.length()));
+    std::vector<uint8_t> decoded(processor.getDecodedCapacity(encoded.size()));
+    size_t encodedLength = 0;
+    size_t decodedLength = 0;
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(processor.encodeData(reinterpret_cast<const uint8_t*>(raw.data()), raw.length(),
+                                         encoded.data(), encoded.size(), encodedLength));
+        ASSERT_TRUE(processor.decodeData(encoded.data(), encodedLength,
+                                         decoded.data(), decoded.size(), decodedLength));
+    }
+    EXPECT_EQ(std::string(encoded.begin(), encoded.begin() + encodedLength), legacyEncode(raw, key));
+    EXPECT_EQ(std::string(decoded.begin(), decoded.begin() + decodedLength), raw);
+
+    const size_t before = g_allocation_count;
+    for (int i = 0; i < 1000; ++i) {
+        processor.encodeData(reinterpret_cast<const uint8_t*>(raw.data()), raw.length(),
+                             encoded.data(), encoded.size(), encodedLength);
+        processor.decodeData(encoded.data(), encodedLength, decoded.data(), decoded.size(), decodedLength);
+    }
+    EXPECT_EQ(g_allocation_count - before, 0u);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,212 @@
+#include "gtest/gtest.h"
+#include "coding/CodingProcessor.h"
+#include "coding/error_correction/reed_solomon/RSCoder.h"
+#include "coding/interleaving/matrix/MatrixInterleaver.h"
+#include "coding/crypto/symmetric/aes/AESCrypto.h"
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace link16::coding;
+
+namespace {
+
+// 标准STDP消息按33字节计
+const size_t stdp_message_bytes = 33;
+
+std::string randomPayload(size_t length, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::string payload(length, '\0');
+    for (auto& c : payload) {
+        c = static_cast<char>(1 + rng() % 255);
+    }
+    return payload;
+}
+
+// 帧头的数据符号：原始数据长度(4字节大端)，其余为0
+std::string frameHeader(size_t length) {
+    std::string header(15, '\0');
+    for (int i = 0; i < 4; ++i) {
+        header[i] = static_cast<char>(length >> (8 * (3 - i)));
+    }
+    return header;
+}
+
+// 字符串流程：帧头与数据一起RS编码后按字符串交织
+std::string legacyEncode(const std::string& raw) {
+    error_correction::RSCoder coder(31, 15);
+    return interleaving::interleave(coder.encode(frameHeader(raw.length()) + raw), 8, 8);
+}
+
+// 字符串流程(有密钥)：数据RS编码后AES加密为十六进制字符串，帧头码字不加密，再交织
+std::string legacyEncode(const std::string& raw, const std::string& key) {
+    error_correction::RSCoder coder(31, 15);
+    crypto::AESCrypto aes;
+    return interleaving::interleave(coder.encode(frameHeader(raw.length())) + aes.encrypt(coder.encode(raw), key),
+                                    8, 8);
+}
+
+} // namespace
+
+TEST(CodingProcessorTest, MatchesLegacyPipeline) {
+    CodingProcessor processor;
+    ASSERT_TRUE(processor.initialize());
+
+    for (size_t length : {1, 14, 15, 16, 33, 100, 960, 1000}) {
+        const std::string raw = randomPayload(length, static_cast<uint32_t>(length));
+        std::string encoded;
+        ASSERT_TRUE(processor.encodeData(raw, encoded)) << length;
+        EXPECT_EQ(encoded, legacyEncode(raw)) << length;
+        EXPECT_EQ(encoded.length(), processor.getEncodedLength(length)) << length;
+    }
+
+    std::string encoded = "unchanged";
+    ASSERT_TRUE(processor.encodeData(std::string(), encoded));
+    EXPECT_TRUE(encoded.empty());
+}
+
+TEST(CodingProcessorTest, RoundTrip) {
+    CodingProcessor processor;
+    ASSERT_TRUE(processor.initialize());
+
+    // 帧头加64个RS块，最后一个矩阵有交织填充
+    const std::string raw = randomPayload(64 * 15, 7);
+    std::string encoded;
+    ASSERT_TRUE(processor.encodeData(raw, encoded));
+
+    // 每个码字内的错误数在纠错能力之内
+    for (size_t i = 0; i < encoded.length(); i += 97) {
+        encoded[i] ^= 0x5A;
+    }
+
+    std::string decoded;
+    ASSERT_TRUE(processor.decodeData(encoded, decoded));
+    EXPECT_EQ(decoded, raw);
+}
+
+TEST(CodingProcessorTest, RoundTripStdpMessage) {
+    CodingProcessor processor;
+    ASSERT_TRUE(processor.initialize());
+
+    // 帧头加3个RS码字共124字节，交织填充到128字节
+    const std::string raw = randomPayload(stdp_message_bytes, 9);
+    std::string encoded;
+    ASSERT_TRUE(processor.encodeData(raw, encoded));
+    ASSERT_EQ(encoded.length(), 128u);
+
+    encoded[5] ^= 0x5A;
+    encoded[70] ^= 0x33;
+
+    std::string decoded;
+    ASSERT_TRUE(processor.decodeData(encoded, decoded));
+    EXPECT_EQ(decoded, raw);
+
+    // 每种剩余长度的短消息都能解码自身的编码结果
+    for (size_t length = 1; length <= 64; ++length) {
+        const std::string message = randomPayload(length, static_cast<uint32_t>(100 + length));
+        ASSERT_TRUE(processor.encodeData(message, encoded)) << length;
+        ASSERT_TRUE(processor.decodeData(encoded, decoded)) << length;
+        EXPECT_EQ(decoded, message) << length;
+    }
+}
+
+TEST(CodingProcessorTest, RoundTripKeepsTrailingZeros) {
+    CodingProcessor processor;
+    ASSERT_TRUE(processor.initialize());
+
+    // 以0x00结尾的二进制数据按帧头记录的长度原样返回
+    for (size_t length : {1, 2, 15, 16, 33, 100}) {
+        std::string raw = randomPayload(length, static_cast<uint32_t>(200 + length));
+        raw[length - 1] = '\0';
+        const std::string zeros(length, '\0');
+
+        std::string encoded;
+        std::string decoded;
+        ASSERT_TRUE(processor.encodeData(raw, encoded)) << length;
+        ASSERT_TRUE(processor.decodeData(encoded, decoded)) << length;
+        EXPECT_EQ(decoded, raw) << length;
+
+        ASSERT_TRUE(processor.encodeData(zeros, encoded)) << length;
+        ASSERT_TRUE(processor.decodeData(encoded, decoded)) << length;
+        EXPECT_EQ(decoded, zeros) << length;
+    }
+}
+
+TEST(CodingProcessorTest, RoundTripPaddingLikePayload) {
+    CodingProcessor processor;
+    ASSERT_TRUE(processor.initialize());
+
+    // 最后一块几乎全是交织填充用的'0'，不能被当成填充丢掉
+    for (size_t length : {15, 30, 33, 45, 93}) {
+        std::string raw = randomPayload(length, static_cast<uint32_t>(300 + length));
+        const size_t lastBlock = (length - 1) / 15 * 15;
+        for (size_t i = lastBlock; i < length; ++i) {
+            raw[i] = '0';
+        }
+
+        std::string encoded;
+        std::string decoded;
+        ASSERT_TRUE(processor.encodeData(raw, encoded)) << length;
+        ASSERT_TRUE(processor.decodeData(encoded, decoded)) << length;
+        EXPECT_EQ(decoded, raw) << length;
+
+        const std::string allPadding(length, '0');
+        ASSERT_TRUE(processor.encodeData(allPadding, encoded)) << length;
+        ASSERT_TRUE(processor.decodeData(encoded, decoded)) << length;
+        EXPECT_EQ(decoded, allPadding) << length;
+    }
+}
+
+TEST(CodingProcessorTest, EncryptedRoundTrip) {
+    CodingProcessor processor;
+    ASSERT_TRUE(processor.initialize());
+    const std::string key = "0123456789abcdef";
+    processor.setEncryptionKey(key);
+
+    // 覆盖RS块、AES块和交织矩阵的各种边界，包括交织填充超过一个密文块的长度
+    std::string encoded;
+    std::string decoded;
+    for (size_t length = 1; length <= 520; ++length) {
+        const std::string raw = randomPayload(length, static_cast<uint32_t>(400 + length));
+        ASSERT_TRUE(processor.encodeData(raw, encoded)) << length;
+        EXPECT_EQ(encoded.length(), processor.getEncodedLength(length)) << length;
+        ASSERT_TRUE(processor.decodeData(encoded, decoded)) << length;
+        EXPECT_EQ(decoded, raw) << length;
+    }
+
+    // 帧头不加密，其中的错误由RS纠正
+    const std::string raw = randomPayload(451, 23);
+    ASSERT_TRUE(processor.encodeData(raw, encoded));
+    EXPECT_EQ(encoded, legacyEncode(raw, key));
+    encoded[0] ^= 0x21;
+    ASSERT_TRUE(processor.decodeData(encoded, decoded));
+    EXPECT_EQ(decoded, raw);
+}
+
+TEST(CodingProcessorTest, BufferCapacity) {
+    CodingProcessor processor;
+    ASSERT_TRUE(processor.initialize());
+
+    const std::string raw = randomPayload(stdp_message_bytes, 3);
+    std::vector<uint8_t> output(processor.getEncodedLength(raw.length()) - 1);
+    size_t encodedLength = 0;
+    EXPECT_FALSE(processor.encodeData(reinterpret_cast<const uint8_t*>(raw.data()), raw.length(),
+                                      output.data(), output.size(), encodedLength));
+    EXPECT_EQ(encodedLength, 0u);
+}
+
+TEST(CodingProcessorTest, BatchCounterMode) {
+    CodingProcessor processor;
+    ASSERT_TRUE(processor.initialize());
+
+    const size_t count = 16;
+    const std::string messages = randomPayload(count * stdp_message_bytes, 19);
+    std::vector<uint8_t> ciphertexts(messages.size());
+    std::vector<uint8_t> decrypted(messages.size());
+    EXPECT_EQ(processor.aesEncryptBatch(reinterpret_cast<const uint8_t*>(messages.data()), count,
+                                        stdp_message_bytes, ciphertexts.data(), "key", 7), count);
+    EXPECT_EQ(processor.aesDecryptBatch(ciphertexts.data(), count, stdp_message_bytes,
+                                        decrypted.data(), "key", 7), count);
+    EXPECT_EQ(std::string(decrypted.begin(), decrypted.end()), messages);
+}
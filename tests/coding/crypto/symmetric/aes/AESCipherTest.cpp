@@ -0,0 +1,227 @@
+#include "gtest/gtest.h"
+#include "coding/crypto/symmetric/aes/AESCipher.h"
+#include "coding/crypto/symmetric/aes/AES.h"
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace link16::coding::crypto;
+
+namespace {
+
+const AESKernelType all_kernels[] = {AESKernelType::PORTABLE, AESKernelType::AESNI};
+
+std::vector<uint8_t> fromHex(const std::string& hex) {
+    std::vector<uint8_t> bytes(hex.length() / 2);
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        bytes[i] = static_cast<uint8_t>(std::stoi(hex.substr(2 * i, 2), nullptr, 16));
+    }
+    return bytes;
+}
+
+std::vector<uint8_t> randomBytes(size_t length, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::vector<uint8_t> bytes(length);
+    for (auto& b : bytes) {
+        b = static_cast<uint8_t>(rng());
+    }
+    return bytes;
+}
+
+// 依次切换到每个受支持的内核执行测试，结束后恢复默认内核
+template <typename Func>
+void forEachKernel(Func&& func) {
+    const AESKernelType original = getAESKernel();
+    for (AESKernelType kernel : all_kernels) {
+        if (!isAESKernelSupported(kernel)) {
+            continue;
+        }
+        setAESKernel(kernel);
+        SCOPED_TRACE(getAESKernelName(kernel));
+        func();
+    }
+    setAESKernel(original);
+}
+
+} // namespace
+
+// FIPS-197附录C
+TEST(AESCipherTest, KnownAnswerBlocks) {
+    const std::vector<uint8_t> plaintext = fromHex("00112233445566778899aabbccddeeff");
+    const struct {
+        const char* key;
+        const char* ciphertext;
+    } vectors[] = {
+        {"000102030405060708090a0b0c0d0e0f", "69c4e0d86a7b0430d8cdb78070b4c55a"},
+        {"000102030405060708090a0b0c0d0e0f1011121314151617", "dda97ca4864cdfe06eaf70a0ec0d7191"},
+        {"000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f",
+         "8ea2b7ca516745bfeafc49904b496089"},
+    };
+
+    forEachKernel([&]() {
+        for (const auto& v : vectors) {
+            const std::vector<uint8_t> key = fromHex(v.key);
+            AESCipher cipher;
+            ASSERT_TRUE(cipher.setKey(key.data(), key.size()));
+
+            std::vector<uint8_t> block(plaintext);
+            cipher.encryptBlocks(block.data(), block.data(), 1);
+            EXPECT_EQ(block, fromHex(v.ciphertext));
+            cipher.decryptBlocks(block.data(), block.data(), 1);
+            EXPECT_EQ(block, plaintext);
+        }
+    });
+
+    AESCipher cipher;
+    EXPECT_FALSE(cipher.setKey(plaintext.data(), 15));
+    EXPECT_FALSE(cipher.hasKey());
+}
+
+// 与原有的逐字节AES实现对比ECB结果
+TEST(AESCipherTest, MatchesLegacyECB) {
+    const AESKeyLength lengths[] = {AESKeyLength::AES_128, AESKeyLength::AES_192, AESKeyLength::AES_256};
+    const size_t keyBytes[] = {16, 24, 32};
+
+    forEachKernel([&]() {
+        for (int k = 0; k < 3; ++k) {
+            const std::vector<uint8_t> key = randomBytes(keyBytes[k], 100 + k);
+            const std::vector<uint8_t> plaintext = randomBytes(16 * 37, 200 + k);
+
+            AES legacy(lengths[k]);
+            const std::vector<unsigned char> expected = legacy.EncryptECB(plaintext, key);
+
+            AESCipher cipher;
+            ASSERT_TRUE(cipher.setKey(key.data(), key.size()));
+            std::vector<uint8_t> ciphertext(plaintext.size());
+            cipher.encryptBlocks(plaintext.data(), ciphertext.data(), plaintext.size() / 16);
+            EXPECT_EQ(ciphertext, expected);
+
+            std::vector<uint8_t> decrypted(ciphertext.size());
+            cipher.decryptBlocks(ciphertext.data(), decrypted.data(), ciphertext.size() / 16);
+            EXPECT_EQ(decrypted, plaintext);
+        }
+    });
+}
+
+// 期望值由 openssl enc -aes-128-ctr 生成，第二组计数器低64位会进位
+TEST(AESCipherTest, CounterMode) {
+    const std::vector<uint8_t> key = fromHex("2b7e151628aed2a6abf7158809cf4f3c");
+    const std::vector<uint8_t> plaintext = fromHex(
+        "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f"
+        "2021222324252627282930313233343536");
+    const struct {
+        const char* counter;
+        const char* ciphertext;
+    } vectors[] = {
+        {"f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff",
+         "ec8ddd709c657ab7fadb1c7ee693afeb263a6e2f7366477400b96dcce04d6db14a0de15b5cac1168969df82a25895871de"},
+        {"00000000000000ffffffffffffffffff",
+         "dacd934bfabef9e44adc8a5e3be71b50e655447ef43a448dbd64807b78b114a9a19d844b0487536dd2674b226e9de39ccb"},
+    };
+
+    forEachKernel([&]() {
+        AESCipher cipher;
+        ASSERT_TRUE(cipher.setKey(key.data(), key.size()));
+        for (const auto& v : vectors) {
+            const std::vector<uint8_t> counter = fromHex(v.counter);
+            std::vector<uint8_t> output(plaintext.size());
+            cipher.cryptCTR(counter.data(), plaintext.data(), output.data(), plaintext.size());
+            EXPECT_EQ(output, fromHex(v.ciphertext));
+
+            // 原地解密
+            cipher.cryptCTR(counter.data(), output.data(), output.data(), output.size());
+            EXPECT_EQ(output, plaintext);
+        }
+    });
+}
+
+// 批量CTR等价于逐条消息使用各自的计数器块
+TEST(AESCipherTest, CounterModeBatch) {
+    const std::vector<uint8_t> key = randomBytes(32, 1);
+    const uint64_t nonce = 0x0123456789ABCDEFULL;
+
+    forEachKernel([&]() {
+        AESCipher cipher;
+        ASSERT_TRUE(cipher.setKey(key.data(), key.size()));
+
+        for (size_t messageLength : {1, 16, 33, 100, 600}) {
+            const size_t count = 57;
+            const std::vector<uint8_t> messages = randomBytes(count * messageLength, 300);
+            std::vector<uint8_t> batch(messages.size());
+            cipher.cryptCTRBatch(nonce, messages.data(), count, messageLength, batch.data());
+
+            for (size_t m = 0; m < count; ++m) {
+                uint8_t counter[16] = {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF,
+                                       static_cast<uint8_t>(m >> 24), static_cast<uint8_t>(m >> 16),
+                                       static_cast<uint8_t>(m >> 8), static_cast<uint8_t>(m), 0, 0, 0, 0};
+                std::vector<uint8_t> single(messageLength);
+                cipher.cryptCTR(counter, messages.data() + m * messageLength, single.data(), messageLength);
+                ASSERT_TRUE(std::equal(single.begin(), single.end(), batch.begin() + m * messageLength))
+                    << "messageLength=" << messageLength << ", m=" << m;
+            }
+
+            cipher.cryptCTRBatch(nonce, batch.data(), count, messageLength, batch.data());
+            EXPECT_EQ(batch, messages);
+        }
+    });
+}
+
+// NIST GCM规范测试用例2~4
+TEST(AESCipherTest, GaloisCounterMode) {
+    const struct {
+        const char* key;
+        const char* iv;
+        const char* aad;
+        const char* plaintext;
+        const char* ciphertext;
+        const char* tag;
+    } vectors[] = {
+        {"00000000000000000000000000000000", "000000000000000000000000", "",
+         "00000000000000000000000000000000", "0388dace60b6a392f328c2b971b2fe78",
+         "ab6e47d42cec13bdf53a67b21257bddf"},
+        {"feffe9928665731c6d6a8f9467308308", "cafebabefacedbaddecaf888", "",
+         "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+         "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b391aafd255",
+         "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+         "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091473f5985",
+         "4d5c2af327cd64a62cf35abd2ba6fab4"},
+        {"feffe9928665731c6d6a8f9467308308", "cafebabefacedbaddecaf888",
+         "feedfacedeadbeeffeedfacedeadbeefabaddad2",
+         "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+         "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b39",
+         "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+         "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091",
+         "5bc94fbc3221a5db94fae95ae7121a47"},
+    };
+
+    forEachKernel([&]() {
+        for (const auto& v : vectors) {
+            const std::vector<uint8_t> key = fromHex(v.key);
+            const std::vector<uint8_t> iv = fromHex(v.iv);
+            const std::vector<uint8_t> aad = fromHex(v.aad);
+            const std::vector<uint8_t> plaintext = fromHex(v.plaintext);
+
+            AESCipher cipher;
+            ASSERT_TRUE(cipher.setKey(key.data(), key.size()));
+
+            std::vector<uint8_t> ciphertext(plaintext.size());
+            uint8_t tag[AESCipher::gcm_tag_size];
+            cipher.encryptGCM(iv.data(), aad.data(), aad.size(), plaintext.data(), ciphertext.data(),
+                              plaintext.size(), tag);
+            EXPECT_EQ(ciphertext, fromHex(v.ciphertext));
+            EXPECT_EQ(std::vector<uint8_t>(tag, tag + 16), fromHex(v.tag));
+
+            std::vector<uint8_t> decrypted(ciphertext.size());
+            EXPECT_TRUE(cipher.decryptGCM(iv.data(), aad.data(), aad.size(), ciphertext.data(),
+                                          decrypted.data(), ciphertext.size(), tag));
+            EXPECT_EQ(decrypted, plaintext);
+
+            // 篡改密文后认证失败，输出被清零
+            ciphertext[0] ^= 1;
+            EXPECT_FALSE(cipher.decryptGCM(iv.data(), aad.data(), aad.size(), ciphertext.data(),
+                                           decrypted.data(), ciphertext.size(), tag));
+            EXPECT_EQ(decrypted, std::vector<uint8_t>(decrypted.size(), 0));
+        }
+    });
+}
@@ -0,0 +1,104 @@
+#include "gtest/gtest.h"
+#include "coding/crypto/symmetric/aes/AESCrypto.h"
+#include "coding/crypto/symmetric/aes/AES.h"
+#include <cstdint>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace link16::coding::crypto;
+
+namespace {
+
+std::string randomString(size_t length, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::string s(length, '\0');
+    for (auto& c : s) {
+        c = static_cast<char>(rng());
+    }
+    return s;
+}
+
+// 原实现：密钥截断或补0，PKCS7填充后逐字节AES ECB加密，输出小写十六进制
+std::string legacyEncrypt(const std::string& plaintext, const std::string& key, int keySize) {
+    const AESKeyLength length = keySize == 128 ? AESKeyLength::AES_128
+                              : keySize == 192 ? AESKeyLength::AES_192 : AESKeyLength::AES_256;
+    std::vector<unsigned char> keyVec(key.begin(), key.end());
+    keyVec.resize(keySize / 8, 0);
+
+    std::vector<unsigned char> data(plaintext.begin(), plaintext.end());
+    const size_t paddingSize = 16 - data.size() % 16;
+    data.insert(data.end(), paddingSize, static_cast<unsigned char>(paddingSize));
+
+    AES aes(length);
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0');
+    for (unsigned char b : aes.EncryptECB(data, keyVec)) {
+        ss << std::setw(2) << static_cast<int>(b);
+    }
+    return ss.str();
+}
+
+} // namespace
+
+TEST(AESCryptoTest, MatchesLegacyFormat) {
+    for (int keySize : {128, 192, 256}) {
+        AESCrypto crypto(keySize);
+        for (size_t length : {0, 1, 15, 16, 17, 93, 256}) {
+            const std::string plaintext = randomString(length, static_cast<uint32_t>(length));
+            // 短密钥补0，长密钥截断
+            for (const std::string& key : {std::string("short"), randomString(40, 9)}) {
+                const std::string ciphertext = crypto.encrypt(plaintext, key);
+                EXPECT_EQ(ciphertext, legacyEncrypt(plaintext, key, keySize));
+                EXPECT_EQ(ciphertext.length(), AESCrypto::getEncryptedLength(length));
+                EXPECT_EQ(crypto.decrypt(ciphertext, key), plaintext);
+            }
+        }
+    }
+
+    AESCrypto crypto;
+    EXPECT_THROW(crypto.decrypt("abc", "key"), std::invalid_argument);
+    EXPECT_THROW(crypto.decrypt(std::string(32, 'x'), "key"), std::invalid_argument);
+}
+
+TEST(AESCryptoTest, BatchCounterMode) {
+    AESCrypto crypto(256);
+    const std::string key = randomString(32, 1);
+    const size_t count = 40;
+    const size_t messageLength = 33;
+    const std::string messages = randomString(count * messageLength, 2);
+
+    std::vector<uint8_t> ciphertexts(messages.size());
+    EXPECT_EQ(crypto.encryptBatchCTR(reinterpret_cast<const uint8_t*>(messages.data()), count, messageLength,
+                                     ciphertexts.data(), key, 42), count);
+    EXPECT_NE(std::string(ciphertexts.begin(), ciphertexts.end()), messages);
+
+    std::vector<uint8_t> decrypted(messages.size());
+    EXPECT_EQ(crypto.decryptBatchCTR(ciphertexts.data(), count, messageLength, decrypted.data(), key, 42), count);
+    EXPECT_EQ(std::string(decrypted.begin(), decrypted.end()), messages);
+}
+
+TEST(AESCryptoTest, GaloisCounterMode) {
+    AESCrypto crypto(128);
+    const std::string key = "0123456789abcdef";
+    const std::string plaintext = randomString(75, 3);
+    const uint8_t iv[12] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    const uint8_t header[4] = {0xA5, 0x5A, 0x00, 0x10};
+
+    std::vector<uint8_t> ciphertext(plaintext.size());
+    uint8_t tag[16];
+    ASSERT_TRUE(crypto.encryptGCM(reinterpret_cast<const uint8_t*>(plaintext.data()), plaintext.size(), key,
+                                  iv, header, sizeof(header), ciphertext.data(), tag));
+
+    std::vector<uint8_t> decrypted(ciphertext.size());
+    EXPECT_TRUE(crypto.decryptGCM(ciphertext.data(), ciphertext.size(), key, iv, header, sizeof(header),
+                                  tag, decrypted.data()));
+    EXPECT_EQ(std::string(decrypted.begin(), decrypted.end()), plaintext);
+
+    // 消息头被篡改时认证失败
+    const uint8_t forged[4] = {0xA5, 0x5A, 0x00, 0x11};
+    EXPECT_FALSE(crypto.decryptGCM(ciphertext.data(), ciphertext.size(), key, iv, forged, sizeof(forged),
+                                   tag, decrypted.data()));
+}
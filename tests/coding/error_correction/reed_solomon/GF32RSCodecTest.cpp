@@ -0,0 +1,263 @@
+#include "gtest/gtest.h"
+#include "coding/error_correction/reed_solomon/GF32RSCodec.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace link16::coding::error_correction;
+
+typedef GF32RSCodec<code_31_15, data_31_15> Codec31;
+typedef GF32RSCodec<code_16_7, data_16_7> Codec16;
+
+// 域表在编译期生成
+static_assert(gf32::alpha(0) == 1, "alpha^0应为1");
+static_assert(gf32::alpha(5) == 0x05, "alpha^5 = alpha^2 + 1");
+static_assert(gf32::mul(gf32::div(17, 9), 9) == 17, "乘除互逆");
+
+// 测试GF(32)域运算
+TEST(GF32RSCodecTest, FieldTables) {
+    // alpha是本原元: alpha^0..alpha^30互不相同且覆盖所有非零元素
+    std::vector<bool> seen(32, false);
+    for (int i = 0; i < gf32::field_size; ++i) {
+        const uint8_t value = gf32::alpha(i);
+        ASSERT_NE(value, 0);
+        ASSERT_LT(value, 32);
+        EXPECT_FALSE(seen[value]);
+        seen[value] = true;
+        EXPECT_EQ(gf32::tables.log[value], i);
+    }
+    EXPECT_EQ(gf32::alpha(gf32::field_size), 1);
+
+    for (int a = 1; a < 32; ++a) {
+        EXPECT_EQ(gf32::mul(static_cast<uint8_t>(a), gf32::div(1, static_cast<uint8_t>(a))), 1);
+    }
+}
+
+// 测试编码结果为合法码字
+template <typename Codec>
+void checkRoundTrip(uint32_t seed) {
+    std::mt19937 rng(seed);
+    uint8_t data[Codec::data_length];
+    uint8_t codeword[Codec::code_length];
+
+    for (int trial = 0; trial < 200; ++trial) {
+        for (auto& s : data) {
+            s = static_cast<uint8_t>(rng() % 32);
+        }
+        Codec::encode(data, codeword);
+
+        // 系统码: 数据符号原样保留
+        for (int i = 0; i < Codec::data_length; ++i) {
+            ASSERT_EQ(codeword[i], data[i]);
+        }
+
+        int corrected = -1;
+        ASSERT_TRUE(Codec::decode(codeword, &corrected));
+        EXPECT_EQ(corrected, 0);
+    }
+}
+
+TEST(GF32RSCodecTest, EncodeProducesCodeword) {
+    checkRoundTrip<Codec31>(1);
+    checkRoundTrip<Codec16>(2);
+}
+
+// 测试纠正不超过纠错能力的错误
+template <typename Codec>
+void checkErrorCorrection(uint32_t seed) {
+    std::mt19937 rng(seed);
+    uint8_t data[Codec::data_length];
+    uint8_t codeword[Codec::code_length];
+    uint8_t received[Codec::code_length];
+
+    for (int trial = 0; trial < 500; ++trial) {
+        for (auto& s : data) {
+            s = static_cast<uint8_t>(rng() % 32);
+        }
+        Codec::encode(data, codeword);
+
+        // 在不同位置引入errors个非零错误
+        const int errors = trial % (Codec::capability + 1);
+        std::vector<int> positions(Codec::code_length);
+        for (int i = 0; i < Codec::code_length; ++i) {
+            positions[i] = i;
+        }
+        std::shuffle(positions.begin(), positions.end(), rng);
+
+        std::copy(codeword, codeword + Codec::code_length, received);
+        for (int e = 0; e < errors; ++e) {
+            received[positions[e]] ^= static_cast<uint8_t>(1 + rng() % 31);
+        }
+
+        int corrected = -1;
+        ASSERT_TRUE(Codec::decode(received, &corrected));
+        EXPECT_EQ(corrected, errors);
+        for (int i = 0; i < Codec::code_length; ++i) {
+            ASSERT_EQ(received[i], codeword[i]);
+        }
+    }
+}
+
+TEST(GF32RSCodecTest, CorrectsUpToCapability) {
+    EXPECT_EQ(Codec31::capability, 8);
+    EXPECT_EQ(Codec16::capability, 4);
+    checkErrorCorrection<Codec31>(3);
+    checkErrorCorrection<Codec16>(4);
+}
+
+// 测试超出纠错能力时不会输出非法码字
+TEST(GF32RSCodecTest, BeyondCapability) {
+    std::mt19937 rng(5);
+    uint8_t data[Codec31::data_length];
+    uint8_t codeword[Codec31::code_length];
+
+    int failures = 0;
+    for (int trial = 0; trial < 200; ++trial) {
+        for (auto& s : data) {
+            s = static_cast<uint8_t>(rng() % 32);
+        }
+        Codec31::encode(data, codeword);
+        for (int e = 0; e < Codec31::capability + 3; ++e) {
+            codeword[(e * 3) % Codec31::code_length] ^= static_cast<uint8_t>(1 + rng() % 31);
+        }
+
+        uint8_t received[Codec31::code_length];
+        std::copy(codeword, codeword + Codec31::code_length, received);
+        if (!Codec31::decode(received)) {
+            // 解码失败时码字保持不变
+            EXPECT_TRUE(std::equal(received, received + Codec31::code_length, codeword));
+            ++failures;
+        } else {
+            int corrected = -1;
+            EXPECT_TRUE(Codec31::decode(received, &corrected));
+            EXPECT_EQ(corrected, 0);
+        }
+    }
+    EXPECT_GT(failures, 0);
+}
+
+// 测试symbol数组接口
+TEST(GF32RSCodecTest, SymbolArrays) {
+    symbol data[Codec31::data_length];
+    for (int i = 0; i < Codec31::data_length; ++i) {
+        data[i] = symbol(static_cast<unsigned long>(i * 7 % 32));
+    }
+
+    symbol codeword[Codec31::code_length];
+    Codec31::encode(data, codeword);
+
+    uint8_t packed[Codec31::data_length];
+    for (int i = 0; i < Codec31::data_length; ++i) {
+        packed[i] = static_cast<uint8_t>(data[i].to_ulong());
+    }
+    uint8_t packedCodeword[Codec31::code_length];
+    Codec31::encode(packed, packedCodeword);
+    for (int i = 0; i < Codec31::code_length; ++i) {
+        EXPECT_EQ(codeword[i].to_ulong(), packedCodeword[i]);
+    }
+
+    codeword[3].flip();
+    codeword[20] ^= symbol(0x11);
+    int corrected = 0;
+    ASSERT_TRUE(Codec31::decode(codeword, &corrected));
+    EXPECT_EQ(corrected, 2);
+    for (int i = 0; i < Codec31::code_length; ++i) {
+        EXPECT_EQ(codeword[i].to_ulong(), packedCodeword[i]);
+    }
+}
+
+// 测试纠错纠删: 2E + S <= fecLength时可以纠正
+template <typename Codec>
+void checkErasureCorrection(uint32_t seed) {
+    std::mt19937 rng(seed);
+    uint8_t data[Codec::data_length];
+    uint8_t codeword[Codec::code_length];
+    uint8_t received[Codec::code_length];
+
+    for (int erasures = 0; erasures <= Codec::fec_length; ++erasures) {
+        const int maxErrors = (Codec::fec_length - erasures) / 2;
+        for (int trial = 0; trial < 50; ++trial) {
+            for (auto& s : data) {
+                s = static_cast<uint8_t>(rng() % 32);
+            }
+            Codec::encode(data, codeword);
+
+            std::vector<int> positions(Codec::code_length);
+            for (int i = 0; i < Codec::code_length; ++i) {
+                positions[i] = i;
+            }
+            std::shuffle(positions.begin(), positions.end(), rng);
+
+            // 删除位置的值任意(可能恰好正确)，错误位置的值一定错误
+            const int errors = trial % (maxErrors + 1);
+            std::copy(codeword, codeword + Codec::code_length, received);
+            for (int e = 0; e < erasures; ++e) {
+                received[positions[e]] = static_cast<uint8_t>(rng() % 32);
+            }
+            for (int e = 0; e < errors; ++e) {
+                received[positions[erasures + e]] ^= static_cast<uint8_t>(1 + rng() % 31);
+            }
+
+            ASSERT_TRUE(Codec::decode(received, positions.data(), erasures))
+                << "erasures=" << erasures << " errors=" << errors;
+            for (int i = 0; i < Codec::code_length; ++i) {
+                ASSERT_EQ(received[i], codeword[i]);
+            }
+        }
+    }
+}
+
+TEST(GF32RSCodecTest, CorrectsErrorsAndErasures) {
+    checkErasureCorrection<Codec31>(6);
+    checkErasureCorrection<Codec16>(7);
+
+    // 非法的删除列表
+    uint8_t codeword[Codec31::code_length] = {};
+    const int duplicate[] = {3, 3};
+    const int outOfRange[] = {Codec31::code_length};
+    EXPECT_FALSE(Codec31::decode(codeword, duplicate, 2));
+    EXPECT_FALSE(Codec31::decode(codeword, outOfRange, 1));
+    std::vector<int> tooMany(Codec31::fec_length + 1);
+    for (int i = 0; i < static_cast<int>(tooMany.size()); ++i) {
+        tooMany[i] = i;
+    }
+    EXPECT_FALSE(Codec31::decode(codeword, tooMany.data(), static_cast<int>(tooMany.size())));
+}
+
+// 测试软判决解码: 错误集中在低可靠度符号时超过硬判决纠错能力也能纠正
+TEST(GF32RSCodecTest, SoftDecisionDecoding) {
+    std::mt19937 rng(8);
+    uint8_t data[Codec31::data_length];
+    uint8_t codeword[Codec31::code_length];
+    double llr[Codec31::code_length * 5];
+
+    for (int errors = 0; errors <= Codec31::fec_length; ++errors) {
+        for (auto& s : data) {
+            s = static_cast<uint8_t>(rng() % 32);
+        }
+        Codec31::encode(data, codeword);
+
+        // 可靠的符号|LLR|为8，出错的符号有一个比特翻转且|LLR|很小
+        for (int t = 0; t < Codec31::code_length; ++t) {
+            for (int b = 0; b < 5; ++b) {
+                llr[t * 5 + b] = ((codeword[t] >> (4 - b)) & 1) ? 8.0 : -8.0;
+            }
+        }
+        for (int e = 0; e < errors; ++e) {
+            const int t = (e * 7) % Codec31::code_length;
+            const int b = e % 5;
+            llr[t * 5 + b] = -0.1 * (e + 1) * (llr[t * 5 + b] > 0.0 ? 1.0 : -1.0);
+        }
+
+        uint8_t decoded[Codec31::code_length];
+        int corrected = -1;
+        int erased = -1;
+        ASSERT_TRUE(Codec31::decodeSoft(llr, decoded, &corrected, &erased)) << "errors=" << errors;
+        EXPECT_EQ(corrected, errors);
+        EXPECT_EQ(erased > 0, errors > Codec31::capability);
+        for (int t = 0; t < Codec31::code_length; ++t) {
+            ASSERT_EQ(decoded[t], codeword[t]);
+        }
+    }
+}
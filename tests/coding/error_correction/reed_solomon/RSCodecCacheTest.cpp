@@ -0,0 +1,65 @@
+#include "gtest/gtest.h"
+#include "coding/error_correction/reed_solomon/RSCodecCache.h"
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace link16::coding::error_correction;
+
+// 同一形状返回同一个上下文，不支持的形状返回空指针
+TEST(RSCodecCacheTest, ReturnsSharedContextPerShape) {
+    RSCodecCache& cache = RSCodecCache::getInstance();
+    ASSERT_TRUE(cache.preload());
+
+    auto context = cache.get(31, 15);
+    ASSERT_TRUE(context);
+    EXPECT_EQ(context, cache.get(31, 15));
+    EXPECT_EQ(context->getCodeLength(), 31);
+    EXPECT_EQ(context->getDataLength(), 15);
+    EXPECT_TRUE(cache.get(16, 7));
+
+    EXPECT_FALSE(RSCodecContext::isSupported(30, 10));
+    EXPECT_FALSE(cache.get(30, 10));
+}
+
+// 缓存上下文与独立构建的上下文编码结果一致，多线程可共享只读上下文
+TEST(RSCodecCacheTest, CachedContextMatchesFreshAndIsThreadSafe) {
+    auto context = RSCodecCache::getInstance().get(31, 15);
+    auto fresh = RSCodecContext::create(31, 15);
+    ASSERT_TRUE(context);
+    ASSERT_TRUE(fresh);
+
+    uint8_t data[15];
+    for (int i = 0; i < 15; ++i) {
+        data[i] = static_cast<uint8_t>(i * 17 + 3);
+    }
+    uint8_t cached[31];
+    uint8_t uncached[31];
+    ASSERT_TRUE(context->encode(data, cached));
+    ASSERT_TRUE(fresh->encode(data, uncached));
+    EXPECT_EQ(std::memcmp(cached, uncached, 31), 0);
+
+    std::vector<std::thread> workers;
+    std::vector<int> failures(4, 0);
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&, t]() {
+            for (int n = 0; n < 200; ++n) {
+                uint8_t codeword[31];
+                std::memcpy(codeword, cached, 31);
+                codeword[(t + n) % 31] ^= 0x5A;
+                int corrected = 0;
+                if (!context->decode(codeword, &corrected) || corrected != 1 ||
+                    std::memcmp(codeword, cached, 31) != 0) {
+                    ++failures[t];
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (int t = 0; t < 4; ++t) {
+        EXPECT_EQ(failures[t], 0) << "线程 " << t;
+    }
+}
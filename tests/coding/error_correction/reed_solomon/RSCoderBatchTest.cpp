@@ -0,0 +1,58 @@
+#include "gtest/gtest.h"
+#include "coding/error_correction/reed_solomon/RSCoder.h"
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace link16::coding::error_correction;
+
+// 批量编码结果与逐个编码一致
+TEST(RSCoderBatchTest, EncodeBatchMatchesSingleEncode) {
+    RSCoder coder(31, 15);
+    const size_t count = 8;
+
+    std::vector<uint8_t> messages(count * 15);
+    for (size_t i = 0; i < messages.size(); ++i) {
+        messages[i] = static_cast<uint8_t>(i * 31 + 5);
+    }
+
+    std::vector<uint8_t> codewords(count * 31);
+    ASSERT_EQ(coder.encodeBatch(messages.data(), count, codewords.data()), count);
+    for (size_t n = 0; n < count; ++n) {
+        uint8_t single[31];
+        ASSERT_TRUE(coder.encode(&messages[n * 15], 15, single));
+        EXPECT_EQ(std::memcmp(single, &codewords[n * 31], 31), 0) << "码字 " << n;
+    }
+}
+
+// 码字n引入n个错误，超过纠错能力(8)的码字标记为失败，其余正确恢复
+TEST(RSCoderBatchTest, DecodeBatchReportsPerCodewordStatus) {
+    RSCoder coder(31, 15);
+    const size_t count = 8;
+
+    std::vector<uint8_t> messages(count * 15);
+    for (size_t i = 0; i < messages.size(); ++i) {
+        messages[i] = static_cast<uint8_t>(i * 31 + 5);
+    }
+    std::vector<uint8_t> codewords(count * 31);
+    ASSERT_EQ(coder.encodeBatch(messages.data(), count, codewords.data()), count);
+
+    for (size_t n = 0; n < count; ++n) {
+        for (size_t e = 0; e < n; ++e) {
+            codewords[n * 31 + e * 3] ^= 0xA5;
+        }
+    }
+    codewords[7 * 31 + 30] ^= 0x01;
+    codewords[7 * 31 + 29] ^= 0x01;
+
+    std::vector<uint8_t> decoded(count * 15);
+    std::vector<int> corrected(count);
+    bool failed[count];
+    EXPECT_EQ(coder.decodeBatch(codewords.data(), count, decoded.data(), corrected.data(), failed), count - 1);
+    for (size_t n = 0; n < count - 1; ++n) {
+        EXPECT_FALSE(failed[n]) << "码字 " << n;
+        EXPECT_EQ(corrected[n], static_cast<int>(n));
+        EXPECT_EQ(std::memcmp(&decoded[n * 15], &messages[n * 15], 15), 0) << "码字 " << n;
+    }
+    EXPECT_TRUE(failed[count - 1]);
+}
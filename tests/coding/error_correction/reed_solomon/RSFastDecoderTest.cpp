@@ -0,0 +1,99 @@
+#include "gtest/gtest.h"
+#include "coding/error_correction/reed_solomon/RSCodecCache.h"
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace link16::coding::error_correction;
+
+// 各向量化解码内核与schifra参考解码器逐位一致，错误数覆盖0到超出纠错能力
+TEST(RSFastDecoderTest, KernelsMatchReferenceDecoder) {
+    const GFKernelType kernels[] = {GFKernelType::SCALAR, GFKernelType::SSE41, GFKernelType::AVX2};
+    const GFKernelType original = RSCodecContext::getDecoderKernel();
+    const int shapes[][2] = {{31, 15}, {16, 7}, {63, 31}};
+    std::mt19937 rng(20240601);
+
+    for (const auto& shape : shapes) {
+        const int codeLength = shape[0];
+        const int dataLength = shape[1];
+        const int capability = (codeLength - dataLength) / 2;
+        auto context = RSCodecCache::getInstance().get(codeLength, dataLength);
+        ASSERT_TRUE(context);
+
+        std::vector<uint8_t> data(dataLength);
+        std::vector<uint8_t> codeword(codeLength);
+
+        for (int trial = 0; trial < 2000; ++trial) {
+            for (auto& symbol : data) {
+                symbol = static_cast<uint8_t>(rng());
+            }
+            ASSERT_TRUE(context->encode(data.data(), codeword.data()));
+
+            const int errors = trial % (capability + 4);
+            for (int e = 0; e < errors; ++e) {
+                codeword[rng() % codeLength] ^= static_cast<uint8_t>(1 + rng() % 255);
+            }
+
+            std::vector<uint8_t> reference(codeword);
+            int referenceCorrected = -1;
+            RSCodecContext::setDecoderKernel(GFKernelType::REFERENCE);
+            const bool referenceResult = context->decode(reference.data(), &referenceCorrected);
+
+            for (GFKernelType kernel : kernels) {
+                if (!isGFKernelSupported(kernel)) {
+                    continue;
+                }
+                std::vector<uint8_t> fast(codeword);
+                int fastCorrected = -1;
+                RSCodecContext::setDecoderKernel(kernel);
+                const bool fastResult = context->decode(fast.data(), &fastCorrected);
+
+                EXPECT_EQ(fastResult, referenceResult)
+                    << getGFKernelName(kernel) << " RS(" << codeLength << "," << dataLength << ") trial " << trial;
+                EXPECT_EQ(fastCorrected, referenceCorrected) << getGFKernelName(kernel) << " trial " << trial;
+                EXPECT_EQ(fast, reference) << getGFKernelName(kernel) << " trial " << trial;
+            }
+        }
+    }
+
+    RSCodecContext::setDecoderKernel(original);
+}
+
+// 查表编码器与schifra参考编码器逐位一致，原地编码结果相同
+TEST(RSFastDecoderTest, FastEncoderMatchesReferenceEncoder) {
+    const GFKernelType original = RSCodecContext::getDecoderKernel();
+    const int shapes[][2] = {{31, 15}, {16, 7}, {63, 31}, {63, 55}};
+    std::mt19937 rng(20240615);
+
+    for (const auto& shape : shapes) {
+        const int codeLength = shape[0];
+        const int dataLength = shape[1];
+        auto context = RSCodecCache::getInstance().get(codeLength, dataLength);
+        ASSERT_TRUE(context);
+
+        std::vector<uint8_t> data(dataLength);
+        std::vector<uint8_t> reference(codeLength);
+        std::vector<uint8_t> fast(codeLength);
+
+        for (int trial = 0; trial < 500; ++trial) {
+            for (auto& symbol : data) {
+                symbol = trial == 0 ? 0 : static_cast<uint8_t>(rng());
+            }
+
+            RSCodecContext::setDecoderKernel(GFKernelType::REFERENCE);
+            ASSERT_TRUE(context->encode(data.data(), reference.data()));
+
+            RSCodecContext::setDecoderKernel(GFKernelType::SCALAR);
+            ASSERT_TRUE(context->encode(data.data(), fast.data()));
+            EXPECT_EQ(fast, reference) << "RS(" << codeLength << "," << dataLength << ") trial " << trial;
+
+            std::vector<uint8_t> inPlace(codeLength);
+            std::memcpy(inPlace.data(), data.data(), dataLength);
+            ASSERT_TRUE(context->encode(inPlace.data(), inPlace.data()));
+            EXPECT_EQ(inPlace, reference) << "RS(" << codeLength << "," << dataLength << ") trial " << trial;
+        }
+    }
+
+    RSCodecContext::setDecoderKernel(original);
+}
@@ -0,0 +1,50 @@
+#include "gtest/gtest.h"
+#include "coding/error_correction/reed_solomon/SymbolReliabilityMapper.h"
+#include <cstdint>
+#include <vector>
+
+using namespace link16::coding::error_correction;
+
+// 测试硬判决和可靠度
+TEST(SymbolReliabilityMapperTest, MapSymbols) {
+    const double llr[] = {
+        3.0, -2.0, 1.5, -0.5, 4.0,    // 10101，最弱比特0.5
+        -1.0, -1.0, -1.0, -1.0, -1.0, // 00000
+        0.2, 9.0, 9.0, 9.0, -9.0      // 11110，最弱比特0.2
+    };
+    uint8_t symbols[3];
+    double reliability[3];
+    SymbolReliabilityMapper::mapSymbols(llr, 3, symbols, reliability);
+
+    EXPECT_EQ(symbols[0], 0x15);
+    EXPECT_EQ(symbols[1], 0x00);
+    EXPECT_EQ(symbols[2], 0x1E);
+    EXPECT_DOUBLE_EQ(reliability[0], 0.5);
+    EXPECT_DOUBLE_EQ(reliability[1], 1.0);
+    EXPECT_DOUBLE_EQ(reliability[2], 0.2);
+
+    int order[3];
+    SymbolReliabilityMapper::rankSymbols(reliability, 3, order);
+    EXPECT_EQ(order[0], 2);
+    EXPECT_EQ(order[1], 0);
+    EXPECT_EQ(order[2], 1);
+}
+
+// 测试按门限选择删除，超出上限时保留最不可靠的
+TEST(SymbolReliabilityMapperTest, SelectErasures) {
+    const std::vector<double> reliability = {5.0, 0.3, 2.0, 0.1, 0.9, 7.0, 0.5};
+    int erasures[8];
+
+    EXPECT_EQ(SymbolReliabilityMapper::selectErasures(reliability.data(), 7, 1.0, 8, erasures), 4);
+    EXPECT_EQ(erasures[0], 3);
+    EXPECT_EQ(erasures[1], 1);
+    EXPECT_EQ(erasures[2], 6);
+    EXPECT_EQ(erasures[3], 4);
+
+    EXPECT_EQ(SymbolReliabilityMapper::selectErasures(reliability.data(), 7, 1.0, 2, erasures), 2);
+    EXPECT_EQ(erasures[0], 3);
+    EXPECT_EQ(erasures[1], 1);
+
+    EXPECT_EQ(SymbolReliabilityMapper::selectErasures(reliability.data(), 7, 1.0, 0, erasures), 0);
+    EXPECT_EQ(SymbolReliabilityMapper::selectErasures(reliability.data(), 7, 0.05, 8, erasures), 0);
+}
@@ -0,0 +1,104 @@
+#include "gtest/gtest.h"
+#include "coding/error_detection/crc/CRCCalculator.h"
+#include "coding/error_detection/crc/CRCCoder.h"
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace link16::coding::error_detection;
+
+namespace {
+
+const CRCKernelType all_kernels[] = {
+    CRCKernelType::BITWISE, CRCKernelType::SLICING_BY_8, CRCKernelType::PCLMUL
+};
+
+std::vector<uint8_t> randomBytes(size_t length, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::vector<uint8_t> bytes(length);
+    for (auto& b : bytes) {
+        b = static_cast<uint8_t>(rng());
+    }
+    return bytes;
+}
+
+} // namespace
+
+// 测试标准校验值
+TEST(CRCCoderTest, CheckValues) {
+    const std::string check = "123456789";
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(check.data());
+
+    for (CRCKernelType kernel : all_kernels) {
+        SCOPED_TRACE(getCRCKernelName(kernel));
+        EXPECT_EQ(calculateCRC32(data, check.length(), kernel), 0xCBF43926u);
+        EXPECT_EQ(calculateCRC16(data, check.length(), kernel), 0x29B1);
+        EXPECT_EQ(calculateCRC32(data, 0, kernel), 0u);
+        EXPECT_EQ(calculateCRC16(data, 0, kernel), 0xFFFF);
+    }
+}
+
+// 测试各内核与CRC++在不同长度和未对齐起始地址下结果一致
+TEST(CRCCoderTest, KernelsMatchReference) {
+    const std::vector<uint8_t> bytes = randomBytes(4096 + 16, 7);
+
+    for (size_t length = 0; length <= 4096; length += (length < 300 ? 1 : 97)) {
+        for (size_t offset = 0; offset < 16; offset += 5) {
+            const uint8_t* data = bytes.data() + offset;
+            const uint32_t expected32 = CRC::Calculate(data, length, CRC::CRC_32());
+            const uint16_t expected16 = CRC::Calculate(data, length, CRC::CRC_16_CCITTFALSE());
+
+            for (CRCKernelType kernel : all_kernels) {
+                ASSERT_EQ(calculateCRC32(data, length, kernel), expected32)
+                    << getCRCKernelName(kernel) << " length=" << length << " offset=" << offset;
+                ASSERT_EQ(calculateCRC16(data, length, kernel), expected16)
+                    << getCRCKernelName(kernel) << " length=" << length << " offset=" << offset;
+            }
+        }
+    }
+}
+
+// 测试默认内核选择
+TEST(CRCCoderTest, KernelSelection) {
+    EXPECT_TRUE(isCRCKernelSupported(CRCKernelType::BITWISE));
+    EXPECT_TRUE(isCRCKernelSupported(CRCKernelType::SLICING_BY_8));
+    EXPECT_TRUE(isCRCKernelSupported(detectCRCKernel()));
+
+    const CRCKernelType saved = getCRCKernel();
+    setCRCKernel(CRCKernelType::BITWISE);
+    EXPECT_EQ(getCRCKernel(), CRCKernelType::BITWISE);
+    setCRCKernel(CRCKernelType::PCLMUL);
+    EXPECT_EQ(getCRCKernel(), isCRCKernelSupported(CRCKernelType::PCLMUL)
+                                  ? CRCKernelType::PCLMUL : CRCKernelType::SLICING_BY_8);
+    setCRCKernel(saved);
+}
+
+// 测试分块流式计算与一次性计算一致
+TEST(CRCCoderTest, Streaming) {
+    const std::vector<uint8_t> bytes = randomBytes(100000, 11);
+    const uint32_t expected32 = calculateCRC32(bytes.data(), bytes.size());
+    const uint16_t expected16 = calculateCRC16(bytes.data(), bytes.size());
+
+    std::mt19937 rng(13);
+    CRC32Stream stream32;
+    CRC16Stream stream16;
+    uint32_t chained = 0;
+    size_t pos = 0;
+    while (pos < bytes.size()) {
+        const size_t chunk = std::min<size_t>(rng() % 5000, bytes.size() - pos);
+        stream32.update(bytes.data() + pos, chunk);
+        stream16.update(bytes.data() + pos, chunk);
+        chained = updateCRC32(chained, bytes.data() + pos, chunk);
+        pos += chunk;
+    }
+
+    EXPECT_EQ(stream32.finalize(), expected32);
+    EXPECT_EQ(stream16.finalize(), expected16);
+    EXPECT_EQ(chained, expected32);
+    EXPECT_EQ(stream32.size(), bytes.size());
+
+    stream32.reset();
+    stream32.update(std::string("123456789"));
+    EXPECT_EQ(stream32.finalize(), 0xCBF43926u);
+}
@@ -2,8 +2,33 @@
 #include "coding/error_detection/parity/BIPCoder.h"
 #include <string>
 #include <bitset>
+#include <random>
+#include <vector>
 
 using namespace link16::coding::error_detection;
+using link16::BitBuffer;
+
+namespace {
+
+// 逐比特参考实现
+std::bitset<5> referenceBIP(const std::string& data) {
+    if (data.empty()) {
+        return std::bitset<5>();
+    }
+    int counts[5] = {0, 0, 0, 0, 0};
+    for (size_t i = 0; i < data.size() * 8; ++i) {
+        if ((static_cast<uint8_t>(data[i / 8]) >> (7 - i % 8)) & 1) {
+            ++counts[i % 5];
+        }
+    }
+    std::bitset<5> bip;
+    for (int g = 0; g < 5; ++g) {
+        bip[g] = counts[g] % 2 == 0;
+    }
+    return bip;
+}
+
+} // namespace
 
 // 测试BIP计算
 TEST(BIPCoderTest, CalculateBIP) {
@@ -18,11 +43,11 @@ TEST(BIPCoderTest, CalculateBIP) {
     std::bitset<5> bip1 = coder.calculateBIP(testData1);
     // 预期结果：奇校验，A的位分组后，每组中1的个数为：
     // 组0: 0,5 => 0个1 => 校验位为1
-    // 组1: 1,6 => 0个1 => 校验位为1
+    // 组1: 1,6 => 1个1 => 校验位为0
     // 组2: 2,7 => 1个1 => 校验位为0
     // 组3: 3   => 0个1 => 校验位为1
     // 组4: 4   => 0个1 => 校验位为1
-    EXPECT_EQ(bip1, std::bitset<5>("11011"));
+    EXPECT_EQ(bip1, std::bitset<5>("11001"));
     
     // 测试复杂字符串
     std::string testData2 = "Hello";
@@ -90,8 +115,9 @@ TEST(BIPCoderTest, ErrorCorrection) {
     std::string dataWithBIP = coder.addBIP(testData);
     
     // 引入单比特错误
+    // 交织校验只能确定错误所在的组，第2位与第7位(最低位)的伴随式相同，这里翻转组内第一个比特
     std::string corruptedData = dataWithBIP;
-    corruptedData[0] = corruptedData[0] ^ 0x01; // 翻转第一个字节的最低位
+    corruptedData[0] = corruptedData[0] ^ 0x20; // 翻转第一个字节的第2位
     
     // 尝试修正错误
     std::string correctedData = correctSingleBitError(corruptedData);
@@ -99,4 +125,49 @@ TEST(BIPCoderTest, ErrorCorrection) {
     // 验证修正后的数据
     EXPECT_TRUE(validateBIP(correctedData));
     EXPECT_EQ(coder.extractData(correctedData), testData);
-}
\ No newline at end of file
+}
+// 测试按字并行计算与逐比特参考实现一致
+TEST(BIPCoderTest, MatchesReference) {
+    std::mt19937 rng(5);
+    for (size_t length = 0; length < 200; ++length) {
+        std::string data(length, '\0');
+        for (auto& c : data) {
+            c = static_cast<char>(rng());
+        }
+        const std::bitset<5> expected = referenceBIP(data);
+        ASSERT_EQ(BIP(data), expected) << "length=" << length;
+
+        // 打包比特版本，包括非字节对齐的长度和偏移
+        const BitBuffer bits = BitBuffer::fromBytes(reinterpret_cast<const uint8_t*>(data.data()), length);
+        ASSERT_EQ(BIP(bits), expected) << "length=" << length;
+        if (length > 0) {
+            const std::string tail = bits.span().subspan(3, bits.size() - 3).toString();
+            const std::string prefix = bits.span().subspan(0, bits.size() - 3).toString();
+            ASSERT_EQ(BIP(bits.span().subspan(3, bits.size() - 3)),
+                      BIP(BitBuffer::fromString(tail)));
+            ASSERT_EQ(BIP(bits.span().subspan(0, bits.size() - 3)),
+                      BIP(BitBuffer::fromString(prefix)));
+        }
+    }
+}
+
+// 测试伴随式查找表
+TEST(BIPCoderTest, SyndromeTable) {
+    EXPECT_EQ(locateSingleBitError(std::bitset<5>("00000")), -1);
+    for (int g = 0; g < 5; ++g) {
+        std::bitset<5> syndrome;
+        syndrome[g] = 1;
+        EXPECT_EQ(locateSingleBitError(syndrome), g);
+    }
+    // 多个校验位同时出错不可能由单比特错误引起
+    EXPECT_EQ(locateSingleBitError(std::bitset<5>("00011")), -1);
+    EXPECT_EQ(locateSingleBitError(std::bitset<5>("11111")), -1);
+
+    // 组内第一个比特出错时可以修正
+    const std::string dataWithBIP = BIPCoder().addBIP("Syndrome");
+    for (int position = 0; position < 5; ++position) {
+        std::string corrupted = dataWithBIP;
+        corrupted[0] = static_cast<char>(corrupted[0] ^ (0x80 >> position));
+        EXPECT_EQ(correctSingleBitError(corrupted), dataWithBIP);
+    }
+}
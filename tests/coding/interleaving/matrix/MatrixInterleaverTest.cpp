@@ -0,0 +1,127 @@
+#include "gtest/gtest.h"
+#include "coding/interleaving/matrix/MatrixInterleaver.h"
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace link16::coding::interleaving;
+
+namespace {
+
+// 逐元素的参考交织: 按行写入、按列读出，不足部分补0
+std::vector<uint8_t> referenceInterleave(const std::vector<uint8_t>& data, int rows, int cols) {
+    const size_t matrixSize = rows * cols;
+    const size_t numMatrices = (data.size() + matrixSize - 1) / matrixSize;
+    std::vector<uint8_t> result;
+    for (size_t m = 0; m < numMatrices; ++m) {
+        for (int j = 0; j < cols; ++j) {
+            for (int i = 0; i < rows; ++i) {
+                const size_t index = m * matrixSize + i * cols + j;
+                result.push_back(index < data.size() ? data[index] : 0);
+            }
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+// 打包比特交织与'0'/'1'字符串交织结果一致，长度不是矩阵大小整数倍
+TEST(MatrixInterleaverTest, PackedBitsMatchStringInterleaving) {
+    MatrixInterleaver interleaver(9, 12);
+
+    std::string bits;
+    for (int i = 0; i < 250; ++i) {
+        bits.push_back(((i * 7) % 3 == 0) ? '1' : '0');
+    }
+
+    link16::BitBuffer packed = link16::BitBuffer::fromString(bits);
+    link16::BitBuffer interleaved = interleaver.interleave(packed);
+    EXPECT_EQ(interleaved.toString(), interleaver.interleave(bits));
+
+    link16::BitBuffer deinterleaved = interleaver.deinterleave(interleaved);
+    EXPECT_EQ(deinterleaved.size(), 9u * 12u * 3u);
+    EXPECT_EQ(deinterleaved.toString().substr(0, bits.length()), bits);
+}
+
+// 输出到调用方缓冲区与参考交织一致，包括使用分块转置的大矩阵
+TEST(MatrixInterleaverTest, BufferMatchesReference) {
+    const int shapes[][2] = {{4, 4}, {9, 12}, {12, 9}, {1, 7}, {300, 400}, {257, 255}};
+    for (const auto& shape : shapes) {
+        const int rows = shape[0];
+        const int cols = shape[1];
+        const size_t matrixSize = rows * cols;
+
+        // 两个完整矩阵加一个不完整矩阵
+        std::vector<uint8_t> data(matrixSize * 2 + matrixSize / 3 + 1);
+        for (size_t i = 0; i < data.size(); ++i) {
+            data[i] = static_cast<uint8_t>(i * 31 + 7);
+        }
+
+        const std::vector<uint8_t> expected = referenceInterleave(data, rows, cols);
+        MatrixInterleaver interleaver(rows, cols);
+
+        std::vector<uint8_t> interleaved(interleaver.calculateInterleavedLength(data.size()));
+        ASSERT_EQ(interleaved.size(), expected.size()) << rows << "x" << cols;
+        EXPECT_EQ(interleaver.interleave(data.data(), data.size(), interleaved.data()), expected.size());
+        EXPECT_EQ(interleaved, expected) << rows << "x" << cols;
+        EXPECT_EQ(interleave(data, rows, cols), expected) << rows << "x" << cols;
+
+        std::vector<uint8_t> deinterleaved(interleaved.size());
+        EXPECT_EQ(interleaver.deinterleave(interleaved.data(), interleaved.size(), deinterleaved.data()),
+                  interleaved.size());
+        EXPECT_TRUE(std::equal(data.begin(), data.end(), deinterleaved.begin())) << rows << "x" << cols;
+    }
+}
+
+// 批量交织每帧与单帧参考交织一致，批量解交织恢复原帧
+TEST(MatrixInterleaverTest, BatchMatchesPerFrame) {
+    MatrixInterleaver interleaver(9, 12);
+    const size_t frameCount = 16;
+    const size_t frameLength = 200;
+    const size_t stride = interleaver.calculateInterleavedLength(frameLength);
+
+    std::vector<uint8_t> frames(frameCount * frameLength);
+    for (size_t i = 0; i < frames.size(); ++i) {
+        frames[i] = static_cast<uint8_t>(i * 13);
+    }
+
+    std::vector<uint8_t> interleaved(frameCount * stride);
+    ASSERT_EQ(interleaver.interleaveBatch(frames.data(), frameCount, frameLength, interleaved.data()), frameCount);
+    for (size_t f = 0; f < frameCount; ++f) {
+        std::vector<uint8_t> frame(frames.begin() + f * frameLength, frames.begin() + (f + 1) * frameLength);
+        std::vector<uint8_t> expected = referenceInterleave(frame, 9, 12);
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), interleaved.begin() + f * stride)) << "帧 " << f;
+    }
+
+    std::vector<uint8_t> deinterleaved(frameCount * stride);
+    ASSERT_EQ(deinterleaveBatch(interleaved.data(), frameCount, stride, deinterleaved.data(), 9, 12), frameCount);
+    for (size_t f = 0; f < frameCount; ++f) {
+        EXPECT_TRUE(std::equal(frames.begin() + f * frameLength, frames.begin() + (f + 1) * frameLength,
+                               deinterleaved.begin() + f * stride)) << "帧 " << f;
+    }
+}
+
+// STDP消息的9x12符号交织与原decode_weave一致
+TEST(MatrixInterleaverTest, SymbolInterleavingMatchesDecodeWeave) {
+    // 545比特: 108个5比特符号加5个不参与交织的比特
+    std::string message;
+    for (int i = 0; i < 545; ++i) {
+        message.push_back(((i * 11) % 7 < 3) ? '1' : '0');
+    }
+
+    // decode_weave: 符号按行填入9x12矩阵，按列读出，末尾5比特原样追加
+    std::string expected;
+    for (int j = 0; j < 12; ++j) {
+        for (int i = 0; i < 9; ++i) {
+            expected += message.substr((i * 12 + j) * 5, 5);
+        }
+    }
+    expected += message.substr(540, 5);
+
+    link16::BitBuffer packed = link16::BitBuffer::fromString(message);
+    link16::BitBuffer woven = interleaveSymbols(packed);
+    EXPECT_EQ(woven.toString(), expected);
+    EXPECT_TRUE(deinterleaveSymbols(woven) == packed);
+}
@@ -0,0 +1,117 @@
+#include "gtest/gtest.h"
+#include "core/types/BitBuffer.h"
+#include <bitset>
+#include <random>
+#include <string>
+
+using namespace link16;
+
+namespace {
+
+// 生成随机'0'/'1'字符串
+std::string randomBitString(std::mt19937& rng, size_t length) {
+    std::string bits(length, '0');
+    for (auto& c : bits) {
+        c = (rng() & 1) ? '1' : '0';
+    }
+    return bits;
+}
+
+} // namespace
+
+// 测试与'0'/'1'字符串互相转换
+TEST(BitBufferTest, StringConversion) {
+    std::mt19937 rng(1);
+    for (size_t length : {0u, 1u, 7u, 8u, 63u, 64u, 65u, 75u, 155u, 1000u}) {
+        const std::string bits = randomBitString(rng, length);
+        bool ok = false;
+        BitBuffer buffer = BitBuffer::fromString(bits, &ok);
+        EXPECT_TRUE(ok);
+        ASSERT_EQ(buffer.size(), length);
+        EXPECT_EQ(buffer.toString(), bits);
+        for (size_t i = 0; i < length; ++i) {
+            ASSERT_EQ(buffer[i], bits[i] == '1');
+        }
+    }
+
+    bool ok = true;
+    BitBuffer invalid = BitBuffer::fromString("0101x11", &ok);
+    EXPECT_FALSE(ok);
+    EXPECT_EQ(invalid.toString(), "0101");
+}
+
+// 测试字节展开顺序与std::bitset<8>::to_string一致
+TEST(BitBufferTest, ByteConversion) {
+    const std::string text = "Link16 packed bits!";
+    BitBuffer buffer = BitBuffer::fromBytes(reinterpret_cast<const uint8_t*>(text.data()), text.size());
+
+    std::string expected;
+    for (char c : text) {
+        expected += std::bitset<8>(static_cast<unsigned char>(c)).to_string();
+    }
+    EXPECT_EQ(buffer.toString(), expected);
+
+    std::string bytes(text.size(), '\0');
+    buffer.toBytes(reinterpret_cast<uint8_t*>(&bytes[0]));
+    EXPECT_EQ(bytes, text);
+}
+
+// 测试按字段追加、读取和写入
+TEST(BitBufferTest, AppendAndFields) {
+    BitBuffer buffer;
+    buffer.append(0x3, 2);
+    buffer.append(0x15, 5);
+    buffer.append(0x123456789ABCDEFULL, 60);
+    buffer.pushBack(true);
+    ASSERT_EQ(buffer.size(), 68u);
+
+    EXPECT_EQ(buffer.getBits(0, 2), 0x3u);
+    EXPECT_EQ(buffer.getBits(2, 5), 0x15u);
+    EXPECT_EQ(buffer.getBits(7, 60), 0x123456789ABCDEFULL);
+    EXPECT_TRUE(buffer[67]);
+
+    buffer.setBits(60, 8, 0xA5);
+    EXPECT_EQ(buffer.getBits(60, 8), 0xA5u);
+    EXPECT_EQ(buffer.getBits(2, 5), 0x15u);
+
+    // 子视图跨字读取
+    BitSpan sub = buffer.span().subspan(7, 60);
+    BitBuffer copy;
+    copy.append(sub);
+    EXPECT_EQ(copy.toString(), buffer.toString().substr(7, 60));
+}
+
+// 测试resize与末尾比特清零
+TEST(BitBufferTest, Resize) {
+    BitBuffer ones(70, true);
+    EXPECT_EQ(ones.count(), 70u);
+
+    ones.resize(10);
+    EXPECT_EQ(ones.count(), 10u);
+    ones.resize(100);
+    EXPECT_EQ(ones.count(), 10u);
+    EXPECT_EQ(ones.toString(), std::string(10, '1') + std::string(90, '0'));
+}
+
+// 测试汉明距离
+TEST(BitBufferTest, HammingDistance) {
+    std::mt19937 rng(2);
+    const std::string a = randomBitString(rng, 1000);
+    std::string b = a;
+    size_t flips = 0;
+    for (size_t i = 0; i < b.size(); i += 7) {
+        b[i] = (b[i] == '0') ? '1' : '0';
+        ++flips;
+    }
+
+    BitBuffer x = BitBuffer::fromString(a);
+    BitBuffer y = BitBuffer::fromString(b);
+    EXPECT_EQ(hammingDistance(x, y), flips);
+
+    // 非对齐视图
+    size_t expected = 0;
+    for (size_t i = 0; i < 900; ++i) {
+        expected += (a[i + 3] != b[i + 5]);
+    }
+    EXPECT_EQ(hammingDistance(x.span().subspan(3, 900), y.span().subspan(5, 900)), expected);
+}
@@ -0,0 +1,106 @@
+#include "gtest/gtest.h"
+#include "core/utils/logger.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace link16::utils;
+
+namespace {
+
+std::string readFile(const std::string& path) {
+    std::ifstream file(path);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+// 每个用例写入独立的临时日志文件，结束时恢复控制台输出和默认级别
+class LoggerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path = ::testing::TempDir() + "link16_logger_" +
+               ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".log";
+        std::remove(path.c_str());
+        ASSERT_TRUE(Logger::getInstance().initialize(path, LogLevel::DEBUG));
+    }
+
+    void TearDown() override {
+        Logger::getInstance().shutdown();
+        Logger::getInstance().setLogLevel(LogLevel::INFO);
+        std::remove(path.c_str());
+    }
+
+    std::string path;
+};
+
+} // namespace
+
+// 多线程写入的日志全部落盘，且每个线程内保持顺序
+TEST_F(LoggerTest, MultiThreadedRecordsAreWritten) {
+    const int threadCount = 4;
+    const int perThread = 3000;  // 超过环形缓冲区容量，覆盖缓冲区满时的等待
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([t]() {
+            for (int i = 0; i < perThread; ++i) {
+                LOG_INFO("thread " + std::to_string(t) + " message " + std::to_string(i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    Logger::getInstance().flush();
+
+    const std::string content = readFile(path);
+    EXPECT_NE(content.find("[INFO] 日志系统初始化成功"), std::string::npos);
+    for (int t = 0; t < threadCount; ++t) {
+        size_t previous = 0;
+        for (int i = 0; i < perThread; i += 97) {
+            const std::string line = "[INFO] thread " + std::to_string(t) + " message " + std::to_string(i) + "\n";
+            const size_t pos = content.find(line);
+            ASSERT_NE(pos, std::string::npos) << line;
+            EXPECT_GE(pos, previous);
+            previous = pos;
+        }
+    }
+}
+
+// 低于当前级别时不构造消息
+TEST_F(LoggerTest, LevelCheckedBeforeMessageIsBuilt) {
+    int evaluated = 0;
+    auto message = [&]() {
+        ++evaluated;
+        return std::string("expensive");
+    };
+
+    Logger::getInstance().setLogLevel(LogLevel::WARNING);
+    LOG_DEBUG(message());
+    LOG_INFO(message());
+    EXPECT_EQ(evaluated, 0);
+
+    LOG_WARNING(message());
+    EXPECT_EQ(evaluated, 1);
+    Logger::getInstance().flush();
+
+    const std::string content = readFile(path);
+    EXPECT_NE(content.find("[WARNING] expensive\n"), std::string::npos);
+    EXPECT_EQ(content.find("[INFO] expensive"), std::string::npos);
+}
+
+// 关闭后剩余日志已写出
+TEST_F(LoggerTest, ShutdownWritesPendingRecords) {
+    for (int i = 0; i < 100; ++i) {
+        LOG_DEBUG("pending " + std::to_string(i));
+    }
+    Logger::getInstance().shutdown();
+
+    const std::string content = readFile(path);
+    EXPECT_NE(content.find("[DEBUG] pending 99\n"), std::string::npos);
+    EXPECT_NE(content.find("[INFO] 日志系统关闭\n"), std::string::npos);
+}
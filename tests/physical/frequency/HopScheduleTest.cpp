@@ -0,0 +1,143 @@
+#include "gtest/gtest.h"
+#include "physical/frequency/hopping/HopSchedule.h"
+#include "physical/frequency/hopping/FrequencyHopping.h"
+#include <cmath>
+#include <memory>
+#include <set>
+#include <vector>
+
+using namespace link16::physical::frequency;
+
+// Philox4x32-10已知答案
+TEST(HopScheduleTest, PhiloxKnownAnswers) {
+    const uint32_t counters[3][4] = {{0, 0, 0, 0},
+                                     {0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu},
+                                     {0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u}};
+    const uint32_t keys[3][2] = {{0, 0}, {0xffffffffu, 0xffffffffu}, {0xa4093822u, 0x299f31d0u}};
+    const uint32_t expected[3][4] = {{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u},
+                                     {0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu},
+                                     {0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}};
+    for (int t = 0; t < 3; ++t) {
+        uint32_t output[4];
+        HopSchedule::philox(counters[t], keys[t], output);
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_EQ(expected[t][i], output[i]) << "vector " << t << " word " << i;
+        }
+    }
+}
+
+// 51个频道: 969-1008MHz、1053-1065MHz、1113-1206MHz，间隔3MHz
+TEST(HopScheduleTest, ChannelFrequencies) {
+    EXPECT_DOUBLE_EQ(969.0e6, HopSchedule::getChannelFrequency(0));
+    EXPECT_DOUBLE_EQ(1008.0e6, HopSchedule::getChannelFrequency(13));
+    EXPECT_DOUBLE_EQ(1053.0e6, HopSchedule::getChannelFrequency(14));
+    EXPECT_DOUBLE_EQ(1065.0e6, HopSchedule::getChannelFrequency(18));
+    EXPECT_DOUBLE_EQ(1113.0e6, HopSchedule::getChannelFrequency(19));
+    EXPECT_DOUBLE_EQ(1206.0e6, HopSchedule::getChannelFrequency(HopSchedule::channel_count - 1));
+    for (int c = 0; c < HopSchedule::channel_count; ++c) {
+        const double mhz = HopSchedule::getChannelFrequency(c) / 1e6;
+        EXPECT_FALSE(std::abs(mhz - 1030.0) < 20.0 || std::abs(mhz - 1090.0) < 20.0) << mhz;
+    }
+}
+
+// 随机访问、整时隙生成和预计算的频道表一致
+TEST(HopScheduleTest, RandomAccessMatchesSlotAndTable) {
+    HopSchedule direct(12345, 7);
+    HopSchedule precomputed(12345, 7);
+    precomputed.precompute(HopSchedule::slots_per_epoch - 10, 30);
+    EXPECT_TRUE(precomputed.isPrecomputed(HopSchedule::slots_per_epoch - 1));
+    EXPECT_TRUE(precomputed.isPrecomputed(19));
+    EXPECT_FALSE(precomputed.isPrecomputed(20));
+    EXPECT_FALSE(direct.isPrecomputed(0));
+
+    std::vector<uint8_t> slotChannels(HopSchedule::pulses_per_slot);
+    for (uint32_t slot : {0u, 5u, 19u, 20u, 1000u, HopSchedule::slots_per_epoch - 10, HopSchedule::slots_per_epoch - 1}) {
+        direct.generateSlot(slot, slotChannels.data());
+        std::vector<uint8_t> fromTable(HopSchedule::pulses_per_slot);
+        precomputed.generateSlot(slot, fromTable.data());
+        EXPECT_EQ(slotChannels, fromTable) << "slot " << slot;
+        for (uint32_t pulse = 0; pulse < HopSchedule::pulses_per_slot; ++pulse) {
+            ASSERT_EQ(slotChannels[pulse], direct.getChannel(slot, pulse));
+            ASSERT_EQ(slotChannels[pulse], precomputed.getChannel(slot, pulse));
+            ASSERT_LT(slotChannels[pulse], HopSchedule::channel_count);
+        }
+    }
+
+    // 时隙按时元回绕，脉冲序号进位到后面的时隙
+    EXPECT_EQ(direct.getChannel(3, 17), direct.getChannel(3 + HopSchedule::slots_per_epoch, 17));
+    EXPECT_EQ(direct.getChannel(4, 1), direct.getChannel(3, HopSchedule::pulses_per_slot + 1));
+}
+
+// 频道分布均匀，不同种子、网号的图样不同
+TEST(HopScheduleTest, ChannelDistribution) {
+    HopSchedule schedule(1);
+    std::vector<int> counts(HopSchedule::channel_count, 0);
+    const uint32_t slots = 2000;
+    std::vector<uint8_t> channels(HopSchedule::pulses_per_slot);
+    for (uint32_t slot = 0; slot < slots; ++slot) {
+        schedule.generateSlot(slot, channels.data());
+        for (uint8_t c : channels) {
+            ++counts[c];
+        }
+    }
+    const double expected = double(slots) * HopSchedule::pulses_per_slot / HopSchedule::channel_count;
+    double chiSquare = 0.0;
+    for (int count : counts) {
+        chiSquare += (count - expected) * (count - expected) / expected;
+    }
+    // 自由度50，99.9%分位约为86.7
+    EXPECT_LT(chiSquare, 86.7);
+
+    HopSchedule otherSeed(2);
+    HopSchedule otherNet(1, 1);
+    int sameSeed = 0;
+    int sameNet = 0;
+    for (uint32_t pulse = 0; pulse < HopSchedule::pulses_per_slot; ++pulse) {
+        sameSeed += schedule.getChannel(100, pulse) == otherSeed.getChannel(100, pulse);
+        sameNet += schedule.getChannel(100, pulse) == otherNet.getChannel(100, pulse);
+    }
+    EXPECT_LT(sameSeed, 20);
+    EXPECT_LT(sameNet, 20);
+}
+
+// 模式6使用时隙跳频图样，收发两端共享同一图样
+TEST(HopScheduleTest, FrequencyHoppingTimeSlotPattern) {
+    FrequencyHopping transmitter;
+    ASSERT_TRUE(transmitter.initialize(FrequencyHopping::time_slot_pattern, 99));
+    auto schedule = transmitter.getSchedule();
+    ASSERT_TRUE(schedule != nullptr);
+    EXPECT_EQ(size_t(HopSchedule::slots_per_epoch) * HopSchedule::pulses_per_slot, transmitter.getSequenceLength());
+    EXPECT_EQ(HopSchedule::pulses_per_slot, transmitter.getSequence().size());
+
+    // 全局脉冲序号与(时隙, 脉冲)对应
+    const size_t index = 5000 * size_t(HopSchedule::pulses_per_slot) + 123;
+    EXPECT_DOUBLE_EQ(schedule->getFrequency(5000, 123), transmitter.getFrequencyAt(index));
+    EXPECT_DOUBLE_EQ(schedule->getFrequency(5000, 123), transmitter.getFrequency(5000, 123));
+    EXPECT_DOUBLE_EQ(transmitter.getFrequencyAt(7), transmitter.getFrequencyAt(7 + transmitter.getSequenceLength()));
+
+    for (size_t i = 0; i < 10; ++i) {
+        EXPECT_DOUBLE_EQ(transmitter.getSequence()[i], transmitter.getNextFrequency());
+    }
+
+    FrequencyHopping receiver;
+    receiver.initialize(1, 0);
+    EXPECT_TRUE(receiver.getSchedule() == nullptr);
+    ASSERT_TRUE(receiver.setSchedule(schedule));
+    EXPECT_EQ(FrequencyHopping::time_slot_pattern, receiver.getPattern());
+    EXPECT_EQ(99u, receiver.getSeed());
+    EXPECT_EQ(schedule.get(), receiver.getSchedule().get());
+
+    ASSERT_TRUE(receiver.precomputeSchedule(4990, 20));
+    EXPECT_TRUE(receiver.getSchedule()->isPrecomputed(5000));
+    EXPECT_FALSE(schedule->isPrecomputed(5000));
+    for (uint32_t pulse = 0; pulse < HopSchedule::pulses_per_slot; ++pulse) {
+        ASSERT_DOUBLE_EQ(transmitter.getFrequency(5000, pulse), receiver.getFrequency(5000, pulse));
+    }
+
+    // 其他模式没有时隙图样
+    EXPECT_FALSE(receiver.setSchedule(nullptr));
+    receiver.setPattern(3);
+    EXPECT_FALSE(receiver.precomputeSchedule());
+    EXPECT_DOUBLE_EQ(receiver.getSequence()[HopSchedule::pulses_per_slot % receiver.getSequenceLength()],
+                     receiver.getFrequency(1, 0));
+}
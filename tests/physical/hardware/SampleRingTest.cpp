@@ -0,0 +1,237 @@
+#include "gtest/gtest.h"
+#include "physical/hardware/usrp/SampleRing.h"
+#include "physical/hardware/usrp/USRPReceiver.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace link16::physical::hardware;
+
+// 块数向上取整为2的幂，块按缓存行对齐
+TEST(SampleRingTest, RoundsBlockCountAndAlignsBlocks) {
+    SampleRing ring(100, 5);
+    EXPECT_EQ(ring.getBlockSize(), 100u);
+    EXPECT_EQ(ring.getBlockCount(), 8u);
+
+    for (size_t i = 0; i < ring.getBlockCount(); ++i) {
+        std::complex<float>* block = ring.tryAcquireWrite();
+        ASSERT_NE(block, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(block) % 64, 0u) << "块 " << i;
+        ring.commitWrite(100, i * 100);
+    }
+    EXPECT_EQ(ring.size(), 8u);
+    EXPECT_EQ(ring.tryAcquireWrite(), nullptr);
+}
+
+// 消费者拿到的是生产者写入的同一块内存
+TEST(SampleRingTest, ReadsWithoutCopy) {
+    SampleRing ring(16, 4);
+    std::complex<float>* block = ring.tryAcquireWrite();
+    ASSERT_NE(block, nullptr);
+    for (size_t i = 0; i < 10; ++i) {
+        block[i] = std::complex<float>(static_cast<float>(i), -1.0f);
+    }
+    ring.commitWrite(10, 1234);
+
+    SampleBlock view;
+    ASSERT_TRUE(ring.tryAcquireRead(view));
+    EXPECT_EQ(view.data, block);
+    EXPECT_EQ(view.length, 10u);
+    EXPECT_EQ(view.sequence, 0u);
+    EXPECT_EQ(view.timestamp, 1234u);
+    EXPECT_EQ(view.data[9], std::complex<float>(9.0f, -1.0f));
+    ring.releaseRead();
+
+    EXPECT_FALSE(ring.tryAcquireRead(view));
+    EXPECT_EQ(ring.size(), 0u);
+}
+
+// 缓冲区满时写入失败，溢出计数由生产者记录，高水位为容量
+TEST(SampleRingTest, CountsOverruns) {
+    SampleRing ring(8, 4);
+    std::vector<std::complex<float>> samples(8, std::complex<float>(1.0f, 0.0f));
+    uint64_t timestamp = 0;
+    for (int i = 0; i < 6; ++i) {
+        if (!ring.write(samples.data(), samples.size(), timestamp)) {
+            ring.recordOverrun(samples.size());
+        }
+        timestamp += samples.size();
+    }
+
+    EXPECT_EQ(ring.getWrittenBlocks(), 4u);
+    EXPECT_EQ(ring.getOverrunCount(), 2u);
+    EXPECT_EQ(ring.getDroppedSamples(), 16u);
+    EXPECT_EQ(ring.getHighWaterMark(), 4u);
+
+    // 读出后可以继续写，时间戳反映丢弃的样本
+    SampleBlock view;
+    ASSERT_TRUE(ring.tryAcquireRead(view));
+    ring.releaseRead();
+    ASSERT_TRUE(ring.write(samples.data(), samples.size(), timestamp));
+    for (uint64_t expected = 1; expected <= 4; ++expected) {
+        ASSERT_TRUE(ring.tryAcquireRead(view));
+        EXPECT_EQ(view.sequence, expected);
+        ring.releaseRead();
+    }
+    EXPECT_EQ(view.timestamp, 48u);
+
+    ring.reset();
+    EXPECT_EQ(ring.size(), 0u);
+    EXPECT_EQ(ring.getOverrunCount(), 0u);
+    EXPECT_EQ(ring.getWrittenBlocks(), 0u);
+}
+
+// 两个线程并发读写，顺序和内容不变
+TEST(SampleRingTest, ProducerConsumerPreservesOrder) {
+    SampleRing ring(64, 8);
+    const uint64_t blockTotal = 20000;
+
+    std::thread producer([&]() {
+        for (uint64_t i = 0; i < blockTotal; ++i) {
+            std::complex<float>* block = nullptr;
+            while ((block = ring.tryAcquireWrite()) == nullptr) {
+                std::this_thread::yield();
+            }
+            for (size_t k = 0; k < 64; ++k) {
+                block[k] = std::complex<float>(static_cast<float>(i % 4096), static_cast<float>(k));
+            }
+            ring.commitWrite(64, i * 64);
+        }
+        ring.close();
+    });
+
+    uint64_t received = 0;
+    bool inOrder = true;
+    SampleBlock view;
+    while (ring.waitRead(view, std::chrono::seconds(10))) {
+        inOrder = inOrder && view.sequence == received && view.timestamp == received * 64 && view.length == 64 &&
+                  view.data[0].real() == static_cast<float>(received % 4096) && view.data[63].imag() == 63.0f;
+        ring.releaseRead();
+        ++received;
+    }
+    producer.join();
+
+    EXPECT_TRUE(inOrder);
+    EXPECT_EQ(received, blockTotal);
+    EXPECT_EQ(ring.getOverrunCount(), 0u);
+}
+
+// 关闭唤醒等待的消费者，等待超时返回false
+TEST(SampleRingTest, CloseWakesWaitingConsumer) {
+    SampleRing ring(8, 2);
+    SampleBlock view;
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(ring.waitRead(view, std::chrono::milliseconds(20)));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+    EXPECT_FALSE(ring.isClosed());
+
+    std::thread closer([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        ring.close();
+    });
+    EXPECT_FALSE(ring.waitRead(view, std::chrono::seconds(30)));
+    EXPECT_TRUE(ring.isClosed());
+    closer.join();
+}
+
+// 接收器的DSP线程按顺序收到接收线程写入的块
+TEST(USRPReceiverTest, StreamsBlocksToDspThread) {
+    USRPReceiver receiver;
+    ASSERT_TRUE(receiver.initialize());
+    ASSERT_TRUE(receiver.setSampleRate(20.0e6));
+    ASSERT_TRUE(receiver.setStreamBuffer(256, 16));
+
+    std::atomic<uint64_t> blocks(0);
+    std::atomic<bool> inOrder(true);
+    ASSERT_TRUE(receiver.startContinuousReceive([&](const SampleBlock& block) {
+        const uint64_t index = blocks.load();
+        if (block.sequence != index || block.length != 256) {
+            inOrder.store(false);
+        }
+        blocks.store(index + 1);
+    }));
+    EXPECT_FALSE(receiver.setStreamBuffer(512, 16));
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (blocks.load() < 50 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    receiver.stopContinuousReceive();
+
+    EXPECT_GE(blocks.load(), 50u);
+    EXPECT_TRUE(inOrder.load());
+    EXPECT_EQ(blocks.load(), receiver.getSampleRing().getWrittenBlocks());
+    receiver.close();
+}
+
+// 兼容原来的vector回调，关闭时停止连续接收
+TEST(USRPReceiverTest, VectorCallbackAndCloseWhileStreaming) {
+    USRPReceiver receiver;
+    ASSERT_TRUE(receiver.initialize());
+    ASSERT_TRUE(receiver.setSampleRate(10.0e6));
+
+    std::atomic<size_t> samples(0);
+    ASSERT_TRUE(receiver.startContinuousReceive(
+        [&](const std::vector<std::complex<float>>& block) { samples.fetch_add(block.size()); }));
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (samples.load() < 4096 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    receiver.close();
+
+    EXPECT_GE(samples.load(), 4096u);
+    EXPECT_EQ(samples.load() % receiver.getSampleRing().getBlockSize(), 0u);
+    EXPECT_FALSE(receiver.isInitialized());
+}
+
+// 样本源结束后连续接收自行停止，之后可以重新启动
+TEST(USRPReceiverTest, RestartsAfterSampleSourceEnds) {
+    USRPReceiver receiver;
+    ASSERT_TRUE(receiver.initialize());
+    ASSERT_TRUE(receiver.setStreamBuffer(100, 4));
+    ASSERT_TRUE(receiver.setRealTime(false));
+
+    // 每次启动提供1000个样本
+    std::atomic<size_t> remaining(1000);
+    ASSERT_TRUE(receiver.setSampleSource([&](std::complex<float>* samples, size_t& numSamples, uint64_t) {
+        const size_t length = std::min(numSamples, remaining.load());
+        if (length == 0) {
+            return false;
+        }
+        std::fill(samples, samples + length, std::complex<float>(1.0f, 0.0f));
+        numSamples = length;
+        remaining -= length;
+        return true;
+    }));
+
+    std::atomic<size_t> samples(0);
+    auto callback = [&](const SampleBlock& block) { samples.fetch_add(block.length); };
+    const auto waitUntil = [](const std::function<bool()>& done) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while (!done() && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    };
+
+    ASSERT_TRUE(receiver.startContinuousReceive(callback));
+    waitUntil([&]() { return !receiver.isReceiving(); });
+    EXPECT_FALSE(receiver.isReceiving());
+    EXPECT_TRUE(receiver.getSampleRing().isClosed());
+
+    // 重新启动时回收已结束的线程，重新开始接收
+    remaining = 1000;
+    ASSERT_TRUE(receiver.startContinuousReceive(callback));
+    waitUntil([&]() { return samples.load() == 2000 && !receiver.isReceiving(); });
+    receiver.stopContinuousReceive();
+
+    EXPECT_EQ(samples.load(), 2000u);
+    EXPECT_FALSE(receiver.isReceiving());
+    receiver.close();
+}
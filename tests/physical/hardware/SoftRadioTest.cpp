@@ -0,0 +1,255 @@
+#include "gtest/gtest.h"
+#include "physical/hardware/softradio/SoftRadioFile.h"
+#include "physical/hardware/softradio/SoftRadioLoopback.h"
+#include "simulation/channel/awgn/AWGNChannel.h"
+#include "core/utils/fileUtils.h"
+#include <atomic>
+#include <chrono>
+#include <complex>
+#include <memory>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace link16::physical::hardware;
+
+namespace {
+
+// 删除SigMF文件
+void removeRecording(const std::string& basePath) {
+    std::remove((basePath + SoftRadioFile::data_extension).c_str());
+    std::remove((basePath + SoftRadioFile::meta_extension).c_str());
+}
+
+// 写一个录制文件，第i个样本为(i, -i)
+void writeRecording(const std::string& basePath, size_t length, double sampleRate) {
+    SoftRadioFile file;
+    ASSERT_TRUE(file.initialize("tx=" + basePath + ",tx_capacity=" + std::to_string(length)));
+    file.setSampleRate(sampleRate);
+    file.setFrequency(1.2e9);
+    std::vector<std::complex<float>> samples(length);
+    for (size_t i = 0; i < length; ++i) {
+        samples[i] = std::complex<float>(static_cast<float>(i), -static_cast<float>(i));
+    }
+    ASSERT_EQ(file.write(samples.data(), samples.size(), 0), length);
+    file.close();
+}
+
+// 等待条件成立
+template <typename Predicate>
+bool waitFor(Predicate predicate) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+} // namespace
+
+// 写入的文件可按SigMF元数据读回，未写入的位置为0，超出容量的样本丢弃
+TEST(SoftRadioFileTest, WritesAndReadsSigMF) {
+    const std::string path = "softradio_test_file";
+    {
+        SoftRadioFile file;
+        ASSERT_TRUE(file.initialize("tx=" + path + ",tx_capacity=100"));
+        file.setSampleRate(2.5e6);
+        const std::vector<std::complex<float>> ones(30, std::complex<float>(1.0f, 2.0f));
+        EXPECT_EQ(file.write(ones.data(), ones.size(), 10), 30u);
+        EXPECT_EQ(file.write(ones.data(), ones.size(), 90), 10u);
+        EXPECT_EQ(file.getTxLength(), 100u);
+        EXPECT_EQ(file.getTxDropped(), 20u);
+        EXPECT_EQ(file.write(ones.data(), 5, 50), 5u);
+        file.close();
+    }
+
+    const std::string meta = link16::utils::FileUtils::readTextFile(path + SoftRadioFile::meta_extension);
+    EXPECT_NE(meta.find("\"core:datatype\": \"cf32_le\""), std::string::npos);
+
+    SoftRadioFile file;
+    ASSERT_TRUE(file.initialize("rx=" + path));
+    EXPECT_DOUBLE_EQ(file.getSampleRate(), 2.5e6);
+    ASSERT_EQ(file.getRxLength(), 100u);
+    const std::complex<float>* data = file.getRxData();
+    EXPECT_EQ(data[9], std::complex<float>(0.0f, 0.0f));
+    EXPECT_EQ(data[10], std::complex<float>(1.0f, 2.0f));
+    EXPECT_EQ(data[40], std::complex<float>(0.0f, 0.0f));
+    EXPECT_EQ(data[54], std::complex<float>(1.0f, 2.0f));
+    EXPECT_EQ(data[99], std::complex<float>(1.0f, 2.0f));
+
+    std::vector<std::complex<float>> samples(64);
+    EXPECT_EQ(file.read(samples.data(), samples.size()), 64u);
+    EXPECT_EQ(file.read(samples.data(), samples.size()), 36u);
+    EXPECT_EQ(file.read(samples.data(), samples.size()), 0u);
+    ASSERT_TRUE(file.seek(10));
+    EXPECT_EQ(file.read(samples.data(), 1), 1u);
+    EXPECT_EQ(samples[0], std::complex<float>(1.0f, 2.0f));
+    file.close();
+    removeRecording(path);
+
+    // 不支持的样本格式
+    link16::utils::FileUtils::writeTextFile(path + SoftRadioFile::meta_extension,
+                                            "{\"global\": {\"core:datatype\": \"ci16_le\"}}");
+    link16::utils::FileUtils::writeBinaryFile(path + SoftRadioFile::data_extension, "abcd", 4);
+    SoftRadioFile other;
+    EXPECT_FALSE(other.initialize("rx=" + path));
+    removeRecording(path);
+}
+
+// 非实时回放: 接收器尽快读完整个文件，不丢样本，读完后环形缓冲区关闭
+TEST(SoftRadioFileTest, ReceiverReplaysRecordingUnthrottled) {
+    const std::string path = "softradio_test_replay";
+    const size_t length = 200000;
+    writeRecording(path, length, 1.0e3);
+
+    SoftRadioFile file;
+    ASSERT_TRUE(file.initialize("rx=" + path + ",realtime=0"));
+    EXPECT_FALSE(file.isRealTime());
+    USRPReceiver receiver;
+    ASSERT_TRUE(receiver.initialize());
+    ASSERT_TRUE(receiver.setStreamBuffer(1000, 4));
+    ASSERT_TRUE(file.attach(receiver));
+    EXPECT_DOUBLE_EQ(receiver.getSampleRate(), 1.0e3);
+
+    // 1ksps实时回放需要200秒，非实时应很快读完
+    std::atomic<size_t> received(0);
+    std::atomic<bool> inOrder(true);
+    ASSERT_TRUE(receiver.startContinuousReceive([&](const SampleBlock& block) {
+        const size_t first = received.load();
+        for (size_t i = 0; i < block.length; ++i) {
+            if (block.data[i].real() != static_cast<float>(first + i)) {
+                inOrder.store(false);
+            }
+        }
+        received.store(first + block.length);
+    }));
+    EXPECT_TRUE(waitFor([&]() { return received.load() == length; }));
+    EXPECT_TRUE(waitFor([&]() { return receiver.getSampleRing().isClosed(); }));
+    receiver.stopContinuousReceive();
+
+    EXPECT_TRUE(inOrder.load());
+    EXPECT_EQ(receiver.getOverrunCount(), 0u);
+    EXPECT_EQ(file.getRxPosition(), length);
+    receiver.close();
+    file.close();
+    removeRecording(path);
+}
+
+// 发送器发出的缓冲区按发送时刻写入文件
+TEST(SoftRadioFileTest, TransmitterWritesAtTimestamps) {
+    const std::string path = "softradio_test_tx";
+    SoftRadioFile file;
+    ASSERT_TRUE(file.initialize("tx=" + path + ",tx_capacity=10000,realtime=0"));
+
+    USRPTransmitter transmitter;
+    ASSERT_TRUE(transmitter.initialize());
+    ASSERT_TRUE(transmitter.setTransmitQueue(1000, 4));
+    ASSERT_TRUE(file.attach(transmitter));
+    ASSERT_TRUE(transmitter.startStreaming());
+
+    for (uint64_t timestamp : {100u, 5000u}) {
+        TxBuffer* buffer = transmitter.acquireBuffer();
+        ASSERT_NE(buffer, nullptr);
+        for (size_t i = 0; i < 1000; ++i) {
+            buffer->data[i] = std::complex<float>(static_cast<float>(timestamp + i), 0.0f);
+        }
+        ASSERT_TRUE(transmitter.submit(buffer, 1000, timestamp, true));
+    }
+    ASSERT_TRUE(transmitter.flush(std::chrono::seconds(30)));
+    transmitter.close();
+    EXPECT_EQ(transmitter.getLateCount(), 0u);
+    file.close();
+
+    SoftRadioFile reader;
+    ASSERT_TRUE(reader.initialize("rx=" + path));
+    ASSERT_EQ(reader.getRxLength(), 6000u);
+    const std::complex<float>* data = reader.getRxData();
+    EXPECT_EQ(data[99].real(), 0.0f);
+    EXPECT_EQ(data[100].real(), 100.0f);
+    EXPECT_EQ(data[1099].real(), 1099.0f);
+    EXPECT_EQ(data[1100].real(), 0.0f);
+    EXPECT_EQ(data[5999].real(), 5999.0f);
+    reader.close();
+    removeRecording(path);
+}
+
+// 非实时回环: 接收端按顺序收到发送端的全部样本
+TEST(SoftRadioLoopbackTest, DeliversSamplesInOrder) {
+    SoftRadioLoopback loopback(256, 8);
+    ASSERT_TRUE(loopback.setRealTime(false));
+    ASSERT_TRUE(loopback.initialize());
+    USRPTransmitter& transmitter = loopback.getTransmitter();
+    USRPReceiver& receiver = loopback.getReceiver();
+    ASSERT_TRUE(transmitter.setTransmitQueue(1000, 4));
+
+    std::mutex mutex;
+    std::vector<std::complex<float>> received;
+    ASSERT_TRUE(receiver.startContinuousReceive([&](const SampleBlock& block) {
+        std::lock_guard<std::mutex> lock(mutex);
+        received.insert(received.end(), block.data, block.data + block.length);
+    }));
+    ASSERT_TRUE(transmitter.startStreaming());
+
+    const size_t total = 50000;
+    std::vector<std::complex<float>> samples(total);
+    for (size_t i = 0; i < total; ++i) {
+        samples[i] = std::complex<float>(static_cast<float>(i), 1.0f);
+    }
+    ASSERT_TRUE(transmitter.transmit(samples));
+    EXPECT_TRUE(waitFor([&]() { return loopback.getDeliveredSamples() == total; }));
+    loopback.close();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(received.size(), total);
+    EXPECT_EQ(received, samples);
+    EXPECT_EQ(loopback.getDroppedSamples(), 0u);
+    EXPECT_FALSE(receiver.isInitialized());
+}
+
+// 实时回环经过信道: 突发出现在接收流中，其余为0
+TEST(SoftRadioLoopbackTest, RealTimeThroughChannel) {
+    SoftRadioLoopback loopback;
+    ASSERT_TRUE(loopback.initialize());
+    ASSERT_TRUE(loopback.setSampleRate(1.0e6));
+    // 仿真层的信道模型包装成回环设备的信道函数
+    auto channel = std::make_shared<link16::simulation::channel::AWGNChannel>(30.0);
+    channel->setSeed(3);
+    ASSERT_TRUE(loopback.setChannel(
+        [channel](const std::complex<float>* samples, size_t length, std::vector<std::complex<float>>& output) {
+            const std::vector<std::complex<double>> result =
+                channel->process(std::vector<std::complex<double>>(samples, samples + length));
+            output.assign(result.begin(), result.end());
+        },
+        channel->getName()));
+    EXPECT_EQ(loopback.getChannelName(), channel->getName());
+    EXPECT_NE(loopback.getDeviceInfo().find("AWGN"), std::string::npos);
+
+    USRPTransmitter& transmitter = loopback.getTransmitter();
+    USRPReceiver& receiver = loopback.getReceiver();
+    std::atomic<size_t> received(0);
+    std::atomic<size_t> burstSamples(0);
+    ASSERT_TRUE(receiver.startContinuousReceive([&](const SampleBlock& block) {
+        size_t count = 0;
+        for (size_t i = 0; i < block.length; ++i) {
+            count += std::abs(block.data[i]) > 0.5f ? 1 : 0;
+        }
+        burstSamples.fetch_add(count);
+        received.fetch_add(block.length);
+    }));
+    ASSERT_TRUE(transmitter.startStreaming());
+    EXPECT_FALSE(loopback.setChannel(nullptr));
+
+    ASSERT_TRUE(transmitter.transmit(std::vector<std::complex<float>>(4000, std::complex<float>(1.0f, 0.0f))));
+    EXPECT_TRUE(waitFor([&]() { return loopback.getDeliveredSamples() >= 4000; }));
+    EXPECT_TRUE(waitFor([&]() { return received.load() >= 20000; }));
+    loopback.close();
+
+    EXPECT_EQ(loopback.getDeliveredSamples(), 4000u);
+    EXPECT_EQ(burstSamples.load(), 4000u);
+    EXPECT_GT(received.load(), 4000u);
+}
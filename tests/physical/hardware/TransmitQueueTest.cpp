@@ -0,0 +1,234 @@
+#include "gtest/gtest.h"
+#include "physical/hardware/usrp/TransmitQueue.h"
+#include "physical/hardware/usrp/USRPTransmitter.h"
+#include <atomic>
+#include <chrono>
+#include <complex>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace link16::physical::hardware;
+
+namespace {
+
+// 发送回调记录的一个缓冲区
+struct SentRecord {
+    size_t length;
+    uint64_t timestamp;
+    float first;
+};
+
+// 启动流式发送并记录每个发出的缓冲区
+class RecordingTransmitter {
+public:
+    RecordingTransmitter(double sampleRate, size_t bufferSize, size_t bufferCount) {
+        transmitter.initialize();
+        transmitter.setSampleRate(sampleRate);
+        transmitter.setTransmitQueue(bufferSize, bufferCount);
+        transmitter.setSendCallback([this](const std::complex<float>* samples, size_t length, uint64_t timestamp) {
+            std::lock_guard<std::mutex> lock(mutex);
+            records.push_back(SentRecord{length, timestamp, samples[0].real()});
+        });
+    }
+
+    std::vector<SentRecord> getRecords() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return records;
+    }
+
+    USRPTransmitter transmitter;
+
+private:
+    std::mutex mutex;
+    std::vector<SentRecord> records;
+};
+
+} // namespace
+
+// 缓冲池固定大小，缓冲区按缓存行对齐，按提交顺序取出
+TEST(TransmitQueueTest, PoolAndFifoOrder) {
+    TransmitQueue queue(100, 3);
+    EXPECT_EQ(queue.getBufferSize(), 100u);
+    EXPECT_EQ(queue.getFreeCount(), 3u);
+
+    TxBuffer* buffers[3];
+    for (int i = 0; i < 3; ++i) {
+        buffers[i] = queue.tryAcquire();
+        ASSERT_NE(buffers[i], nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(buffers[i]->data) % 64, 0u);
+        EXPECT_EQ(buffers[i]->capacity, 100u);
+    }
+    EXPECT_EQ(queue.tryAcquire(), nullptr);
+    EXPECT_EQ(queue.acquire(std::chrono::milliseconds(5)), nullptr);
+
+    // 超过容量的提交失败并归还
+    buffers[0]->length = 101;
+    EXPECT_FALSE(queue.submit(buffers[0]));
+    EXPECT_EQ(queue.getFreeCount(), 1u);
+
+    buffers[2]->length = 2;
+    buffers[1]->length = 1;
+    ASSERT_TRUE(queue.submit(buffers[2]));
+    ASSERT_TRUE(queue.submit(buffers[1]));
+    EXPECT_EQ(queue.getPendingCount(), 2u);
+    EXPECT_FALSE(queue.waitIdle(std::chrono::milliseconds(1)));
+
+    EXPECT_EQ(queue.popPending(), buffers[2]);
+    EXPECT_EQ(queue.waitPending(std::chrono::milliseconds(1)), buffers[1]);
+    EXPECT_EQ(queue.popPending(), nullptr);
+    queue.recycle(buffers[2]);
+    queue.recycle(buffers[1]);
+    EXPECT_TRUE(queue.waitIdle(std::chrono::milliseconds(1)));
+    EXPECT_EQ(queue.getFreeCount(), 3u);
+}
+
+// 关闭后提交失败，等待者被唤醒
+TEST(TransmitQueueTest, CloseWakesWaiters) {
+    TransmitQueue queue(16, 2);
+    std::thread closer([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        queue.close();
+    });
+    EXPECT_EQ(queue.waitPending(std::chrono::seconds(30)), nullptr);
+    closer.join();
+
+    EXPECT_EQ(queue.acquire(std::chrono::seconds(30)), nullptr);
+    queue.open();
+    TxBuffer* buffer = queue.tryAcquire();
+    ASSERT_NE(buffer, nullptr);
+    buffer->length = 4;
+    ASSERT_TRUE(queue.submit(buffer));
+    queue.close();
+    EXPECT_EQ(queue.discardPending(), 1u);
+    EXPECT_EQ(queue.getFreeCount(), 2u);
+}
+
+// 突发中的缓冲区首尾相接发出，只在发送线程报告欠载的地方断开
+TEST(USRPTransmitterTest, StreamsBurstBackToBack) {
+    RecordingTransmitter recorder(1.0e6, 1000, 4);
+    USRPTransmitter& transmitter = recorder.transmitter;
+    ASSERT_TRUE(transmitter.startStreaming());
+    EXPECT_FALSE(transmitter.setTransmitQueue(2000, 4));
+
+    // 先提交全部缓冲区，发送线程还在发第一个时就已准备好后面的
+    const int bufferTotal = 12;
+    for (int i = 0; i < bufferTotal; ++i) {
+        TxBuffer* buffer = transmitter.acquireBuffer(std::chrono::seconds(30));
+        ASSERT_NE(buffer, nullptr);
+        for (size_t k = 0; k < 1000; ++k) {
+            buffer->data[k] = std::complex<float>(static_cast<float>(i), 0.0f);
+        }
+        ASSERT_TRUE(transmitter.submit(buffer, 1000, TransmitQueue::asap, i == bufferTotal - 1));
+    }
+    ASSERT_TRUE(transmitter.flush(std::chrono::seconds(30)));
+    transmitter.stopStreaming();
+
+    // 队列只有4个缓冲区，生产者能否及时补上取决于调度，不按墙钟断言没有欠载；
+    // 每处断开都必须有对应的欠载计数，没有欠载时全部首尾相接
+    const auto records = recorder.getRecords();
+    ASSERT_EQ(records.size(), static_cast<size_t>(bufferTotal));
+    EXPECT_EQ(records[0].first, 0.0f);
+    uint64_t gaps = 0;
+    for (int i = 1; i < bufferTotal; ++i) {
+        EXPECT_EQ(records[i].first, static_cast<float>(i));
+        EXPECT_GE(records[i].timestamp, records[i - 1].timestamp + 1000) << "缓冲区 " << i;
+        if (records[i].timestamp != records[i - 1].timestamp + 1000) {
+            ++gaps;
+        }
+    }
+    EXPECT_LE(gaps, transmitter.getUnderrunCount());
+    EXPECT_EQ(transmitter.getSentSamples(), 12000u);
+    EXPECT_EQ(transmitter.getLateCount(), 0u);
+}
+
+// 突发中断流计为欠载，突发结尾之后的空闲不计
+TEST(USRPTransmitterTest, CountsUnderruns) {
+    RecordingTransmitter recorder(1.0e6, 500, 2);
+    USRPTransmitter& transmitter = recorder.transmitter;
+    ASSERT_TRUE(transmitter.startStreaming());
+
+    TxBuffer* buffer = transmitter.acquireBuffer();
+    ASSERT_NE(buffer, nullptr);
+    ASSERT_TRUE(transmitter.submit(buffer, 500, TransmitQueue::asap, false));
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+
+    buffer = transmitter.acquireBuffer();
+    ASSERT_NE(buffer, nullptr);
+    ASSERT_TRUE(transmitter.submit(buffer, 500, TransmitQueue::asap, true));
+    ASSERT_TRUE(transmitter.flush(std::chrono::seconds(30)));
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    transmitter.stopStreaming();
+
+    EXPECT_EQ(transmitter.getUnderrunCount(), 1u);
+    EXPECT_EQ(transmitter.getSentBuffers(), 2u);
+}
+
+// 定时发送在指定设备时间发出，错过发送时刻的整个突发被丢弃
+TEST(USRPTransmitterTest, TimedAndLateSubmissions) {
+    RecordingTransmitter recorder(1.0e6, 1000, 4);
+    USRPTransmitter& transmitter = recorder.transmitter;
+    ASSERT_TRUE(transmitter.startStreaming());
+
+    // 时隙4从4 * 7.8125ms = 31250个样本开始
+    TxBuffer* buffer = transmitter.acquireBuffer();
+    ASSERT_NE(buffer, nullptr);
+    buffer->data[0] = std::complex<float>(4.0f, 0.0f);
+    ASSERT_TRUE(transmitter.submitAtSlot(buffer, 1000, 4));
+    ASSERT_TRUE(transmitter.flush(std::chrono::seconds(30)));
+    EXPECT_GE(transmitter.getDeviceTime(), 31250u);
+
+    // 已经过去的时刻，突发的两个缓冲区都丢弃
+    buffer = transmitter.acquireBuffer();
+    ASSERT_NE(buffer, nullptr);
+    ASSERT_TRUE(transmitter.submit(buffer, 1000, 10, false));
+    buffer = transmitter.acquireBuffer();
+    ASSERT_NE(buffer, nullptr);
+    ASSERT_TRUE(transmitter.submit(buffer, 1000, TransmitQueue::asap, true));
+
+    // 之后的突发正常发送
+    buffer = transmitter.acquireBuffer();
+    ASSERT_NE(buffer, nullptr);
+    buffer->data[0] = std::complex<float>(7.0f, 0.0f);
+    ASSERT_TRUE(transmitter.submit(buffer, 1000, transmitter.getDeviceTime() + 20000, true));
+    ASSERT_TRUE(transmitter.flush(std::chrono::seconds(30)));
+    transmitter.stopStreaming();
+
+    const auto records = recorder.getRecords();
+    ASSERT_EQ(records.size(), 2u);
+    EXPECT_EQ(records[0].timestamp, 31250u);
+    EXPECT_EQ(records[0].first, 4.0f);
+    EXPECT_EQ(records[1].first, 7.0f);
+    EXPECT_EQ(transmitter.getLateCount(), 2u);
+    EXPECT_EQ(transmitter.getUnderrunCount(), 0u);
+}
+
+// 流式发送时transmit()不等待空中时间，连续发送经过同一个队列
+TEST(USRPTransmitterTest, TransmitAndContinuousUseQueue) {
+    RecordingTransmitter recorder(1.0e5, 1000, 4);
+    USRPTransmitter& transmitter = recorder.transmitter;
+    ASSERT_TRUE(transmitter.startStreaming());
+
+    // 2500个样本在100ksps下需要25ms，拆成3个缓冲区
+    std::vector<std::complex<float>> samples(2500, std::complex<float>(1.0f, 0.0f));
+    const auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(transmitter.transmit(samples));
+    const auto blocked = std::chrono::steady_clock::now() - start;
+    ASSERT_TRUE(transmitter.flush(std::chrono::seconds(30)));
+    EXPECT_LT(blocked, std::chrono::milliseconds(25));
+
+    ASSERT_TRUE(transmitter.startContinuousTransmit(std::vector<std::complex<float>>(600), 5));
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (transmitter.getSentSamples() < 2500 + 5 * 600 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    transmitter.stopContinuousTransmit();
+    transmitter.close();
+
+    const auto records = recorder.getRecords();
+    ASSERT_EQ(records.size(), 3u + 5u);
+    EXPECT_EQ(records[2].length, 500u);
+    EXPECT_EQ(transmitter.getSentSamples(), 2500u + 5u * 600u);
+    EXPECT_FALSE(transmitter.isStreaming());
+}
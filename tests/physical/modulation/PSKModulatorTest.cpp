@@ -0,0 +1,197 @@
+#include "gtest/gtest.h"
+#include "physical/modulation/digital/PSK/BPSKModulator.h"
+#include "physical/modulation/digital/PSK/QPSKModulator.h"
+#include <cmath>
+#include <complex>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace link16;
+using namespace link16::physical::modulation;
+
+namespace {
+
+std::string randomBits(size_t length, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::string bits(length, '0');
+    for (auto& bit : bits) {
+        bit = (rng() & 1) ? '1' : '0';
+    }
+    return bits;
+}
+
+// 归一化的升余弦滤波器(beta=0.35)
+std::vector<double> raisedCosine(int filterLength, int samplesPerSymbol) {
+    const double beta = 0.35;
+    std::vector<double> filter(filterLength);
+    double sum = 0.0;
+    for (int i = 0; i < filterLength; ++i) {
+        const double t = i - filterLength / 2;
+        if (t == 0) {
+            filter[i] = 1.0;
+        } else if (std::abs(t) == samplesPerSymbol / (2.0 * beta)) {
+            filter[i] = (M_PI / 4.0) * std::sin(M_PI / (2.0 * beta));
+        } else {
+            const double x = M_PI * t / samplesPerSymbol;
+            const double d = 2.0 * beta * t / samplesPerSymbol;
+            filter[i] = (std::sin(x) / x) * (std::cos(M_PI * beta * t / samplesPerSymbol) / (1.0 - d * d));
+        }
+        sum += filter[i];
+    }
+    for (auto& c : filter) {
+        c /= sum;
+    }
+    return filter;
+}
+
+// 符号重复samplesPerSymbol次后与滤波器做完整卷积
+std::vector<std::complex<double>> referenceShape(const std::vector<std::complex<double>>& symbols,
+                                                 int samplesPerSymbol, int filterLength) {
+    const std::vector<double> filter = raisedCosine(filterLength, samplesPerSymbol);
+    std::vector<std::complex<double>> baseband;
+    for (const auto& symbol : symbols) {
+        baseband.insert(baseband.end(), samplesPerSymbol, symbol);
+    }
+    std::vector<std::complex<double>> output(baseband.size() + filter.size() - 1);
+    for (size_t n = 0; n < baseband.size(); ++n) {
+        for (size_t k = 0; k < filter.size(); ++k) {
+            output[n + k] += baseband[n] * filter[k];
+        }
+    }
+    return output;
+}
+
+void expectNear(const std::vector<std::complex<double>>& expected, const std::vector<std::complex<double>>& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_NEAR(expected[i].real(), actual[i].real(), 1e-12) << "i=" << i;
+        ASSERT_NEAR(expected[i].imag(), actual[i].imag(), 1e-12) << "i=" << i;
+    }
+}
+
+// 每符号样本数和滤波器长度，包括查表和逐符号叠加两种路径
+const int configurations[][2] = {{10, 32}, {20, 32}, {8, 8}, {4, 64}, {1, 16}, {1, 80}, {3, 1}};
+
+} // namespace
+
+TEST(PSKModulatorTest, BPSKMatchesConvolution) {
+    for (const auto& config : configurations) {
+        BPSKModulator modulator;
+        modulator.setSamplesPerSymbol(config[0]);
+        modulator.setFilterLength(config[1]);
+
+        for (size_t length : {1, 2, 5, 100, 333}) {
+            const std::string bits = randomBits(length, static_cast<uint32_t>(length + config[0]));
+            std::vector<std::complex<double>> symbols;
+            for (char bit : bits) {
+                symbols.emplace_back(bit == '0' ? -1.0 : 1.0, 0.0);
+            }
+            SCOPED_TRACE("sps=" + std::to_string(config[0]) + " taps=" + std::to_string(config[1]) +
+                         " bits=" + std::to_string(length));
+            expectNear(referenceShape(symbols, config[0], config[1]), modulator.modulate(bits));
+        }
+    }
+}
+
+TEST(PSKModulatorTest, QPSKMatchesConvolution) {
+    for (const auto& config : configurations) {
+        QPSKModulator modulator;
+        modulator.setSamplesPerSymbol(config[0]);
+        modulator.setFilterLength(config[1]);
+
+        // 奇数个比特时末位正交支路按0处理
+        for (size_t length : {1, 2, 7, 100, 333}) {
+            const std::string bits = randomBits(length, static_cast<uint32_t>(length * 3 + config[1]));
+            std::vector<std::complex<double>> symbols;
+            for (size_t i = 0; i < bits.size(); i += 2) {
+                const char q = i + 1 < bits.size() ? bits[i + 1] : '0';
+                symbols.emplace_back(bits[i] == '0' ? -1.0 : 1.0, q == '0' ? -1.0 : 1.0);
+            }
+            SCOPED_TRACE("sps=" + std::to_string(config[0]) + " taps=" + std::to_string(config[1]) +
+                         " bits=" + std::to_string(length));
+            expectNear(referenceShape(symbols, config[0], config[1]), modulator.modulate(bits));
+        }
+    }
+}
+
+TEST(PSKModulatorTest, BufferModulationMatchesVector) {
+    BPSKModulator bpsk;
+    QPSKModulator qpsk;
+    const BitBuffer bits = BitBuffer::fromString(randomBits(1000, 7));
+
+    std::vector<std::complex<double>> output(bpsk.getModulatedLength(bits.size()));
+    ASSERT_EQ(output.size(), bpsk.modulate(bits.span(), output.data(), output.size()));
+    expectNear(bpsk.modulate(bits.span()), output);
+    EXPECT_EQ(0u, bpsk.modulate(bits.span(), output.data(), output.size() - 1));
+
+    output.assign(qpsk.getModulatedLength(bits.size()), std::complex<double>());
+    ASSERT_EQ(output.size(), qpsk.modulate(bits.span(), output.data(), output.size()));
+    expectNear(qpsk.modulate(bits.span()), output);
+    EXPECT_EQ(0u, qpsk.modulate(bits.span(), output.data(), output.size() - 1));
+
+    EXPECT_EQ(0u, bpsk.getModulatedLength(0));
+    EXPECT_TRUE(bpsk.modulate(BitSpan()).empty());
+}
+
+TEST(PSKModulatorTest, RoundTrip) {
+    for (const auto& config : configurations) {
+        BPSKModulator bpsk;
+        bpsk.setSamplesPerSymbol(config[0]);
+        bpsk.setFilterLength(config[1]);
+        const std::string bits = randomBits(257, 11);
+        EXPECT_EQ(bits, bpsk.demodulate(bpsk.modulate(bits)));
+
+        BitBuffer packed;
+        ASSERT_TRUE(bpsk.demodulate(bpsk.modulate(bits), packed));
+        EXPECT_EQ(bits, packed.toString());
+
+        QPSKModulator qpsk;
+        qpsk.setSamplesPerSymbol(config[0]);
+        qpsk.setFilterLength(config[1]);
+        EXPECT_EQ(bits + "0", qpsk.demodulate(qpsk.modulate(bits)));
+    }
+}
+
+// 测试LLR的符号和幅度: 噪声引起的LLR方差应为无噪声LLR均值的2倍(高斯LLR的一致性条件)
+TEST(PSKModulatorTest, SoftDemodulationScale) {
+    const double noiseVariance = 4.0;
+    std::mt19937 rng(12);
+    std::normal_distribution<double> gauss(0.0, std::sqrt(noiseVariance / 2.0));
+
+    BPSKModulator bpsk;
+    QPSKModulator qpsk;
+    bpsk.setNoiseVariance(noiseVariance);
+    qpsk.setNoiseVariance(noiseVariance);
+    const BitBuffer bits = BitBuffer::fromString(randomBits(20000, 13));
+
+    for (int bitsPerSymbol : {1, 2}) {
+        std::vector<std::complex<double>> signal =
+            bitsPerSymbol == 1 ? bpsk.modulate(bits.span()) : qpsk.modulate(bits.span());
+        const std::vector<double> clean =
+            bitsPerSymbol == 1 ? bpsk.demodulateSoft(signal) : qpsk.demodulateSoft(signal);
+        for (auto& sample : signal) {
+            sample += std::complex<double>(gauss(rng), gauss(rng));
+        }
+
+        std::vector<double> llr(clean.size());
+        const size_t count = bitsPerSymbol == 1
+            ? bpsk.demodulateSoft(signal.data(), signal.size(), llr.data(), llr.size())
+            : qpsk.demodulateSoft(signal.data(), signal.size(), llr.data(), llr.size());
+        ASSERT_EQ(bits.size(), count);
+        EXPECT_EQ(0u, bitsPerSymbol == 1
+            ? bpsk.demodulateSoft(signal.data(), signal.size(), llr.data(), llr.size() - 1)
+            : qpsk.demodulateSoft(signal.data(), signal.size(), llr.data(), llr.size() - 1));
+
+        double cleanMean = 0.0;
+        double noiseSquare = 0.0;
+        for (size_t i = 0; i < count; ++i) {
+            const double sign = bits[i] ? 1.0 : -1.0;
+            ASSERT_GT(clean[i] * sign, 0.0);
+            cleanMean += clean[i] * sign;
+            noiseSquare += (llr[i] - clean[i]) * (llr[i] - clean[i]);
+        }
+        cleanMean /= count;
+        EXPECT_NEAR(noiseSquare / count, 2.0 * cleanMean, 0.05 * 2.0 * cleanMean);
+    }
+}
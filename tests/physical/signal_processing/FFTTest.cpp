@@ -0,0 +1,47 @@
+#include "gtest/gtest.h"
+#include "physical/signal_processing/fft/FFT.h"
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+using namespace link16::physical::signal_processing;
+
+// 与直接计算的DFT对比，并验证逆变换还原
+TEST(FFTTest, MatchesDirectDFT) {
+    std::mt19937 rng(1);
+    std::normal_distribution<double> gauss;
+
+    for (size_t size : {2u, 4u, 8u, 64u, 512u}) {
+        FFT fft;
+        ASSERT_TRUE(fft.initialize(size));
+
+        std::vector<std::complex<double>> input(size);
+        for (auto& x : input) {
+            x = std::complex<double>(gauss(rng), gauss(rng));
+        }
+
+        std::vector<std::complex<double>> spectrum(input);
+        fft.forward(spectrum.data());
+        for (size_t k = 0; k < size; ++k) {
+            std::complex<double> expected(0.0, 0.0);
+            for (size_t n = 0; n < size; ++n) {
+                const double phase = -2.0 * M_PI * static_cast<double>(k * n % size) / size;
+                expected += input[n] * std::complex<double>(std::cos(phase), std::sin(phase));
+            }
+            EXPECT_NEAR(std::abs(spectrum[k] - expected), 0.0, 1e-9 * size) << "size=" << size << ", k=" << k;
+        }
+
+        fft.inverse(spectrum.data());
+        for (size_t n = 0; n < size; ++n) {
+            EXPECT_NEAR(std::abs(spectrum[n] - input[n]), 0.0, 1e-12 * size);
+        }
+    }
+
+    FFT fft;
+    EXPECT_FALSE(fft.initialize(0));
+    EXPECT_FALSE(fft.initialize(1));
+    EXPECT_FALSE(fft.initialize(48));
+    EXPECT_EQ(FFT::nextPowerOfTwo(1), 1u);
+    EXPECT_EQ(FFT::nextPowerOfTwo(129), 256u);
+}
@@ -0,0 +1,136 @@
+#include "gtest/gtest.h"
+#include "physical/signal_processing/filter/FIRFilter.h"
+#include <algorithm>
+#include <complex>
+#include <random>
+#include <vector>
+
+using namespace link16::physical::signal_processing;
+
+namespace {
+
+const FIRKernelType all_kernels[] = {FIRKernelType::SCALAR, FIRKernelType::AVX2};
+
+std::vector<double> randomSignal(size_t length, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> gauss;
+    std::vector<double> signal(length);
+    for (auto& x : signal) {
+        x = gauss(rng);
+    }
+    return signal;
+}
+
+// y[n] = sum c[k] * x[n-k]，x[n<0] = 0
+template <typename T>
+std::vector<T> convolve(const std::vector<double>& taps, const std::vector<T>& input) {
+    std::vector<T> output(input.size(), T());
+    for (size_t n = 0; n < input.size(); ++n) {
+        for (size_t k = 0; k < taps.size() && k <= n; ++k) {
+            output[n] += taps[k] * input[n - k];
+        }
+    }
+    return output;
+}
+
+// 依次切换到每个受支持的内核执行测试，结束后恢复默认内核
+template <typename Func>
+void forEachKernel(Func&& func) {
+    const FIRKernelType original = getFIRKernel();
+    for (FIRKernelType kernel : all_kernels) {
+        if (!isFIRKernelSupported(kernel)) {
+            continue;
+        }
+        setFIRKernel(kernel);
+        SCOPED_TRACE(getFIRKernelName(kernel));
+        func();
+    }
+    setFIRKernel(original);
+}
+
+} // namespace
+
+// 分多次不等长调用与整段直接卷积结果一致
+TEST(FIRFilterTest, StreamingMatchesConvolution) {
+    const std::vector<double> input = randomSignal(10000, 1);
+
+    forEachKernel([&]() {
+        for (size_t numTaps : {1u, 2u, 7u, 31u, 127u, 300u}) {
+            const std::vector<double> taps = randomSignal(numTaps, static_cast<uint32_t>(numTaps));
+            const std::vector<double> expected = convolve(taps, input);
+
+            for (auto mode : {FIRFilter::FilterMode::DIRECT, FIRFilter::FilterMode::FFT}) {
+                FIRFilter filter;
+                filter.setFilterMode(mode);
+                filter.setCoefficients(taps);
+                EXPECT_EQ(filter.isUsingFFT(), mode == FIRFilter::FilterMode::FFT);
+
+                std::vector<double> output(input.size());
+                std::mt19937 rng(static_cast<uint32_t>(numTaps));
+                for (size_t pos = 0; pos < input.size();) {
+                    const size_t length = std::min<size_t>(rng() % 5000, input.size() - pos);
+                    ASSERT_TRUE(filter.filter(input.data() + pos, output.data() + pos, length));
+                    pos += length;
+                }
+
+                for (size_t n = 0; n < input.size(); ++n) {
+                    ASSERT_NEAR(output[n], expected[n], 1e-9) << "numTaps=" << numTaps << ", n=" << n;
+                }
+            }
+        }
+    });
+}
+
+// 复数信号及原地滤波
+TEST(FIRFilterTest, ComplexInPlace) {
+    const std::vector<double> real = randomSignal(5000, 2);
+    const std::vector<double> imag = randomSignal(5000, 3);
+    std::vector<std::complex<double>> input(real.size());
+    for (size_t i = 0; i < input.size(); ++i) {
+        input[i] = std::complex<double>(real[i], imag[i]);
+    }
+
+    forEachKernel([&]() {
+        for (size_t numTaps : {5u, 64u, 200u}) {
+            const std::vector<double> taps = randomSignal(numTaps, 10 + static_cast<uint32_t>(numTaps));
+            const std::vector<std::complex<double>> expected = convolve(taps, input);
+
+            for (auto mode : {FIRFilter::FilterMode::DIRECT, FIRFilter::FilterMode::FFT}) {
+                FIRFilter filter;
+                filter.setFilterMode(mode);
+                filter.setCoefficients(taps);
+
+                std::vector<std::complex<double>> signal(input);
+                ASSERT_TRUE(filter.filter(signal.data(), signal.data(), 1234));
+                ASSERT_TRUE(filter.filter(signal.data() + 1234, signal.data() + 1234, signal.size() - 1234));
+                for (size_t n = 0; n < signal.size(); ++n) {
+                    ASSERT_NEAR(std::abs(signal[n] - expected[n]), 0.0, 1e-9) << "numTaps=" << numTaps;
+                }
+
+                // reset后从零状态重新开始
+                filter.reset();
+                const std::vector<std::complex<double>> again = filter.filter(input);
+                EXPECT_NEAR(std::abs(again.back() - expected.back()), 0.0, 1e-9);
+            }
+        }
+    });
+}
+
+// 设计的低通滤波器按阶数自动选择实现
+TEST(FIRFilterTest, AutoModeSelection) {
+    FIRFilter shortFilter;
+    ASSERT_TRUE(shortFilter.initialize(FIRFilter::FilterType::LOWPASS, 31, 1000.0, 8000.0));
+    EXPECT_FALSE(shortFilter.isUsingFFT());
+
+    FIRFilter longFilter;
+    ASSERT_TRUE(longFilter.initialize(FIRFilter::FilterType::LOWPASS, FIRFilter::fft_min_taps + 1, 1000.0, 8000.0));
+    EXPECT_TRUE(longFilter.isUsingFFT());
+
+    // 直流信号经过归一化低通滤波器后保持不变
+    const std::vector<double> output = longFilter.filter(std::vector<double>(1000, 1.0));
+    EXPECT_NEAR(output.back(), 1.0, 1e-9);
+
+    FIRFilter empty;
+    const std::vector<double> input = randomSignal(10, 4);
+    EXPECT_EQ(empty.filter(input), input);
+}
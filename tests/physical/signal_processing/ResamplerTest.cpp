@@ -0,0 +1,126 @@
+#include "gtest/gtest.h"
+#include "physical/signal_processing/resampling/Resampler.h"
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+using namespace link16::physical::signal_processing;
+
+namespace {
+
+using Method = Resampler::InterpolationMethod;
+
+// 低频正弦重采样后与理想值的最大误差，跳过滤波器建立阶段
+double sineError(Resampler& resampler, double inputRate, double frequency) {
+    const size_t length = 20000;
+    std::vector<double> input(length);
+    for (size_t i = 0; i < length; ++i) {
+        input[i] = std::sin(2.0 * M_PI * frequency * i / inputRate);
+    }
+
+    const std::vector<double> output = resampler.resample(input);
+    const double step = inputRate / resampler.getOutputRate();
+    double maxError = 0.0;
+    for (size_t k = 0; k < output.size(); ++k) {
+        const double time = k * step - resampler.getDelay();
+        if (time < 200.0 || time > length - 200.0) {
+            continue;
+        }
+        maxError = std::max(maxError, std::abs(output[k] - std::sin(2.0 * M_PI * frequency * time / inputRate)));
+    }
+    return maxError;
+}
+
+} // namespace
+
+// 有理比率使用多相滤波器组，其他比率使用Farrow结构
+TEST(ResamplerTest, StructureSelection) {
+    Resampler resampler;
+    ASSERT_TRUE(resampler.initialize(48000.0, 44100.0));
+    EXPECT_TRUE(resampler.isPolyphase());
+    EXPECT_EQ(resampler.getInterpolationFactor(), 147);
+    EXPECT_EQ(resampler.getDecimationFactor(), 160);
+
+    ASSERT_TRUE(resampler.initialize(1e6, 250e3));
+    EXPECT_TRUE(resampler.isPolyphase());
+    EXPECT_EQ(resampler.getInterpolationFactor(), 1);
+    EXPECT_EQ(resampler.getDecimationFactor(), 4);
+
+    ASSERT_TRUE(resampler.initialize(1e6, 1e6 * M_PI / 3.0));
+    EXPECT_FALSE(resampler.isPolyphase());
+
+    ASSERT_TRUE(resampler.initialize(48000.0, 44100.0, Method::CUBIC));
+    EXPECT_FALSE(resampler.isPolyphase());
+}
+
+// 分块调用与一次处理整段信号结果相同
+TEST(ResamplerTest, StreamingMatchesSingleCall) {
+    std::mt19937 rng(1);
+    std::normal_distribution<double> gauss;
+    std::vector<std::complex<double>> input(30000);
+    for (auto& x : input) {
+        x = std::complex<double>(gauss(rng), gauss(rng));
+    }
+
+    const double rates[][2] = {{48000.0, 44100.0}, {1e6, 250e3}, {100e3, 1e6}, {1e6, 1234567.891}};
+    for (const auto& rate : rates) {
+        for (Method method : {Method::SINC, Method::CUBIC, Method::LINEAR, Method::NEAREST}) {
+            Resampler whole;
+            Resampler chunked;
+            ASSERT_TRUE(whole.initialize(rate[0], rate[1], method));
+            ASSERT_TRUE(chunked.initialize(rate[0], rate[1], method));
+
+            const std::vector<std::complex<double>> expected = whole.resample(input);
+            const double expectedLength = input.size() * rate[1] / rate[0];
+            EXPECT_NEAR(static_cast<double>(expected.size()), expectedLength, 2.0);
+
+            std::vector<std::complex<double>> output;
+            std::vector<std::complex<double>> buffer;
+            for (size_t pos = 0; pos < input.size();) {
+                const size_t length = std::min<size_t>(rng() % 3000, input.size() - pos);
+                buffer.resize(chunked.getMaxOutputLength(length));
+                const size_t produced = chunked.resample(input.data() + pos, length, buffer.data(), buffer.size());
+                output.insert(output.end(), buffer.begin(), buffer.begin() + produced);
+                pos += length;
+            }
+
+            ASSERT_EQ(output.size(), expected.size()) << rate[0] << " -> " << rate[1];
+            for (size_t i = 0; i < output.size(); ++i) {
+                ASSERT_NEAR(std::abs(output[i] - expected[i]), 0.0, 1e-12);
+            }
+        }
+    }
+}
+
+// 低频正弦的插值精度
+TEST(ResamplerTest, SineAccuracy) {
+    const double rates[][2] = {{48000.0, 44100.0}, {44100.0, 48000.0}, {1e6, 1e6 * M_PI / 3.0}, {1e6, 0.37e6}};
+    for (const auto& rate : rates) {
+        const double frequency = 0.02 * std::min(rate[0], rate[1]);
+
+        Resampler resampler;
+        ASSERT_TRUE(resampler.initialize(rate[0], rate[1], Method::SINC));
+        EXPECT_LT(sineError(resampler, rate[0], frequency), 5e-3) << rate[0] << " -> " << rate[1];
+
+        ASSERT_TRUE(resampler.initialize(rate[0], rate[1], Method::CUBIC));
+        EXPECT_LT(sineError(resampler, rate[0], frequency), 2e-3);
+
+        ASSERT_TRUE(resampler.initialize(rate[0], rate[1], Method::LINEAR));
+        EXPECT_LT(sineError(resampler, rate[0], frequency), 1e-2);
+    }
+}
+
+// 输出缓冲区容量不足时不消耗输入
+TEST(ResamplerTest, CapacityCheck) {
+    Resampler resampler;
+    ASSERT_TRUE(resampler.initialize(1e6, 2e6));
+    std::vector<double> input(100, 1.0);
+    std::vector<double> output(resampler.getMaxOutputLength(input.size()));
+    EXPECT_EQ(resampler.resample(input.data(), input.size(), output.data(), 150), 0u);
+    EXPECT_EQ(resampler.resample(input.data(), input.size(), output.data(), output.size()), 200u);
+
+    // 采样率相同时直接复制
+    ASSERT_TRUE(resampler.initialize(1e6, 1e6));
+    EXPECT_EQ(resampler.resample(input), input);
+}
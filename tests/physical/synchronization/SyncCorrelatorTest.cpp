@@ -0,0 +1,181 @@
+#include "gtest/gtest.h"
+#include "physical/synchronization/frame/FrameSynchronizer.h"
+#include "physical/synchronization/frame/SyncCorrelator.h"
+#include "physical/signal_processing/filter/FIRFilter.h"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace link16::physical::synchronization;
+using namespace link16::physical::signal_processing;
+
+namespace {
+
+std::string randomSequence(size_t length, std::mt19937& rng) {
+    std::string sequence;
+    for (size_t i = 0; i < length; ++i) {
+        sequence += (rng() & 1) ? '1' : '0';
+    }
+    return sequence;
+}
+
+// 噪声中按给定位置插入同步信号，幅度与相位各不相同
+std::vector<std::complex<double>> makeSignal(const std::vector<std::complex<double>>& sync, size_t length,
+                                             const std::vector<size_t>& positions, std::mt19937& rng) {
+    std::normal_distribution<double> gauss(0.0, 0.1);
+    std::vector<std::complex<double>> signal(length);
+    for (auto& sample : signal) {
+        sample = std::complex<double>(gauss(rng), gauss(rng));
+    }
+    for (size_t k = 0; k < positions.size(); ++k) {
+        const std::complex<double> gain = std::polar(1.0 + 0.5 * k, 0.1 * k);
+        for (size_t i = 0; i < sync.size(); ++i) {
+            signal[positions[k] + i] += gain * sync[i];
+        }
+    }
+    return signal;
+}
+
+} // namespace
+
+// 各种参考长度和内核下与逐位置直接计算的结果一致
+TEST(SyncCorrelatorTest, MatchesDirectCorrelation) {
+    const FIRKernelType original = getFIRKernel();
+    std::mt19937 rng(3);
+
+    for (size_t length : {5, 16, 63, 64, 100, 191, 192, 300}) {
+        FrameSynchronizer synchronizer;
+        synchronizer.setSyncSequence(randomSequence(length, rng));
+        const auto sync = synchronizer.generateSyncSignal();
+        const auto signal = makeSignal(sync, 2000, {123, 1500}, rng);
+
+        SyncCorrelator correlator;
+        ASSERT_TRUE(correlator.setReference(sync));
+
+        for (FIRKernelType kernel : {FIRKernelType::SCALAR, FIRKernelType::AVX2}) {
+            if (!isFIRKernelSupported(kernel)) {
+                continue;
+            }
+            setFIRKernel(kernel);
+            const size_t fftLength = kernel == FIRKernelType::AVX2 ? SyncCorrelator::fft_min_length_avx2
+                                                                   : SyncCorrelator::fft_min_length;
+            EXPECT_EQ(length >= fftLength, correlator.isUsingFFT());
+            std::vector<double> output(signal.size());
+            ASSERT_EQ(signal.size() - length + 1, correlator.correlate(signal.data(), signal.size(), output.data()));
+            for (size_t p = 0; p + length <= signal.size(); ++p) {
+                ASSERT_NEAR(synchronizer.calculateCorrelation(signal, p), output[p], 1e-9)
+                    << "length " << length << " kernel " << getFIRKernelName(kernel) << " position " << p;
+            }
+        }
+    }
+    setFIRKernel(original);
+}
+
+// 复数参考序列和全0区间
+TEST(SyncCorrelatorTest, ComplexReferenceAndSilence) {
+    std::mt19937 rng(5);
+    std::normal_distribution<double> gauss(0.0, 1.0);
+
+    for (size_t length : {12, 256}) {
+        std::vector<std::complex<double>> reference(length);
+        for (auto& value : reference) {
+            value = std::complex<double>(gauss(rng), gauss(rng));
+        }
+        std::vector<std::complex<double>> signal(2000, std::complex<double>(0.0, 0.0));
+        for (size_t i = 0; i < length; ++i) {
+            signal[400 + i] = reference[i] * std::complex<double>(0.0, 2.0);
+            signal[1200 + i] = reference[i] * 3.0;
+        }
+
+        SyncCorrelator correlator;
+        ASSERT_TRUE(correlator.setReference(reference));
+        std::vector<double> output(signal.size());
+        const size_t count = correlator.correlate(signal.data(), signal.size(), output.data());
+        EXPECT_NEAR(0.0, output[400], 1e-9);
+        EXPECT_NEAR(1.0, output[1200], 1e-9);
+        // 远离同步序列的全0窗口
+        EXPECT_EQ(0.0, output[100]);
+        EXPECT_EQ(0.0, output[count - 1]);
+    }
+
+    SyncCorrelator correlator;
+    EXPECT_FALSE(correlator.setReference({}));
+    EXPECT_FALSE(correlator.setReference(std::vector<std::complex<double>>(4)));
+}
+
+// 返回所有超过阈值的峰，而不只是最大值
+TEST(SyncCorrelatorTest, DetectsAllPeaks) {
+    std::mt19937 rng(7);
+    const std::vector<size_t> positions = {50, 700, 1333, 2700};
+
+    for (size_t length : {32, 256}) {
+        FrameSynchronizer synchronizer;
+        synchronizer.setSyncSequence(randomSequence(length, rng));
+        const auto signal = makeSignal(synchronizer.generateSyncSignal(), 3000, positions, rng);
+
+        std::vector<SyncPeak> peaks;
+        ASSERT_TRUE(synchronizer.detectSyncPeaks(signal, peaks));
+        ASSERT_EQ(positions.size(), peaks.size());
+        for (size_t k = 0; k < positions.size(); ++k) {
+            EXPECT_EQ(positions[k], peaks[k].position);
+            EXPECT_GT(peaks[k].correlation, 0.9);
+        }
+
+        size_t position = 0;
+        EXPECT_TRUE(synchronizer.detectSync(signal, position));
+        EXPECT_TRUE(std::find(positions.begin(), positions.end(), position) != positions.end());
+    }
+}
+
+// 任意分块流式处理与整段处理的峰值相同，跨块的同步序列也能检出
+TEST(SyncCorrelatorTest, StreamingMatchesOneShot) {
+    std::mt19937 rng(11);
+
+    for (size_t length : {20, 96, 256}) {
+        FrameSynchronizer synchronizer;
+        synchronizer.setSyncSequence(randomSequence(length, rng));
+        const auto sync = synchronizer.generateSyncSignal();
+        const auto signal = makeSignal(sync, 5000, {10, 999, 1000 + length, 2047, 4000}, rng);
+
+        SyncCorrelator correlator;
+        correlator.setReference(sync);
+        std::vector<double> output(signal.size());
+        const size_t count = correlator.correlate(signal.data(), signal.size(), output.data());
+        std::vector<SyncPeak> expected;
+        SyncCorrelator::findPeaks(output.data(), count - 1, 0.5, 0, expected);
+        ASSERT_FALSE(expected.empty());
+
+        for (size_t maxBlock : {1, 7, 64, 1000, 5000}) {
+            std::uniform_int_distribution<size_t> blockSize(1, maxBlock);
+            std::vector<SyncPeak> peaks;
+            correlator.reset();
+            size_t offset = 0;
+            while (offset < signal.size()) {
+                const size_t block = std::min(blockSize(rng), signal.size() - offset);
+                correlator.process(signal.data() + offset, block, 0.5, peaks);
+                offset += block;
+            }
+            EXPECT_EQ(signal.size(), correlator.getStreamPosition());
+            ASSERT_EQ(expected.size(), peaks.size()) << "length " << length << " block " << maxBlock;
+            for (size_t k = 0; k < expected.size(); ++k) {
+                EXPECT_EQ(expected[k].position, peaks[k].position);
+                EXPECT_NEAR(expected[k].correlation, peaks[k].correlation, 1e-9);
+            }
+        }
+    }
+}
+
+// 峰值判定: 平顶取最后一个点，两端之外视为负无穷
+TEST(SyncCorrelatorTest, FindPeaks) {
+    const double correlation[] = {0.9, 0.2, 0.8, 0.8, 0.1, 0.3, 0.6, 0.95};
+    std::vector<SyncPeak> peaks;
+    EXPECT_EQ(3u, SyncCorrelator::findPeaks(correlation, 8, 0.5, 100, peaks));
+    ASSERT_EQ(3u, peaks.size());
+    EXPECT_EQ(100u, peaks[0].position);
+    EXPECT_EQ(103u, peaks[1].position);
+    EXPECT_EQ(107u, peaks[2].position);
+    EXPECT_DOUBLE_EQ(0.95, peaks[2].correlation);
+}
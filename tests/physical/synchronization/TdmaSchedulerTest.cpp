@@ -0,0 +1,163 @@
+#include "gtest/gtest.h"
+#include "physical/synchronization/time/TdmaScheduler.h"
+#include "physical/synchronization/time/TimeSynchronizer.h"
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace link16::physical::synchronization;
+
+namespace {
+
+// 一次分发的记录
+struct Dispatch {
+    uint64_t slot;
+    float firstSample;
+    size_t length;
+    std::chrono::steady_clock::time_point time;
+};
+
+} // namespace
+
+// 每个时隙的缓冲区提前准备，并在时隙边界之后立即分发
+TEST(TdmaSchedulerTest, DispatchesPreparedBuffersAtSlotBoundaries) {
+    const uint64_t slotLength = 2000000;
+    TdmaScheduler scheduler;
+    ASSERT_TRUE(scheduler.setSlotLength(slotLength));
+    ASSERT_TRUE(scheduler.setLookahead(2));
+
+    std::mutex mutex;
+    std::vector<Dispatch> dispatches;
+    std::vector<int64_t> prepareLead;
+
+    scheduler.setPrepareCallback([&](uint64_t slot, TdmaScheduler::SampleBuffer& buffer) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            prepareLead.push_back(static_cast<int64_t>(slot) - static_cast<int64_t>(scheduler.getNextSlot()));
+        }
+        // 奇数时隙不发射
+        if (slot % 2 == 1) {
+            return false;
+        }
+        buffer.assign(100 + slot, std::complex<float>(static_cast<float>(slot), 0.0f));
+        return true;
+    });
+    scheduler.setDispatchCallback([&](uint64_t slot, const TdmaScheduler::SampleBuffer& buffer) {
+        const auto now = std::chrono::steady_clock::now();
+        std::lock_guard<std::mutex> lock(mutex);
+        dispatches.push_back(Dispatch{slot, buffer[0].real(), buffer.size(), now});
+    });
+
+    const auto epoch = std::chrono::steady_clock::now() + std::chrono::milliseconds(5);
+    ASSERT_TRUE(scheduler.start(epoch, 10));
+    EXPECT_TRUE(scheduler.isRunning());
+    EXPECT_FALSE(scheduler.setSlotLength(1000000));
+    EXPECT_FALSE(scheduler.start());
+    std::this_thread::sleep_until(epoch + std::chrono::nanoseconds(slotLength * 40 + slotLength / 2));
+    scheduler.stop();
+    EXPECT_FALSE(scheduler.isRunning());
+
+    std::lock_guard<std::mutex> lock(mutex);
+    // 时隙10-40中的偶数时隙共16个，留出系统调度偶尔停顿导致错过的余量
+    ASSERT_GE(dispatches.size(), 10u);
+    uint64_t previous = 0;
+    for (const auto& dispatch : dispatches) {
+        EXPECT_EQ(0u, dispatch.slot % 2);
+        EXPECT_GE(dispatch.slot, 10u);
+        EXPECT_GT(dispatch.slot + 1, previous + 1);
+        previous = dispatch.slot;
+        EXPECT_EQ(static_cast<float>(dispatch.slot), dispatch.firstSample);
+        EXPECT_EQ(100 + dispatch.slot, dispatch.length);
+        // 分发不早于时隙边界
+        EXPECT_GE(dispatch.time, epoch + std::chrono::nanoseconds(dispatch.slot * slotLength));
+    }
+    for (int64_t lead : prepareLead) {
+        EXPECT_LE(lead, 2);
+    }
+
+    const SlotJitterHistogram histogram = scheduler.getJitterHistogram();
+    EXPECT_GE(histogram.count + histogram.missedSlots, 20u);
+    uint64_t total = histogram.overflow;
+    for (uint64_t bin : histogram.bins) {
+        total += bin;
+    }
+    EXPECT_EQ(histogram.count, total);
+    EXPECT_LE(histogram.percentile(0.5), histogram.percentile(0.99));
+    EXPECT_LE(histogram.mean, static_cast<double>(histogram.max));
+}
+
+// 准备太慢的时隙不发射，计入latePreparations
+TEST(TdmaSchedulerTest, CountsLatePreparations) {
+    const uint64_t slotLength = 1000000;
+    TdmaScheduler scheduler;
+    scheduler.setSlotLength(slotLength);
+    scheduler.setLookahead(1);
+
+    std::mutex mutex;
+    std::vector<uint64_t> dispatched;
+    scheduler.setPrepareCallback([&](uint64_t slot, TdmaScheduler::SampleBuffer& buffer) {
+        if (slot == 5) {
+            std::this_thread::sleep_for(std::chrono::nanoseconds(slotLength * 10));
+        }
+        buffer.assign(1, std::complex<float>(1.0f, 0.0f));
+        return true;
+    });
+    scheduler.setDispatchCallback([&](uint64_t slot, const TdmaScheduler::SampleBuffer&) {
+        std::lock_guard<std::mutex> lock(mutex);
+        dispatched.push_back(slot);
+    });
+
+    ASSERT_TRUE(scheduler.start());
+    std::this_thread::sleep_for(std::chrono::nanoseconds(slotLength * 40));
+    scheduler.stop();
+
+    const SlotJitterHistogram histogram = scheduler.getJitterHistogram();
+    EXPECT_GE(histogram.latePreparations, 1u);
+    std::lock_guard<std::mutex> lock(mutex);
+    // 时隙5准备了10个时隙长的时间，错过了时隙边界
+    for (uint64_t slot : dispatched) {
+        EXPECT_NE(5u, slot);
+    }
+    EXPECT_GT(dispatched.back(), 20u);
+}
+
+// 起点早于当前时刻时跳过过期的时隙
+TEST(TdmaSchedulerTest, SkipsExpiredSlots) {
+    TdmaScheduler scheduler;
+    scheduler.setSlotLength(1000000);
+    EXPECT_FALSE(scheduler.setLookahead(0));
+    EXPECT_FALSE(scheduler.setLookahead(TdmaScheduler::max_lookahead + 1));
+    EXPECT_FALSE(scheduler.setSpinTime(1000000));
+    EXPECT_TRUE(scheduler.setSpinTime(0));
+
+    ASSERT_TRUE(scheduler.start(std::chrono::steady_clock::now() - std::chrono::milliseconds(50), 0));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    scheduler.stop();
+    EXPECT_GE(scheduler.getJitterHistogram().missedSlots, 49u);
+    EXPECT_GE(scheduler.getNextSlot(), 55u);
+}
+
+// 时隙长度为7.8125ms，不取整到微秒
+TEST(TdmaSchedulerTest, TimeSynchronizerSlotLength) {
+    TimeSynchronizer synchronizer;
+    synchronizer.initialize();
+    EXPECT_EQ(7812500u, synchronizer.getTimeSlotLengthNs());
+    EXPECT_EQ(7812u, synchronizer.getTimeSlotLength());
+    EXPECT_EQ(TdmaScheduler::default_slot_length_ns, synchronizer.getTimeSlotLengthNs());
+
+    // 第128个时隙恰好在1秒处
+    const auto start0 = synchronizer.getTimeSlotStart(0);
+    EXPECT_EQ(std::chrono::seconds(1), synchronizer.getTimeSlotStart(128) - start0);
+
+    const auto before = std::chrono::steady_clock::now();
+    EXPECT_TRUE(synchronizer.waitForNextTimeSlot());
+    const auto elapsed = std::chrono::steady_clock::now() - start0;
+    const auto remainder = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() % 7812500;
+    EXPECT_LT(std::chrono::steady_clock::now() - before, std::chrono::milliseconds(20));
+    // 醒来时刻在时隙边界之后不久
+    EXPECT_LT(remainder, 3000000);
+
+    synchronizer.setTimeSlotLength(1000);
+    EXPECT_EQ(1000000u, synchronizer.getTimeSlotLengthNs());
+}
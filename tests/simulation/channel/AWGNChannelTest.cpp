@@ -0,0 +1,152 @@
+#include "gtest/gtest.h"
+#include "simulation/channel/awgn/AWGNChannel.h"
+#include "simulation/channel/base/GaussianNoise.h"
+#include <cmath>
+#include <complex>
+#include <vector>
+
+using namespace link16::simulation::channel;
+
+namespace {
+
+const GaussianKernelType all_kernels[] = {GaussianKernelType::SCALAR, GaussianKernelType::AVX2};
+
+// 用指定内核生成样本
+std::vector<float> generateWith(GaussianKernelType kernel, uint64_t seed, uint64_t stream, size_t count) {
+    const GaussianKernelType original = getGaussianKernel();
+    setGaussianKernel(kernel);
+    GaussianNoise noise(seed, stream);
+    std::vector<float> output(count);
+    noise.generate(output.data(), output.size());
+    setGaussianKernel(original);
+    return output;
+}
+
+// 噪声功率(每个复数样本)
+double measureNoisePower(const std::vector<std::complex<double>>& output,
+                         const std::vector<std::complex<double>>& input) {
+    double power = 0.0;
+    for (size_t i = 0; i < output.size(); ++i) {
+        power += std::norm(output[i] - input[i]);
+    }
+    return power / output.size();
+}
+
+} // namespace
+
+// 各内核输出逐位相同
+TEST(GaussianNoiseTest, KernelsProduceIdenticalSamples) {
+    const std::vector<float> reference = generateWith(GaussianKernelType::SCALAR, 42, 3, 4099);
+    for (GaussianKernelType kernel : all_kernels) {
+        if (!isGaussianKernelSupported(kernel)) {
+            continue;
+        }
+        SCOPED_TRACE(getGaussianKernelName(kernel));
+        EXPECT_EQ(generateWith(kernel, 42, 3, 4099), reference);
+    }
+}
+
+// 样本序列与分块方式无关，可跳到任意位置
+TEST(GaussianNoiseTest, StreamIndependentOfChunking) {
+    const std::vector<float> reference = generateWith(getGaussianKernel(), 7, 0, 1000);
+
+    GaussianNoise noise(7);
+    std::vector<float> chunked;
+    const size_t chunkSizes[] = {1, 7, 33, 64, 5, 200};
+    size_t next = 0;
+    while (chunked.size() < reference.size()) {
+        const size_t length = std::min(chunkSizes[next++ % 6], reference.size() - chunked.size());
+        std::vector<float> part(length);
+        noise.generate(part.data(), length);
+        chunked.insert(chunked.end(), part.begin(), part.end());
+        EXPECT_EQ(noise.tell(), chunked.size());
+    }
+    EXPECT_EQ(chunked, reference);
+
+    noise.seek(517);
+    float value[3];
+    noise.generate(value, 3);
+    EXPECT_EQ(value[0], reference[517]);
+    EXPECT_EQ(value[2], reference[519]);
+}
+
+// 均值0方差1，尾部概率与正态分布一致，不同流不相关
+TEST(GaussianNoiseTest, SamplesAreStandardNormal) {
+    const size_t count = 1 << 20;
+    const std::vector<float> samples = generateWith(getGaussianKernel(), 1, 0, count);
+    const std::vector<float> other = generateWith(getGaussianKernel(), 1, 1, count);
+
+    double sum = 0.0, squares = 0.0, cross = 0.0;
+    size_t tail = 0;
+    for (size_t i = 0; i < count; ++i) {
+        sum += samples[i];
+        squares += samples[i] * samples[i];
+        cross += samples[i] * other[i];
+        tail += std::fabs(samples[i]) > 2.0f ? 1 : 0;
+    }
+
+    // 容差约为5个标准误差
+    EXPECT_NEAR(sum / count, 0.0, 0.005);
+    EXPECT_NEAR(squares / count, 1.0, 0.007);
+    EXPECT_NEAR(cross / count, 0.0, 0.005);
+    EXPECT_NEAR(static_cast<double>(tail) / count, std::erfc(2.0 / std::sqrt(2.0)), 0.001);
+}
+
+// 原地处理与返回新向量的结果相同，单精度版本使用同一噪声序列
+TEST(AWGNChannelTest, InPlaceMatchesProcess) {
+    std::vector<std::complex<double>> signal(1000);
+    for (size_t i = 0; i < signal.size(); ++i) {
+        signal[i] = std::polar(1.0, 0.1 * i);
+    }
+
+    AWGNChannel channel(5.0);
+    channel.setSeed(9, 2);
+    const std::vector<std::complex<double>> expected = channel.process(signal);
+
+    channel.setSeed(9, 2);
+    std::vector<std::complex<double>> buffer = signal;
+    channel.processInPlace(buffer.data(), buffer.size());
+    EXPECT_EQ(buffer, expected);
+
+    channel.setSeed(9, 2);
+    std::vector<std::complex<float>> single(signal.begin(), signal.end());
+    channel.processInPlace(single.data(), single.size());
+    for (size_t i = 0; i < single.size(); ++i) {
+        EXPECT_NEAR(single[i].real(), expected[i].real(), 1e-5);
+        EXPECT_NEAR(single[i].imag(), expected[i].imag(), 1e-5);
+    }
+
+    // 流号不同噪声不同
+    channel.setSeed(9, 3);
+    EXPECT_NE(channel.process(signal), expected);
+}
+
+// 按信噪比和实测信号功率确定噪声功率
+TEST(AWGNChannelTest, NoisePowerFollowsSnr) {
+    std::vector<std::complex<double>> signal(200000, std::complex<double>(2.0, 0.0));
+    AWGNChannel channel(10.0);
+    channel.setSeed(1);
+    const double power = measureNoisePower(channel.process(signal), signal);
+    EXPECT_NEAR(power, 4.0 / 10.0, 0.4 * 0.02);
+}
+
+// 已知噪声功率时不测量信号功率，信噪比不起作用
+TEST(AWGNChannelTest, KnownNoisePowerSkipsMeasurement) {
+    AWGNChannel channel(30.0);
+    channel.setSeed(4);
+    channel.setParameter("noise_power", 0.5);
+    EXPECT_DOUBLE_EQ(channel.getNoisePower(), 0.5);
+    EXPECT_DOUBLE_EQ(channel.clone()->getParameter("noise_power"), 0.5);
+
+    // 全零信号也加指定功率的噪声
+    std::vector<std::complex<double>> zeros(200000);
+    std::vector<std::complex<double>> buffer = zeros;
+    channel.processInPlace(buffer.data(), buffer.size());
+    EXPECT_NEAR(measureNoisePower(buffer, zeros), 0.5, 0.5 * 0.02);
+
+    // 恢复按信噪比计算后全零信号不加噪声
+    channel.setNoisePower(0.0);
+    buffer = zeros;
+    channel.processInPlace(buffer.data(), buffer.size());
+    EXPECT_EQ(buffer, zeros);
+}
@@ -0,0 +1,145 @@
+#include "gtest/gtest.h"
+#include "simulation/channel/fading/JakesFader.h"
+#include "simulation/channel/fading/RayleighChannel.h"
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+using namespace link16::simulation::channel;
+
+// 自相关为J0(2*pi*fd*tau)，平均功率为1
+TEST(JakesFaderTest, AutocorrelationFollowsBessel) {
+    const double doppler = 0.01;
+    const size_t lags[] = {0, 10, 20, 38, 60};
+    const int realizations = 2000;
+    std::mt19937_64 generator(3);
+    JakesFader fader;
+
+    std::vector<double> correlation(61, 0.0);
+    std::vector<std::complex<double>> gains(61);
+    for (int r = 0; r < realizations; ++r) {
+        fader.reset(doppler, generator);
+        fader.generate(gains.data(), gains.size());
+        for (size_t lag : lags) {
+            correlation[lag] += std::real(gains[0] * std::conj(gains[lag])) / realizations;
+        }
+    }
+
+    for (size_t lag : lags) {
+        EXPECT_NEAR(correlation[lag], std::cyl_bessel_j(0.0, 2.0 * M_PI * doppler * lag), 0.07) << "延迟 " << lag;
+    }
+}
+
+// 衰落系数与分块方式无关，跨调用连续
+TEST(JakesFaderTest, StateContinuesAcrossCalls) {
+    std::mt19937_64 first(5), second(5);
+    JakesFader whole, split;
+    whole.reset(0.002, first);
+    split.reset(0.002, second);
+
+    std::vector<std::complex<double>> expected(10000), actual(10000);
+    whole.generate(expected.data(), expected.size());
+    split.generate(actual.data(), 1);
+    split.generate(actual.data() + 1, 4999);
+    split.generate(actual.data() + 5000, 5000);
+    EXPECT_EQ(actual, expected);
+
+    // 相邻样本的变化受多普勒频移限制
+    for (size_t i = 1; i < actual.size(); ++i) {
+        ASSERT_LT(std::abs(actual[i] - actual[i - 1]), 2.0 * M_PI * 0.002 * 4.0);
+    }
+}
+
+// 连续调用的输出与一次处理相同，重新设置种子后重现
+TEST(RayleighChannelTest, ProcessKeepsChannelState) {
+    RayleighChannel channel(20.0, 200.0, 1.0e5, 3.0e-5);
+    EXPECT_EQ(channel.getTapCount(), 16u);
+
+    std::vector<std::complex<double>> signal(3000);
+    for (size_t i = 0; i < signal.size(); ++i) {
+        signal[i] = std::polar(1.0, 0.5 * i);
+    }
+
+    channel.setSeed(8);
+    const std::vector<std::complex<double>> expected = channel.process(signal);
+
+    channel.setSeed(8);
+    std::vector<std::complex<double>> buffer = signal;
+    channel.processInPlace(buffer.data(), 1000);
+    channel.processInPlace(buffer.data() + 1000, 7);
+    channel.processInPlace(buffer.data() + 1007, 1993);
+    for (size_t i = 0; i < buffer.size(); ++i) {
+        ASSERT_NEAR(std::abs(buffer[i] - expected[i]), 0.0, 1e-12) << i;
+    }
+
+    channel.setSeed(9);
+    EXPECT_NE(channel.process(signal), expected);
+}
+
+// 多普勒频移为0时信道不随时间变化
+TEST(RayleighChannelTest, ZeroDopplerIsStatic) {
+    RayleighChannel channel(300.0, 0.0);
+    channel.setSeed(2);
+    const std::vector<std::complex<double>> ones(100, std::complex<double>(1.0, 0.0));
+    const std::complex<double> gain = channel.process(ones)[0];
+    for (int call = 0; call < 3; ++call) {
+        for (const auto& sample : channel.process(ones)) {
+            ASSERT_NEAR(std::abs(sample - gain), 0.0, 1e-9);
+        }
+    }
+}
+
+// 抽头功率按时延扩展指数衰减，冲激响应的平均功率与之一致
+TEST(RayleighChannelTest, TapDelayLineFollowsDelaySpread) {
+    link16::ChannelParams params;
+    params.snr = 300.0;
+    params.delaySpread = 2.0e-6;
+    RayleighChannel channel(params, 1.0e6);
+    ASSERT_EQ(channel.getTapCount(), 11u);
+    EXPECT_DOUBLE_EQ(channel.getParameter("delay_spread"), 2.0e-6);
+
+    const std::vector<double> powers = channel.getTapPowers();
+    double total = 0.0;
+    for (size_t i = 0; i < powers.size(); ++i) {
+        total += powers[i];
+        if (i > 0) {
+            EXPECT_NEAR(powers[i] / powers[i - 1], std::exp(-0.5), 1e-12);
+        }
+    }
+    EXPECT_NEAR(total, 1.0, 1e-12);
+
+    const int realizations = 3000;
+    std::vector<std::complex<double>> impulse(powers.size());
+    std::vector<double> measured(powers.size(), 0.0);
+    for (int r = 0; r < realizations; ++r) {
+        channel.setSeed(r);
+        std::fill(impulse.begin(), impulse.end(), std::complex<double>(0.0, 0.0));
+        impulse[0] = 1.0;
+        channel.processInPlace(impulse.data(), impulse.size());
+        for (size_t i = 0; i < impulse.size(); ++i) {
+            measured[i] += std::norm(impulse[i]) / realizations;
+        }
+    }
+    for (size_t i = 0; i < powers.size(); ++i) {
+        EXPECT_NEAR(measured[i], powers[i], 0.1 * powers[i] + 1e-3) << "抽头 " << i;
+    }
+
+    channel.setDelaySpread(0.0);
+    EXPECT_EQ(channel.getTapCount(), 1u);
+}
+
+// 平均接收功率等于输入功率
+TEST(RayleighChannelTest, PreservesAveragePower) {
+    RayleighChannel channel(300.0, 500.0, 1.0e5, 1.0e-5);
+    const std::vector<std::complex<double>> signal(4096, std::complex<double>(0.0, 2.0));
+    double power = 0.0;
+    const int realizations = 200;
+    for (int r = 0; r < realizations; ++r) {
+        channel.setSeed(100 + r);
+        for (const auto& sample : channel.process(signal)) {
+            power += std::norm(sample) / (signal.size() * realizations);
+        }
+    }
+    EXPECT_NEAR(power, 4.0, 0.2);
+}
@@ -0,0 +1,291 @@
+#include "gtest/gtest.h"
+#include "simulation/engine/SimulationEngine.h"
+#include "simulation/channel/awgn/AWGNChannel.h"
+#include "simulation/channel/fading/RayleighChannel.h"
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace link16::simulation;
+
+namespace {
+
+// 创建仿真配置
+engine::SimulationConfig makeConfig(double snr, int iterations, size_t bits, const std::string& modulation = "BPSK",
+                                    const std::string& channelType = "AWGN") {
+    engine::SimulationConfig config;
+    link16::SimulationParams simParams;
+    simParams.snr = snr;
+    simParams.iterations = iterations;
+    simParams.numSamples = bits;
+    config.setSimulationParams(simParams);
+
+    link16::PhysicalParams physParams;
+    physParams.modulation = modulation;
+    config.setPhysicalParams(physParams);
+    config.setChannelType(channelType);
+    return config;
+}
+
+} // namespace
+
+// 同一种子下结果与线程数和块大小无关
+TEST(SimulationEngineTest, ResultsIndependentOfThreadCount) {
+    const auto config = makeConfig(-6.0, 40, 256);
+
+    engine::SimulationEngine reference;
+    ASSERT_TRUE(reference.initialize(config));
+    reference.setSeed(7);
+    reference.setThreadCount(1);
+    ASSERT_TRUE(reference.run());
+    ASSERT_EQ(reference.getResults().size(), 40u);
+    EXPECT_EQ(reference.getTotalBits(), 40u * 256u);
+    EXPECT_GT(reference.getErrorBits(), 0u);
+
+    const size_t threadCounts[] = {2, 3, 8};
+    const size_t chunkSizes[] = {0, 1, 7};
+    for (size_t threads : threadCounts) {
+        for (size_t chunk : chunkSizes) {
+            engine::SimulationEngine simulation;
+            ASSERT_TRUE(simulation.initialize(config));
+            simulation.setSeed(7);
+            simulation.setThreadCount(threads);
+            simulation.setChunkSize(chunk);
+            ASSERT_TRUE(simulation.run());
+            EXPECT_EQ(simulation.getResults(), reference.getResults()) << threads << "线程，块大小" << chunk;
+            EXPECT_EQ(simulation.getErrorBits(), reference.getErrorBits());
+            EXPECT_EQ(simulation.getTotalBits(), reference.getTotalBits());
+        }
+    }
+}
+
+// 再次运行结果相同，换种子结果不同
+TEST(SimulationEngineTest, SeedSelectsRandomStream) {
+    engine::SimulationEngine simulation;
+    ASSERT_TRUE(simulation.initialize(makeConfig(-6.0, 20, 512)));
+    simulation.setThreadCount(2);
+    simulation.setSeed(1);
+    ASSERT_TRUE(simulation.run());
+    const auto first = simulation.getResults();
+
+    ASSERT_TRUE(simulation.run());
+    EXPECT_EQ(simulation.getResults(), first);
+
+    simulation.setSeed(2);
+    ASSERT_TRUE(simulation.run());
+    EXPECT_NE(simulation.getResults(), first);
+}
+
+// 误码率随信噪比下降，极低信噪比下接近0.5
+TEST(SimulationEngineTest, BitErrorRateDecreasesWithSnr) {
+    for (const char* modulation : {"BPSK", "QPSK"}) {
+        double previous = 1.0;
+        for (double snr : {-30.0, -8.0, -4.0, 0.0}) {
+            engine::SimulationEngine simulation;
+            ASSERT_TRUE(simulation.initialize(makeConfig(snr, 16, 1000, modulation)));
+            simulation.setThreadCount(4);
+            ASSERT_TRUE(simulation.run());
+
+            const double ber = simulation.getBitErrorRate();
+            if (snr == -30.0) {
+                EXPECT_NEAR(ber, 0.5, 0.05) << modulation;
+            }
+            EXPECT_LT(ber, previous) << modulation << " SNR = " << snr;
+            previous = ber;
+        }
+    }
+}
+
+// 吞吐量统计包含所有迭代的比特和帧
+TEST(SimulationEngineTest, ReportsThroughput) {
+    engine::SimulationEngine simulation;
+    ASSERT_TRUE(simulation.initialize(makeConfig(10.0, 12, 300, "QPSK", "Rayleigh")));
+    simulation.setThreadCount(3);
+    ASSERT_TRUE(simulation.run());
+
+    const auto throughput = simulation.getThroughput();
+    EXPECT_EQ(throughput.getTotalBits(), 12u * 300u);
+    EXPECT_EQ(throughput.getTotalPackets(), 12u);
+    EXPECT_EQ(simulation.getTotalBits(), 12u * 300u);
+}
+
+// 瑞利信道使用配置中的多普勒频移和时延扩展
+TEST(SimulationEngineTest, RayleighChannelUsesChannelParams) {
+    auto config = makeConfig(10.0, 4, 300, "BPSK", "Rayleigh");
+    link16::ChannelParams channelParams;
+    channelParams.dopplerShift = 50.0;
+    channelParams.delaySpread = 2.0e-6;
+    config.setChannelParams(channelParams);
+
+    engine::SimulationEngine simulation;
+    ASSERT_TRUE(simulation.initialize(config));
+    const auto model = simulation.getChannelModel();
+    EXPECT_DOUBLE_EQ(model->getParameter("doppler_shift"), 50.0);
+    EXPECT_DOUBLE_EQ(model->getParameter("delay_spread"), 2.0e-6);
+    EXPECT_DOUBLE_EQ(model->getSnr(), 10.0);
+    ASSERT_TRUE(simulation.run());
+    EXPECT_EQ(simulation.getTotalBits(), 4u * 300u);
+}
+
+// 不支持的调制方式
+TEST(SimulationEngineTest, RejectsUnsupportedModulation) {
+    engine::SimulationEngine simulation;
+    ASSERT_TRUE(simulation.initialize(makeConfig(10.0, 4, 64, "FSK")));
+    EXPECT_FALSE(simulation.run());
+}
+
+// 信道副本参数相同，种子相同的副本产生相同的输出
+TEST(SimulationEngineTest, ChannelCloneIsIndependentAndSeedable) {
+    channel::RayleighChannel original(5.0, 100.0);
+    auto copy = original.clone();
+    ASSERT_NE(copy.get(), &original);
+    EXPECT_EQ(copy->getName(), "Rayleigh");
+    EXPECT_DOUBLE_EQ(copy->getSnr(), 5.0);
+    EXPECT_DOUBLE_EQ(copy->getParameter("doppler_shift"), 100.0);
+
+    std::vector<std::complex<double>> signal(64, std::complex<double>(1.0, 0.0));
+    channel::AWGNChannel awgn(3.0);
+    auto other = awgn.clone();
+    awgn.setSeed(11);
+    other->setSeed(11);
+    EXPECT_EQ(awgn.process(signal), other->process(signal));
+    other->setSeed(12);
+    EXPECT_NE(awgn.process(signal), other->process(signal));
+}
+
+// 扫描在达到目标错误数后停止，结果按信噪比排列
+TEST(SimulationEngineTest, SweepStopsAtTargetErrors) {
+    engine::SimulationEngine simulation;
+    ASSERT_TRUE(simulation.initialize(makeConfig(0.0, 1, 500)));
+    simulation.setThreadCount(4);
+
+    engine::SweepParams params;
+    params.snrStart = -10.0;
+    params.snrStop = -4.0;
+    params.snrStep = 2.0;
+    params.targetErrors = 200;
+    params.minBits = 1000;
+    params.maxBits = 2000000;
+    params.framesPerBatch = 2;
+    params.concurrentPoints = 2;
+
+    std::vector<double> finishedSnrs;
+    std::vector<engine::SweepPoint> points;
+    ASSERT_TRUE(simulation.runSweep(params, points,
+                                    [&](const engine::SweepPoint& point) { finishedSnrs.push_back(point.snr); }));
+
+    ASSERT_EQ(points.size(), 4u);
+    EXPECT_EQ(finishedSnrs.size(), 4u);
+    const uint64_t batchBits = 2 * 500;
+    for (size_t i = 0; i < points.size(); ++i) {
+        const auto& point = points[i];
+        EXPECT_DOUBLE_EQ(point.snr, -10.0 + 2.0 * i);
+        EXPECT_TRUE(point.converged);
+        EXPECT_GE(point.errorBits, 200u);
+        EXPECT_EQ(point.totalBits, point.frames * 500);
+        EXPECT_LE(point.confidenceLow, point.ber);
+        EXPECT_GE(point.confidenceHigh, point.ber);
+
+        // 在达到目标的那个批次停止，一个批次最多batchBits个错误
+        EXPECT_LT(point.errorBits, 200u + batchBits);
+        if (i > 0) {
+            EXPECT_LT(point.ber, points[i - 1].ber);
+            EXPECT_GT(point.totalBits, points[i - 1].totalBits);
+        }
+    }
+}
+
+// 扫描结果与线程数和同时仿真的点数无关
+TEST(SimulationEngineTest, SweepResultsIndependentOfThreadCount) {
+    engine::SweepParams params;
+    params.snrStart = -8.0;
+    params.snrStop = -2.0;
+    params.snrStep = 3.0;
+    params.targetErrors = 0;
+    params.relativeWidth = 0.3;
+    params.minBits = 2000;
+    params.maxBits = 400000;
+    params.framesPerBatch = 1;
+
+    std::vector<engine::SweepPoint> reference;
+    {
+        engine::SimulationEngine simulation;
+        ASSERT_TRUE(simulation.initialize(makeConfig(0.0, 1, 400, "QPSK")));
+        simulation.setThreadCount(1);
+        params.concurrentPoints = 1;
+        ASSERT_TRUE(simulation.runSweep(params, reference));
+    }
+
+    engine::SimulationEngine simulation;
+    ASSERT_TRUE(simulation.initialize(makeConfig(0.0, 1, 400, "QPSK")));
+    simulation.setThreadCount(5);
+    params.concurrentPoints = 3;
+    std::vector<engine::SweepPoint> points;
+    ASSERT_TRUE(simulation.runSweep(params, points));
+
+    ASSERT_EQ(points.size(), reference.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        EXPECT_EQ(points[i].errorBits, reference[i].errorBits) << "SNR = " << points[i].snr;
+        EXPECT_EQ(points[i].totalBits, reference[i].totalBits);
+        EXPECT_EQ(points[i].converged, reference[i].converged);
+        if (points[i].converged) {
+            EXPECT_LE((points[i].confidenceHigh - points[i].confidenceLow) / 2.0, 0.3 * points[i].ber);
+        }
+    }
+}
+
+// 达到maxBits仍未收敛的点按未收敛结束，结果逐点写入CSV
+TEST(SimulationEngineTest, SweepWritesCsvAndStopsAtMaxBits) {
+    engine::SimulationEngine simulation;
+    ASSERT_TRUE(simulation.initialize(makeConfig(0.0, 1, 256)));
+    simulation.setThreadCount(2);
+
+    engine::SweepParams params;
+    params.snrStart = -10.0;
+    params.snrStop = 20.0;
+    params.snrStep = 30.0;
+    params.targetErrors = 50;
+    params.minBits = 256;
+    params.maxBits = 20000;
+    params.framesPerBatch = 4;
+
+    const std::string path = "sweep_test_output.csv";
+    std::vector<engine::SweepPoint> points;
+    ASSERT_TRUE(simulation.runSweep(params, path, &points));
+    ASSERT_EQ(points.size(), 2u);
+
+    EXPECT_TRUE(points[0].converged);
+    EXPECT_FALSE(points[1].converged);
+    EXPECT_GE(points[1].totalBits, params.maxBits);
+    EXPECT_LT(points[1].totalBits, params.maxBits + 4 * 256);
+
+    std::ifstream file(path);
+    ASSERT_TRUE(file.is_open());
+    std::string line;
+    std::vector<std::string> lines;
+    while (std::getline(file, line)) {
+        lines.push_back(line);
+    }
+    file.close();
+    std::remove(path.c_str());
+
+    ASSERT_EQ(lines.size(), 3u);
+    EXPECT_EQ(lines[0].find("snr_db,ber"), 0u);
+}
+
+// 无效的扫描参数
+TEST(SimulationEngineTest, SweepRejectsInvalidParams) {
+    engine::SimulationEngine simulation;
+    ASSERT_TRUE(simulation.initialize(makeConfig(0.0, 1, 64)));
+    std::vector<engine::SweepPoint> points;
+
+    engine::SweepParams params;
+    params.snrStep = 0.0;
+    EXPECT_FALSE(simulation.runSweep(params, points));
+
+    params = engine::SweepParams();
+    params.targetErrors = 0;
+    params.relativeWidth = 0.0;
+    EXPECT_FALSE(simulation.runSweep(params, points));
+}
@@ -0,0 +1,108 @@
+#include "gtest/gtest.h"
+#include "simulation/engine/WorkStealingPool.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace link16::simulation::engine;
+
+// 每个任务恰好执行一次，worker序号在范围内
+TEST(WorkStealingPoolTest, RunsEveryTaskExactlyOnce) {
+    WorkStealingPool pool(4);
+    EXPECT_EQ(pool.getThreadCount(), 4u);
+
+    const size_t taskCount = 10007;
+    std::unique_ptr<std::atomic<int>[]> counts(new std::atomic<int>[taskCount]);
+    for (size_t i = 0; i < taskCount; ++i) {
+        counts[i].store(0);
+    }
+    std::atomic<bool> badWorker(false);
+
+    pool.run(taskCount, [&](size_t task, size_t worker) {
+        counts[task].fetch_add(1);
+        if (worker >= 4) {
+            badWorker.store(true);
+        }
+    });
+
+    for (size_t i = 0; i < taskCount; ++i) {
+        EXPECT_EQ(counts[i].load(), 1) << "任务 " << i;
+    }
+    EXPECT_FALSE(badWorker.load());
+}
+
+// 同一个worker上的任务不并发，可以无锁使用线程私有状态
+TEST(WorkStealingPoolTest, TasksOnSameWorkerDoNotOverlap) {
+    WorkStealingPool pool(3);
+    std::vector<std::atomic<int>> active(3);
+    for (auto& value : active) {
+        value.store(0);
+    }
+    std::atomic<bool> overlapped(false);
+
+    pool.run(300, [&](size_t, size_t worker) {
+        if (active[worker].fetch_add(1) != 0) {
+            overlapped.store(true);
+        }
+        std::this_thread::yield();
+        active[worker].fetch_sub(1);
+    });
+
+    EXPECT_FALSE(overlapped.load());
+}
+
+// 负载集中在一个线程的区间时，其他线程窃取剩余任务
+TEST(WorkStealingPoolTest, IdleWorkersStealFromBusyWorker) {
+    WorkStealingPool pool(4);
+    const size_t taskCount = 64;
+    std::vector<size_t> executedBy(taskCount, 0);
+
+    // 0号线程分到[0, 16)，每个任务都很慢
+    pool.run(taskCount, [&](size_t task, size_t worker) {
+        if (task < 16) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        executedBy[task] = worker;
+    });
+
+    EXPECT_GT(pool.getStealCount(), 0u);
+    size_t stolen = 0;
+    for (size_t task = 0; task < 16; ++task) {
+        stolen += executedBy[task] != 0 ? 1 : 0;
+    }
+    EXPECT_GT(stolen, 0u);
+}
+
+// 线程池在多次run之间复用，空批次直接返回
+TEST(WorkStealingPoolTest, ReusableAcrossRuns) {
+    WorkStealingPool pool(2);
+    std::atomic<size_t> total(0);
+    for (int round = 0; round < 50; ++round) {
+        pool.run(round, [&](size_t, size_t) { total.fetch_add(1); });
+    }
+    EXPECT_EQ(total.load(), 49u * 50u / 2u);
+}
+
+// 任务抛出的异常在批次结束后重新抛出，其他任务照常执行
+TEST(WorkStealingPoolTest, RethrowsTaskException) {
+    WorkStealingPool pool(2);
+    std::atomic<size_t> executed(0);
+
+    EXPECT_THROW(pool.run(100,
+                          [&](size_t task, size_t) {
+                              executed.fetch_add(1);
+                              if (task == 42) {
+                                  throw std::runtime_error("失败");
+                              }
+                          }),
+                 std::runtime_error);
+    EXPECT_EQ(executed.load(), 100u);
+
+    // 之后仍可继续使用
+    executed.store(0);
+    pool.run(10, [&](size_t, size_t) { executed.fetch_add(1); });
+    EXPECT_EQ(executed.load(), 10u);
+}